@@ -28,6 +28,10 @@
 #include <string.h>
 
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE: for file_digest
+#include "py/objarray.h"
+#include "py/objtuple.h"
+#include "py/stream.h"
 
 #if MICROPY_PY_HASHLIB
 
@@ -363,8 +367,98 @@ STATIC MP_DEFINE_CONST_OBJ_TYPE(
     );
 #endif // MICROPY_PY_HASHLIB_MD5
 
+// CIRCUITPY-CHANGE: hash a file in C, with one or more algorithms in a single pass.
+#define FILE_DIGEST_BLOCK_SIZE (4096)
+
+STATIC const mp_obj_type_t *const hashlib_types[] = {
+    #if MICROPY_PY_HASHLIB_SHA256
+    &hashlib_sha256_type,
+    #endif
+    #if MICROPY_PY_HASHLIB_SHA1
+    &hashlib_sha1_type,
+    #endif
+    #if MICROPY_PY_HASHLIB_MD5
+    &hashlib_md5_type,
+    #endif
+};
+
+// digest is the name of an algorithm in this module or a callable that
+// returns a new hash object.
+STATIC mp_obj_t hashlib_file_digest_new(mp_obj_t digest) {
+    if (!mp_obj_is_str(digest)) {
+        return mp_call_function_0(digest);
+    }
+    qstr name = mp_obj_str_get_qstr(digest);
+    for (size_t i = 0; i < MP_ARRAY_SIZE(hashlib_types); i++) {
+        if (hashlib_types[i]->name == name) {
+            return mp_call_function_0(MP_OBJ_FROM_PTR(hashlib_types[i]));
+        }
+    }
+    mp_arg_error_invalid(MP_QSTR_digest);
+}
+
+STATIC bool hashlib_is_own(mp_obj_t hash) {
+    const mp_obj_type_t *type = mp_obj_get_type(hash);
+    for (size_t i = 0; i < MP_ARRAY_SIZE(hashlib_types); i++) {
+        if (hashlib_types[i] == type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+STATIC mp_obj_t hashlib_file_digest(mp_obj_t fileobj, mp_obj_t digest) {
+    mp_get_stream_raise(fileobj, MP_STREAM_OP_READ);
+    bool single = !mp_obj_is_type(digest, &mp_type_tuple) && !mp_obj_is_type(digest, &mp_type_list);
+    size_t n = 1;
+    mp_obj_t *digests = &digest;
+    if (!single) {
+        mp_obj_get_array(digest, &n, &digests);
+    }
+    mp_obj_tuple_t *hashes = MP_OBJ_TO_PTR(mp_obj_new_tuple(n, NULL));
+    // Hash objects from elsewhere may keep the bytearray they are updated
+    // with, so then the buffer is left for the GC to free.
+    bool shared = false;
+    for (size_t i = 0; i < n; i++) {
+        hashes->items[i] = hashlib_file_digest_new(digests[i]);
+        shared |= !hashlib_is_own(hashes->items[i]);
+    }
+
+    // Every block is read into the same buffer, and each hash is updated from
+    // it through its update method so that any hash object can be used.
+    byte *buf = m_new(byte, FILE_DIGEST_BLOCK_SIZE);
+    mp_obj_t view = mp_obj_new_bytearray_by_ref(FILE_DIGEST_BLOCK_SIZE, buf);
+    while (true) {
+        int errcode;
+        mp_uint_t len = mp_stream_read_exactly(fileobj, buf, FILE_DIGEST_BLOCK_SIZE, &errcode);
+        if (errcode != 0) {
+            mp_raise_OSError(errcode);
+        }
+        if (len == 0) {
+            break;
+        }
+        ((mp_obj_array_t *)MP_OBJ_TO_PTR(view))->len = len;
+        for (size_t i = 0; i < n; i++) {
+            mp_obj_t dest[3];
+            mp_load_method(hashes->items[i], MP_QSTR_update, dest);
+            dest[2] = view;
+            mp_call_method_n_kw(1, 0, dest);
+        }
+        if (len < FILE_DIGEST_BLOCK_SIZE) {
+            break;
+        }
+    }
+    if (!shared) {
+        m_del(byte, buf, FILE_DIGEST_BLOCK_SIZE);
+    }
+    return single ? hashes->items[0] : MP_OBJ_FROM_PTR(hashes);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(hashlib_file_digest_obj, hashlib_file_digest);
+
 STATIC const mp_rom_map_elem_t mp_module_hashlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_hashlib) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_file_digest), MP_ROM_PTR(&hashlib_file_digest_obj) },
     #if MICROPY_PY_HASHLIB_SHA256
     { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&hashlib_sha256_type) },
     #endif
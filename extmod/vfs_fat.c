@@ -426,7 +426,12 @@ STATIC mp_obj_t vfs_fat_mount(mp_obj_t self_in, mp_obj_t readonly, mp_obj_t mkfs
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(vfs_fat_mount_obj, vfs_fat_mount);
 
 STATIC mp_obj_t vfs_fat_umount(mp_obj_t self_in) {
+    // CIRCUITPY-CHANGE: the sector cache must not outlive the object
+    #if MICROPY_FATFS_CACHE_SECTORS
+    fatfs_cache_release(MP_OBJ_TO_PTR(self_in));
+    #else
     (void)self_in;
+    #endif
     // keep the FAT filesystem mounted internally so the VFS methods can still be used
     return mp_const_none;
 }
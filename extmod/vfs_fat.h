@@ -41,6 +41,23 @@ typedef struct _fs_user_mount_t {
 } fs_user_mount_t;
 
 extern const byte fresult_to_errno_table[20];
+// CIRCUITPY-CHANGE: Bumped on every sector write to a FAT filesystem, so that
+// information derived from file contents can be revalidated cheaply.
+extern uint32_t fatfs_sector_write_count;
+#if MICROPY_FATFS_CACHE_SECTORS
+// CIRCUITPY-CHANGE: Write back the dirty cached sectors of a volume, and
+// write back and forget all of them.
+int fatfs_cache_flush(fs_user_mount_t *vfs);
+void fatfs_cache_release(fs_user_mount_t *vfs);
+// Write back the dirty cached sectors of a volume one at a time, leaving every
+// slot in place, so that it is safe from a background task.
+void fatfs_cache_write_back(fs_user_mount_t *vfs);
+// Write back the dirty cached sectors of every volume, ignoring errors.
+void fatfs_cache_flush_all(void);
+// Write back and forget the cached sectors of every volume, before the volumes
+// on the heap go away.
+void fatfs_cache_reset(void);
+#endif
 extern const mp_obj_type_t mp_fat_vfs_type;
 extern const mp_obj_type_t mp_type_vfs_fat_fileio;
 extern const mp_obj_type_t mp_type_vfs_fat_textio;
@@ -50,6 +67,11 @@ MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    #if FF_USE_EXPAND
+    // CIRCUITPY-CHANGE: Bytes allocated by preallocate(). Clusters still unused
+    // are freed when the file is closed.
+    FSIZE_t preallocated;
+    #endif
 } pyb_file_obj_t;
 
 #endif  // MICROPY_INCLUDED_EXTMOD_VFS_FAT_H
@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "py/mphal.h"
 
@@ -48,6 +49,186 @@ STATIC fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t *)bdev;
 }
 
+// CIRCUITPY-CHANGE: A write-back cache of recently used sectors, shared by all
+// FAT volumes with FF_MIN_SS byte sectors. FF_FS_TINY makes every file share
+// the single sector window of its volume with the FAT and directories, so
+// without it each switch of the window costs a sector read and often a write.
+// Dirty sectors are written back when the volume is synced, or when one of
+// them has to be evicted, in as few multi-block writes as possible.
+#if MICROPY_FATFS_CACHE_SECTORS
+
+typedef struct {
+    fs_user_mount_t *vfs; // NULL if the slot is free
+    DWORD sector;
+    uint32_t last_used;
+    bool dirty;
+    bool metadata;
+} fatfs_cache_slot_t;
+
+STATIC fatfs_cache_slot_t fatfs_cache_slots[MICROPY_FATFS_CACHE_SECTORS];
+STATIC uint32_t fatfs_cache_data[MICROPY_FATFS_CACHE_SECTORS][FF_MIN_SS / sizeof(uint32_t)];
+STATIC uint32_t fatfs_cache_clock;
+
+STATIC bool fatfs_cache_usable(fs_user_mount_t *vfs) {
+    return vfs->blockdev.block_size == FF_MIN_SS;
+}
+
+STATIC int fatfs_cache_find(fs_user_mount_t *vfs, DWORD sector) {
+    for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        if (fatfs_cache_slots[i].vfs == vfs && fatfs_cache_slots[i].sector == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+STATIC void fatfs_cache_swap(int a, int b) {
+    fatfs_cache_slot_t slot = fatfs_cache_slots[a];
+    fatfs_cache_slots[a] = fatfs_cache_slots[b];
+    fatfs_cache_slots[b] = slot;
+    for (size_t i = 0; i < FF_MIN_SS / sizeof(uint32_t); i++) {
+        uint32_t word = fatfs_cache_data[a][i];
+        fatfs_cache_data[a][i] = fatfs_cache_data[b][i];
+        fatfs_cache_data[b][i] = word;
+    }
+}
+
+// Write back the dirty sectors of a volume. They are first sorted by sector
+// so that each run of consecutive sectors goes out in a single write.
+int fatfs_cache_flush(fs_user_mount_t *vfs) {
+    int n = 0;
+    for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        if (fatfs_cache_slots[i].vfs != vfs || !fatfs_cache_slots[i].dirty) {
+            continue;
+        }
+        int pos = n++;
+        fatfs_cache_swap(i, pos);
+        while (pos > 0 && fatfs_cache_slots[pos - 1].sector > fatfs_cache_slots[pos].sector) {
+            fatfs_cache_swap(pos - 1, pos);
+            pos--;
+        }
+    }
+    int ret = 0;
+    for (int start = 0; start < n;) {
+        int end = start + 1;
+        while (end < n && fatfs_cache_slots[end].sector == fatfs_cache_slots[end - 1].sector + 1) {
+            end++;
+        }
+        int err = mp_vfs_blockdev_write(&vfs->blockdev, fatfs_cache_slots[start].sector, end - start,
+            (const uint8_t *)fatfs_cache_data[start]);
+        if (err == 0) {
+            for (int i = start; i < end; i++) {
+                fatfs_cache_slots[i].dirty = false;
+            }
+        } else {
+            ret = err;
+        }
+        start = end;
+    }
+    return ret;
+}
+
+// Choose a slot for a new sector of a volume, preferring a free one. Otherwise
+// the least recently used clean slot is reused, with sectors before the data
+// area (boot sector, FATs and the FAT12/16 root directory) counted as used
+// MICROPY_FATFS_CACHE_SECTORS accesses later than they were. Dirty slots of
+// other volumes are never written back here. Returns -1 if no slot is usable.
+STATIC int fatfs_cache_alloc(fs_user_mount_t *vfs, DWORD sector) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        int victim = -1;
+        uint32_t victim_age = 0;
+        for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+            fatfs_cache_slot_t *slot = &fatfs_cache_slots[i];
+            if (slot->vfs == NULL) {
+                victim = i;
+                break;
+            }
+            if (slot->dirty) {
+                continue;
+            }
+            uint32_t age = fatfs_cache_clock - slot->last_used;
+            if (slot->metadata) {
+                age = age > MICROPY_FATFS_CACHE_SECTORS ? age - MICROPY_FATFS_CACHE_SECTORS : 0;
+            }
+            if (victim == -1 || age > victim_age) {
+                victim = i;
+                victim_age = age;
+            }
+        }
+        if (victim != -1) {
+            fatfs_cache_slot_t *slot = &fatfs_cache_slots[victim];
+            slot->vfs = vfs;
+            slot->sector = sector;
+            slot->dirty = false;
+            slot->metadata = sector < vfs->fatfs.database;
+            return victim;
+        }
+        if (attempt == 0 && fatfs_cache_flush(vfs) != 0) {
+            break;
+        }
+    }
+    return -1;
+}
+
+STATIC void fatfs_cache_discard(fs_user_mount_t *vfs) {
+    for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        if (fatfs_cache_slots[i].vfs == vfs) {
+            fatfs_cache_slots[i].vfs = NULL;
+        }
+    }
+}
+
+void fatfs_cache_release(fs_user_mount_t *vfs) {
+    fatfs_cache_flush(vfs);
+    fatfs_cache_discard(vfs);
+}
+
+void fatfs_cache_write_back(fs_user_mount_t *vfs) {
+    for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        fatfs_cache_slot_t *slot = &fatfs_cache_slots[i];
+        if (slot->vfs == vfs && slot->dirty &&
+            mp_vfs_blockdev_write(&vfs->blockdev, slot->sector, 1, (const uint8_t *)fatfs_cache_data[i]) == 0) {
+            slot->dirty = false;
+        }
+    }
+}
+
+void fatfs_cache_flush_all(void) {
+    // Flushing sorts the slots, so first list the volumes that need it.
+    fs_user_mount_t *volumes[MICROPY_FATFS_CACHE_SECTORS];
+    int n = 0;
+    for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        fs_user_mount_t *vfs = fatfs_cache_slots[i].vfs;
+        if (vfs == NULL || !fatfs_cache_slots[i].dirty) {
+            continue;
+        }
+        int j = 0;
+        while (j < n && volumes[j] != vfs) {
+            j++;
+        }
+        if (j == n) {
+            volumes[n++] = vfs;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        // Block devices written in Python may raise. Their sectors stay dirty.
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            fatfs_cache_flush(volumes[i]);
+            nlr_pop();
+        }
+    }
+}
+
+void fatfs_cache_reset(void) {
+    fatfs_cache_flush_all();
+    for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+        fatfs_cache_slots[i].vfs = NULL;
+    }
+}
+
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
@@ -63,6 +244,40 @@ DRESULT disk_read(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_FATFS_CACHE_SECTORS
+    if (fatfs_cache_usable(vfs)) {
+        if (count == 1) {
+            int i = fatfs_cache_find(vfs, sector);
+            if (i == -1) {
+                i = fatfs_cache_alloc(vfs, sector);
+                if (i != -1 && mp_vfs_blockdev_read(&vfs->blockdev, sector, 1, (uint8_t *)fatfs_cache_data[i]) != 0) {
+                    fatfs_cache_slots[i].vfs = NULL;
+                    return RES_ERROR;
+                }
+            }
+            if (i != -1) {
+                fatfs_cache_slots[i].last_used = ++fatfs_cache_clock;
+                memcpy(buff, fatfs_cache_data[i], FF_MIN_SS);
+                return RES_OK;
+            }
+        } else {
+            // Longer reads go straight to the device, in a single call, and
+            // only pick up sectors that have not been written back yet.
+            if (mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff) != 0) {
+                return RES_ERROR;
+            }
+            for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+                fatfs_cache_slot_t *slot = &fatfs_cache_slots[i];
+                if (slot->vfs == vfs && slot->dirty && slot->sector - sector < count) {
+                    memcpy(buff + (slot->sector - sector) * FF_MIN_SS, fatfs_cache_data[i], FF_MIN_SS);
+                }
+            }
+            return RES_OK;
+        }
+    }
+    #endif
+
     int ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
 
     return ret == 0 ? RES_OK : RES_ERROR;
@@ -72,6 +287,9 @@ DRESULT disk_read(
 /* Write Sector(s)                                                       */
 /*-----------------------------------------------------------------------*/
 
+// CIRCUITPY-CHANGE
+uint32_t fatfs_sector_write_count;
+
 DRESULT disk_write(
     bdev_t pdrv,          /* Physical drive nmuber (0..) */
     const BYTE *buff,    /* Data to be written */
@@ -83,6 +301,33 @@ DRESULT disk_write(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE
+    fatfs_sector_write_count++;
+    #if MICROPY_FATFS_CACHE_SECTORS
+    if (fatfs_cache_usable(vfs) && vfs->blockdev.writeblocks[0] != MP_OBJ_NULL) {
+        if (count == 1) {
+            int i = fatfs_cache_find(vfs, sector);
+            if (i == -1) {
+                i = fatfs_cache_alloc(vfs, sector);
+            }
+            if (i != -1) {
+                fatfs_cache_slots[i].last_used = ++fatfs_cache_clock;
+                fatfs_cache_slots[i].dirty = true;
+                memcpy(fatfs_cache_data[i], buff, FF_MIN_SS);
+                return RES_OK;
+            }
+        } else {
+            // Longer writes go straight to the device and supersede any cached
+            // copies of the sectors they cover.
+            for (int i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+                fatfs_cache_slot_t *slot = &fatfs_cache_slots[i];
+                if (slot->vfs == vfs && slot->sector - sector < count) {
+                    slot->vfs = NULL;
+                }
+            }
+        }
+    }
+    #endif
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
     if (ret == -MP_EROFS) {
@@ -108,6 +353,18 @@ DRESULT disk_ioctl(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_FATFS_CACHE_SECTORS
+    if (cmd == CTRL_SYNC) {
+        if (fatfs_cache_flush(vfs) != 0) {
+            return RES_ERROR;
+        }
+    } else if (cmd == IOCTL_INIT) {
+        // Anything cached for this address belongs to an earlier mount.
+        fatfs_cache_discard(vfs);
+    }
+    #endif
+
     // First part: call the relevant method of the underlying block device
     static const uint8_t op_map[8] = {
         [CTRL_SYNC] = MP_BLOCKDEV_IOCTL_SYNC,
@@ -124,6 +381,11 @@ DRESULT disk_ioctl(
     // Second part: convert the result for return
     switch (cmd) {
         case CTRL_SYNC:
+            // CIRCUITPY-CHANGE: a block device that writes behind reports a
+            // failed write when synced.
+            if (mp_obj_is_small_int(ret) && MP_OBJ_SMALL_INT_VALUE(ret) != 0) {
+                return RES_ERROR;
+            }
             return RES_OK;
 
         case GET_SECTOR_COUNT: {
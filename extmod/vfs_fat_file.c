@@ -79,6 +79,13 @@ STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
 
 STATIC mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // CIRCUITPY-CHANGE: The cluster map of a preallocated file only covers the
+    // clusters allocated. Beyond them, the file grows one cluster at a time again.
+    #if FF_USE_EXPAND
+    if (self->preallocated != 0 && f_tell(&self->fp) + size > self->preallocated) {
+        self->fp.cltbl = NULL;
+    }
+    #endif
     UINT sz_out;
     FRESULT res = f_write(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -93,6 +100,24 @@ STATIC mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t siz
     return sz_out;
 }
 
+// CIRCUITPY-CHANGE
+#if FF_USE_EXPAND
+// Free the preallocated clusters after the end of the file.
+STATIC FRESULT file_obj_free_preallocated(pyb_file_obj_t *self) {
+    FIL *fp = &self->fp;
+    FSIZE_t size = f_size(fp);
+    self->preallocated = 0;
+    FRESULT res = f_lseek(fp, size);
+    if (res == FR_OK) {
+        // f_truncate only frees the clusters after the file pointer when the
+        // file is longer than that.
+        fp->obj.objsize = size + 1;
+        res = f_truncate(fp);
+    }
+    return res;
+}
+#endif
+
 STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(o_in);
 
@@ -127,6 +152,17 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
+            // CIRCUITPY-CHANGE
+            #if FF_USE_EXPAND
+            if (self->preallocated != 0) {
+                FRESULT res = file_obj_free_preallocated(self);
+                if (res != FR_OK) {
+                    f_close(&self->fp);
+                    *errcode = fresult_to_errno_table[res];
+                    return MP_STREAM_ERROR;
+                }
+            }
+            #endif
             FRESULT res = f_close(&self->fp);
             if (res != FR_OK) {
                 *errcode = fresult_to_errno_table[res];
@@ -143,6 +179,39 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
 
 // TODO gc hook to close the file if not already closed
 
+// CIRCUITPY-CHANGE
+#if FF_USE_EXPAND
+// Allocate contiguous clusters for size bytes to an empty file that is open
+// for writing. Writes then find their clusters through a cluster map instead
+// of allocating them on the FAT one by one, and the FAT is written only once.
+// The file keeps the length of what has been written to it.
+STATIC mp_obj_t file_obj_preallocate(mp_obj_t self_in, mp_obj_t size_in) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t size = mp_arg_validate_int_min(mp_obj_get_int(size_in), 1, MP_QSTR_size);
+    #if FF_FS_EXFAT
+    if (self->fp.obj.fs != NULL && self->fp.obj.fs->fs_type == FS_EXFAT) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+    #endif
+    FRESULT res = f_expand(&self->fp, size, 1);
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+    self->fp.obj.objsize = 0;
+    self->preallocated = size;
+
+    // A contiguous file needs a map of one fragment.
+    DWORD *map = m_new(DWORD, 4);
+    map[0] = 4;
+    self->fp.cltbl = map;
+    if (f_lseek(&self->fp, CREATE_LINKMAP) != FR_OK) {
+        self->fp.cltbl = NULL;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(file_obj_preallocate_obj, file_obj_preallocate);
+#endif
+
 STATIC const mp_rom_map_elem_t vfs_fat_rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
@@ -153,6 +222,10 @@ STATIC const mp_rom_map_elem_t vfs_fat_rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj) },
+    // CIRCUITPY-CHANGE
+    #if FF_USE_EXPAND
+    { MP_ROM_QSTR(MP_QSTR_preallocate), MP_ROM_PTR(&file_obj_preallocate_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&mp_stream___exit___obj) },
@@ -250,6 +323,10 @@ STATIC mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
 
     pyb_file_obj_t *o = m_new_obj_with_finaliser(pyb_file_obj_t);
     o->base.type = type;
+    // CIRCUITPY-CHANGE
+    #if FF_USE_EXPAND
+    o->preallocated = 0;
+    #endif
 
     const char *fname = mp_obj_str_get_str(path_in);
     FRESULT res = f_open(&self->fatfs, &o->fp, fname, mode);
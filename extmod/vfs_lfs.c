@@ -33,7 +33,9 @@
 #include "extmod/vfs.h"
 #include "extmod/vfs_lfs.h"
 
-enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime };
+// CIRCUITPY-CHANGE: block_cycles and cache_size
+enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime,
+       LFS_MAKE_ARG_block_cycles, LFS_MAKE_ARG_cache_size };
 
 static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
@@ -41,6 +43,12 @@ static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_progsize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_lookahead, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_mtime, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    // Erase cycles before littlefs moves a metadata block, spreading wear.
+    // Only used by littlefs v2.
+    { MP_QSTR_block_cycles, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
+    // Size of the read and program caches. 0 means four times the larger of
+    // readsize and progsize. Only used by littlefs v2.
+    { MP_QSTR_cache_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
 };
 
 #if MICROPY_VFS_LFS1
@@ -36,4 +36,21 @@ extern const mp_obj_type_t mp_type_vfs_lfs2;
 extern const mp_obj_type_t mp_type_vfs_lfs2_fileio;
 extern const mp_obj_type_t mp_type_vfs_lfs2_textio;
 
+// CIRCUITPY-CHANGE: Mount littlefs on a native block device without using the
+// VM heap, for CIRCUITPY. Formats the device first if format is true, and
+// returns 0 or a negative littlefs error. native_vfs() is the VfsLfs2 object
+// to put in the mount table, and native_lfs() gives the filesystem to the
+// supervisor outside of the VM.
+#if MICROPY_VFS_LFS2 && CIRCUITPY_FILESYSTEM_LITTLEFS
+#include "extmod/vfs.h"
+#include "lib/littlefs/lfs2.h"
+
+int mp_vfs_lfs2_mount_native(const mp_vfs_blockdev_t *blockdev, bool format);
+mp_obj_t mp_vfs_lfs2_native_vfs(void);
+lfs2_t *mp_vfs_lfs2_native_lfs(void);
+// The attribute that modification times are kept in, as 64-bit little endian
+// nanoseconds since 1970.
+#define MP_VFS_LFS2_ATTR_MTIME (1)
+#endif
+
 #endif // MICROPY_INCLUDED_EXTMOD_VFS_LFS_H
@@ -53,14 +53,32 @@ STATIC int MP_VFS_LFSx(dev_ioctl)(const struct LFSx_API (config) * c, int cmd, i
 }
 
 STATIC int MP_VFS_LFSx(dev_read)(const struct LFSx_API (config) * c, LFSx_API(block_t) block, LFSx_API(off_t) off, void *buffer, LFSx_API(size_t) size) {
+    // CIRCUITPY-CHANGE: Native block devices transfer whole sectors of
+    // blockdev.block_size, which read_size and prog_size are multiples of.
+    mp_vfs_blockdev_t *blockdev = c->context;
+    if (blockdev->flags & MP_BLOCKDEV_FLAG_NATIVE) {
+        size_t sector = (block * c->block_size + off) / blockdev->block_size;
+        return mp_vfs_blockdev_read(blockdev, sector, size / blockdev->block_size, buffer) == 0 ? 0 : -MP_EIO;
+    }
     return mp_vfs_blockdev_read_ext(c->context, block, off, size, buffer);
 }
 
 STATIC int MP_VFS_LFSx(dev_prog)(const struct LFSx_API (config) * c, LFSx_API(block_t) block, LFSx_API(off_t) off, const void *buffer, LFSx_API(size_t) size) {
+    // CIRCUITPY-CHANGE
+    mp_vfs_blockdev_t *blockdev = c->context;
+    if (blockdev->flags & MP_BLOCKDEV_FLAG_NATIVE) {
+        size_t sector = (block * c->block_size + off) / blockdev->block_size;
+        return mp_vfs_blockdev_write(blockdev, sector, size / blockdev->block_size, buffer) == 0 ? 0 : -MP_EIO;
+    }
     return mp_vfs_blockdev_write_ext(c->context, block, off, size, buffer);
 }
 
 STATIC int MP_VFS_LFSx(dev_erase)(const struct LFSx_API (config) * c, LFSx_API(block_t) block) {
+    // CIRCUITPY-CHANGE: Native flash erases as it writes.
+    mp_vfs_blockdev_t *blockdev = c->context;
+    if (blockdev->flags & MP_BLOCKDEV_FLAG_NATIVE) {
+        return 0;
+    }
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_BLOCK_ERASE, block, true);
 }
 
@@ -68,10 +86,9 @@ STATIC int MP_VFS_LFSx(dev_sync)(const struct LFSx_API (config) * c) {
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_SYNC, 0, false);
 }
 
-STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead) {
-    self->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
-    mp_vfs_blockdev_init(&self->blockdev, bdev);
-
+// CIRCUITPY-CHANGE: Split out of init_config so that a native block device can
+// be set up without allocating.
+STATIC void MP_VFS_LFSx(init_device)(MP_OBJ_VFS_LFSx * self, size_t read_size, size_t prog_size) {
     struct LFSx_API (config) * config = &self->config;
     memset(config, 0, sizeof(*config));
 
@@ -91,15 +108,45 @@ STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size
     config->prog_size = prog_size;
     config->block_size = bs;
     config->block_count = bc;
+}
+
+STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead,
+    // CIRCUITPY-CHANGE
+    mp_int_t block_cycles, size_t cache_size) {
+    self->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
+    mp_vfs_blockdev_init(&self->blockdev, bdev);
+
+    MP_VFS_LFSx(init_device)(self, read_size, prog_size);
+    struct LFSx_API (config) * config = &self->config;
+
+    // CIRCUITPY-CHANGE: Native block devices only transfer whole sectors, and
+    // have no readblocks/writeblocks with an offset to fall back on.
+    if (self->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) {
+        if (read_size == 0 || read_size % config->block_size != 0) {
+            mp_arg_error_invalid(MP_QSTR_readsize);
+        }
+        if (prog_size == 0 || prog_size % config->block_size != 0) {
+            mp_arg_error_invalid(MP_QSTR_progsize);
+        }
+    }
 
     #if LFS_BUILD_VERSION == 1
+    (void)block_cycles;
+    (void)cache_size;
     config->lookahead = lookahead;
     config->read_buffer = m_new(uint8_t, config->read_size);
     config->prog_buffer = m_new(uint8_t, config->prog_size);
     config->lookahead_buffer = m_new(uint8_t, config->lookahead / 8);
     #else
-    config->block_cycles = 100;
-    config->cache_size = 4 * MAX(read_size, prog_size);
+    // CIRCUITPY-CHANGE: Tunable wear leveling and cache size.
+    if (cache_size == 0) {
+        // No larger than a block, which it has to divide.
+        cache_size = MIN(4 * MAX(read_size, prog_size), config->block_size);
+    } else if (cache_size % read_size != 0 || cache_size % prog_size != 0 || config->block_size % cache_size != 0) {
+        mp_arg_error_invalid(MP_QSTR_cache_size);
+    }
+    config->block_cycles = block_cycles;
+    config->cache_size = cache_size;
     config->lookahead_size = lookahead;
     config->read_buffer = m_new(uint8_t, config->cache_size);
     config->prog_buffer = m_new(uint8_t, config->cache_size);
@@ -132,7 +179,8 @@ STATIC mp_obj_t MP_VFS_LFSx(make_new)(const mp_obj_type_t * type, size_t n_args,
     self->enable_mtime = args[LFS_MAKE_ARG_mtime].u_bool;
     #endif
     MP_VFS_LFSx(init_config)(self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_block_cycles].u_int, args[LFS_MAKE_ARG_cache_size].u_int);
     int ret = LFSx_API(mount)(&self->lfs, &self->config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -146,7 +194,8 @@ STATIC mp_obj_t MP_VFS_LFSx(mkfs)(size_t n_args, const mp_obj_t *pos_args, mp_ma
 
     MP_OBJ_VFS_LFSx self;
     MP_VFS_LFSx(init_config)(&self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_block_cycles].u_int, args[LFS_MAKE_ARG_cache_size].u_int);
     int ret = LFSx_API(format)(&self.lfs, &self.config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -154,6 +203,55 @@ STATIC mp_obj_t MP_VFS_LFSx(mkfs)(size_t n_args, const mp_obj_t *pos_args, mp_ma
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(MP_VFS_LFSx(mkfs_fun_obj), 0, MP_VFS_LFSx(mkfs));
+
+// CIRCUITPY-CHANGE: CIRCUITPY as littlefs. Its state is all static, rather than
+// on the VM heap, so it stays mounted while VMs come and go.
+#if LFS_BUILD_VERSION == 2 && CIRCUITPY_FILESYSTEM_LITTLEFS
+STATIC MP_OBJ_VFS_LFSx MP_VFS_LFSx(native_obj);
+STATIC char MP_VFS_LFSx(native_cur_dir)[MICROPY_ALLOC_PATH_MAX + 1];
+STATIC uint32_t MP_VFS_LFSx(native_read_buffer)[CIRCUITPY_LITTLEFS_CACHE_SIZE / sizeof(uint32_t)];
+STATIC uint32_t MP_VFS_LFSx(native_prog_buffer)[CIRCUITPY_LITTLEFS_CACHE_SIZE / sizeof(uint32_t)];
+STATIC uint32_t MP_VFS_LFSx(native_lookahead_buffer)[CIRCUITPY_LITTLEFS_LOOKAHEAD_SIZE / sizeof(uint32_t)];
+
+int MP_VFS_LFSx(mount_native)(const mp_vfs_blockdev_t *blockdev, bool format) {
+    MP_OBJ_VFS_LFSx *self = &MP_VFS_LFSx(native_obj);
+    self->base.type = &MP_TYPE_VFS_LFSx;
+    self->blockdev = *blockdev;
+    self->enable_mtime = true;
+    vstr_init_fixed_buf(&self->cur_dir, sizeof(MP_VFS_LFSx(native_cur_dir)), MP_VFS_LFSx(native_cur_dir));
+    vstr_add_byte(&self->cur_dir, '/');
+
+    MP_VFS_LFSx(init_device)(self, 0, 0);
+    // The device reports its sectors. littlefs blocks are whole erase sectors.
+    struct LFSx_API (config) * config = &self->config;
+    config->read_size = self->blockdev.block_size;
+    config->prog_size = self->blockdev.block_size;
+    config->block_count = config->block_count / (CIRCUITPY_LITTLEFS_BLOCK_SIZE / self->blockdev.block_size);
+    config->block_size = CIRCUITPY_LITTLEFS_BLOCK_SIZE;
+    config->block_cycles = CIRCUITPY_LITTLEFS_BLOCK_CYCLES;
+    config->cache_size = CIRCUITPY_LITTLEFS_CACHE_SIZE;
+    config->lookahead_size = CIRCUITPY_LITTLEFS_LOOKAHEAD_SIZE;
+    config->read_buffer = MP_VFS_LFSx(native_read_buffer);
+    config->prog_buffer = MP_VFS_LFSx(native_prog_buffer);
+    config->lookahead_buffer = MP_VFS_LFSx(native_lookahead_buffer);
+
+    if (format) {
+        int ret = LFSx_API(format)(&self->lfs, config);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+    return LFSx_API(mount)(&self->lfs, config);
+}
+
+mp_obj_t MP_VFS_LFSx(native_vfs)(void) {
+    return MP_OBJ_FROM_PTR(&MP_VFS_LFSx(native_obj));
+}
+
+LFSx_API(t) * MP_VFS_LFSx(native_lfs)(void) {
+    return &MP_VFS_LFSx(native_obj).lfs;
+}
+#endif
 STATIC MP_DEFINE_CONST_STATICMETHOD_OBJ(MP_VFS_LFSx(mkfs_obj), MP_ROM_PTR(&MP_VFS_LFSx(mkfs_fun_obj)));
 
 // Implementation of mp_vfs_lfs_file_open is provided in vfs_lfsx_file.c
@@ -69,7 +69,12 @@ STATIC void mp_reader_vfs_close(void *data) {
     m_del_obj(mp_reader_vfs_t, reader);
 }
 
+// CIRCUITPY-CHANGE: allow starting part way into the file
 void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
+    mp_reader_new_file_at(reader, filename, 0);
+}
+
+void mp_reader_new_file_at(mp_reader_t *reader, const char *filename, size_t offset) {
     mp_reader_vfs_t *rf = m_new_obj(mp_reader_vfs_t);
     mp_obj_t args[2] = {
         mp_obj_new_str(filename, strlen(filename)),
@@ -77,6 +82,14 @@ void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
     };
     rf->file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
     int errcode;
+    if (offset != 0) {
+        const mp_stream_p_t *stream_p = mp_get_stream(rf->file);
+        struct mp_stream_seek_t seek_s = { .offset = offset, .whence = MP_SEEK_SET };
+        if (stream_p->ioctl(rf->file, MP_STREAM_SEEK, (uintptr_t)&seek_s, &errcode) == MP_STREAM_ERROR) {
+            mp_stream_close(rf->file);
+            mp_raise_OSError(errcode);
+        }
+    }
     rf->len = mp_stream_rw(rf->file, rf->buf, sizeof(rf->buf), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
     if (errcode != 0) {
         mp_raise_OSError(errcode);
@@ -43,14 +43,30 @@ static const WORD k[64] = {
 };
 
 /*********************** FUNCTION DEFINITIONS ***********************/
+// CIRCUITPY-CHANGE: keep only the last 16 words of the message schedule and
+// unroll the rounds by 8, renaming the working variables instead of shifting
+// them, so that they can stay in registers on small cores.
+#define LOAD(i) \
+	(m[i] = ((WORD)data[(i) * 4] << 24) | ((WORD)data[(i) * 4 + 1] << 16) | ((WORD)data[(i) * 4 + 2] << 8) | (data[(i) * 4 + 3]))
+#define SCHEDULE(i) \
+	(m[(i) & 15] += SIG1(m[((i) - 2) & 15]) + m[((i) - 7) & 15] + SIG0(m[((i) - 15) & 15]))
+#define ROUND(a,b,c,d,e,f,g,h,i,w) \
+	t1 = h + EP1(e) + CH(e,f,g) + k[i] + (w); \
+	d += t1; \
+	h = t1 + EP0(a) + MAJ(a,b,c)
+#define ROUNDS8(i,W) \
+	ROUND(a,b,c,d,e,f,g,h,(i) + 0,W((i) + 0)); \
+	ROUND(h,a,b,c,d,e,f,g,(i) + 1,W((i) + 1)); \
+	ROUND(g,h,a,b,c,d,e,f,(i) + 2,W((i) + 2)); \
+	ROUND(f,g,h,a,b,c,d,e,(i) + 3,W((i) + 3)); \
+	ROUND(e,f,g,h,a,b,c,d,(i) + 4,W((i) + 4)); \
+	ROUND(d,e,f,g,h,a,b,c,(i) + 5,W((i) + 5)); \
+	ROUND(c,d,e,f,g,h,a,b,(i) + 6,W((i) + 6)); \
+	ROUND(b,c,d,e,f,g,h,a,(i) + 7,W((i) + 7))
+
 static void sha256_transform(CRYAL_SHA256_CTX *ctx, const BYTE data[])
 {
-	WORD a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
-
-	for (i = 0, j = 0; i < 16; ++i, j += 4)
-		m[i] = ((uint32_t)data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-	for ( ; i < 64; ++i)
-		m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+	WORD a, b, c, d, e, f, g, h, i, t1, m[16];
 
 	a = ctx->state[0];
 	b = ctx->state[1];
@@ -61,17 +77,10 @@ static void sha256_transform(CRYAL_SHA256_CTX *ctx, const BYTE data[])
 	g = ctx->state[6];
 	h = ctx->state[7];
 
-	for (i = 0; i < 64; ++i) {
-		t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-		t2 = EP0(a) + MAJ(a,b,c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + t1;
-		d = c;
-		c = b;
-		b = a;
-		a = t1 + t2;
+	ROUNDS8(0, LOAD);
+	ROUNDS8(8, LOAD);
+	for (i = 16; i < 64; i += 8) {
+		ROUNDS8(i, SCHEDULE);
 	}
 
 	ctx->state[0] += a;
@@ -98,12 +107,15 @@ void sha256_init(CRYAL_SHA256_CTX *ctx)
 	ctx->state[7] = 0x5be0cd19;
 }
 
+// CIRCUITPY-CHANGE: transform whole blocks straight from data rather than
+// copying them into ctx->data a byte at a time.
 void sha256_update(CRYAL_SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD i;
+	size_t i = 0;
 
-	for (i = 0; i < len; ++i) {
-		ctx->data[ctx->datalen] = data[i];
+	// Top up a partly filled block first.
+	while (ctx->datalen != 0 && i < len) {
+		ctx->data[ctx->datalen] = data[i++];
 		ctx->datalen++;
 		if (ctx->datalen == 64) {
 			sha256_transform(ctx, ctx->data);
@@ -111,6 +123,12 @@ void sha256_update(CRYAL_SHA256_CTX *ctx, const BYTE data[], size_t len)
 			ctx->datalen = 0;
 		}
 	}
+	for ( ; len - i >= 64; i += 64) {
+		sha256_transform(ctx, data + i);
+		ctx->bitlen += 512;
+	}
+	memcpy(ctx->data + ctx->datalen, data + i, len - i);
+	ctx->datalen += len - i;
 }
 
 void sha256_final(CRYAL_SHA256_CTX *ctx, BYTE hash[])
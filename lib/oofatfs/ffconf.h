@@ -83,7 +83,11 @@
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
+#ifdef MICROPY_FATFS_USE_EXPAND
+#define FF_USE_EXPAND   (MICROPY_FATFS_USE_EXPAND)
+#else
 #define FF_USE_EXPAND   0
+#endif
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
@@ -700,7 +700,8 @@ static void block_idct (
 /*-----------------------------------------------------------------------*/
 
 static JRESULT mcu_load (
-	JDEC* jd		/* Pointer to the decompressor object */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	int skip		/* Only advance through the stream, the MCU will not be output */
 )
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
@@ -739,7 +740,7 @@ static JRESULT mcu_load (
 			tmp[0] = d * dqf[0] >> 8;				/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
 
 			/* Extract following 63 AC elements from input stream */
-			memset(&tmp[1], 0, 63 * sizeof (int32_t));	/* Initialize all AC elements */
+			if (!skip) memset(&tmp[1], 0, 63 * sizeof (int32_t));	/* Initialize all AC elements */
 			z = 1;		/* Top of the AC elements (in zigzag-order) */
 			do {
 				d = huffext(jd, id, 1);				/* Extract a huffman coded value (zero runs and bit length) */
@@ -753,12 +754,14 @@ static JRESULT mcu_load (
 					if (d < 0) return (JRESULT)(0 - d);	/* Err: input device */
 					bc = 1 << (bc - 1);				/* MSB position */
 					if (!(d & bc)) d -= (bc << 1) - 1;	/* Restore negative value if needed */
-					i = Zig[z];						/* Get raster-order index */
-					tmp[i] = d * dqf[i] >> 8;		/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+					if (!skip) {
+						i = Zig[z];						/* Get raster-order index */
+						tmp[i] = d * dqf[i] >> 8;		/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+					}
 				}
 			} while (++z < 64);		/* Next AC element */
 
-			if (JD_FORMAT != 2 || !cmp) {	/* C components may not be processed if in grayscale output */
+			if (!skip && (JD_FORMAT != 2 || !cmp)) {	/* C components may not be processed if in grayscale output */
 				if (z == 1 || (JD_USE_SCALE && jd->scale == 3)) {	/* If no AC element or scale ratio is 1/8, IDCT can be ommited and the block is filled with DC value */
 					d = (jd_yuv_t)((*tmp / 256) + 128);
 					if (JD_FASTDECODE >= 1) {
@@ -941,12 +944,25 @@ static JRESULT mcu_output (
 		uint16_t w, *d = (uint16_t*)s;
 		unsigned int n = rx * ry;
 
-		do {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		/* Store two byte-swapped pixels per word write (the work buffer is word aligned) */
+		uint32_t w2, *d2 = (uint32_t*)s;
+		for (; n >= 2; n -= 2) {
+			w2 = (s[0] & 0xF8) | (s[1] >> 5) | ((s[1] & 0x1C) << 11) | ((uint32_t)(s[2] & 0xF8) << 5);
+			w2 |= ((uint32_t)(s[3] & 0xF8) << 16) | ((uint32_t)(s[4] >> 5) << 16) | ((uint32_t)(s[4] & 0x1C) << 27) | ((uint32_t)(s[5] & 0xF8) << 21);
+			*d2++ = w2;
+			s += 6;
+		}
+		d = (uint16_t*)d2;
+		while (n--) {
+#else
+		while (n--) {
+#endif
 			w = (*s++ & 0xF8) << 8;		/* RRRRR----------- */
 			w |= (*s++ & 0xFC) << 3;	/* -----GGGGGG----- */
 			w |= *s++ >> 3;				/* -----------BBBBB */
 			*d++ = __builtin_bswap16(w);
-		} while (--n);
+		}
 	}
 
 	/* Output the rectangular */
@@ -1124,9 +1140,26 @@ JRESULT jd_decomp (
 	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
 	uint8_t scale							/* Output de-scaling factor (0 to 3) */
 )
+{
+	return jd_decomp_rect(jd, outfunc, scale, NULL);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Decompress only the MCUs that overlap a region of the output image    */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_decomp_rect (
+	JDEC* jd,								/* Initialized decompression object */
+	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
+	uint8_t scale,							/* Output de-scaling factor (0 to 3) */
+	const JRECT* roi						/* Region of the descaled output image to be output, NULL for all */
+)
 {
 	unsigned int x, y, mx, my;
 	uint16_t rst, rsc;
+	int skip_row, skip;
 	JRESULT rc;
 
 
@@ -1140,14 +1173,19 @@ JRESULT jd_decomp (
 
 	rc = JDR_OK;
 	for (y = 0; y < jd->height; y += my) {		/* Vertical loop of MCUs */
+		if (roi && (y >> scale) > roi->bottom) break;	/* Below the region, nothing more to output */
+		skip_row = roi && ((y + my - 1) >> scale) < roi->top;
 		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
 			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
 				rc = restart(jd, rsc++);
 				if (rc != JDR_OK) return rc;
 				rst = 1;
 			}
-			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
+			/* MCUs outside of the region are huffman decoded to keep the stream in sync, but not dequantized, transformed or output */
+			skip = skip_row || (roi && (((x + mx - 1) >> scale) < roi->left || (x >> scale) > roi->right));
+			rc = mcu_load(jd, skip);			/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
 			if (rc != JDR_OK) return rc;
+			if (skip) continue;
 			rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
 			if (rc != JDR_OK) return rc;
 		}
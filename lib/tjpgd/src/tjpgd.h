@@ -93,6 +93,7 @@ struct JDEC {
 /* TJpgDec API functions */
 JRESULT jd_prepare (JDEC* jd, size_t (*infunc)(JDEC*,uint8_t*,size_t), void* pool, size_t sz_pool, void* dev);
 JRESULT jd_decomp (JDEC* jd, int (*outfunc)(JDEC*,void*,JRECT*), uint8_t scale);
+JRESULT jd_decomp_rect (JDEC* jd, int (*outfunc)(JDEC*,void*,JRECT*), uint8_t scale, const JRECT* roi);
 
 
 #ifdef __cplusplus
@@ -86,6 +86,14 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILER
+#include "shared-module/profiler/__init__.h"
+#endif
+
+#if CIRCUITPY_SDCARDIO
+#include "shared-module/sdcardio/__init__.h"
+#endif
+
 #if CIRCUITPY_SOCKETPOOL
 #include "shared-bindings/socketpool/__init__.h"
 #endif
@@ -209,6 +217,11 @@ static void stop_mp(void) {
     #if MICROPY_VFS
     mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table);
 
+    // The FAT sector cache must not keep sectors of mounts about to be dropped.
+    #if MICROPY_FATFS_CACHE_SECTORS
+    fatfs_cache_reset();
+    #endif
+
     // Unmount all heap allocated vfs mounts.
     while (gc_nbytes(vfs) > 0) {
         vfs = vfs->next;
@@ -360,6 +373,10 @@ static void cleanup_after_vm(mp_obj_t exception) {
     memorymonitor_reset();
     #endif
 
+    #if CIRCUITPY_PROFILER
+    profiler_reset();
+    #endif
+
     // Disable user related BLE state that uses the micropython heap.
     #if CIRCUITPY_BLEIO
     bleio_user_reset();
@@ -373,6 +390,17 @@ static void cleanup_after_vm(mp_obj_t exception) {
     keypad_reset();
     #endif
 
+    // Write back sectors cached for FAT volumes while the buses of those on
+    // the heap, such as SD cards, still work.
+    #if MICROPY_FATFS_CACHE_SECTORS
+    fatfs_cache_flush_all();
+    #endif
+
+    // Write out blocks still queued for SD cards.
+    #if CIRCUITPY_SDCARDIO
+    sdcardio_reset();
+    #endif
+
     // Close user-initiated sockets.
     #if CIRCUITPY_SOCKETPOOL
     socketpool_user_reset();
@@ -0,0 +1,87 @@
+// # words 0
+// words []
+// 32   935 000 0
+// 97 a 377 0010 2
+// 101 e 644 0011 3
+// 105 i 351 0100 4
+// 110 n 467 0101 5
+// 111 o 407 0110 6
+// 114 r 345 0111 7
+// 115 s 345 1000 8
+// 116 t 562 1001 9
+// 39 \' 182 10100 20
+// 99 c 222 10101 21
+// 100 d 204 10110 22
+// 108 l 192 10111 23
+// 109 m 178 11000 24
+// 112 p 151 11001 25
+// 117 u 221 11010 26
+// 37 % 143 110110 54
+// 98 b 116 110111 55
+// 102 f 129 111000 56
+// 103 g 133 111001 57
+// 113 q 91 111010 58
+// 104 h 54 1110110 118
+// 118 v 50 1110111 119
+// 119 w 47 1111000 120
+// 120 x 52 1111001 121
+// 121 y 71 1111010 122
+// 40 ( 22 11110110 246
+// 41 ) 22 11110111 247
+// 44 , 17 11111000 248
+// 106 j 25 11111001 249
+// 107 k 32 11111010 250
+// 45 - 15 111110110 502
+// 48 0 12 111110111 503
+// 95 _ 12 111111000 504
+// 42 * 8 1111110010 1010
+// 46 . 8 1111110011 1011
+// 47 / 5 1111110100 1012
+// 49 1 8 1111110101 1013
+// 58 : 5 1111110110 1014
+// 61 = 7 1111110111 1015
+// 78 N 5 1111111000 1016
+// 50 2 3 11111110010 2034
+// 51 3 3 11111110011 2035
+// 84 T 3 11111110100 2036
+// 122 z 4 11111110101 2037
+// 10 \n 2 111111101100 4076
+// 13 \r 2 111111101101 4077
+// 34 \" 2 111111101110 4078
+// 35 # 1 111111101111 4079
+// 52 4 2 111111110000 4080
+// 53 5 1 111111110001 4081
+// 60 < 2 111111110010 4082
+// 62 > 2 111111110011 4083
+// 66 B 1 111111110100 4084
+// 69 E 2 111111110101 4085
+// 70 F 2 111111110110 4086
+// 71 G 1 111111110111 4087
+// 73 I 2 111111111000 4088
+// 83 S 2 111111111001 4089
+// 85 U 2 111111111010 4090
+// 88 X 2 111111111011 4091
+// 67 C 1 1111111111000 8184
+// 72 H 1 1111111111001 8185
+// 76 L 1 1111111111010 8186
+// 80 P 1 1111111111011 8187
+// 91 [ 1 1111111111100 8188
+// 93 ] 1 1111111111101 8189
+// 123 { 1 1111111111110 8190
+// 125 } 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 7, 6: 5, 7: 5, 8: 5, 9: 3, 10: 7, 11: 4, 12: 16, 13: 8}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', "'", 'c', 'd', 'l', 'm', 'p', 'u', '%', 'b', 'f', 'g', 'q', 'h', 'v', 'w', 'x', 'y', '(', ')', ',', 'j', 'k', '-', '0', '_', '*', '.', '/', '1', ':', '=', 'N', '2', '3', 'T', 'z', '\n', '\r', '"', '#', '4', '5', '<', '>', 'B', 'E', 'F', 'G', 'I', 'S', 'U', 'X', 'C', 'H', 'L', 'P', '[', ']', '{', '}'] lengths 14 bytearray(b'\x00\x00\x01\x08\x07\x05\x05\x05\x03\x07\x04\x10\x08\x00')
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', "'", 'c', 'd', 'l', 'm', 'p', 'u', '%', 'b', 'f', 'g', 'q', 'h', 'v', 'w', 'x', 'y', '(', ')', ',', 'j', 'k', '-', '0', '_', '*', '.', '/', '1', ':', '=', 'N', '2', '3', 'T', 'z', '\n', '\r', '"', '#', '4', '5', '<', '>', 'B', 'E', 'F', 'G', 'I', 'S', 'U', 'X', 'C', 'H', 'L', 'P', '[', ']', '{', '}'] bytearray(b'\x00\x00\x01\x08\x07\x05\x05\x05\x03\x07\x04\x10\x08\x00')
+typedef uint8_t mchar_t;
+const uint8_t lengths[] = { 0, 0, 1, 8, 7, 5, 5, 5, 3, 7, 4, 16, 8, 0 };
+const mchar_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 39, 99, 100, 108, 109, 112, 117, 37, 98, 102, 103, 113, 104, 118, 119, 120, 121, 40, 41, 44, 106, 107, 45, 48, 95, 42, 46, 47, 49, 58, 61, 78, 50, 51, 84, 122, 10, 13, 34, 35, 52, 53, 60, 62, 66, 69, 70, 71, 73, 83, 85, 88, 67, 72, 76, 80, 91, 93, 123, 125 };
+#define compress_max_length_bits (7)
+const mchar_t words[] = {  };
+const uint8_t wlencount[] = { 0 };
+#define word_start 128
+#define word_end 127
+#define minlen 0
+#define maxlen 0
+#define translation_offstart 0
+#define translation_offset 0
+#define translation_qstr_bits 0
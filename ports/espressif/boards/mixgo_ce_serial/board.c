@@ -17,6 +17,9 @@ void board_init(void) {
     mp_import_stat_t stat_b = mp_import_stat("boot.py");
     if (stat_b != MP_IMPORT_STAT_FILE) {
         fs_user_mount_t *fs_mount = filesystem_circuitpy();
+        if (fs_mount == NULL) {
+            return;
+        }
         FATFS *fatfs = &fs_mount->fatfs;
         FIL fs;
         UINT char_written = 0;
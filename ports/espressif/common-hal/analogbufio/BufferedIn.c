@@ -293,3 +293,15 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     #endif // DEBUG_ANALOGBUFIO
     return captured_samples;
 }
+
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self, mp_obj_t buffer, mp_int_t block_count, mp_int_t decimation) {
+    // TODO: Drive the ring from the adc_continuous conversion done callback.
+    mp_raise_NotImplementedError(NULL);
+}
+
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self) {
+}
+
+analogbufio_ring_t *common_hal_analogbufio_bufferedin_get_ring(analogbufio_bufferedin_obj_t *self) {
+    return NULL;
+}
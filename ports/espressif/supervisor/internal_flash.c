@@ -44,6 +44,10 @@ static uint32_t _cache_lba = 0xffffffff;
 #endif // FF_MAX_SS == FF_MIN_SS
 static DWORD fatfs_bytes(void) {
     fs_user_mount_t *fs_mount = filesystem_circuitpy();
+    // A littlefs CIRCUITPY is never larger than its partition.
+    if (fs_mount == NULL) {
+        return 0;
+    }
     FATFS *fatfs = &fs_mount->fatfs;
     return (fatfs->csize * SECSIZE(fatfs)) * (fatfs->n_fatent - 2);
 }
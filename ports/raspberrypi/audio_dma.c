@@ -10,6 +10,9 @@
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "bindings/rp2pio/StateMachine.h"
+#if CIRCUITPY_ANALOGBUFIO
+#include "common-hal/analogbufio/BufferedIn.h"
+#endif
 #include "supervisor/background_callback.h"
 
 #include "py/mpstate.h"
@@ -480,6 +483,12 @@ void isr_dma_0(void) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio)[i];
             rp2pio_statemachine_dma_complete(pio, i);
         }
+        #if CIRCUITPY_ANALOGBUFIO
+        if (MP_STATE_PORT(background_adc)[i] != NULL) {
+            analogbufio_bufferedin_obj_t *adc = MP_STATE_PORT(background_adc)[i];
+            analogbufio_bufferedin_dma_complete(adc, i);
+        }
+        #endif
     }
 }
 
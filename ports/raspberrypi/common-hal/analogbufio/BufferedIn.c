@@ -8,11 +8,13 @@
 #include <stdio.h>
 #include "common-hal/analogbufio/BufferedIn.h"
 #include "shared-bindings/analogbufio/BufferedIn.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared/runtime/interrupt_char.h"
 #include "py/runtime.h"
 #include "src/rp2_common/hardware_adc/include/hardware/adc.h"
 #include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+#include "src/rp2_common/hardware_irq/include/hardware/irq.h"
 #include "src/common/pico_stdlib_headers/include/pico/stdlib.h"
 
 #define ADC_FIRST_PIN_NUMBER 26
@@ -58,6 +60,7 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
     float clk_div = (float)ADC_CLOCK_INPUT / (float)sample_rate - 1;
     adc_set_clkdiv(clk_div);
 
+    self->streaming = false;
     self->dma_chan[0] = dma_claim_unused_channel(true);
     self->dma_chan[1] = dma_claim_unused_channel(true);
 
@@ -103,6 +106,8 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
         return;
     }
 
+    common_hal_analogbufio_bufferedin_stop(self);
+
     // stop DMA
     dma_channel_abort(self->dma_chan[0]);
     dma_channel_abort(self->dma_chan[1]);
@@ -218,3 +223,101 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
 
     }
 }
+
+static void scale_samples(uint16_t *buf16, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint16_t value = buf16[i];
+        buf16[i] = (value << 4) | (value >> 8);
+    }
+}
+
+void analogbufio_bufferedin_dma_complete(analogbufio_bufferedin_obj_t *self, uint channel) {
+    // Called from the DMA interrupt. The other channel is already filling the
+    // next block, so rearm this one to follow it without starting it.
+    size_t i = channel == self->dma_chan[0] ? 0 : 1;
+    analogbufio_ring_t *ring = &self->ring;
+    if (ring->bytes_per_sample == 2) {
+        scale_samples((uint16_t *)self->dma_block[i], ring->block_samples);
+    }
+    analogbufio_ring_complete(ring, self->dma_block[i]);
+    self->dma_block[i] = analogbufio_ring_issue(ring);
+    dma_channel_set_write_addr(channel, self->dma_block[i], false);
+    dma_channel_set_trans_count(channel, ring->block_samples, false);
+}
+
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self, mp_obj_t buffer, mp_int_t block_count, mp_int_t decimation) {
+    analogbufio_ring_t *ring = &self->ring;
+    // Both DMA channels hold a block, so a third is needed to read from.
+    analogbufio_ring_init(ring, buffer, block_count, decimation, 2);
+    uint8_t bytes_per_sample = ring->bytes_per_sample;
+
+    // Unlike readinto(), leave out the error bit so that every sample can be kept.
+    adc_fifo_setup(true, true, 1, false, bytes_per_sample == 1);
+
+    for (size_t i = 0; i < 2; i++) {
+        dma_channel_config cfg = dma_channel_get_default_config(self->dma_chan[i]);
+        channel_config_set_read_increment(&cfg, false);
+        channel_config_set_write_increment(&cfg, true);
+        channel_config_set_transfer_data_size(&cfg, bytes_per_sample == 2 ? DMA_SIZE_16 : DMA_SIZE_8);
+        channel_config_set_dreq(&cfg, DREQ_ADC);
+        channel_config_set_chain_to(&cfg, self->dma_chan[1 - i]);
+        self->dma_block[i] = analogbufio_ring_issue(ring);
+        dma_channel_configure(self->dma_chan[i], &cfg,
+            self->dma_block[i],     // dst
+            &adc_hw->fifo,          // src
+            ring->block_samples,    // transfer count
+            false                   // don't start yet
+            );
+    }
+
+    uint32_t mask = (1u << self->dma_chan[0]) | (1u << self->dma_chan[1]);
+    common_hal_mcu_disable_interrupts();
+    MP_STATE_PORT(background_adc)[self->dma_chan[0]] = self;
+    MP_STATE_PORT(background_adc)[self->dma_chan[1]] = self;
+    self->streaming = true;
+    dma_hw->ints0 = mask;
+    dma_hw->inte0 |= mask;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+    dma_channel_start(self->dma_chan[0]);
+    common_hal_mcu_enable_interrupts();
+
+    adc_run(true);
+}
+
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self) {
+    if (!self->streaming) {
+        return;
+    }
+    adc_run(false);
+
+    uint32_t mask = (1u << self->dma_chan[0]) | (1u << self->dma_chan[1]);
+    common_hal_mcu_disable_interrupts();
+    dma_hw->inte0 &= ~mask;
+    if (!dma_hw->inte0) {
+        irq_set_mask_enabled(1 << DMA_IRQ_0, false);
+    }
+    MP_STATE_PORT(background_adc)[self->dma_chan[0]] = NULL;
+    MP_STATE_PORT(background_adc)[self->dma_chan[1]] = NULL;
+    self->streaming = false;
+    common_hal_mcu_enable_interrupts();
+
+    // Chain each channel to itself so that aborting one can't start the other.
+    for (size_t i = 0; i < 2; i++) {
+        dma_channel_config cfg = dma_get_channel_config(self->dma_chan[i]);
+        channel_config_set_chain_to(&cfg, self->dma_chan[i]);
+        dma_channel_set_config(self->dma_chan[i], &cfg, false);
+    }
+    dma_channel_abort(self->dma_chan[0]);
+    dma_channel_abort(self->dma_chan[1]);
+    dma_hw->ints0 = mask;
+    adc_fifo_drain();
+    analogbufio_ring_deinit(&self->ring);
+}
+
+analogbufio_ring_t *common_hal_analogbufio_bufferedin_get_ring(analogbufio_bufferedin_obj_t *self) {
+    return self->streaming ? &self->ring : NULL;
+}
+
+// Use a compile-time constant for MP_REGISTER_POINTER so the preprocessor will
+// not split the expansion across multiple lines.
+MP_REGISTER_ROOT_POINTER(mp_obj_t background_adc[enum_NUM_DMA_CHANNELS]);
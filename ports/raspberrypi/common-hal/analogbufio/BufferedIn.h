@@ -11,6 +11,7 @@
 #include "src/rp2_common/hardware_dma/include/hardware/dma.h"
 
 #include "py/obj.h"
+#include "shared-module/analogbufio/SampleRing.h"
 
 //  This is the analogbufio object
 typedef struct {
@@ -19,4 +20,10 @@ typedef struct {
     uint8_t chan;
     uint dma_chan[2];
     dma_channel_config cfg[2];
+    // Continuous capture: each DMA channel fills a block and then starts the other.
+    analogbufio_ring_t ring;
+    uint8_t *dma_block[2];
+    bool streaming;
 } analogbufio_bufferedin_obj_t;
+
+void analogbufio_bufferedin_dma_complete(analogbufio_bufferedin_obj_t *self, uint channel);
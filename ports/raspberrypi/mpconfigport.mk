@@ -15,6 +15,9 @@ CIRCUITPY_AUDIOMP3 ?= 1
 CIRCUITPY_BITOPS ?= 1
 CIRCUITPY_HASHLIB ?= 1
 CIRCUITPY_HASHLIB_MBEDTLS ?= 1
+# mbedtls is built with MBEDTLS_SHA256_SMALLER, and os.urandom already links
+# lib/crypto-algorithms/sha256.c.
+CIRCUITPY_HASHLIB_SHA256_SOFTWARE ?= 1
 CIRCUITPY_IMAGECAPTURE ?= 1
 CIRCUITPY_MAX3421E ?= 0
 CIRCUITPY_MEMORYMAP ?= 1
@@ -0,0 +1,96 @@
+// # words 0
+// words []
+// 32   1384 000 0
+// 97 a 521 0010 2
+// 101 e 930 0011 3
+// 105 i 492 0100 4
+// 110 n 597 0101 5
+// 111 o 615 0110 6
+// 114 r 503 0111 7
+// 115 s 472 1000 8
+// 116 t 788 1001 9
+// 99 c 306 10100 20
+// 100 d 286 10101 21
+// 108 l 303 10110 22
+// 109 m 276 10111 23
+// 112 p 245 11000 24
+// 117 u 344 11001 25
+// 37 % 146 110100 52
+// 39 \' 182 110101 53
+// 98 b 190 110110 54
+// 102 f 213 110111 55
+// 103 g 158 111000 56
+// 121 y 129 111001 57
+// 104 h 116 1110100 116
+// 113 q 107 1110101 117
+// 118 v 83 1110110 118
+// 119 w 62 1110111 119
+// 120 x 63 1111000 120
+// 40 ( 30 11110010 242
+// 41 ) 30 11110011 243
+// 44 , 45 11110100 244
+// 95 _ 30 11110101 245
+// 106 j 29 11110110 246
+// 107 k 39 11110111 247
+// 45 - 21 111110000 496
+// 48 0 18 111110001 497
+// 122 z 16 111110010 498
+// 10 \n 11 1111100110 998
+// 13 \r 11 1111100111 999
+// 42 * 10 1111101000 1000
+// 46 . 12 1111101001 1001
+// 47 / 9 1111101010 1002
+// 49 1 14 1111101011 1003
+// 50 2 10 1111101100 1004
+// 51 3 9 1111101101 1005
+// 54 6 10 1111101110 1006
+// 58 : 12 1111101111 1007
+// 66 B 11 1111110000 1008
+// 67 C 10 1111110001 1009
+// 73 I 13 1111110010 1010
+// 78 N 10 1111110011 1011
+// 82 R 7 1111110100 1012
+// 83 S 9 1111110101 1013
+// 84 T 7 1111110110 1014
+// 34 \" 4 11111101110 2030
+// 52 4 5 11111101111 2031
+// 53 5 5 11111110000 2032
+// 56 8 6 11111110001 2033
+// 61 = 7 11111110010 2034
+// 65 A 5 11111110011 2035
+// 68 D 4 11111110100 2036
+// 69 E 6 11111110101 2037
+// 70 F 5 11111110110 2038
+// 71 G 5 11111110111 2039
+// 79 O 6 11111111000 2040
+// 80 P 5 11111111001 2041
+// 85 U 4 11111111010 2042
+// 57 9 2 111111110110 4086
+// 62 > 2 111111110111 4087
+// 72 H 3 111111111000 4088
+// 74 J 2 111111111001 4089
+// 75 K 2 111111111010 4090
+// 76 L 3 111111111011 4091
+// 96 ` 2 111111111100 4092
+// 33 ! 1 1111111111010 8186
+// 35 # 1 1111111111011 8187
+// 43 + 1 1111111111100 8188
+// 60 < 2 1111111111101 8189
+// 86 V 1 1111111111110 8190
+// 87 W 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 6, 7: 5, 8: 6, 9: 3, 10: 17, 11: 13, 12: 7, 13: 6}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'y', 'h', 'q', 'v', 'w', 'x', '(', ')', ',', '_', 'j', 'k', '-', '0', 'z', '\n', '\r', '*', '.', '/', '1', '2', '3', '6', ':', 'B', 'C', 'I', 'N', 'R', 'S', 'T', '"', '4', '5', '8', '=', 'A', 'D', 'E', 'F', 'G', 'O', 'P', 'U', '9', '>', 'H', 'J', 'K', 'L', '`', '!', '#', '+', '<', 'V', 'W'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x06\x05\x06\x03\x11\r\x07\x06\x00')
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'y', 'h', 'q', 'v', 'w', 'x', '(', ')', ',', '_', 'j', 'k', '-', '0', 'z', '\n', '\r', '*', '.', '/', '1', '2', '3', '6', ':', 'B', 'C', 'I', 'N', 'R', 'S', 'T', '"', '4', '5', '8', '=', 'A', 'D', 'E', 'F', 'G', 'O', 'P', 'U', '9', '>', 'H', 'J', 'K', 'L', '`', '!', '#', '+', '<', 'V', 'W'] bytearray(b'\x00\x00\x01\x08\x06\x06\x05\x06\x03\x11\r\x07\x06\x00')
+typedef uint8_t mchar_t;
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 6, 5, 6, 3, 17, 13, 7, 6, 0 };
+const mchar_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 99, 100, 108, 109, 112, 117, 37, 39, 98, 102, 103, 121, 104, 113, 118, 119, 120, 40, 41, 44, 95, 106, 107, 45, 48, 122, 10, 13, 42, 46, 47, 49, 50, 51, 54, 58, 66, 67, 73, 78, 82, 83, 84, 34, 52, 53, 56, 61, 65, 68, 69, 70, 71, 79, 80, 85, 57, 62, 72, 74, 75, 76, 96, 33, 35, 43, 60, 86, 87 };
+#define compress_max_length_bits (8)
+const mchar_t words[] = {  };
+const uint8_t wlencount[] = { 0 };
+#define word_start 128
+#define word_end 127
+#define minlen 0
+#define maxlen 0
+#define translation_offstart 0
+#define translation_offset 0
+#define translation_qstr_bits 0
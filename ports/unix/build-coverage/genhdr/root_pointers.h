@@ -0,0 +1,16 @@
+// Automatically generated by make_root_pointers.py.
+
+const char *readline_hist[(50)];
+int example_package_initialised;
+mp_obj_base_t * cur_exception;
+mp_obj_list_t mp_sys_argv_obj;
+mp_obj_t active_allocationalarms;
+mp_obj_t active_allocationprofiler;
+mp_obj_t active_allocationsizes;
+mp_obj_t sampling_profiler;
+mp_obj_t sys_exitfunc;
+mp_obj_t sys_mutable[MP_SYS_MUTABLE_NUM];
+mp_sched_item_t sched_queue[(4)];
+struct _mp_vfs_mount_t *vfs_cur;
+struct _mp_vfs_mount_t *vfs_mount_table;
+void *mmap_region_head;
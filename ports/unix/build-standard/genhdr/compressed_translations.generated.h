@@ -0,0 +1,90 @@
+// # words 0
+// words []
+// 32   946 000 0
+// 97 a 369 0010 2
+// 101 e 657 0011 3
+// 105 i 389 0100 4
+// 110 n 469 0101 5
+// 111 o 448 0110 6
+// 114 r 354 0111 7
+// 115 s 342 1000 8
+// 116 t 579 1001 9
+// 99 c 244 10100 20
+// 100 d 221 10101 21
+// 108 l 220 10110 22
+// 109 m 191 10111 23
+// 112 p 162 11000 24
+// 117 u 237 11001 25
+// 37 % 124 110100 52
+// 39 \' 150 110101 53
+// 98 b 116 110110 54
+// 102 f 144 110111 55
+// 103 g 135 111000 56
+// 113 q 88 111001 57
+// 121 y 89 111010 58
+// 104 h 65 1110110 118
+// 118 v 54 1110111 119
+// 119 w 50 1111000 120
+// 120 x 47 1111001 121
+// 40 ( 24 11110100 244
+// 41 ) 24 11110101 245
+// 45 - 20 11110110 246
+// 106 j 26 11110111 247
+// 107 k 34 11111000 248
+// 44 , 14 111110010 498
+// 46 . 9 111110011 499
+// 47 / 9 111110100 500
+// 48 0 9 111110101 501
+// 58 : 9 111110110 502
+// 78 N 9 111110111 503
+// 95 _ 12 111111000 504
+// 10 \n 9 1111110010 1010
+// 13 \r 9 1111110011 1011
+// 42 * 8 1111110100 1012
+// 49 1 5 1111110101 1013
+// 61 = 7 1111110110 1014
+// 73 I 5 1111110111 1015
+// 122 z 6 1111111000 1016
+// 34 \" 4 11111110010 2034
+// 51 3 4 11111110011 2035
+// 67 C 3 11111110100 2036
+// 69 E 3 11111110101 2037
+// 79 O 3 11111110110 2038
+// 80 P 3 11111110111 2039
+// 83 S 3 11111111000 2040
+// 50 2 2 111111110010 4082
+// 57 9 1 111111110011 4083
+// 60 < 2 111111110100 4084
+// 62 > 2 111111110101 4085
+// 70 F 2 111111110110 4086
+// 74 J 1 111111110111 4087
+// 84 T 2 111111111000 4088
+// 96 ` 2 111111111001 4089
+// 33 ! 1 1111111110100 8180
+// 35 # 1 1111111110101 8181
+// 56 8 1 1111111110110 8182
+// 65 A 1 1111111110111 8183
+// 66 B 1 1111111111000 8184
+// 71 G 1 1111111111001 8185
+// 72 H 1 1111111111010 8186
+// 76 L 1 1111111111011 8187
+// 82 R 1 1111111111100 8188
+// 85 U 1 1111111111101 8189
+// 86 V 1 1111111111110 8190
+// 87 W 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 7, 7: 4, 8: 5, 9: 7, 10: 7, 11: 7, 12: 8, 13: 12}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'q', 'y', 'h', 'v', 'w', 'x', '(', ')', '-', 'j', 'k', ',', '.', '/', '0', ':', 'N', '_', '\n', '\r', '*', '1', '=', 'I', 'z', '"', '3', 'C', 'E', 'O', 'P', 'S', '2', '9', '<', '>', 'F', 'J', 'T', '`', '!', '#', '8', 'A', 'B', 'G', 'H', 'L', 'R', 'U', 'V', 'W'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x07\x04\x05\x07\x07\x07\x08\x0c\x00')
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'q', 'y', 'h', 'v', 'w', 'x', '(', ')', '-', 'j', 'k', ',', '.', '/', '0', ':', 'N', '_', '\n', '\r', '*', '1', '=', 'I', 'z', '"', '3', 'C', 'E', 'O', 'P', 'S', '2', '9', '<', '>', 'F', 'J', 'T', '`', '!', '#', '8', 'A', 'B', 'G', 'H', 'L', 'R', 'U', 'V', 'W'] bytearray(b'\x00\x00\x01\x08\x06\x07\x04\x05\x07\x07\x07\x08\x0c\x00')
+typedef uint8_t mchar_t;
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 7, 4, 5, 7, 7, 7, 8, 12, 0 };
+const mchar_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 99, 100, 108, 109, 112, 117, 37, 39, 98, 102, 103, 113, 121, 104, 118, 119, 120, 40, 41, 45, 106, 107, 44, 46, 47, 48, 58, 78, 95, 10, 13, 42, 49, 61, 73, 122, 34, 51, 67, 69, 79, 80, 83, 50, 57, 60, 62, 70, 74, 84, 96, 33, 35, 56, 65, 66, 71, 72, 76, 82, 85, 86, 87 };
+#define compress_max_length_bits (8)
+const mchar_t words[] = {  };
+const uint8_t wlencount[] = { 0 };
+#define word_start 128
+#define word_end 127
+#define minlen 0
+#define maxlen 0
+#define translation_offstart 0
+#define translation_offset 0
+#define translation_qstr_bits 0
@@ -0,0 +1,924 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTRnull, 0, 0, "")
+QDEF(MP_QSTR_, 5381, 0, "")
+QDEF(MP_QSTR___dir__, 36730, 7, "__dir__")
+QDEF(MP_QSTR__0x0a_, 46511, 1, "\x0a")
+QDEF(MP_QSTR__space_, 46469, 1, " ")
+QDEF(MP_QSTR__star_, 46479, 1, "*")
+QDEF(MP_QSTR__slash_, 46474, 1, "/")
+QDEF(MP_QSTR__lt_module_gt_, 38077, 8, "<module>")
+QDEF(MP_QSTR__, 46586, 1, "_")
+QDEF(MP_QSTR___call__, 63911, 8, "__call__")
+QDEF(MP_QSTR___class__, 50475, 9, "__class__")
+QDEF(MP_QSTR___delitem__, 13821, 11, "__delitem__")
+QDEF(MP_QSTR___enter__, 47725, 9, "__enter__")
+QDEF(MP_QSTR___exit__, 63557, 8, "__exit__")
+QDEF(MP_QSTR___getattr__, 63552, 11, "__getattr__")
+QDEF(MP_QSTR___getitem__, 14630, 11, "__getitem__")
+QDEF(MP_QSTR___hash__, 51447, 8, "__hash__")
+QDEF(MP_QSTR___init__, 42335, 8, "__init__")
+QDEF(MP_QSTR___int__, 6934, 7, "__int__")
+QDEF(MP_QSTR___iter__, 13007, 8, "__iter__")
+QDEF(MP_QSTR___len__, 45282, 7, "__len__")
+QDEF(MP_QSTR___main__, 5006, 8, "__main__")
+QDEF(MP_QSTR___module__, 12543, 10, "__module__")
+QDEF(MP_QSTR___name__, 14562, 8, "__name__")
+QDEF(MP_QSTR___new__, 5497, 7, "__new__")
+QDEF(MP_QSTR___next__, 29442, 8, "__next__")
+QDEF(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF(MP_QSTR___repr__, 2832, 8, "__repr__")
+QDEF(MP_QSTR___setitem__, 15922, 11, "__setitem__")
+QDEF(MP_QSTR___str__, 52688, 7, "__str__")
+QDEF(MP_QSTR_ArithmeticError, 35885, 15, "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, 23191, 14, "AssertionError")
+QDEF(MP_QSTR_AttributeError, 56865, 14, "AttributeError")
+QDEF(MP_QSTR_BaseException, 37383, 13, "BaseException")
+QDEF(MP_QSTR_EOFError, 49041, 8, "EOFError")
+QDEF(MP_QSTR_Ellipsis, 57584, 8, "Ellipsis")
+QDEF(MP_QSTR_Exception, 10738, 9, "Exception")
+QDEF(MP_QSTR_GeneratorExit, 25110, 13, "GeneratorExit")
+QDEF(MP_QSTR_ImportError, 39968, 11, "ImportError")
+QDEF(MP_QSTR_IndentationError, 8284, 16, "IndentationError")
+QDEF(MP_QSTR_IndexError, 44419, 10, "IndexError")
+QDEF(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, 58031, 17, "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, 27135, 11, "LookupError")
+QDEF(MP_QSTR_MemoryError, 33756, 11, "MemoryError")
+QDEF(MP_QSTR_NameError, 11706, 9, "NameError")
+QDEF(MP_QSTR_NoneType, 26647, 8, "NoneType")
+QDEF(MP_QSTR_NotImplementedError, 39110, 19, "NotImplementedError")
+QDEF(MP_QSTR_OSError, 26017, 7, "OSError")
+QDEF(MP_QSTR_OverflowError, 57729, 13, "OverflowError")
+QDEF(MP_QSTR_RuntimeError, 61793, 12, "RuntimeError")
+QDEF(MP_QSTR_StopIteration, 7402, 13, "StopIteration")
+QDEF(MP_QSTR_SyntaxError, 36756, 11, "SyntaxError")
+QDEF(MP_QSTR_SystemExit, 65312, 10, "SystemExit")
+QDEF(MP_QSTR_TypeError, 38437, 9, "TypeError")
+QDEF(MP_QSTR_ValueError, 34710, 10, "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, 10166, 17, "ZeroDivisionError")
+QDEF(MP_QSTR_abs, 12949, 3, "abs")
+QDEF(MP_QSTR_all, 13124, 3, "all")
+QDEF(MP_QSTR_any, 13075, 3, "any")
+QDEF(MP_QSTR_append, 38763, 6, "append")
+QDEF(MP_QSTR_args, 50882, 4, "args")
+QDEF(MP_QSTR_bool, 15595, 4, "bool")
+QDEF(MP_QSTR_builtins, 12791, 8, "builtins")
+QDEF(MP_QSTR_bytearray, 41846, 9, "bytearray")
+QDEF(MP_QSTR_bytecode, 32034, 8, "bytecode")
+QDEF(MP_QSTR_bytes, 45660, 5, "bytes")
+QDEF(MP_QSTR_callable, 28685, 8, "callable")
+QDEF(MP_QSTR_chr, 19676, 3, "chr")
+QDEF(MP_QSTR_classmethod, 36020, 11, "classmethod")
+QDEF(MP_QSTR_clear, 41084, 5, "clear")
+QDEF(MP_QSTR_close, 26419, 5, "close")
+QDEF(MP_QSTR_const, 65472, 5, "const")
+QDEF(MP_QSTR_copy, 56288, 4, "copy")
+QDEF(MP_QSTR_count, 19878, 5, "count")
+QDEF(MP_QSTR_dict, 64575, 4, "dict")
+QDEF(MP_QSTR_dir, 7930, 3, "dir")
+QDEF(MP_QSTR_divmod, 1208, 6, "divmod")
+QDEF(MP_QSTR_end, 8970, 3, "end")
+QDEF(MP_QSTR_endswith, 41755, 8, "endswith")
+QDEF(MP_QSTR_eval, 42651, 4, "eval")
+QDEF(MP_QSTR_exec, 49182, 4, "exec")
+QDEF(MP_QSTR_extend, 59491, 6, "extend")
+QDEF(MP_QSTR_find, 13312, 4, "find")
+QDEF(MP_QSTR_format, 13094, 6, "format")
+QDEF(MP_QSTR_from_bytes, 29749, 10, "from_bytes")
+QDEF(MP_QSTR_get, 15155, 3, "get")
+QDEF(MP_QSTR_getattr, 6080, 7, "getattr")
+QDEF(MP_QSTR_globals, 18845, 7, "globals")
+QDEF(MP_QSTR_hasattr, 45196, 7, "hasattr")
+QDEF(MP_QSTR_hash, 28855, 4, "hash")
+QDEF(MP_QSTR_id, 28456, 2, "id")
+QDEF(MP_QSTR_index, 10363, 5, "index")
+QDEF(MP_QSTR_insert, 21522, 6, "insert")
+QDEF(MP_QSTR_int, 21270, 3, "int")
+QDEF(MP_QSTR_isalpha, 14315, 7, "isalpha")
+QDEF(MP_QSTR_isdigit, 39592, 7, "isdigit")
+QDEF(MP_QSTR_isinstance, 48822, 10, "isinstance")
+QDEF(MP_QSTR_islower, 33020, 7, "islower")
+QDEF(MP_QSTR_isspace, 63579, 7, "isspace")
+QDEF(MP_QSTR_issubclass, 32693, 10, "issubclass")
+QDEF(MP_QSTR_isupper, 42973, 7, "isupper")
+QDEF(MP_QSTR_items, 21475, 5, "items")
+QDEF(MP_QSTR_iter, 8591, 4, "iter")
+QDEF(MP_QSTR_join, 23719, 4, "join")
+QDEF(MP_QSTR_key, 27954, 3, "key")
+QDEF(MP_QSTR_keys, 4865, 4, "keys")
+QDEF(MP_QSTR_len, 16482, 3, "len")
+QDEF(MP_QSTR_list, 7463, 4, "list")
+QDEF(MP_QSTR_little, 27273, 6, "little")
+QDEF(MP_QSTR_locals, 41275, 6, "locals")
+QDEF(MP_QSTR_lower, 52166, 5, "lower")
+QDEF(MP_QSTR_lstrip, 47589, 6, "lstrip")
+QDEF(MP_QSTR_main, 47054, 4, "main")
+QDEF(MP_QSTR_map, 17337, 3, "map")
+QDEF(MP_QSTR_micropython, 31755, 11, "micropython")
+QDEF(MP_QSTR_next, 34882, 4, "next")
+QDEF(MP_QSTR_object, 36240, 6, "object")
+QDEF(MP_QSTR_open, 15057, 4, "open")
+QDEF(MP_QSTR_ord, 24092, 3, "ord")
+QDEF(MP_QSTR_pop, 29482, 3, "pop")
+QDEF(MP_QSTR_popitem, 11455, 7, "popitem")
+QDEF(MP_QSTR_pow, 29485, 3, "pow")
+QDEF(MP_QSTR_print, 50772, 5, "print")
+QDEF(MP_QSTR_range, 24090, 5, "range")
+QDEF(MP_QSTR_read, 63927, 4, "read")
+QDEF(MP_QSTR_readinto, 48971, 8, "readinto")
+QDEF(MP_QSTR_readline, 6649, 8, "readline")
+QDEF(MP_QSTR_remove, 35427, 6, "remove")
+QDEF(MP_QSTR_replace, 9545, 7, "replace")
+QDEF(MP_QSTR_repr, 63440, 4, "repr")
+QDEF(MP_QSTR_reverse, 10789, 7, "reverse")
+QDEF(MP_QSTR_rfind, 40146, 5, "rfind")
+QDEF(MP_QSTR_rindex, 11241, 6, "rindex")
+QDEF(MP_QSTR_round, 9703, 5, "round")
+QDEF(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF(MP_QSTR_rstrip, 38203, 6, "rstrip")
+QDEF(MP_QSTR_self, 30585, 4, "self")
+QDEF(MP_QSTR_send, 30393, 4, "send")
+QDEF(MP_QSTR_sep, 36643, 3, "sep")
+QDEF(MP_QSTR_set, 36647, 3, "set")
+QDEF(MP_QSTR_setattr, 43220, 7, "setattr")
+QDEF(MP_QSTR_setdefault, 41836, 10, "setdefault")
+QDEF(MP_QSTR_sort, 40383, 4, "sort")
+QDEF(MP_QSTR_sorted, 5470, 6, "sorted")
+QDEF(MP_QSTR_split, 13239, 5, "split")
+QDEF(MP_QSTR_start, 61317, 5, "start")
+QDEF(MP_QSTR_startswith, 59508, 10, "startswith")
+QDEF(MP_QSTR_staticmethod, 44898, 12, "staticmethod")
+QDEF(MP_QSTR_step, 13911, 4, "step")
+QDEF(MP_QSTR_stop, 13981, 4, "stop")
+QDEF(MP_QSTR_str, 36176, 3, "str")
+QDEF(MP_QSTR_strip, 7721, 5, "strip")
+QDEF(MP_QSTR_sum, 36142, 3, "sum")
+QDEF(MP_QSTR_super, 45764, 5, "super")
+QDEF(MP_QSTR_throw, 17587, 5, "throw")
+QDEF(MP_QSTR_to_bytes, 16088, 8, "to_bytes")
+QDEF(MP_QSTR_tuple, 16893, 5, "tuple")
+QDEF(MP_QSTR_type, 32669, 4, "type")
+QDEF(MP_QSTR_update, 30388, 6, "update")
+QDEF(MP_QSTR_upper, 37927, 5, "upper")
+QDEF(MP_QSTR_utf_hyphen_8, 33463, 5, "utf-8")
+QDEF(MP_QSTR_value, 13390, 5, "value")
+QDEF(MP_QSTR_values, 48765, 6, "values")
+QDEF(MP_QSTR_write, 43160, 5, "write")
+QDEF(MP_QSTR_zip, 44262, 3, "zip")
+QDEF(MP_QSTR___abs__, 54933, 7, "__abs__")
+QDEF(MP_QSTR___add__, 33476, 7, "__add__")
+QDEF(MP_QSTR___and__, 56078, 7, "__and__")
+QDEF(MP_QSTR___bool__, 25899, 8, "__bool__")
+QDEF(MP_QSTR___complex__, 58053, 11, "__complex__")
+QDEF(MP_QSTR___contains__, 24518, 12, "__contains__")
+QDEF(MP_QSTR___delete__, 60892, 10, "__delete__")
+QDEF(MP_QSTR___divmod__, 4472, 10, "__divmod__")
+QDEF(MP_QSTR___eq__, 15985, 6, "__eq__")
+QDEF(MP_QSTR___float__, 28725, 9, "__float__")
+QDEF(MP_QSTR___floordiv__, 24390, 12, "__floordiv__")
+QDEF(MP_QSTR___ge__, 18087, 6, "__ge__")
+QDEF(MP_QSTR___get__, 36787, 7, "__get__")
+QDEF(MP_QSTR___gt__, 33462, 6, "__gt__")
+QDEF(MP_QSTR___iadd__, 19053, 8, "__iadd__")
+QDEF(MP_QSTR___invert__, 30711, 10, "__invert__")
+QDEF(MP_QSTR___isub__, 30728, 8, "__isub__")
+QDEF(MP_QSTR___le__, 5068, 6, "__le__")
+QDEF(MP_QSTR___lshift__, 34825, 10, "__lshift__")
+QDEF(MP_QSTR___lt__, 26717, 6, "__lt__")
+QDEF(MP_QSTR___matmul__, 62281, 10, "__matmul__")
+QDEF(MP_QSTR___mod__, 14179, 7, "__mod__")
+QDEF(MP_QSTR___mul__, 16945, 7, "__mul__")
+QDEF(MP_QSTR___ne__, 2830, 6, "__ne__")
+QDEF(MP_QSTR___neg__, 54633, 7, "__neg__")
+QDEF(MP_QSTR___or__, 47928, 6, "__or__")
+QDEF(MP_QSTR___pos__, 61481, 7, "__pos__")
+QDEF(MP_QSTR___pow__, 45, 7, "__pow__")
+QDEF(MP_QSTR___radd__, 50454, 8, "__radd__")
+QDEF(MP_QSTR___rand__, 11996, 8, "__rand__")
+QDEF(MP_QSTR___rfloordiv__, 38996, 13, "__rfloordiv__")
+QDEF(MP_QSTR___rlshift__, 53531, 11, "__rlshift__")
+QDEF(MP_QSTR___rmatmul__, 987, 11, "__rmatmul__")
+QDEF(MP_QSTR___rmod__, 35377, 8, "__rmod__")
+QDEF(MP_QSTR___rmul__, 355, 8, "__rmul__")
+QDEF(MP_QSTR___ror__, 56362, 7, "__ror__")
+QDEF(MP_QSTR___rpow__, 39679, 8, "__rpow__")
+QDEF(MP_QSTR___rrshift__, 40389, 11, "__rrshift__")
+QDEF(MP_QSTR___rshift__, 38999, 10, "__rshift__")
+QDEF(MP_QSTR___rsub__, 30579, 8, "__rsub__")
+QDEF(MP_QSTR___rtruediv__, 55130, 12, "__rtruediv__")
+QDEF(MP_QSTR___rxor__, 34546, 8, "__rxor__")
+QDEF(MP_QSTR___set__, 45991, 7, "__set__")
+QDEF(MP_QSTR___sub__, 2337, 7, "__sub__")
+QDEF(MP_QSTR___truediv__, 61320, 11, "__truediv__")
+QDEF(MP_QSTR___xor__, 60448, 7, "__xor__")
+QDEF(MP_QSTR__gt__gt__gt__space_, 44187, 4, ">>> ")
+QDEF(MP_QSTR__dot__dot__dot__space_, 10379, 4, "... ")
+QDEF(MP_QSTR__percent__hash_o, 6764, 3, "%#o")
+QDEF(MP_QSTR__percent__hash_x, 6779, 3, "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, 14168, 5, "{:#b}")
+QDEF(MP_QSTR__lt_lambda_gt_, 35968, 8, "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, 5588, 10, "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, 36300, 10, "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, 20820, 9, "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, 27188, 9, "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, 21330, 8, "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, 25571, 7, "<stdin>")
+QDEF(MP_QSTR_ARRAY, 31324, 5, "ARRAY")
+QDEF(MP_QSTR_BFINT16, 58005, 7, "BFINT16")
+QDEF(MP_QSTR_BFINT32, 57939, 7, "BFINT32")
+QDEF(MP_QSTR_BFINT8, 39498, 6, "BFINT8")
+QDEF(MP_QSTR_BFUINT16, 42560, 8, "BFUINT16")
+QDEF(MP_QSTR_BFUINT32, 42502, 8, "BFUINT32")
+QDEF(MP_QSTR_BFUINT8, 44991, 7, "BFUINT8")
+QDEF(MP_QSTR_BF_LEN, 45081, 6, "BF_LEN")
+QDEF(MP_QSTR_BF_POS, 40274, 6, "BF_POS")
+QDEF(MP_QSTR_BIG_ENDIAN, 20991, 10, "BIG_ENDIAN")
+QDEF(MP_QSTR_BrokenPipeError, 25902, 15, "BrokenPipeError")
+QDEF(MP_QSTR_BytesIO, 46874, 7, "BytesIO")
+QDEF(MP_QSTR_CancelledError, 39926, 14, "CancelledError")
+QDEF(MP_QSTR_ConnectionError, 4427, 15, "ConnectionError")
+QDEF(MP_QSTR_DecompIO, 46995, 8, "DecompIO")
+QDEF(MP_QSTR_EACCES, 49719, 6, "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, 4375, 10, "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, 60448, 6, "EAGAIN")
+QDEF(MP_QSTR_EALREADY, 5446, 8, "EALREADY")
+QDEF(MP_QSTR_EBADF, 41825, 5, "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, 43815, 12, "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, 11322, 12, "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, 64281, 10, "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, 44371, 6, "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, 9606, 12, "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, 41114, 11, "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, 65372, 6, "EINVAL")
+QDEF(MP_QSTR_EIO, 42630, 3, "EIO")
+QDEF(MP_QSTR_EISDIR, 20389, 6, "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, 34787, 7, "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, 26550, 6, "ENODEV")
+QDEF(MP_QSTR_ENOENT, 25950, 6, "ENOENT")
+QDEF(MP_QSTR_ENOMEM, 34212, 6, "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, 55161, 8, "ENOTCONN")
+QDEF(MP_QSTR_EOPNOTSUPP, 38828, 10, "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, 32746, 5, "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, 63743, 9, "ETIMEDOUT")
+QDEF(MP_QSTR_FLOAT32, 34740, 7, "FLOAT32")
+QDEF(MP_QSTR_FLOAT64, 34583, 7, "FLOAT64")
+QDEF(MP_QSTR_FileIO, 5573, 6, "FileIO")
+QDEF(MP_QSTR_INT, 55094, 3, "INT")
+QDEF(MP_QSTR_INT16, 30353, 5, "INT16")
+QDEF(MP_QSTR_INT32, 30295, 5, "INT32")
+QDEF(MP_QSTR_INT64, 30196, 5, "INT64")
+QDEF(MP_QSTR_INT8, 48590, 4, "INT8")
+QDEF(MP_QSTR_IOBase, 48694, 6, "IOBase")
+QDEF(MP_QSTR_LITTLE_ENDIAN, 23487, 13, "LITTLE_ENDIAN")
+QDEF(MP_QSTR_LONG, 25871, 4, "LONG")
+QDEF(MP_QSTR_LONGLONG, 54405, 8, "LONGLONG")
+QDEF(MP_QSTR_LockType, 8246, 8, "LockType")
+QDEF(MP_QSTR_NATIVE, 36356, 6, "NATIVE")
+QDEF(MP_QSTR_None, 53615, 4, "None")
+QDEF(MP_QSTR_NotImplemented, 50750, 14, "NotImplemented")
+QDEF(MP_QSTR_OrderedDict, 32496, 11, "OrderedDict")
+QDEF(MP_QSTR_POLLERR, 49375, 7, "POLLERR")
+QDEF(MP_QSTR_POLLHUP, 35447, 7, "POLLHUP")
+QDEF(MP_QSTR_POLLIN, 24957, 6, "POLLIN")
+QDEF(MP_QSTR_POLLOUT, 34164, 7, "POLLOUT")
+QDEF(MP_QSTR_PTR, 3251, 3, "PTR")
+QDEF(MP_QSTR_ReloadException, 49667, 15, "ReloadException")
+QDEF(MP_QSTR_SHORT, 7159, 5, "SHORT")
+QDEF(MP_QSTR_StopAsyncIteration, 61676, 18, "StopAsyncIteration")
+QDEF(MP_QSTR_StringIO, 30326, 8, "StringIO")
+QDEF(MP_QSTR_Task, 16904, 4, "Task")
+QDEF(MP_QSTR_TaskQueue, 23705, 9, "TaskQueue")
+QDEF(MP_QSTR_TextIOWrapper, 36269, 13, "TextIOWrapper")
+QDEF(MP_QSTR_TimeoutError, 19302, 12, "TimeoutError")
+QDEF(MP_QSTR_True, 5907, 4, "True")
+QDEF(MP_QSTR_UINT, 15651, 4, "UINT")
+QDEF(MP_QSTR_UINT16, 6084, 6, "UINT16")
+QDEF(MP_QSTR_UINT32, 6018, 6, "UINT32")
+QDEF(MP_QSTR_UINT64, 6241, 6, "UINT64")
+QDEF(MP_QSTR_UINT8, 57787, 5, "UINT8")
+QDEF(MP_QSTR_ULONG, 36218, 5, "ULONG")
+QDEF(MP_QSTR_ULONGLONG, 50800, 9, "ULONGLONG")
+QDEF(MP_QSTR_USHORT, 62626, 6, "USHORT")
+QDEF(MP_QSTR_UnicodeError, 53538, 12, "UnicodeError")
+QDEF(MP_QSTR_VOID, 62001, 4, "VOID")
+QDEF(MP_QSTR_VfsFat, 39701, 6, "VfsFat")
+QDEF(MP_QSTR_VfsPosix, 20155, 8, "VfsPosix")
+QDEF(MP_QSTR_ViperTypeError, 1501, 14, "ViperTypeError")
+QDEF(MP_QSTR___aenter__, 33868, 10, "__aenter__")
+QDEF(MP_QSTR___aexit__, 53188, 9, "__aexit__")
+QDEF(MP_QSTR___aiter__, 11086, 9, "__aiter__")
+QDEF(MP_QSTR___anext__, 46211, 9, "__anext__")
+QDEF(MP_QSTR___await__, 64079, 9, "__await__")
+QDEF(MP_QSTR___bases__, 12291, 9, "__bases__")
+QDEF(MP_QSTR___build_class__, 34882, 15, "__build_class__")
+QDEF(MP_QSTR___bytes__, 33244, 9, "__bytes__")
+QDEF(MP_QSTR___context__, 26234, 11, "__context__")
+QDEF(MP_QSTR___del__, 14184, 7, "__del__")
+QDEF(MP_QSTR___delattr__, 30555, 11, "__delattr__")
+QDEF(MP_QSTR___dict__, 21631, 8, "__dict__")
+QDEF(MP_QSTR___file__, 21507, 8, "__file__")
+QDEF(MP_QSTR___globals__, 44701, 11, "__globals__")
+QDEF(MP_QSTR___import__, 15928, 10, "__import__")
+QDEF(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF(MP_QSTR___repl_print__, 47872, 14, "__repl_print__")
+QDEF(MP_QSTR___reversed__, 65377, 12, "__reversed__")
+QDEF(MP_QSTR___setattr__, 6484, 11, "__setattr__")
+QDEF(MP_QSTR___traceback__, 53071, 13, "__traceback__")
+QDEF(MP_QSTR__asyncio, 18906, 8, "_asyncio")
+QDEF(MP_QSTR__machine, 19391, 8, "_machine")
+QDEF(MP_QSTR__mpy, 10590, 4, "_mpy")
+QDEF(MP_QSTR__task_queue, 50649, 11, "_task_queue")
+QDEF(MP_QSTR__thread, 724, 7, "_thread")
+QDEF(MP_QSTR_a2b_base64, 2876, 10, "a2b_base64")
+QDEF(MP_QSTR_abs_tol, 28029, 7, "abs_tol")
+QDEF(MP_QSTR_acos, 40987, 4, "acos")
+QDEF(MP_QSTR_acosh, 41747, 5, "acosh")
+QDEF(MP_QSTR_acquire, 54045, 7, "acquire")
+QDEF(MP_QSTR_add, 12868, 3, "add")
+QDEF(MP_QSTR_addressof, 63834, 9, "addressof")
+QDEF(MP_QSTR_allocate_lock, 60908, 13, "allocate_lock")
+QDEF(MP_QSTR_appendleft, 7856, 10, "appendleft")
+QDEF(MP_QSTR_argv, 50887, 4, "argv")
+QDEF(MP_QSTR_array, 29308, 5, "array")
+QDEF(MP_QSTR_asin, 58704, 4, "asin")
+QDEF(MP_QSTR_asinh, 36664, 5, "asinh")
+QDEF(MP_QSTR_atan, 48671, 4, "atan")
+QDEF(MP_QSTR_atan2, 33229, 5, "atan2")
+QDEF(MP_QSTR_atanh, 33175, 5, "atanh")
+QDEF(MP_QSTR_atexit, 39088, 6, "atexit")
+QDEF(MP_QSTR_b2a_base64, 36668, 10, "b2a_base64")
+QDEF(MP_QSTR_base, 18160, 4, "base")
+QDEF(MP_QSTR_big, 18665, 3, "big")
+QDEF(MP_QSTR_bin, 18656, 3, "bin")
+QDEF(MP_QSTR_binascii, 15505, 8, "binascii")
+QDEF(MP_QSTR_bit_length, 6841, 10, "bit_length")
+QDEF(MP_QSTR_bound_method, 41623, 12, "bound_method")
+QDEF(MP_QSTR_buffer, 41189, 6, "buffer")
+QDEF(MP_QSTR_buffering, 56101, 9, "buffering")
+QDEF(MP_QSTR_bytearray_at, 23708, 12, "bytearray_at")
+QDEF(MP_QSTR_byteorder, 39265, 9, "byteorder")
+QDEF(MP_QSTR_bytes_at, 23990, 8, "bytes_at")
+QDEF(MP_QSTR_calcsize, 14413, 8, "calcsize")
+QDEF(MP_QSTR_cancel, 34563, 6, "cancel")
+QDEF(MP_QSTR_cast, 49728, 4, "cast")
+QDEF(MP_QSTR_ceil, 45062, 4, "ceil")
+QDEF(MP_QSTR_center, 48974, 6, "center")
+QDEF(MP_QSTR_chdir, 45745, 5, "chdir")
+QDEF(MP_QSTR_choice, 13102, 6, "choice")
+QDEF(MP_QSTR_circuitpython, 15106, 13, "circuitpython")
+QDEF(MP_QSTR_clock, 25901, 5, "clock")
+QDEF(MP_QSTR_closure, 51828, 7, "closure")
+QDEF(MP_QSTR_cmath, 62646, 5, "cmath")
+QDEF(MP_QSTR_co_argcount, 44705, 11, "co_argcount")
+QDEF(MP_QSTR_co_cellvars, 64102, 11, "co_cellvars")
+QDEF(MP_QSTR_co_code, 20987, 7, "co_code")
+QDEF(MP_QSTR_co_consts, 928, 9, "co_consts")
+QDEF(MP_QSTR_co_filename, 7031, 11, "co_filename")
+QDEF(MP_QSTR_co_firstlineno, 23075, 14, "co_firstlineno")
+QDEF(MP_QSTR_co_flags, 43081, 8, "co_flags")
+QDEF(MP_QSTR_co_freevars, 19700, 11, "co_freevars")
+QDEF(MP_QSTR_co_kwonlyargcount, 21993, 17, "co_kwonlyargcount")
+QDEF(MP_QSTR_co_lnotab, 48140, 9, "co_lnotab")
+QDEF(MP_QSTR_co_name, 46001, 7, "co_name")
+QDEF(MP_QSTR_co_names, 10658, 8, "co_names")
+QDEF(MP_QSTR_co_nlocals, 56518, 10, "co_nlocals")
+QDEF(MP_QSTR_co_stacksize, 6781, 12, "co_stacksize")
+QDEF(MP_QSTR_co_varnames, 31111, 11, "co_varnames")
+QDEF(MP_QSTR_code, 55912, 4, "code")
+QDEF(MP_QSTR_collect, 26011, 7, "collect")
+QDEF(MP_QSTR_collections, 51424, 11, "collections")
+QDEF(MP_QSTR_compile, 51700, 7, "compile")
+QDEF(MP_QSTR_complex, 40389, 7, "complex")
+QDEF(MP_QSTR_copysign, 5171, 8, "copysign")
+QDEF(MP_QSTR_coro, 56244, 4, "coro")
+QDEF(MP_QSTR_coroutine, 32279, 9, "coroutine")
+QDEF(MP_QSTR_cos, 19578, 3, "cos")
+QDEF(MP_QSTR_cosh, 56274, 4, "cosh")
+QDEF(MP_QSTR_crc32, 59510, 5, "crc32")
+QDEF(MP_QSTR_cur_task, 11763, 8, "cur_task")
+QDEF(MP_QSTR_data, 56341, 4, "data")
+QDEF(MP_QSTR_decode, 22953, 6, "decode")
+QDEF(MP_QSTR_decompress, 64354, 10, "decompress")
+QDEF(MP_QSTR_default, 32206, 7, "default")
+QDEF(MP_QSTR_degrees, 16642, 7, "degrees")
+QDEF(MP_QSTR_delattr, 51419, 7, "delattr")
+QDEF(MP_QSTR_deleter, 56174, 7, "deleter")
+QDEF(MP_QSTR_deque, 39173, 5, "deque")
+QDEF(MP_QSTR_dict_view, 43309, 9, "dict_view")
+QDEF(MP_QSTR_difference, 9330, 10, "difference")
+QDEF(MP_QSTR_difference_update, 64156, 17, "difference_update")
+QDEF(MP_QSTR_digest, 50381, 6, "digest")
+QDEF(MP_QSTR_disable, 30353, 7, "disable")
+QDEF(MP_QSTR_discard, 28943, 7, "discard")
+QDEF(MP_QSTR_doc, 7981, 3, "doc")
+QDEF(MP_QSTR_done, 837, 4, "done")
+QDEF(MP_QSTR_dump, 12265, 4, "dump")
+QDEF(MP_QSTR_dumps, 11642, 5, "dumps")
+QDEF(MP_QSTR_e, 46528, 1, "e")
+QDEF(MP_QSTR_enable, 56836, 6, "enable")
+QDEF(MP_QSTR_encode, 51779, 6, "encode")
+QDEF(MP_QSTR_encoding, 39942, 8, "encoding")
+QDEF(MP_QSTR_enumerate, 47729, 9, "enumerate")
+QDEF(MP_QSTR_erf, 9108, 3, "erf")
+QDEF(MP_QSTR_erfc, 38519, 4, "erfc")
+QDEF(MP_QSTR_errno, 4545, 5, "errno")
+QDEF(MP_QSTR_errorcode, 56592, 9, "errorcode")
+QDEF(MP_QSTR_exc_info, 65290, 8, "exc_info")
+QDEF(MP_QSTR_execfile, 10328, 8, "execfile")
+QDEF(MP_QSTR_executable, 12821, 10, "executable")
+QDEF(MP_QSTR_exit, 48773, 4, "exit")
+QDEF(MP_QSTR_exp, 9416, 3, "exp")
+QDEF(MP_QSTR_expm1, 29300, 5, "expm1")
+QDEF(MP_QSTR_f_back, 18583, 6, "f_back")
+QDEF(MP_QSTR_f_builtins, 37518, 10, "f_builtins")
+QDEF(MP_QSTR_f_code, 33169, 6, "f_code")
+QDEF(MP_QSTR_f_globals, 7236, 9, "f_globals")
+QDEF(MP_QSTR_f_lasti, 5631, 7, "f_lasti")
+QDEF(MP_QSTR_f_lineno, 10227, 8, "f_lineno")
+QDEF(MP_QSTR_f_locals, 9410, 8, "f_locals")
+QDEF(MP_QSTR_f_trace, 54461, 7, "f_trace")
+QDEF(MP_QSTR_fabs, 4755, 4, "fabs")
+QDEF(MP_QSTR_factorial, 13004, 9, "factorial")
+QDEF(MP_QSTR_file, 13507, 4, "file")
+QDEF(MP_QSTR_file_digest, 32692, 11, "file_digest")
+QDEF(MP_QSTR_filename, 21732, 8, "filename")
+QDEF(MP_QSTR_filename2, 61782, 9, "filename2")
+QDEF(MP_QSTR_fileno, 30338, 6, "fileno")
+QDEF(MP_QSTR_filter, 48677, 6, "filter")
+QDEF(MP_QSTR_float, 17461, 5, "float")
+QDEF(MP_QSTR_floor, 18045, 5, "floor")
+QDEF(MP_QSTR_flush, 49505, 5, "flush")
+QDEF(MP_QSTR_fmod, 17637, 4, "fmod")
+QDEF(MP_QSTR_frame, 35448, 5, "frame")
+QDEF(MP_QSTR_frexp, 38940, 5, "frexp")
+QDEF(MP_QSTR_fromhex, 14598, 7, "fromhex")
+QDEF(MP_QSTR_fromkeys, 48439, 8, "fromkeys")
+QDEF(MP_QSTR_frozenset, 40173, 9, "frozenset")
+QDEF(MP_QSTR_function, 551, 8, "function")
+QDEF(MP_QSTR_gamma, 36866, 5, "gamma")
+QDEF(MP_QSTR_gc, 28257, 2, "gc")
+QDEF(MP_QSTR_generator, 50070, 9, "generator")
+QDEF(MP_QSTR_get_ident, 45566, 9, "get_ident")
+QDEF(MP_QSTR_getcwd, 53251, 6, "getcwd")
+QDEF(MP_QSTR_getenv, 64430, 6, "getenv")
+QDEF(MP_QSTR_getrandbits, 32102, 11, "getrandbits")
+QDEF(MP_QSTR_getter, 45712, 6, "getter")
+QDEF(MP_QSTR_getvalue, 44152, 8, "getvalue")
+QDEF(MP_QSTR_gmtime, 36442, 6, "gmtime")
+QDEF(MP_QSTR_group, 45242, 5, "group")
+QDEF(MP_QSTR_hashlib, 27920, 7, "hashlib")
+QDEF(MP_QSTR_heap_lock, 36013, 9, "heap_lock")
+QDEF(MP_QSTR_heap_unlock, 11606, 11, "heap_unlock")
+QDEF(MP_QSTR_heapify, 11695, 7, "heapify")
+QDEF(MP_QSTR_heappop, 10198, 7, "heappop")
+QDEF(MP_QSTR_heappush, 27527, 8, "heappush")
+QDEF(MP_QSTR_heapq, 7528, 5, "heapq")
+QDEF(MP_QSTR_help, 23700, 4, "help")
+QDEF(MP_QSTR_hex, 20592, 3, "hex")
+QDEF(MP_QSTR_hexlify, 32554, 7, "hexlify")
+QDEF(MP_QSTR_ilistdir, 27249, 8, "ilistdir")
+QDEF(MP_QSTR_imag, 46919, 4, "imag")
+QDEF(MP_QSTR_implementation, 11543, 14, "implementation")
+QDEF(MP_QSTR_indices, 18522, 7, "indices")
+QDEF(MP_QSTR_inf, 21252, 3, "inf")
+QDEF(MP_QSTR_input, 23155, 5, "input")
+QDEF(MP_QSTR_intersection, 10792, 12, "intersection")
+QDEF(MP_QSTR_intersection_update, 56582, 19, "intersection_update")
+QDEF(MP_QSTR_io, 28451, 2, "io")
+QDEF(MP_QSTR_ioctl, 49784, 5, "ioctl")
+QDEF(MP_QSTR_ipoll, 23891, 5, "ipoll")
+QDEF(MP_QSTR_isclose, 20041, 7, "isclose")
+QDEF(MP_QSTR_isdisjoint, 26871, 10, "isdisjoint")
+QDEF(MP_QSTR_isenabled, 58778, 9, "isenabled")
+QDEF(MP_QSTR_isfinite, 43942, 8, "isfinite")
+QDEF(MP_QSTR_isinf, 4414, 5, "isinf")
+QDEF(MP_QSTR_isnan, 926, 5, "isnan")
+QDEF(MP_QSTR_issubset, 49593, 8, "issubset")
+QDEF(MP_QSTR_issuperset, 60668, 10, "issuperset")
+QDEF(MP_QSTR_iterable, 37413, 8, "iterable")
+QDEF(MP_QSTR_iterator, 48711, 8, "iterator")
+QDEF(MP_QSTR_json, 53757, 4, "json")
+QDEF(MP_QSTR_kbd_intr, 5110, 8, "kbd_intr")
+QDEF(MP_QSTR_keepends, 35682, 8, "keepends")
+QDEF(MP_QSTR_label, 59203, 5, "label")
+QDEF(MP_QSTR_last, 16175, 4, "last")
+QDEF(MP_QSTR_ldexp, 28480, 5, "ldexp")
+QDEF(MP_QSTR_length, 34649, 6, "length")
+QDEF(MP_QSTR_lgamma, 27854, 6, "lgamma")
+QDEF(MP_QSTR_libc_ver, 47615, 8, "libc_ver")
+QDEF(MP_QSTR_listdir, 58264, 7, "listdir")
+QDEF(MP_QSTR_load, 9315, 4, "load")
+QDEF(MP_QSTR_loads, 45232, 5, "loads")
+QDEF(MP_QSTR_localtime, 18045, 9, "localtime")
+QDEF(MP_QSTR_lock, 9134, 4, "lock")
+QDEF(MP_QSTR_locked, 47631, 6, "locked")
+QDEF(MP_QSTR_log, 16161, 3, "log")
+QDEF(MP_QSTR_log10, 37184, 5, "log10")
+QDEF(MP_QSTR_log2, 9075, 4, "log2")
+QDEF(MP_QSTR_match, 8854, 5, "match")
+QDEF(MP_QSTR_math, 47925, 4, "math")
+QDEF(MP_QSTR_max, 17329, 3, "max")
+QDEF(MP_QSTR_maxsize, 28884, 7, "maxsize")
+QDEF(MP_QSTR_mem_alloc, 11090, 9, "mem_alloc")
+QDEF(MP_QSTR_mem_current, 47638, 11, "mem_current")
+QDEF(MP_QSTR_mem_free, 25291, 8, "mem_free")
+QDEF(MP_QSTR_mem_info, 61905, 8, "mem_info")
+QDEF(MP_QSTR_mem_peak, 9536, 8, "mem_peak")
+QDEF(MP_QSTR_mem_total, 27389, 9, "mem_total")
+QDEF(MP_QSTR_memoryview, 17513, 10, "memoryview")
+QDEF(MP_QSTR_min, 17071, 3, "min")
+QDEF(MP_QSTR_mkdir, 46492, 5, "mkdir")
+QDEF(MP_QSTR_mkfs, 45174, 4, "mkfs")
+QDEF(MP_QSTR_mktime, 11158, 6, "mktime")
+QDEF(MP_QSTR_mode, 49190, 4, "mode")
+QDEF(MP_QSTR_modf, 49189, 4, "modf")
+QDEF(MP_QSTR_modify, 26357, 6, "modify")
+QDEF(MP_QSTR_module, 39359, 6, "module")
+QDEF(MP_QSTR_modules, 53740, 7, "modules")
+QDEF(MP_QSTR_mount, 3496, 5, "mount")
+QDEF(MP_QSTR_move_to_end, 28640, 11, "move_to_end")
+QDEF(MP_QSTR_name, 30114, 4, "name")
+QDEF(MP_QSTR_namedtuple, 5662, 10, "namedtuple")
+QDEF(MP_QSTR_nan, 22756, 3, "nan")
+QDEF(MP_QSTR_native, 2948, 6, "native")
+QDEF(MP_QSTR_native_tier, 38705, 11, "native_tier")
+QDEF(MP_QSTR_newline, 35127, 7, "newline")
+QDEF(MP_QSTR_oct, 23805, 3, "oct")
+QDEF(MP_QSTR_opt_level, 26503, 9, "opt_level")
+QDEF(MP_QSTR_os, 28537, 2, "os")
+QDEF(MP_QSTR_pack, 53692, 4, "pack")
+QDEF(MP_QSTR_pack_into, 43295, 9, "pack_into")
+QDEF(MP_QSTR_partition, 58759, 9, "partition")
+QDEF(MP_QSTR_path, 52872, 4, "path")
+QDEF(MP_QSTR_peek, 49534, 4, "peek")
+QDEF(MP_QSTR_pend_throw, 29939, 10, "pend_throw")
+QDEF(MP_QSTR_ph_key, 6901, 6, "ph_key")
+QDEF(MP_QSTR_phase, 54634, 5, "phase")
+QDEF(MP_QSTR_pi, 28700, 2, "pi")
+QDEF(MP_QSTR_platform, 6458, 8, "platform")
+QDEF(MP_QSTR_polar, 3077, 5, "polar")
+QDEF(MP_QSTR_poll, 55706, 4, "poll")
+QDEF(MP_QSTR_pop_head, 10269, 8, "pop_head")
+QDEF(MP_QSTR_popleft, 39537, 7, "popleft")
+QDEF(MP_QSTR_preallocate, 7967, 11, "preallocate")
+QDEF(MP_QSTR_print_exception, 8732, 15, "print_exception")
+QDEF(MP_QSTR_property, 10690, 8, "property")
+QDEF(MP_QSTR_protocol_vfs, 16367, 12, "protocol_vfs")
+QDEF(MP_QSTR_ps1, 28919, 3, "ps1")
+QDEF(MP_QSTR_ps2, 28916, 3, "ps2")
+QDEF(MP_QSTR_ptr, 28755, 3, "ptr")
+QDEF(MP_QSTR_ptr16, 51956, 5, "ptr16")
+QDEF(MP_QSTR_ptr32, 51890, 5, "ptr32")
+QDEF(MP_QSTR_ptr8, 31371, 4, "ptr8")
+QDEF(MP_QSTR_push, 32443, 4, "push")
+QDEF(MP_QSTR_push_head, 7788, 9, "push_head")
+QDEF(MP_QSTR_push_sorted, 40991, 11, "push_sorted")
+QDEF(MP_QSTR_putenv, 27849, 6, "putenv")
+QDEF(MP_QSTR_python_compiler, 38285, 15, "python_compiler")
+QDEF(MP_QSTR_qstr_info, 33200, 9, "qstr_info")
+QDEF(MP_QSTR_r, 46551, 1, "r")
+QDEF(MP_QSTR_radians, 16263, 7, "radians")
+QDEF(MP_QSTR_randint, 56495, 7, "randint")
+QDEF(MP_QSTR_random, 11454, 6, "random")
+QDEF(MP_QSTR_randrange, 16035, 9, "randrange")
+QDEF(MP_QSTR_rb, 28885, 2, "rb")
+QDEF(MP_QSTR_re, 28882, 2, "re")
+QDEF(MP_QSTR_readblocks, 7213, 10, "readblocks")
+QDEF(MP_QSTR_readlines, 22890, 9, "readlines")
+QDEF(MP_QSTR_readonly, 35075, 8, "readonly")
+QDEF(MP_QSTR_real, 63935, 4, "real")
+QDEF(MP_QSTR_rect, 63973, 4, "rect")
+QDEF(MP_QSTR_register, 41388, 8, "register")
+QDEF(MP_QSTR_rel_tol, 18006, 7, "rel_tol")
+QDEF(MP_QSTR_release, 36844, 7, "release")
+QDEF(MP_QSTR_rename, 6197, 6, "rename")
+QDEF(MP_QSTR_reversed, 28321, 8, "reversed")
+QDEF(MP_QSTR_rmdir, 42821, 5, "rmdir")
+QDEF(MP_QSTR_rpartition, 53269, 10, "rpartition")
+QDEF(MP_QSTR_schedule, 44256, 8, "schedule")
+QDEF(MP_QSTR_search, 49579, 6, "search")
+QDEF(MP_QSTR_seed, 30098, 4, "seed")
+QDEF(MP_QSTR_seek, 30109, 4, "seek")
+QDEF(MP_QSTR_select, 16781, 6, "select")
+QDEF(MP_QSTR_separators, 3307, 10, "separators")
+QDEF(MP_QSTR_setter, 22788, 6, "setter")
+QDEF(MP_QSTR_sha256, 302, 6, "sha256")
+QDEF(MP_QSTR_signed, 311, 6, "signed")
+QDEF(MP_QSTR_sin, 37041, 3, "sin")
+QDEF(MP_QSTR_single, 8255, 6, "single")
+QDEF(MP_QSTR_sinh, 42681, 4, "sinh")
+QDEF(MP_QSTR_size, 42272, 4, "size")
+QDEF(MP_QSTR_sizeof, 29513, 6, "sizeof")
+QDEF(MP_QSTR_sleep, 10218, 5, "sleep")
+QDEF(MP_QSTR_sleep_ms, 25355, 8, "sleep_ms")
+QDEF(MP_QSTR_sleep_us, 24595, 8, "sleep_us")
+QDEF(MP_QSTR_slice, 62645, 5, "slice")
+QDEF(MP_QSTR_splitlines, 54122, 10, "splitlines")
+QDEF(MP_QSTR_sqrt, 17441, 4, "sqrt")
+QDEF(MP_QSTR_stack_size, 15153, 10, "stack_size")
+QDEF(MP_QSTR_stack_use, 63383, 9, "stack_use")
+QDEF(MP_QSTR_start_new_thread, 9687, 16, "start_new_thread")
+QDEF(MP_QSTR_stat, 13783, 4, "stat")
+QDEF(MP_QSTR_state, 61650, 5, "state")
+QDEF(MP_QSTR_statvfs, 6420, 7, "statvfs")
+QDEF(MP_QSTR_stderr, 22691, 6, "stderr")
+QDEF(MP_QSTR_stdin, 1057, 5, "stdin")
+QDEF(MP_QSTR_stdout, 33544, 6, "stdout")
+QDEF(MP_QSTR_strerror, 29000, 8, "strerror")
+QDEF(MP_QSTR_struct, 36882, 6, "struct")
+QDEF(MP_QSTR_sub, 36129, 3, "sub")
+QDEF(MP_QSTR_symmetric_difference, 26574, 20, "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, 63584, 27, "symmetric_difference_update")
+QDEF(MP_QSTR_sync, 25250, 4, "sync")
+QDEF(MP_QSTR_sys, 36540, 3, "sys")
+QDEF(MP_QSTR_system, 5280, 6, "system")
+QDEF(MP_QSTR_tan, 25086, 3, "tan")
+QDEF(MP_QSTR_tanh, 41430, 4, "tanh")
+QDEF(MP_QSTR_tau, 25061, 3, "tau")
+QDEF(MP_QSTR_tb_frame, 60721, 8, "tb_frame")
+QDEF(MP_QSTR_tb_lasti, 59823, 8, "tb_lasti")
+QDEF(MP_QSTR_tb_lineno, 53027, 9, "tb_lineno")
+QDEF(MP_QSTR_tb_next, 5355, 7, "tb_next")
+QDEF(MP_QSTR_tell, 45332, 4, "tell")
+QDEF(MP_QSTR_threshold, 12274, 9, "threshold")
+QDEF(MP_QSTR_ticks_add, 44701, 9, "ticks_add")
+QDEF(MP_QSTR_ticks_cpu, 42266, 9, "ticks_cpu")
+QDEF(MP_QSTR_ticks_diff, 57521, 10, "ticks_diff")
+QDEF(MP_QSTR_ticks_ms, 12866, 8, "ticks_ms")
+QDEF(MP_QSTR_ticks_us, 12634, 8, "ticks_us")
+QDEF(MP_QSTR_time, 49648, 4, "time")
+QDEF(MP_QSTR_time_ns, 45682, 7, "time_ns")
+QDEF(MP_QSTR_traceback, 45775, 9, "traceback")
+QDEF(MP_QSTR_trunc, 39259, 5, "trunc")
+QDEF(MP_QSTR_uctypes, 29176, 7, "uctypes")
+QDEF(MP_QSTR_uint, 15843, 4, "uint")
+QDEF(MP_QSTR_umount, 40669, 6, "umount")
+QDEF(MP_QSTR_unhexlify, 47537, 9, "unhexlify")
+QDEF(MP_QSTR_uniform, 62721, 7, "uniform")
+QDEF(MP_QSTR_union, 31990, 5, "union")
+QDEF(MP_QSTR_unlink, 36862, 6, "unlink")
+QDEF(MP_QSTR_unpack, 15367, 6, "unpack")
+QDEF(MP_QSTR_unpack_from, 27918, 11, "unpack_from")
+QDEF(MP_QSTR_unregister, 54295, 10, "unregister")
+QDEF(MP_QSTR_unsetenv, 18049, 8, "unsetenv")
+QDEF(MP_QSTR_urandom, 44715, 7, "urandom")
+QDEF(MP_QSTR_usys, 62409, 4, "usys")
+QDEF(MP_QSTR_utime, 40421, 5, "utime")
+QDEF(MP_QSTR_uzlib, 39789, 5, "uzlib")
+QDEF(MP_QSTR_version, 54207, 7, "version")
+QDEF(MP_QSTR_version_info, 2670, 12, "version_info")
+QDEF(MP_QSTR_viper, 9053, 5, "viper")
+QDEF(MP_QSTR_writeblocks, 57090, 11, "writeblocks")
+QDEF(MP_QSTR_zlib, 14328, 4, "zlib")
+// Enumerate translated texts but don't actually include translations. Instead, the linker will link them in.
+TRANSLATION("  File \"%q\", line %d", 0)
+TRANSLATION(" is of type %q\n", 1)
+TRANSLATION("%%c requires int or char", 2)
+TRANSLATION("%q in %q must be of type %q, not %q", 3)
+TRANSLATION("%q index out of range", 4)
+TRANSLATION("%q indices must be integers, not %s", 5)
+TRANSLATION("%q length must be %d", 6)
+TRANSLATION("%q length must be %d-%d", 7)
+TRANSLATION("%q length must be <= %d", 8)
+TRANSLATION("%q length must be >= %d", 9)
+TRANSLATION("%q must be %d", 10)
+TRANSLATION("%q must be %d-%d", 11)
+TRANSLATION("%q must be <= %d", 12)
+TRANSLATION("%q must be >= %d", 13)
+TRANSLATION("%q must be of type %q or %q, not %q", 14)
+TRANSLATION("%q must be of type %q, not %q", 15)
+TRANSLATION("%q out of range", 16)
+TRANSLATION("%q step cannot be zero", 17)
+TRANSLATION("%q() takes %d positional arguments but %d were given", 18)
+TRANSLATION("%q=%q", 19)
+TRANSLATION("%s", 20)
+TRANSLATION("'%q' argument required", 21)
+TRANSLATION("'%q' object does not support '%q'", 22)
+TRANSLATION("'%q' object is not an iterator", 23)
+TRANSLATION("'%q' object is not callable", 24)
+TRANSLATION("'%q' object is not iterable", 25)
+TRANSLATION("'%s' object doesn't support item assignment", 26)
+TRANSLATION("'%s' object doesn't support item deletion", 27)
+TRANSLATION("'%s' object has no attribute '%q'", 28)
+TRANSLATION("'%s' object isn't subscriptable", 29)
+TRANSLATION("'=' alignment not allowed in string format specifier", 30)
+TRANSLATION("'await' outside function", 31)
+TRANSLATION("'break'/'continue' outside loop", 32)
+TRANSLATION("'return' outside function", 33)
+TRANSLATION("'yield from' inside async function", 34)
+TRANSLATION("'yield' outside function", 35)
+TRANSLATION("* arg after **", 36)
+TRANSLATION("*x must be assignment target", 37)
+TRANSLATION(", in %q\n", 38)
+TRANSLATION("0.0 to a complex power", 39)
+TRANSLATION("Call super().__init__() before accessing native object.", 40)
+TRANSLATION("Cannot subclass slice", 41)
+TRANSLATION("Error in regex", 42)
+TRANSLATION("File exists", 43)
+TRANSLATION("I/O operation on closed file", 44)
+TRANSLATION("Input/output error", 45)
+TRANSLATION("Invalid %q", 46)
+TRANSLATION("Invalid argument", 47)
+TRANSLATION("LHS of keyword arg must be an id", 48)
+TRANSLATION("Name too long", 49)
+TRANSLATION("No space left on device", 50)
+TRANSLATION("No such device", 51)
+TRANSLATION("No such file/directory", 52)
+TRANSLATION("Operation not permitted", 53)
+TRANSLATION("Permission denied", 54)
+TRANSLATION("Plus any modules on the filesystem\n", 55)
+TRANSLATION("Read-only filesystem", 56)
+TRANSLATION("Traceback (most recent call last):\n", 57)
+TRANSLATION("Unable to init parser", 58)
+TRANSLATION("Welcome to Adafruit CircuitPython %s!\n\nVisit circuitpython.org for more information.\n\nTo list built-in modules type `help(\"modules\")`.\n", 59)
+TRANSLATION("__init__() should return None, not '%s'", 60)
+TRANSLATION("__new__ arg must be a user-type", 61)
+TRANSLATION("a bytes-like object is required", 62)
+TRANSLATION("abort() called", 63)
+TRANSLATION("annotation must be an identifier", 64)
+TRANSLATION("arg is an empty sequence", 65)
+TRANSLATION("arg must be user-type", 66)
+TRANSLATION("argument name reused", 67)
+TRANSLATION("array/bytes required on right side", 68)
+TRANSLATION("async for/with outside async function", 69)
+TRANSLATION("attributes not supported", 70)
+TRANSLATION("bad compile mode", 71)
+TRANSLATION("bad typecode", 72)
+TRANSLATION("binary op %q not implemented", 73)
+TRANSLATION("bits must be 32 or less", 74)
+TRANSLATION("buffer too small", 75)
+TRANSLATION("bytecode overflow", 76)
+TRANSLATION("bytes length not a multiple of item size", 77)
+TRANSLATION("bytes value out of range", 78)
+TRANSLATION("can't add special method to already-subclassed class", 79)
+TRANSLATION("can't assign to expression", 80)
+TRANSLATION("can't cancel self", 81)
+TRANSLATION("can't convert %s to complex", 82)
+TRANSLATION("can't convert %s to float", 83)
+TRANSLATION("can't convert %s to int", 84)
+TRANSLATION("can't convert '%q' object to %q implicitly", 85)
+TRANSLATION("can't declare nonlocal in outer code", 86)
+TRANSLATION("can't delete expression", 87)
+TRANSLATION("can't do binary op between '%q' and '%q'", 88)
+TRANSLATION("can't implicitly convert '%q' to 'bool'", 89)
+TRANSLATION("can't import name %q", 90)
+TRANSLATION("can't load from '%q'", 91)
+TRANSLATION("can't load with '%q' index", 92)
+TRANSLATION("can't perform relative import", 93)
+TRANSLATION("can't send non-None value to a just-started generator", 94)
+TRANSLATION("can't set attribute", 95)
+TRANSLATION("can't set attribute '%q'", 96)
+TRANSLATION("can't store '%q'", 97)
+TRANSLATION("can't store to '%q'", 98)
+TRANSLATION("can't store with '%q' index", 99)
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 100)
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 101)
+TRANSLATION("can't truncate-divide a complex number", 102)
+TRANSLATION("can't unambiguously get sizeof scalar", 103)
+TRANSLATION("can't wait", 104)
+TRANSLATION("cannot create '%q' instances", 105)
+TRANSLATION("casting", 106)
+TRANSLATION("chr() arg not in range(0x110000)", 107)
+TRANSLATION("comparison of int and uint", 108)
+TRANSLATION("complex divide by zero", 109)
+TRANSLATION("compression header", 110)
+TRANSLATION("conversion to object", 111)
+TRANSLATION("default 'except' must be last", 112)
+TRANSLATION("dict update sequence has wrong length", 113)
+TRANSLATION("div/mod not implemented for uint", 114)
+TRANSLATION("division by zero", 115)
+TRANSLATION("empty", 116)
+TRANSLATION("empty heap", 117)
+TRANSLATION("empty separator", 118)
+TRANSLATION("end of format while looking for conversion specifier", 119)
+TRANSLATION("exceptions must derive from BaseException", 120)
+TRANSLATION("expected ':' after format specifier", 121)
+TRANSLATION("expecting a dict for keyword args", 122)
+TRANSLATION("expecting just a value for set", 123)
+TRANSLATION("expecting key:value for dict", 124)
+TRANSLATION("extra keyword arguments given", 125)
+TRANSLATION("extra positional arguments given", 126)
+TRANSLATION("first argument to super() must be type", 127)
+TRANSLATION("format requires a dict", 128)
+TRANSLATION("full", 129)
+TRANSLATION("function doesn't take keyword arguments", 130)
+TRANSLATION("function expected at most %d arguments, got %d", 131)
+TRANSLATION("function got multiple values for argument '%q'", 132)
+TRANSLATION("function missing %d required positional arguments", 133)
+TRANSLATION("function missing keyword-only argument", 134)
+TRANSLATION("function missing required keyword argument '%q'", 135)
+TRANSLATION("function missing required positional argument #%d", 136)
+TRANSLATION("function takes %d positional arguments but %d were given", 137)
+TRANSLATION("generator already executing", 138)
+TRANSLATION("generator ignored GeneratorExit", 139)
+TRANSLATION("generator raised StopIteration", 140)
+TRANSLATION("heap must be a list", 141)
+TRANSLATION("identifier redefined as global", 142)
+TRANSLATION("identifier redefined as nonlocal", 143)
+TRANSLATION("import * not at module level", 144)
+TRANSLATION("incompatible .mpy arch", 145)
+TRANSLATION("incompatible .mpy file", 146)
+TRANSLATION("incomplete format", 147)
+TRANSLATION("incomplete format key", 148)
+TRANSLATION("incorrect padding", 149)
+TRANSLATION("invalid format specifier", 150)
+TRANSLATION("invalid micropython decorator", 151)
+TRANSLATION("invalid mktime usage", 152)
+TRANSLATION("invalid syntax", 153)
+TRANSLATION("invalid syntax for number", 154)
+TRANSLATION("issubclass() arg 1 must be a class", 155)
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 156)
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 157)
+TRANSLATION("keyword argument(s) not implemented - use normal args instead", 158)
+TRANSLATION("lhs and rhs should be compatible", 159)
+TRANSLATION("local '%q' has type '%q' but source is '%q'", 160)
+TRANSLATION("local '%q' used before type known", 161)
+TRANSLATION("local variable referenced before assignment", 162)
+TRANSLATION("malformed f-string", 163)
+TRANSLATION("math domain error", 164)
+TRANSLATION("maximum recursion depth exceeded", 165)
+TRANSLATION("memory allocation failed, allocating %u bytes", 166)
+TRANSLATION("memory allocation failed, heap is locked", 167)
+TRANSLATION("memoryview offset too large", 168)
+TRANSLATION("memoryview: length is not a multiple of itemsize", 169)
+TRANSLATION("mktime needs a tuple of length 8 or 9", 170)
+TRANSLATION("multiple *x in assignment", 171)
+TRANSLATION("multiple bases have instance lay-out conflict", 172)
+TRANSLATION("must raise an object", 173)
+TRANSLATION("must use keyword argument for key function", 174)
+TRANSLATION("name '%q' is not defined", 175)
+TRANSLATION("native code in .mpy unsupported", 176)
+TRANSLATION("native yield", 177)
+TRANSLATION("need more than %d values to unpack", 178)
+TRANSLATION("negative factorial", 179)
+TRANSLATION("negative shift count", 180)
+TRANSLATION("no active exception to reraise", 181)
+TRANSLATION("no binding for nonlocal found", 182)
+TRANSLATION("no module named '%q'", 183)
+TRANSLATION("no such attribute", 184)
+TRANSLATION("non-default argument follows default argument", 185)
+TRANSLATION("non-hex digit found", 186)
+TRANSLATION("not a constant", 187)
+TRANSLATION("not all arguments converted during string formatting", 188)
+TRANSLATION("not enough arguments for format string", 189)
+TRANSLATION("object ", 190)
+TRANSLATION("object '%s' isn't a tuple or list", 191)
+TRANSLATION("object not in sequence", 192)
+TRANSLATION("object of type '%s' has no len()", 193)
+TRANSLATION("object with buffer protocol required", 194)
+TRANSLATION("odd-length string", 195)
+TRANSLATION("only slices with step=1 (aka None) are supported", 196)
+TRANSLATION("opcode", 197)
+TRANSLATION("ord() expected a character, but string of length %d found", 198)
+TRANSLATION("overflow converting long int to machine word", 199)
+TRANSLATION("pack expected %d items for packing (got %d)", 200)
+TRANSLATION("pop from empty %q", 201)
+TRANSLATION("positional arg after **", 202)
+TRANSLATION("positional arg after keyword arg", 203)
+TRANSLATION("pow() 3rd argument cannot be 0", 204)
+TRANSLATION("pow() with 3 arguments requires integers", 205)
+TRANSLATION("raw f-strings are not supported", 206)
+TRANSLATION("requested length %d but object has length %d", 207)
+TRANSLATION("return expected '%q' but got '%q'", 208)
+TRANSLATION("rsplit(None,n)", 209)
+TRANSLATION("schedule queue full", 210)
+TRANSLATION("sign not allowed in string format specifier", 211)
+TRANSLATION("sign not allowed with integer format specifier 'c'", 212)
+TRANSLATION("small int overflow", 213)
+TRANSLATION("splitting with sub-captures", 214)
+TRANSLATION("start/end indices", 215)
+TRANSLATION("stream operation not supported", 216)
+TRANSLATION("string argument without an encoding", 217)
+TRANSLATION("string index out of range", 218)
+TRANSLATION("string indices must be integers, not %s", 219)
+TRANSLATION("struct: can't index", 220)
+TRANSLATION("struct: index out of range", 221)
+TRANSLATION("struct: no fields", 222)
+TRANSLATION("substring not found", 223)
+TRANSLATION("super() can't find self", 224)
+TRANSLATION("syntax error in JSON", 225)
+TRANSLATION("syntax error in uctypes descriptor", 226)
+TRANSLATION("ticks interval overflow", 227)
+TRANSLATION("too many args", 228)
+TRANSLATION("too many values to unpack (expected %d)", 229)
+TRANSLATION("type '%q' is not an acceptable base type", 230)
+TRANSLATION("type object '%q' has no attribute '%q'", 231)
+TRANSLATION("type takes 1 or 3 arguments", 232)
+TRANSLATION("unary op %q not implemented", 233)
+TRANSLATION("unexpected indent", 234)
+TRANSLATION("unexpected keyword argument '%q'", 235)
+TRANSLATION("unicode name escapes", 236)
+TRANSLATION("unindent doesn't match any outer indent level", 237)
+TRANSLATION("unknown conversion specifier %c", 238)
+TRANSLATION("unknown format code '%c' for object of type '%q'", 239)
+TRANSLATION("unknown type '%q'", 240)
+TRANSLATION("unmatched '%c' in format", 241)
+TRANSLATION("unreadable attribute", 242)
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 243)
+TRANSLATION("unsupported type for %q: '%s'", 244)
+TRANSLATION("unsupported types for %q: '%q', '%q'", 245)
+TRANSLATION("value must fit in %d byte(s)", 246)
+TRANSLATION("wrong number of arguments", 247)
+
+// 4793 bytes worth of qstr
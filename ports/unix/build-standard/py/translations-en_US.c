@@ -0,0 +1,255 @@
+// This file was automatically generated by maketranslatedata.py
+#include "supervisor/shared/translate/compressed_string.h"
+
+const struct compressed_string translation0 = { .data = 20, .tail = { 3, 253, 146, 198, 63, 150, 156, 255, 47, 144, 178, 41, 141, 42 } }; //   File \"%q\", line %d
+const struct compressed_string translation1 = { .data = 16, .tail = { 9, 1, 183, 19, 214, 12, 105, 207, 231, 249, 0 } }; //  is of type %q\n
+const struct compressed_string translation2 = { .data = 24, .tail = { 211, 74, 7, 62, 114, 142, 112, 17, 100, 51, 138, 118, 39 } }; // %%c requires int or char
+const struct compressed_string translation3 = { .data = 35, .tail = { 211, 144, 138, 52, 228, 95, 49, 35, 99, 13, 184, 158, 176, 99, 78, 126, 65, 90, 70, 156, 128 } }; // %q in %q must be of type %q, not %q
+const struct compressed_string translation4 = { .data = 21, .tail = { 211, 144, 139, 83, 242, 27, 50, 27, 112, 228, 188, 24 } }; // %q index out of range
+const struct compressed_string translation5 = { .data = 35, .tail = { 211, 144, 139, 84, 161, 192, 190, 98, 70, 198, 17, 100, 248, 55, 143, 144, 86, 145, 164, 0 } }; // %q indices must be integers, not %s
+const struct compressed_string translation6 = { .data = 20, .tail = { 211, 145, 99, 94, 39, 176, 190, 98, 70, 198, 52, 168 } }; // %q length must be %d
+const struct compressed_string translation7 = { .data = 23, .tail = { 211, 145, 99, 94, 39, 176, 190, 98, 70, 198, 52, 175, 182, 149 } }; // %q length must be %d-%d
+const struct compressed_string translation8 = { .data = 23, .tail = { 211, 145, 99, 94, 39, 176, 190, 98, 70, 198, 63, 211, 246, 26, 84 } }; // %q length must be <= %d
+const struct compressed_string translation9 = { .data = 23, .tail = { 211, 145, 99, 94, 39, 176, 190, 98, 70, 198, 63, 215, 246, 26, 84 } }; // %q length must be >= %d
+const struct compressed_string translation10 = { .data = 13, .tail = { 211, 145, 124, 196, 141, 140, 105, 80 } }; // %q must be %d
+const struct compressed_string translation11 = { .data = 16, .tail = { 211, 145, 124, 196, 141, 140, 105, 95, 109, 42 } }; // %q must be %d-%d
+const struct compressed_string translation12 = { .data = 16, .tail = { 211, 145, 124, 196, 141, 140, 127, 167, 236, 52, 168 } }; // %q must be <= %d
+const struct compressed_string translation13 = { .data = 16, .tail = { 211, 145, 124, 196, 141, 140, 127, 175, 236, 52, 168 } }; // %q must be >= %d
+const struct compressed_string translation14 = { .data = 35, .tail = { 211, 145, 124, 196, 141, 140, 54, 226, 122, 193, 141, 57, 12, 227, 78, 126, 65, 90, 70, 156, 128 } }; // %q must be of type %q or %q, not %q
+const struct compressed_string translation15 = { .data = 29, .tail = { 211, 145, 124, 196, 141, 140, 54, 226, 122, 193, 141, 57, 249, 5, 105, 26, 114 } }; // %q must be of type %q, not %q
+const struct compressed_string translation16 = { .data = 15, .tail = { 211, 144, 217, 144, 219, 135, 37, 224, 192 } }; // %q out of range
+const struct compressed_string translation17 = { .data = 22, .tail = { 211, 145, 18, 120, 20, 37, 86, 145, 177, 143, 224, 221, 128 } }; // %q step cannot be zero
+const struct compressed_string translation18 = { .data = 52, .tail = { 211, 159, 79, 81, 37, 240, 112, 52, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192, 219, 50, 52, 168, 240, 110, 99, 132, 238, 106 } }; // %q() takes %d positional arguments but %d were given
+const struct compressed_string translation19 = { .data = 5, .tail = { 211, 159, 219, 78, 64 } }; // %q=%q
+const struct compressed_string translation20 = { .data = 2, .tail = { 210, 0 } }; // %s
+const struct compressed_string translation21 = { .data = 22, .tail = { 215, 78, 117, 4, 252, 102, 230, 178, 28, 249, 202, 57, 212 } }; // '%q' argument required
+const struct compressed_string translation22 = { .data = 33, .tail = { 215, 78, 117, 13, 183, 185, 210, 69, 88, 224, 43, 72, 140, 227, 12, 242, 53, 211, 157, 64 } }; // '%q' object does not support '%q'
+const struct compressed_string translation23 = { .data = 30, .tail = { 215, 78, 117, 13, 183, 185, 210, 66, 64, 86, 144, 74, 18, 77, 202, 89, 192 } }; // '%q' object is not an iterator
+const struct compressed_string translation24 = { .data = 27, .tail = { 215, 78, 117, 13, 183, 185, 210, 66, 64, 86, 145, 66, 181, 139, 107, 24 } }; // '%q' object is not callable
+const struct compressed_string translation25 = { .data = 27, .tail = { 215, 78, 117, 13, 183, 185, 210, 66, 64, 86, 144, 146, 110, 91, 88, 192 } }; // '%q' object is not iterable
+const struct compressed_string translation26 = { .data = 43, .tail = { 215, 72, 212, 54, 222, 231, 73, 21, 99, 133, 214, 68, 103, 24, 103, 144, 146, 119, 5, 16, 156, 45, 205, 100 } }; // '%s' object doesn't support item assignment
+const struct compressed_string translation27 = { .data = 41, .tail = { 215, 72, 212, 54, 222, 231, 73, 21, 99, 133, 214, 68, 103, 24, 103, 144, 146, 119, 21, 59, 28, 163, 40 } }; // '%s' object doesn't support item deletion
+const struct compressed_string translation28 = { .data = 33, .tail = { 215, 72, 212, 54, 222, 231, 73, 29, 138, 2, 176, 41, 151, 77, 179, 38, 53, 211, 157, 64 } }; // '%s' object has no attribute '%q'
+const struct compressed_string translation29 = { .data = 31, .tail = { 215, 72, 212, 54, 222, 231, 73, 9, 11, 172, 136, 206, 209, 71, 76, 73, 109, 99 } }; // '%s' object isn't subscriptable
+const struct compressed_string translation30 = { .data = 52, .tail = { 215, 246, 212, 21, 147, 133, 185, 172, 133, 105, 5, 107, 55, 131, 168, 69, 17, 46, 139, 192, 221, 158, 229, 34, 48, 116, 77, 208, 220 } }; // '=' alignment not allowed in string format specifier
+const struct compressed_string translation31 = { .data = 24, .tail = { 212, 188, 18, 78, 161, 179, 48, 149, 49, 190, 86, 146, 140, 160 } }; // 'await' outside function
+const struct compressed_string translation32 = { .data = 31, .tail = { 215, 103, 50, 248, 215, 233, 173, 25, 101, 23, 39, 168, 108, 204, 37, 76, 89, 155, 0 } }; // 'break'/'continue' outside loop
+const struct compressed_string translation33 = { .data = 25, .tail = { 213, 206, 114, 235, 168, 108, 204, 37, 76, 111, 149, 164, 163, 40 } }; // 'return' outside function
+const struct compressed_string translation34 = { .data = 34, .tail = { 215, 164, 59, 84, 110, 237, 125, 66, 44, 37, 76, 20, 116, 180, 27, 229, 105, 40, 202 } }; // 'yield from' inside async function
+const struct compressed_string translation35 = { .data = 24, .tail = { 215, 164, 59, 87, 80, 217, 152, 74, 152, 223, 43, 73, 70, 80 } }; // 'yield' outside function
+const struct compressed_string translation36 = { .data = 14, .tail = { 253, 1, 63, 0, 183, 147, 113, 250, 126, 128 } }; // * arg after **
+const struct compressed_string translation37 = { .data = 28, .tail = { 253, 60, 139, 230, 36, 108, 96, 162, 19, 133, 185, 172, 137, 39, 224, 228 } }; // *x must be assignment target
+const struct compressed_string translation38 = { .data = 9, .tail = { 249, 4, 81, 167, 63, 159, 228 } }; // , in %q\n
+const struct compressed_string translation39 = { .data = 22, .tail = { 250, 252, 254, 162, 88, 16, 163, 95, 22, 63, 35, 13, 224, 220 } }; // 0.0 to a complex power
+const struct compressed_string translation40 = { .data = 55, .tail = { 254, 133, 107, 8, 206, 13, 253, 61, 126, 127, 143, 194, 42, 79, 227, 241, 233, 234, 54, 61, 217, 204, 21, 40, 113, 8, 188, 5, 41, 78, 230, 27, 111, 115, 164, 252, 192 } }; // Call super().__init__() before accessing native object.
+const struct compressed_string translation41 = { .data = 21, .tail = { 254, 132, 170, 210, 35, 59, 82, 197, 16, 34, 201, 67 } }; // Cannot subclass slice
+const struct compressed_string translation42 = { .data = 14, .tail = { 254, 174, 236, 225, 20, 57, 240, 126, 64 } }; // Error in regex
+const struct compressed_string translation43 = { .data = 11, .tail = { 255, 100, 177, 131, 242, 145, 48 } }; // File exists
+const struct compressed_string translation44 = { .data = 28, .tail = { 253, 254, 159, 216, 54, 13, 202, 81, 148, 50, 138, 89, 160, 234, 55, 75, 24 } }; // I/O operation on closed file
+const struct compressed_string translation45 = { .data = 18, .tail = { 253, 215, 25, 159, 163, 102, 113, 153, 6, 238, 206 } }; // Input/output error
+const struct compressed_string translation46 = { .data = 10, .tail = { 253, 215, 185, 89, 42, 52, 228 } }; // Invalid %q
+const struct compressed_string translation47 = { .data = 16, .tail = { 253, 215, 185, 89, 42, 9, 248, 205, 205, 100 } }; // Invalid argument
+const struct compressed_string translation48 = { .data = 32, .tail = { 255, 223, 254, 191, 192, 109, 199, 193, 245, 225, 158, 160, 159, 129, 124, 196, 141, 140, 18, 132, 168 } }; // LHS of keyword arg must be an id
+const struct compressed_string translation49 = { .data = 13, .tail = { 251, 149, 204, 75, 48, 179, 47, 0 } }; // Name too long
+const struct compressed_string translation50 = { .data = 23, .tail = { 251, 176, 140, 21, 12, 88, 247, 144, 202, 42, 125, 210, 134 } }; // No space left on device
+const struct compressed_string translation51 = { .data = 14, .tail = { 251, 176, 140, 211, 176, 169, 247, 74, 24 } }; // No such device
+const struct compressed_string translation52 = { .data = 22, .tail = { 251, 176, 140, 211, 176, 221, 44, 127, 74, 163, 157, 37, 159, 160 } }; // No such file/directory
+const struct compressed_string translation53 = { .data = 23, .tail = { 254, 216, 55, 41, 70, 80, 173, 35, 6, 247, 73, 147, 168 } }; // Operation not permitted
+const struct compressed_string translation54 = { .data = 17, .tail = { 254, 230, 247, 72, 132, 101, 21, 53, 67, 168 } }; // Permission denied
+const struct compressed_string translation55 = { .data = 36, .tail = { 254, 246, 204, 2, 94, 133, 218, 185, 177, 192, 101, 19, 216, 198, 233, 99, 142, 162, 78, 255, 159, 228 } }; // Plus any modules on the filesystem\n
+const struct compressed_string translation56 = { .data = 20, .tail = { 255, 225, 149, 125, 153, 109, 208, 221, 44, 113, 212, 73, 220 } }; // Read-only filesystem
+const struct compressed_string translation57 = { .data = 36, .tail = { 255, 135, 42, 30, 197, 79, 129, 233, 118, 137, 14, 116, 53, 145, 66, 181, 133, 138, 39, 215, 237, 249, 254, 64 } }; // Traceback (most recent call last):\n
+const struct compressed_string translation58 = { .data = 21, .tail = { 255, 234, 150, 214, 49, 44, 17, 82, 70, 9, 224, 220 } }; // Unable to init parser
+const struct compressed_string translation59 = { .data = 140, .tail = { 255, 249, 218, 141, 115, 18, 195, 254, 245, 45, 223, 41, 35, 250, 35, 211, 41, 63, 223, 169, 236, 202, 52, 143, 250, 126, 127, 151, 231, 249, 127, 249, 33, 36, 81, 30, 153, 73, 199, 83, 217, 151, 230, 207, 192, 221, 156, 93, 156, 194, 46, 236, 247, 41, 70, 95, 159, 231, 249, 126, 127, 151, 252, 48, 178, 68, 141, 178, 150, 159, 100, 81, 118, 174, 108, 112, 39, 172, 24, 255, 158, 199, 108, 122, 127, 43, 181, 115, 99, 143, 229, 235, 255, 63, 63, 207, 242 } }; // Welcome to Adafruit CircuitPython %s!\n\nVisit circuitpython.org for more information.\n\nTo list built-in modules type `help(\"modules\")`.\n
+const struct compressed_string translation60 = { .data = 39, .tail = { 252, 126, 17, 82, 127, 31, 143, 79, 81, 29, 155, 54, 168, 115, 156, 186, 143, 187, 41, 252, 130, 180, 141, 116, 141, 64 } }; // __init__() should return None, not '%s'
+const struct compressed_string translation61 = { .data = 31, .tail = { 252, 126, 20, 252, 126, 63, 0, 159, 129, 124, 196, 141, 140, 16, 204, 27, 251, 79, 88, 48 } }; // __new__ arg must be a user-type
+const struct compressed_string translation62 = { .data = 31, .tail = { 33, 183, 82, 113, 237, 100, 248, 48, 219, 123, 157, 36, 36, 7, 62, 114, 142, 117 } }; // a bytes-like object is required
+const struct compressed_string translation63 = { .data = 14, .tail = { 45, 153, 231, 211, 212, 80, 173, 99, 168 } }; // abort() called
+const struct compressed_string translation64 = { .data = 32, .tail = { 37, 86, 146, 148, 101, 23, 204, 72, 216, 193, 40, 74, 154, 202, 110, 134, 224 } }; // annotation must be an identifier
+const struct compressed_string translation65 = { .data = 24, .tail = { 39, 224, 36, 2, 80, 119, 196, 244, 32, 249, 201, 173, 12 } }; // arg is an empty sequence
+const struct compressed_string translation66 = { .data = 21, .tail = { 39, 224, 95, 49, 35, 99, 25, 131, 127, 105, 235, 6 } }; // arg must be user-type
+const struct compressed_string translation67 = { .data = 20, .tail = { 39, 227, 55, 53, 144, 165, 115, 14, 121, 131, 168 } }; // argument name reused
+const struct compressed_string translation68 = { .data = 34, .tail = { 39, 114, 235, 233, 183, 82, 112, 28, 249, 202, 57, 212, 50, 135, 78, 59, 72, 132, 169, 128 } }; // array/bytes required on right side
+const struct compressed_string translation69 = { .data = 37, .tail = { 40, 233, 104, 55, 103, 250, 120, 73, 236, 27, 51, 9, 83, 5, 29, 45, 6, 249, 90, 74, 50, 128 } }; // async for/with outside async function
+const struct compressed_string translation70 = { .data = 24, .tail = { 41, 151, 77, 179, 39, 1, 90, 68, 103, 24, 103, 147, 168 } }; // attributes not supported
+const struct compressed_string translation71 = { .data = 16, .tail = { 216, 170, 40, 215, 194, 88, 197, 218, 166 } }; // bad compile mode
+const struct compressed_string translation72 = { .data = 12, .tail = { 216, 170, 39, 172, 29, 26, 166 } }; // bad typecode
+const struct compressed_string translation73 = { .data = 28, .tail = { 217, 20, 159, 160, 216, 26, 114, 21, 164, 37, 241, 99, 185, 172, 157, 64 } }; // binary op %q not implemented
+const struct compressed_string translation74 = { .data = 23, .tail = { 217, 38, 5, 243, 18, 54, 49, 252, 255, 200, 51, 139, 28, 64 } }; // bits must be 32 or less
+const struct compressed_string translation75 = { .data = 16, .tail = { 219, 59, 238, 110, 37, 152, 69, 202, 214 } }; // buffer too small
+const struct compressed_string translation76 = { .data = 17, .tail = { 219, 169, 58, 53, 76, 55, 115, 125, 236, 222, 0 } }; // bytecode overflow
+const struct compressed_string translation77 = { .data = 40, .tail = { 219, 169, 56, 22, 53, 226, 123, 5, 105, 4, 47, 155, 74, 98, 198, 27, 112, 146, 119, 16, 159, 193, 128 } }; // bytes length not a multiple of item size
+const struct compressed_string translation78 = { .data = 24, .tail = { 219, 169, 56, 29, 202, 217, 48, 217, 144, 219, 135, 37, 224, 192 } }; // bytes value out of range
+const struct compressed_string translation79 = { .data = 52, .tail = { 161, 46, 178, 10, 181, 17, 131, 162, 21, 133, 206, 123, 53, 68, 176, 43, 57, 149, 122, 246, 140, 237, 75, 20, 65, 212, 82, 197, 16 } }; // can't add special method to already-subclassed class
+const struct compressed_string translation80 = { .data = 26, .tail = { 161, 46, 178, 10, 33, 56, 81, 44, 15, 206, 28, 226, 17, 148 } }; // can't assign to expression
+const struct compressed_string translation81 = { .data = 17, .tail = { 161, 46, 178, 40, 75, 67, 176, 131, 182, 224 } }; // can't cancel self
+const struct compressed_string translation82 = { .data = 27, .tail = { 161, 46, 178, 40, 203, 220, 222, 70, 144, 37, 133, 26, 248, 177, 249 } }; // can't convert %s to complex
+const struct compressed_string translation83 = { .data = 25, .tail = { 161, 46, 178, 40, 203, 220, 222, 70, 144, 37, 134, 246, 98, 144 } }; // can't convert %s to float
+const struct compressed_string translation84 = { .data = 23, .tail = { 161, 46, 178, 40, 203, 220, 222, 70, 144, 37, 130, 44, 128 } }; // can't convert %s to int
+const struct compressed_string translation85 = { .data = 42, .tail = { 161, 46, 178, 40, 203, 220, 222, 70, 186, 115, 168, 109, 189, 206, 146, 37, 134, 156, 132, 190, 44, 148, 73, 183, 64 } }; // can't convert '%q' object to %q implicitly
+const struct compressed_string translation86 = { .data = 36, .tail = { 161, 46, 178, 42, 116, 177, 57, 133, 101, 179, 80, 172, 17, 67, 102, 77, 197, 26, 166 } }; // can't declare nonlocal in outer code
+const struct compressed_string translation87 = { .data = 23, .tail = { 161, 46, 178, 42, 118, 57, 48, 126, 112, 231, 16, 140, 160 } }; // can't delete expression
+const struct compressed_string translation88 = { .data = 40, .tail = { 161, 46, 178, 42, 195, 100, 82, 126, 131, 96, 108, 115, 224, 205, 70, 186, 115, 168, 37, 168, 215, 78, 117 } }; // can't do binary op between '%q' and '%q'
+const struct compressed_string translation89 = { .data = 39, .tail = { 161, 46, 178, 18, 248, 178, 81, 38, 221, 10, 50, 247, 55, 145, 174, 156, 234, 37, 134, 187, 51, 91, 80 } }; // can't implicitly convert '%q' to 'bool'
+const struct compressed_string translation90 = { .data = 20, .tail = { 161, 46, 178, 18, 248, 103, 144, 165, 115, 26, 114 } }; // can't import name %q
+const struct compressed_string translation91 = { .data = 20, .tail = { 161, 46, 178, 44, 197, 81, 187, 181, 198, 186, 115, 168 } }; // can't load from '%q'
+const struct compressed_string translation92 = { .data = 26, .tail = { 161, 46, 178, 44, 197, 81, 225, 39, 176, 215, 78, 117, 8, 181, 63, 32 } }; // can't load with '%q' index
+const struct compressed_string translation93 = { .data = 29, .tail = { 161, 46, 178, 48, 111, 187, 61, 195, 157, 138, 83, 185, 132, 190, 25, 228 } }; // can't perform relative import
+const struct compressed_string translation94 = { .data = 53, .tail = { 161, 46, 178, 32, 214, 161, 89, 125, 190, 236, 166, 59, 149, 178, 98, 88, 16, 247, 204, 79, 180, 73, 60, 157, 71, 6, 166, 229, 44, 224 } }; // can't send non-None value to a just-started generator
+const struct compressed_string translation95 = { .data = 19, .tail = { 161, 46, 178, 32, 228, 20, 203, 166, 217, 147 } }; // can't set attribute
+const struct compressed_string translation96 = { .data = 24, .tail = { 161, 46, 178, 32, 228, 20, 203, 166, 217, 147, 26, 233, 206, 160 } }; // can't set attribute '%q'
+const struct compressed_string translation97 = { .data = 16, .tail = { 161, 46, 178, 34, 89, 204, 107, 167, 58, 128 } }; // can't store '%q'
+const struct compressed_string translation98 = { .data = 19, .tail = { 161, 46, 178, 34, 89, 204, 75, 13, 116, 231, 80 } }; // can't store to '%q'
+const struct compressed_string translation99 = { .data = 27, .tail = { 161, 46, 178, 34, 89, 204, 120, 73, 236, 53, 211, 157, 66, 45, 79, 200 } }; // can't store with '%q' index
+const struct compressed_string translation100 = { .data = 73, .tail = { 161, 46, 178, 35, 194, 77, 59, 13, 221, 174, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 9, 97, 114, 92, 149, 134, 232, 118, 168, 140, 29, 19, 116, 161, 74, 50, 128 } }; // can't switch from automatic field numbering to manual field specification
+const struct compressed_string translation101 = { .data = 73, .tail = { 161, 46, 178, 35, 194, 77, 59, 13, 221, 174, 46, 75, 146, 176, 221, 14, 213, 17, 131, 162, 110, 148, 41, 70, 81, 44, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 0 } }; // can't switch from manual field specification to automatic field numbering
+const struct compressed_string translation102 = { .data = 38, .tail = { 161, 46, 178, 37, 242, 180, 41, 63, 106, 167, 116, 169, 130, 20, 107, 226, 199, 228, 46, 111, 177, 184 } }; // can't truncate-divide a complex number
+const struct compressed_string translation103 = { .data = 37, .tail = { 161, 46, 178, 50, 165, 125, 147, 140, 182, 98, 221, 14, 14, 68, 39, 240, 109, 184, 138, 21, 137, 192 } }; // can't unambiguously get sizeof scalar
+const struct compressed_string translation104 = { .data = 10, .tail = { 161, 46, 178, 60, 18, 72 } }; // can't wait
+const struct compressed_string translation105 = { .data = 28, .tail = { 161, 42, 180, 138, 57, 148, 152, 215, 78, 117, 8, 177, 36, 180, 56 } }; // cannot create '%q' instances
+const struct compressed_string translation106 = { .data = 7, .tail = { 161, 68, 162, 240 } }; // casting
+const struct compressed_string translation107 = { .data = 32, .tail = { 167, 103, 244, 245, 4, 252, 5, 105, 8, 161, 201, 120, 63, 79, 175, 159, 215, 245, 250, 253, 126, 191, 95, 80 } }; // chr() arg not in range(0x110000)
+const struct compressed_string translation108 = { .data = 26, .tail = { 163, 95, 4, 233, 12, 161, 183, 8, 178, 9, 106, 50, 139, 32 } }; // comparison of int and uint
+const struct compressed_string translation109 = { .data = 22, .tail = { 163, 95, 22, 63, 34, 169, 221, 42, 99, 110, 135, 240, 110, 192 } }; // complex divide by zero
+const struct compressed_string translation110 = { .data = 18, .tail = { 163, 95, 14, 113, 8, 202, 59, 25, 84, 220 } }; // compression header
+const struct compressed_string translation111 = { .data = 20, .tail = { 163, 47, 115, 120, 70, 81, 44, 27, 111, 115, 164, 128 } }; // conversion to object
+const struct compressed_string translation112 = { .data = 29, .tail = { 169, 238, 89, 180, 141, 79, 205, 15, 19, 168, 190, 98, 70, 198, 44, 81, 32 } }; // default 'except' must be last
+const struct compressed_string translation113 = { .data = 37, .tail = { 170, 82, 70, 113, 82, 147, 16, 124, 228, 214, 134, 59, 20, 15, 14, 203, 192, 177, 175, 19, 216 } }; // dict update sequence has wrong length
+const struct compressed_string translation114 = { .data = 32, .tail = { 170, 119, 250, 93, 170, 21, 164, 37, 241, 99, 185, 172, 157, 70, 236, 227, 40, 178 } }; // div/mod not implemented for uint
+const struct compressed_string translation115 = { .data = 16, .tail = { 170, 119, 72, 70, 81, 183, 67, 248, 55, 96 } }; // division by zero
+const struct compressed_string translation116 = { .data = 5, .tail = { 59, 226, 122 } }; // empty
+const struct compressed_string translation117 = { .data = 10, .tail = { 59, 226, 122, 29, 140, 176 } }; // empty heap
+const struct compressed_string translation118 = { .data = 15, .tail = { 59, 226, 122, 16, 120, 39, 41, 103 } }; // empty separator
+const struct compressed_string translation119 = { .data = 52, .tail = { 53, 168, 109, 198, 236, 247, 41, 30, 59, 37, 140, 89, 155, 225, 23, 129, 187, 56, 163, 47, 115, 120, 70, 81, 24, 58, 38, 232, 110 } }; // end of format while looking for conversion specifier
+const struct compressed_string translation120 = { .data = 41, .tail = { 63, 52, 60, 74, 50, 192, 190, 98, 69, 77, 211, 185, 141, 221, 174, 63, 240, 80, 127, 215, 205, 15, 18, 140, 160 } }; // exceptions must derive from BaseException
+const struct compressed_string translation121 = { .data = 35, .tail = { 63, 56, 58, 73, 212, 107, 246, 212, 22, 242, 110, 55, 103, 185, 72, 140, 29, 19, 116, 55 } }; // expected ':' after format specifier
+const struct compressed_string translation122 = { .data = 33, .tail = { 63, 56, 58, 74, 47, 0, 133, 82, 146, 55, 103, 31, 7, 215, 134, 122, 130, 126, 32 } }; // expecting a dict for keyword args
+const struct compressed_string translation123 = { .data = 30, .tail = { 63, 56, 58, 74, 47, 3, 223, 49, 32, 135, 114, 182, 76, 110, 206, 32, 228 } }; // expecting just a value for set
+const struct compressed_string translation124 = { .data = 28, .tail = { 63, 56, 58, 74, 47, 3, 224, 250, 251, 119, 43, 100, 198, 236, 226, 169, 73 } }; // expecting key:value for dict
+const struct compressed_string translation125 = { .data = 29, .tail = { 63, 50, 228, 62, 15, 175, 12, 245, 4, 252, 102, 230, 179, 3, 132, 238, 106 } }; // extra keyword arguments given
+const struct compressed_string translation126 = { .data = 32, .tail = { 63, 50, 228, 48, 208, 146, 140, 165, 96, 79, 198, 110, 107, 48, 56, 78, 230, 160 } }; // extra positional arguments given
+const struct compressed_string translation127 = { .data = 38, .tail = { 221, 30, 36, 19, 241, 155, 154, 200, 150, 17, 156, 27, 250, 122, 139, 230, 36, 108, 98, 122, 193, 128 } }; // first argument to super() must be type
+const struct compressed_string translation128 = { .data = 22, .tail = { 221, 158, 229, 33, 207, 156, 163, 156, 2, 21, 74, 72 } }; // format requires a dict
+const struct compressed_string translation129 = { .data = 4, .tail = { 223, 54, 176 } }; // full
+const struct compressed_string translation130 = { .data = 39, .tail = { 223, 43, 73, 70, 81, 86, 56, 93, 100, 73, 124, 24, 248, 62, 188, 51, 212, 19, 241, 155, 154, 204, 0 } }; // function doesn't take keyword arguments
+const struct compressed_string translation131 = { .data = 46, .tail = { 223, 43, 73, 70, 80, 126, 112, 116, 147, 168, 41, 23, 104, 145, 165, 65, 63, 25, 185, 172, 199, 200, 112, 210, 52, 168 } }; // function expected at most %d arguments, got %d
+const struct compressed_string translation132 = { .data = 46, .tail = { 223, 43, 73, 70, 81, 195, 72, 190, 109, 41, 139, 24, 238, 86, 201, 192, 221, 156, 19, 241, 155, 154, 200, 215, 78, 117 } }; // function got multiple values for argument '%q'
+const struct compressed_string translation133 = { .data = 49, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 105, 80, 231, 206, 81, 206, 163, 13, 9, 40, 202, 86, 4, 252, 102, 230, 179, 0 } }; // function missing %d required positional arguments
+const struct compressed_string translation134 = { .data = 38, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 124, 31, 94, 25, 235, 236, 203, 110, 129, 63, 25, 185, 172, 128 } }; // function missing keyword-only argument
+const struct compressed_string translation135 = { .data = 47, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 243, 148, 115, 168, 248, 62, 188, 51, 212, 19, 241, 155, 154, 200, 215, 78, 117 } }; // function missing required keyword argument '%q'
+const struct compressed_string translation136 = { .data = 49, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 243, 148, 115, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 143, 250, 233, 80 } }; // function missing required positional argument #%d
+const struct compressed_string translation137 = { .data = 56, .tail = { 223, 43, 73, 70, 81, 37, 240, 112, 52, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192, 219, 50, 52, 168, 240, 110, 99, 132, 238, 106 } }; // function takes %d positional arguments but %d were given
+const struct compressed_string translation138 = { .data = 27, .tail = { 224, 212, 220, 165, 156, 21, 156, 202, 189, 3, 242, 116, 204, 162, 240 } }; // generator already executing
+const struct compressed_string translation139 = { .data = 31, .tail = { 224, 212, 220, 165, 156, 39, 10, 206, 117, 31, 249, 53, 55, 41, 103, 254, 190, 82, 64 } }; // generator ignored GeneratorExit
+const struct compressed_string translation140 = { .data = 30, .tail = { 224, 212, 220, 165, 156, 57, 36, 29, 71, 248, 150, 199, 239, 38, 229, 40, 202 } }; // generator raised StopIteration
+const struct compressed_string translation141 = { .data = 19, .tail = { 236, 101, 129, 124, 196, 141, 140, 16, 178, 68, 128 } }; // heap must be a list
+const struct compressed_string translation142 = { .data = 30, .tail = { 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 14, 44, 219, 21, 128 } }; // identifier redefined as global
+const struct compressed_string translation143 = { .data = 32, .tail = { 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 5, 101, 179, 80, 172 } }; // identifier redefined as nonlocal
+const struct compressed_string translation144 = { .data = 28, .tail = { 75, 225, 158, 71, 232, 21, 164, 20, 139, 181, 115, 99, 22, 62, 231, 96 } }; // import * not at module level
+const struct compressed_string translation145 = { .data = 22, .tail = { 69, 163, 95, 5, 41, 181, 140, 124, 239, 142, 129, 61, 59, 0 } }; // incompatible .mpy arch
+const struct compressed_string translation146 = { .data = 22, .tail = { 69, 163, 95, 5, 41, 181, 140, 124, 239, 142, 134, 233, 99 } }; // incompatible .mpy file
+const struct compressed_string translation147 = { .data = 17, .tail = { 69, 163, 95, 22, 57, 49, 187, 61, 202, 64 } }; // incomplete format
+const struct compressed_string translation148 = { .data = 21, .tail = { 69, 163, 95, 22, 57, 49, 187, 61, 202, 71, 193, 244 } }; // incomplete format key
+const struct compressed_string translation149 = { .data = 17, .tail = { 69, 163, 59, 157, 36, 96, 171, 84, 94, 0 } }; // incorrect padding
+const struct compressed_string translation150 = { .data = 24, .tail = { 69, 238, 86, 74, 141, 217, 238, 82, 35, 7, 68, 221, 13, 192 } }; // invalid format specifier
+const struct compressed_string translation151 = { .data = 29, .tail = { 69, 238, 86, 74, 139, 165, 29, 177, 212, 246, 101, 21, 58, 51, 148, 179, 128 } }; // invalid micropython decorator
+const struct compressed_string translation152 = { .data = 20, .tail = { 69, 238, 86, 74, 139, 252, 74, 92, 198, 96, 184, 48 } }; // invalid mktime usage
+const struct compressed_string translation153 = { .data = 14, .tail = { 69, 238, 86, 74, 136, 233, 100, 188, 128 } }; // invalid syntax
+const struct compressed_string translation154 = { .data = 25, .tail = { 69, 238, 86, 74, 136, 233, 100, 188, 141, 217, 194, 230, 251, 27, 128 } }; // invalid syntax for number
+const struct compressed_string translation155 = { .data = 34, .tail = { 72, 140, 237, 75, 20, 71, 167, 168, 39, 224, 126, 162, 249, 137, 27, 24, 33, 75, 20, 64 } }; // issubclass() arg 1 must be a class
+const struct compressed_string translation156 = { .data = 56, .tail = { 72, 140, 237, 75, 20, 71, 167, 168, 39, 224, 127, 144, 190, 98, 70, 198, 8, 82, 197, 16, 25, 193, 9, 206, 44, 97, 183, 20, 177, 68, 28, 0 } }; // issubclass() arg 2 must be a class or a tuple of classes
+const struct compressed_string translation157 = { .data = 68, .tail = { 247, 100, 80, 126, 112, 116, 152, 4, 44, 145, 33, 183, 17, 47, 244, 219, 169, 56, 13, 183, 185, 210, 96, 81, 150, 18, 36, 214, 71, 132, 158, 194, 14, 219, 134, 219, 220, 233, 32 } }; // join expects a list of str/bytes objects consistent with self object
+const struct compressed_string translation158 = { .data = 61, .tail = { 248, 62, 188, 51, 212, 19, 241, 155, 154, 207, 164, 122, 133, 105, 9, 124, 88, 238, 107, 39, 81, 236, 51, 6, 21, 158, 229, 96, 79, 196, 4, 88, 147, 42, 128 } }; // keyword argument(s) not implemented - use normal args instead
+const struct compressed_string translation159 = { .data = 32, .tail = { 183, 104, 4, 181, 15, 218, 4, 118, 108, 218, 163, 99, 20, 107, 224, 165, 54, 177, 128 } }; // lhs and rhs should be compatible
+const struct compressed_string translation160 = { .data = 43, .tail = { 179, 80, 172, 53, 211, 157, 71, 98, 129, 61, 96, 198, 186, 115, 168, 219, 50, 33, 178, 244, 48, 144, 53, 211, 157, 64 } }; // local '%q' has type '%q' but source is '%q'
+const struct compressed_string translation161 = { .data = 33, .tail = { 179, 80, 172, 53, 211, 157, 70, 96, 234, 54, 61, 217, 204, 79, 88, 49, 240, 173, 225, 64 } }; // local '%q' used before type known
+const struct compressed_string translation162 = { .data = 43, .tail = { 179, 80, 172, 59, 147, 161, 109, 99, 14, 123, 155, 154, 208, 234, 54, 61, 217, 204, 20, 66, 112, 183, 53, 144 } }; // local variable referenced before assignment
+const struct compressed_string translation163 = { .data = 18, .tail = { 185, 91, 118, 123, 157, 70, 254, 209, 46, 139, 192 } }; // malformed f-string
+const struct compressed_string translation164 = { .data = 17, .tail = { 185, 79, 97, 86, 185, 34, 131, 119, 103 } }; // math domain error
+const struct compressed_string translation165 = { .data = 32, .tail = { 185, 121, 75, 230, 225, 206, 153, 120, 70, 81, 83, 196, 246, 7, 230, 134, 117, 58, 128 } }; // maximum recursion depth exceeded
+const struct compressed_string translation166 = { .data = 45, .tail = { 185, 221, 159, 160, 86, 179, 80, 165, 25, 70, 228, 150, 58, 252, 129, 90, 205, 66, 148, 94, 6, 153, 27, 117, 39, 0 } }; // memory allocation failed, allocating %u bytes
+const struct compressed_string translation167 = { .data = 40, .tail = { 185, 221, 159, 160, 86, 179, 80, 165, 25, 70, 228, 150, 58, 252, 135, 99, 44, 4, 129, 102, 167, 193, 212 } }; // memory allocation failed, heap is locked
+const struct compressed_string translation168 = { .data = 27, .tail = { 185, 221, 159, 174, 232, 126, 3, 111, 188, 28, 137, 102, 22, 39, 224, 192 } }; // memoryview offset too large
+const struct compressed_string translation169 = { .data = 48, .tail = { 185, 221, 159, 174, 232, 126, 62, 194, 198, 188, 79, 96, 144, 21, 164, 16, 190, 109, 41, 139, 24, 109, 194, 73, 222, 19, 248, 48 } }; // memoryview: length is not a multiple of itemsize
+const struct compressed_string translation170 = { .data = 37, .tail = { 191, 196, 165, 204, 41, 157, 96, 16, 156, 226, 198, 27, 113, 99, 94, 39, 176, 255, 176, 103, 31, 230 } }; // mktime needs a tuple of length 8 or 9
+const struct compressed_string translation171 = { .data = 25, .tail = { 190, 109, 41, 139, 24, 253, 60, 132, 80, 81, 9, 194, 220, 214, 64 } }; // multiple *x in assignment
+const struct compressed_string translation172 = { .data = 45, .tail = { 190, 109, 41, 139, 24, 216, 160, 224, 118, 46, 230, 17, 98, 73, 104, 98, 197, 215, 179, 102, 69, 25, 119, 178, 82, 64 } }; // multiple bases have instance lay-out conflict
+const struct compressed_string translation173 = { .data = 20, .tail = { 190, 98, 67, 146, 65, 130, 80, 219, 123, 157, 36 } }; // must raise an object
+const struct compressed_string translation174 = { .data = 42, .tail = { 190, 98, 70, 96, 199, 193, 245, 225, 158, 160, 159, 140, 220, 214, 70, 236, 227, 224, 250, 27, 229, 105, 40, 202 } }; // must use keyword argument for key function
+const struct compressed_string translation175 = { .data = 24, .tail = { 82, 185, 141, 116, 231, 80, 144, 21, 164, 84, 247, 69, 58, 128 } }; // name '%q' is not defined
+const struct compressed_string translation176 = { .data = 31, .tail = { 82, 148, 238, 98, 141, 83, 8, 163, 231, 124, 116, 50, 177, 156, 97, 158, 78, 160 } }; // native code in .mpy unsupported
+const struct compressed_string translation177 = { .data = 12, .tail = { 82, 148, 238, 99, 164, 59, 84 } }; // native yield
+const struct compressed_string translation178 = { .data = 34, .tail = { 83, 58, 139, 179, 152, 158, 196, 163, 74, 142, 229, 108, 156, 9, 97, 149, 193, 83, 224 } }; // need more than %d values to unpack
+const struct compressed_string translation179 = { .data = 18, .tail = { 83, 224, 165, 59, 152, 220, 169, 44, 232, 86 } }; // negative factorial
+const struct compressed_string translation180 = { .data = 20, .tail = { 83, 224, 165, 59, 152, 142, 201, 188, 138, 54, 86, 64 } }; // negative shift count
+const struct compressed_string translation181 = { .data = 30, .tail = { 86, 5, 73, 78, 230, 15, 205, 15, 18, 140, 162, 88, 57, 185, 36, 24 } }; // no active exception to reraise
+const struct compressed_string translation182 = { .data = 29, .tail = { 86, 27, 34, 213, 23, 129, 187, 56, 86, 91, 53, 10, 195, 118, 202, 212 } }; // no binding for nonlocal found
+const struct compressed_string translation183 = { .data = 20, .tail = { 86, 23, 106, 230, 198, 20, 174, 117, 26, 233, 206, 160 } }; // no module named '%q'
+const struct compressed_string translation184 = { .data = 17, .tail = { 86, 17, 154, 118, 5, 50, 233, 182, 100, 192 } }; // no such attribute
+const struct compressed_string translation185 = { .data = 45, .tail = { 86, 95, 106, 158, 229, 155, 72, 39, 227, 55, 53, 145, 187, 90, 205, 226, 5, 79, 114, 205, 164, 19, 241, 155, 154, 200 } }; // non-default argument follows default argument
+const struct compressed_string translation186 = { .data = 19, .tail = { 86, 95, 110, 199, 228, 85, 56, 73, 27, 182, 86, 160 } }; // non-hex digit found
+const struct compressed_string translation187 = { .data = 14, .tail = { 86, 144, 66, 140, 177, 36, 178 } }; // not a constant
+const struct compressed_string translation188 = { .data = 52, .tail = { 86, 144, 86, 176, 39, 227, 55, 53, 152, 20, 101, 238, 111, 39, 81, 92, 186, 47, 2, 37, 209, 120, 27, 179, 220, 166, 81, 120 } }; // not all arguments converted during string formatting
+const struct compressed_string translation189 = { .data = 38, .tail = { 86, 144, 106, 217, 227, 176, 39, 227, 55, 53, 152, 27, 179, 141, 217, 238, 82, 34, 93, 23, 128 } }; // not enough arguments for format string
+const struct compressed_string translation190 = { .data = 7, .tail = { 109, 189, 206, 146, 0 } }; // object 
+const struct compressed_string translation191 = { .data = 33, .tail = { 109, 189, 206, 146, 53, 210, 53, 9, 11, 172, 130, 19, 156, 88, 195, 56, 178, 68, 128 } }; // object '%s' isn't a tuple or list
+const struct compressed_string translation192 = { .data = 22, .tail = { 109, 189, 206, 146, 21, 164, 34, 136, 62, 114, 107, 67 } }; // object not in sequence
+const struct compressed_string translation193 = { .data = 32, .tail = { 109, 189, 206, 146, 27, 113, 61, 96, 198, 186, 70, 163, 177, 64, 86, 22, 53, 244, 245 } }; // object of type '%s' has no len()
+const struct compressed_string translation194 = { .data = 36, .tail = { 109, 189, 206, 146, 60, 36, 246, 27, 103, 125, 205, 198, 29, 165, 168, 214, 14, 124, 229, 28, 234 } }; // object with buffer protocol required
+const struct compressed_string translation195 = { .data = 17, .tail = { 106, 215, 218, 198, 188, 79, 97, 18, 232, 188, 0 } }; // odd-length string
+const struct compressed_string translation196 = { .data = 48, .tail = { 101, 183, 66, 44, 148, 56, 30, 18, 123, 8, 147, 199, 237, 250, 143, 66, 248, 33, 247, 101, 63, 80, 78, 98, 51, 140, 51, 201, 212 } }; // only slices with step=1 (aka None) are supported
+const struct compressed_string translation197 = { .data = 6, .tail = { 108, 81, 170, 96 } }; // opcode
+const struct compressed_string translation198 = { .data = 57, .tail = { 103, 175, 167, 168, 63, 56, 58, 73, 212, 16, 167, 98, 114, 164, 155, 252, 134, 217, 145, 18, 232, 188, 6, 220, 88, 215, 137, 236, 52, 168, 221, 178, 181 } }; // ord() expected a character, but string of length %d found
+const struct compressed_string translation199 = { .data = 44, .tail = { 110, 230, 251, 217, 188, 10, 50, 247, 55, 148, 94, 5, 153, 120, 8, 178, 37, 133, 202, 157, 145, 76, 120, 103, 168 } }; // overflow converting long int to machine word
+const struct compressed_string translation200 = { .data = 43, .tail = { 193, 83, 224, 31, 156, 29, 36, 234, 52, 168, 73, 59, 192, 221, 156, 96, 169, 240, 139, 192, 244, 225, 164, 105, 95, 80 } }; // pack expected %d items for packing (got %d)
+const struct compressed_string translation201 = { .data = 17, .tail = { 195, 96, 110, 237, 112, 119, 196, 244, 52, 228 } }; // pop from empty %q
+const struct compressed_string translation202 = { .data = 23, .tail = { 195, 66, 74, 50, 149, 129, 63, 0, 183, 147, 113, 250, 126, 128 } }; // positional arg after **
+const struct compressed_string translation203 = { .data = 32, .tail = { 195, 66, 74, 50, 149, 129, 63, 0, 183, 147, 113, 240, 125, 120, 103, 168, 39, 224 } }; // positional arg after keyword arg
+const struct compressed_string translation204 = { .data = 30, .tail = { 195, 120, 244, 245, 31, 205, 234, 9, 248, 205, 205, 100, 80, 149, 90, 70, 198, 62, 160 } }; // pow() 3rd argument cannot be 0
+const struct compressed_string translation205 = { .data = 40, .tail = { 195, 120, 244, 245, 30, 18, 123, 15, 230, 9, 248, 205, 205, 102, 3, 159, 57, 71, 56, 8, 178, 124, 27, 192 } }; // pow() with 3 arguments requires integers
+const struct compressed_string translation206 = { .data = 31, .tail = { 114, 240, 55, 246, 137, 116, 94, 32, 19, 152, 86, 145, 25, 198, 25, 228, 234 } }; // raw f-strings are not supported
+const struct compressed_string translation207 = { .data = 44, .tail = { 115, 231, 39, 18, 117, 22, 53, 226, 123, 13, 42, 54, 204, 134, 219, 220, 233, 35, 177, 64, 177, 175, 19, 216, 105, 80 } }; // requested length %d but object has length %d
+const struct compressed_string translation208 = { .data = 33, .tail = { 115, 156, 186, 131, 243, 131, 164, 157, 70, 186, 115, 168, 219, 50, 56, 105, 26, 233, 206, 160 } }; // return expected '%q' but got '%q'
+const struct compressed_string translation209 = { .data = 14, .tail = { 120, 197, 146, 125, 62, 236, 167, 242, 95, 80 } }; // rsplit(None,n)
+const struct compressed_string translation210 = { .data = 19, .tail = { 138, 118, 58, 230, 198, 57, 201, 228, 198, 249, 181, 128 } }; // schedule queue full
+const struct compressed_string translation211 = { .data = 43, .tail = { 132, 225, 66, 180, 130, 181, 155, 193, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110 } }; // sign not allowed in string format specifier
+const struct compressed_string translation212 = { .data = 50, .tail = { 132, 225, 66, 180, 130, 181, 155, 193, 212, 120, 73, 236, 17, 100, 248, 55, 27, 179, 220, 164, 70, 14, 137, 186, 27, 141, 105, 168 } }; // sign not allowed with integer format specifier 'c'
+const struct compressed_string translation213 = { .data = 18, .tail = { 139, 149, 172, 17, 100, 55, 115, 125, 236, 222, 0 } }; // small int overflow
+const struct compressed_string translation214 = { .data = 27, .tail = { 140, 89, 38, 81, 120, 30, 18, 123, 8, 206, 222, 212, 44, 78, 92, 224 } }; // splitting with sub-captures
+const struct compressed_string translation215 = { .data = 17, .tail = { 137, 39, 159, 161, 173, 66, 45, 82, 135, 0 } }; // start/end indices
+const struct compressed_string translation216 = { .data = 30, .tail = { 137, 115, 43, 134, 193, 185, 74, 50, 133, 105, 17, 156, 97, 158, 78, 160 } }; // stream operation not supported
+const struct compressed_string translation217 = { .data = 35, .tail = { 137, 116, 94, 1, 63, 25, 185, 172, 143, 9, 61, 155, 50, 9, 65, 173, 26, 168, 188, 0 } }; // string argument without an encoding
+const struct compressed_string translation218 = { .data = 25, .tail = { 137, 116, 94, 2, 45, 79, 200, 108, 200, 109, 195, 146, 240, 96 } }; // string index out of range
+const struct compressed_string translation219 = { .data = 39, .tail = { 137, 116, 94, 2, 45, 82, 135, 2, 249, 137, 27, 24, 69, 147, 224, 222, 62, 65, 90, 70, 144 } }; // string indices must be integers, not %s
+const struct compressed_string translation220 = { .data = 19, .tail = { 137, 124, 210, 126, 194, 132, 186, 200, 69, 169, 249 } }; // struct: can't index
+const struct compressed_string translation221 = { .data = 26, .tail = { 137, 124, 210, 126, 193, 22, 167, 228, 54, 100, 54, 225, 201, 120, 48 } }; // struct: index out of range
+const struct compressed_string translation222 = { .data = 17, .tail = { 137, 124, 210, 126, 193, 88, 110, 135, 106, 192 } }; // struct: no fields
+const struct compressed_string translation223 = { .data = 19, .tail = { 140, 237, 18, 232, 188, 5, 105, 27, 182, 86, 160 } }; // substring not found
+const struct compressed_string translation224 = { .data = 23, .tail = { 140, 224, 223, 211, 212, 80, 151, 89, 27, 162, 212, 65, 219, 112 } }; // super() can't find self
+const struct compressed_string translation225 = { .data = 20, .tail = { 142, 150, 75, 200, 55, 118, 112, 138, 63, 223, 252, 127, 111, 184 } }; // syntax error in JSON
+const struct compressed_string translation226 = { .data = 34, .tail = { 142, 150, 75, 200, 55, 118, 112, 138, 51, 73, 235, 7, 2, 167, 20, 116, 196, 179, 128 } }; // syntax error in uctypes descriptor
+const struct compressed_string translation227 = { .data = 23, .tail = { 148, 167, 196, 4, 89, 55, 238, 86, 13, 220, 223, 123, 55, 128 } }; // ticks interval overflow
+const struct compressed_string translation228 = { .data = 13, .tail = { 150, 97, 114, 94, 129, 63, 16 } }; // too many args
+const struct compressed_string translation229 = { .data = 39, .tail = { 150, 97, 114, 94, 135, 114, 182, 78, 4, 176, 202, 224, 169, 240, 61, 15, 206, 14, 146, 117, 26, 87, 212 } }; // too many values to unpack (expected %d)
+const struct compressed_string translation230 = { .data = 40, .tail = { 158, 176, 99, 93, 57, 212, 36, 5, 105, 4, 160, 169, 67, 196, 150, 214, 49, 177, 65, 137, 235, 6 } }; // type '%q' is not an acceptable base type
+const struct compressed_string translation231 = { .data = 38, .tail = { 158, 176, 97, 182, 247, 58, 72, 215, 78, 117, 29, 138, 2, 176, 41, 151, 77, 179, 38, 53, 211, 157, 64 } }; // type object '%q' has no attribute '%q'
+const struct compressed_string translation232 = { .data = 27, .tail = { 158, 176, 98, 75, 224, 224, 126, 161, 156, 127, 48, 79, 198, 110, 107, 48 } }; // type takes 1 or 3 arguments
+const struct compressed_string translation233 = { .data = 27, .tail = { 202, 147, 244, 27, 3, 78, 66, 180, 132, 190, 44, 119, 53, 147, 168 } }; // unary op %q not implemented
+const struct compressed_string translation234 = { .data = 17, .tail = { 202, 159, 156, 29, 36, 234, 17, 106, 107, 32 } }; // unexpected indent
+const struct compressed_string translation235 = { .data = 32, .tail = { 202, 159, 156, 29, 36, 234, 62, 15, 175, 12, 245, 4, 252, 102, 230, 178, 53, 211, 157, 64 } }; // unexpected keyword argument '%q'
+const struct compressed_string translation236 = { .data = 20, .tail = { 202, 165, 26, 166, 20, 174, 96, 226, 133, 131, 128 } }; // unicode name escapes
+const struct compressed_string translation237 = { .data = 45, .tail = { 202, 162, 212, 214, 69, 88, 225, 117, 145, 114, 154, 118, 4, 189, 6, 204, 155, 132, 90, 154, 200, 177, 247, 59, 0 } }; // unindent doesn't match any outer indent level
+const struct compressed_string translation238 = { .data = 31, .tail = { 202, 252, 43, 120, 81, 70, 94, 230, 240, 140, 162, 48, 116, 77, 208, 220, 105, 64 } }; // unknown conversion specifier %c
+const struct compressed_string translation239 = { .data = 48, .tail = { 202, 252, 43, 120, 81, 187, 61, 202, 69, 26, 166, 53, 210, 154, 141, 217, 195, 109, 238, 116, 144, 219, 137, 235, 6, 53, 211, 157, 64 } }; // unknown format code '%c' for object of type '%q'
+const struct compressed_string translation240 = { .data = 17, .tail = { 202, 252, 43, 120, 81, 61, 96, 198, 186, 115, 168 } }; // unknown type '%q'
+const struct compressed_string translation241 = { .data = 24, .tail = { 202, 220, 166, 157, 142, 163, 93, 41, 168, 69, 27, 179, 220, 164 } }; // unmatched '%c' in format
+const struct compressed_string translation242 = { .data = 20, .tail = { 202, 185, 149, 75, 107, 24, 41, 151, 77, 179, 38 } }; // unreadable attribute
+const struct compressed_string translation243 = { .data = 52, .tail = { 202, 198, 113, 134, 121, 58, 141, 217, 238, 82, 41, 216, 156, 169, 38, 227, 93, 41, 168, 244, 250, 249, 211, 207, 168, 41, 8, 181, 63, 35, 74, 128 } }; // unsupported format character '%c' (0x%x) at index %d
+const struct compressed_string translation244 = { .data = 29, .tail = { 202, 198, 113, 134, 121, 58, 137, 235, 6, 55, 103, 26, 115, 246, 26, 233, 26, 128 } }; // unsupported type for %q: '%s'
+const struct compressed_string translation245 = { .data = 36, .tail = { 202, 198, 113, 134, 121, 58, 137, 235, 7, 3, 118, 113, 167, 63, 97, 174, 156, 235, 242, 26, 233, 206, 160 } }; // unsupported types for %q: '%q', '%q'
+const struct compressed_string translation246 = { .data = 28, .tail = { 238, 86, 201, 139, 230, 36, 110, 146, 17, 70, 149, 27, 117, 39, 233, 30, 160 } }; // value must fit in %d byte(s)
+const struct compressed_string translation247 = { .data = 25, .tail = { 240, 236, 188, 5, 205, 246, 55, 13, 184, 39, 227, 55, 53, 152 } }; // wrong number of arguments
+
+// 7187 bytes worth of translations
+// 4478 bytes worth of translations compressed
+// 2709 bytes saved
@@ -0,0 +1,25 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/busio/Transaction.h"
+
+// There are no buses on unix, but a Transaction can replay steps on any object
+// with the busio methods, so it can be tested with a bus written in Python.
+static const mp_rom_map_elem_t busio_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_busio) },
+    { MP_ROM_QSTR(MP_QSTR_Transaction), MP_ROM_PTR(&busio_transaction_type) },
+};
+static MP_DEFINE_CONST_DICT(busio_module_globals, busio_module_globals_table);
+
+const mp_obj_module_t busio_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&busio_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_busio, busio_module);
@@ -85,6 +85,10 @@ MP_DEFINE_CONST_FUN_OBJ_1(mod_os_getenv_str_obj, mod_os_getenv_str);
 // Command line options, with their defaults
 STATIC bool compile_only = false;
 STATIC uint emit_opt = MP_EMIT_OPT_NONE;
+// CIRCUITPY-CHANGE
+#if MICROPY_NATIVE_TIER
+STATIC mp_uint_t native_tier_threshold = 0;
+#endif
 
 #if MICROPY_ENABLE_GC
 // Heap size of GC heap (if enabled)
@@ -366,6 +370,11 @@ STATIC void print_help(char **argv) {
         #endif
         );
     impl_opts_cnt++;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    printf("  tier=<n> -- recompile functions as native code after n calls and loop iterations (default 0, off)\n");
+    impl_opts_cnt++;
+    #endif
     #if MICROPY_ENABLE_GC
     printf(
         "  heapsize=<n>[w][K|M] -- set the heap size for the GC (default %ld)\n"
@@ -413,6 +422,15 @@ STATIC void pre_process_options(int argc, char **argv) {
                 } else if (strcmp(argv[a + 1], "emit=viper") == 0) {
                     emit_opt = MP_EMIT_OPT_VIPER;
                 #endif
+                // CIRCUITPY-CHANGE
+                #if MICROPY_NATIVE_TIER
+                } else if (strncmp(argv[a + 1], "tier=", sizeof("tier=") - 1) == 0) {
+                    char *end;
+                    native_tier_threshold = strtoul(argv[a + 1] + sizeof("tier=") - 1, &end, 0);
+                    if (*end != 0) {
+                        goto invalid_arg;
+                    }
+                #endif
                 #if MICROPY_ENABLE_GC
                 } else if (strncmp(argv[a + 1], "heapsize=", sizeof("heapsize=") - 1) == 0) {
                     char *end;
@@ -563,6 +581,10 @@ MP_NOINLINE int main_(int argc, char **argv) {
     #else
     (void)emit_opt;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    MP_STATE_VM(native_tier_threshold) = native_tier_threshold;
+    #endif
 
     #if MICROPY_VFS_POSIX
     {
@@ -624,6 +646,15 @@ MP_NOINLINE int main_(int argc, char **argv) {
         // CIRCUITPY-CHANGE: test native base classes work as needed by CircuitPython libraries.
         extern const mp_obj_type_t native_base_class_type;
         mp_store_global(MP_QSTR_NativeBaseClass, MP_OBJ_FROM_PTR(&native_base_class_type));
+        // CIRCUITPY-CHANGE: test the ring that analogbufio streams samples into.
+        extern const mp_obj_type_t sample_ring_type;
+        mp_store_global(MP_QSTR_SampleRing, MP_OBJ_FROM_PTR(&sample_ring_type));
+        // CIRCUITPY-CHANGE: test sdcardio's write queue against a simulated card.
+        extern const mp_obj_type_t sdcard_protocol_type;
+        mp_store_global(MP_QSTR_SDCardProtocol, MP_OBJ_FROM_PTR(&sdcard_protocol_type));
+        // CIRCUITPY-CHANGE: test socketpool's partial sends and receives against a simulated socket.
+        extern const mp_obj_type_t socket_transfer_type;
+        mp_store_global(MP_QSTR_SocketTransfer, MP_OBJ_FROM_PTR(&socket_transfer_type));
         mp_store_global(MP_QSTR_getenv_int, MP_OBJ_FROM_PTR(&mod_os_getenv_int_obj));
         mp_store_global(MP_QSTR_getenv_str, MP_OBJ_FROM_PTR(&mod_os_getenv_str_obj));
     }
@@ -140,6 +140,11 @@ typedef long mp_off_t;
 #define MICROPY_STACKLESS_STRICT    (0)
 #endif
 
+// CIRCUITPY-CHANGE: allow hot functions to be promoted to native code, see -X tier
+#ifndef MICROPY_NATIVE_TIER
+#define MICROPY_NATIVE_TIER ((MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM) && !MICROPY_STACKLESS)
+#endif
+
 // Unix-specific configuration of machine.mem*.
 #define MICROPY_MACHINE_MEM_GET_READ_ADDR   mod_machine_mem_get_addr
 #define MICROPY_MACHINE_MEM_GET_WRITE_ADDR  mod_machine_mem_get_addr
@@ -150,6 +155,7 @@ typedef long mp_off_t;
 #define MICROPY_FATFS_LFN_CODE_PAGE    437 /* 1=SFN/ANSI 437=LFN/U.S.(OEM) */
 #define MICROPY_FATFS_MKFS_FAT32       (1)
 #define MICROPY_FATFS_USE_LABEL (1)
+#define MICROPY_FATFS_USE_EXPAND       (1)
 
 #define MICROPY_ALLOC_PATH_MAX      (PATH_MAX)
 
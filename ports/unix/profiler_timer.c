@@ -0,0 +1,42 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+// The unix port has no supervisor tick, so profiler samples are taken from a
+// SIGPROF handler driven by a CPU time interval timer instead.
+
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "shared-module/profiler/__init__.h"
+#include "shared-module/profiler/SamplingProfiler.h"
+
+static void sigprof_handler(int signum) {
+    (void)signum;
+    profiler_samplingprofiler_sample();
+}
+
+void profiler_timer_start(uint32_t interval_us) {
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    // Restart system calls interrupted by a sample rather than failing them.
+    sa.sa_flags = SA_RESTART;
+    sa.sa_handler = sigprof_handler;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGPROF, &sa, NULL);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = interval_us / 1000000;
+    timer.it_interval.tv_usec = interval_us % 1000000;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+void profiler_timer_stop(void) {
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+}
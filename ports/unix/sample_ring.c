@@ -0,0 +1,129 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-module/analogbufio/SampleRing.h"
+
+#if defined(MICROPY_UNIX_COVERAGE)
+
+// Drives analogbufio's sample ring from Python, standing in for the DMA
+// interrupt that fills it on a microcontroller. Blocks are named by their
+// index in the buffer, with -1 for the scratch block. in_flight is the number
+// of blocks that the producer keeps issued, such as 2 for RP2040's chained
+// DMA channels.
+
+typedef struct {
+    mp_obj_base_t base;
+    analogbufio_ring_t ring;
+} sample_ring_obj_t;
+
+const mp_obj_type_t sample_ring_type;
+
+static mp_obj_t sample_ring_make_new(const mp_obj_type_t *type, size_t n_args,
+    size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_buffer, ARG_blocks, ARG_decimation, ARG_in_flight };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_blocks, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 3} },
+        { MP_QSTR_decimation, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_in_flight, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    sample_ring_obj_t *self = mp_obj_malloc(sample_ring_obj_t, &sample_ring_type);
+    mp_int_t in_flight = mp_arg_validate_int_range(args[ARG_in_flight].u_int, 1, 2, MP_QSTR_in_flight);
+    analogbufio_ring_init(&self->ring, args[ARG_buffer].u_obj, args[ARG_blocks].u_int, args[ARG_decimation].u_int, in_flight);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static size_t block_bytes(analogbufio_ring_t *ring) {
+    return ring->block_samples * ring->bytes_per_sample;
+}
+
+static mp_obj_t sample_ring_issue(mp_obj_t self_in) {
+    sample_ring_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint8_t *block = analogbufio_ring_issue(&self->ring);
+    if (block == self->ring.scratch) {
+        return MP_OBJ_NEW_SMALL_INT(-1);
+    }
+    return MP_OBJ_NEW_SMALL_INT((block - self->ring.buffer) / block_bytes(&self->ring));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(sample_ring_issue_obj, sample_ring_issue);
+
+// Fill the block with samples, repeating the last one, then complete it.
+static mp_obj_t sample_ring_complete(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t samples_in) {
+    sample_ring_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    analogbufio_ring_t *ring = &self->ring;
+    mp_int_t index = mp_obj_get_int(index_in);
+    uint8_t *block = index < 0 ? ring->scratch : ring->buffer + index * block_bytes(ring);
+    size_t n;
+    mp_obj_t *samples;
+    mp_obj_get_array(samples_in, &n, &samples);
+    mp_uint_t value = 0;
+    for (size_t i = 0; i < ring->block_samples; i++) {
+        if (i < n) {
+            value = mp_obj_get_int(samples[i]);
+        }
+        if (ring->bytes_per_sample == 2) {
+            ((uint16_t *)block)[i] = value;
+        } else {
+            block[i] = value;
+        }
+    }
+    analogbufio_ring_complete(ring, block);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(sample_ring_complete_obj, sample_ring_complete);
+
+static mp_obj_t sample_ring_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    sample_ring_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    size_t len = bufinfo.len / self->ring.bytes_per_sample;
+    return MP_OBJ_NEW_SMALL_INT(analogbufio_ring_readinto(&self->ring, bufinfo.buf, len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(sample_ring_readinto_obj, sample_ring_readinto);
+
+static mp_obj_t sample_ring_get_in_waiting(mp_obj_t self_in) {
+    sample_ring_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(analogbufio_ring_get_in_waiting(&self->ring));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(sample_ring_get_in_waiting_obj, sample_ring_get_in_waiting);
+
+MP_PROPERTY_GETTER(sample_ring_in_waiting_obj,
+    (mp_obj_t)&sample_ring_get_in_waiting_obj);
+
+static mp_obj_t sample_ring_get_overflow_count(mp_obj_t self_in) {
+    sample_ring_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->ring.overflow_count);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(sample_ring_get_overflow_count_obj, sample_ring_get_overflow_count);
+
+MP_PROPERTY_GETTER(sample_ring_overflow_count_obj,
+    (mp_obj_t)&sample_ring_get_overflow_count_obj);
+
+static const mp_rom_map_elem_t sample_ring_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_issue), MP_ROM_PTR(&sample_ring_issue_obj) },
+    { MP_ROM_QSTR(MP_QSTR_complete), MP_ROM_PTR(&sample_ring_complete_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&sample_ring_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&sample_ring_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overflow_count), MP_ROM_PTR(&sample_ring_overflow_count_obj) },
+};
+static MP_DEFINE_CONST_DICT(sample_ring_locals_dict, sample_ring_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    sample_ring_type,
+    MP_QSTR_SampleRing,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, &sample_ring_make_new,
+    locals_dict, &sample_ring_locals_dict
+    );
+
+#endif
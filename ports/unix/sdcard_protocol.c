@@ -0,0 +1,160 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-module/sdcardio/Protocol.h"
+
+#if defined(MICROPY_UNIX_COVERAGE)
+
+// Drives sdcardio's SPI mode protocol from Python, with a simulated card in
+// place of the SPI bus. The card is a function that is given the bytes sent
+// and returns the bytes received. Each reading of the clock advances it by 1ms
+// so that timeouts don't depend on the host. background() stands in for the
+// background callback that a microcontroller runs after pending is set.
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t exchange;
+    uint64_t now_ns;
+    bool pending;
+    sdcardio_protocol_t protocol;
+} sdcard_protocol_obj_t;
+
+const mp_obj_type_t sdcard_protocol_type;
+
+static void sdcard_protocol_exchange(void *link, const uint8_t *tx, uint8_t *rx, size_t len) {
+    sdcard_protocol_obj_t *self = link;
+    vstr_t vstr;
+    vstr_init_len(&vstr, len);
+    if (tx) {
+        memcpy(vstr.buf, tx, len);
+    } else {
+        memset(vstr.buf, 0xff, len);
+    }
+    mp_obj_t received = mp_call_function_1(self->exchange, mp_obj_new_bytes_from_vstr(&vstr));
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(received, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len != len) {
+        mp_raise_ValueError(NULL);
+    }
+    if (rx) {
+        memcpy(rx, bufinfo.buf, len);
+    }
+}
+
+static uint64_t sdcard_protocol_monotonic_ns(void *link) {
+    sdcard_protocol_obj_t *self = link;
+    self->now_ns += 1000000;
+    return self->now_ns;
+}
+
+static void sdcard_protocol_set_pending(void *link, bool pending) {
+    sdcard_protocol_obj_t *self = link;
+    self->pending = pending;
+}
+
+static mp_obj_t sdcard_protocol_make_new(const mp_obj_type_t *type, size_t n_args,
+    size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_exchange, ARG_queue };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_exchange, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_queue, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    sdcard_protocol_obj_t *self = mp_obj_malloc(sdcard_protocol_obj_t, &sdcard_protocol_type);
+    self->exchange = args[ARG_exchange].u_obj;
+    self->now_ns = 0;
+    self->pending = false;
+    self->protocol.link = self;
+    self->protocol.exchange = sdcard_protocol_exchange;
+    self->protocol.monotonic_ns = sdcard_protocol_monotonic_ns;
+    self->protocol.set_pending = sdcard_protocol_set_pending;
+    uint8_t *write_queue = NULL;
+    if (args[ARG_queue].u_bool) {
+        write_queue = m_malloc(CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS * SDCARDIO_FRAME_SIZE);
+    }
+    sdcardio_protocol_init(&self->protocol, write_queue);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t sdcard_protocol_readblocks(mp_obj_t self_in, mp_obj_t start_block, mp_obj_t buf_in) {
+    sdcard_protocol_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    return MP_OBJ_NEW_SMALL_INT(sdcardio_protocol_readblocks(&self->protocol, bufinfo.buf, mp_obj_get_int(start_block), bufinfo.len / 512));
+}
+MP_DEFINE_CONST_FUN_OBJ_3(sdcard_protocol_readblocks_obj, sdcard_protocol_readblocks);
+
+static mp_obj_t sdcard_protocol_writeblocks(mp_obj_t self_in, mp_obj_t start_block, mp_obj_t buf_in) {
+    sdcard_protocol_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(sdcardio_protocol_writeblocks(&self->protocol, bufinfo.buf, mp_obj_get_int(start_block), bufinfo.len / 512));
+}
+MP_DEFINE_CONST_FUN_OBJ_3(sdcard_protocol_writeblocks_obj, sdcard_protocol_writeblocks);
+
+static mp_obj_t sdcard_protocol_background(mp_obj_t self_in) {
+    sdcard_protocol_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    sdcardio_protocol_background(&self->protocol);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(sdcard_protocol_background_obj, sdcard_protocol_background);
+
+// Returns None when there was nothing to do, as SDCard.sync() then doesn't
+// use the bus.
+static mp_obj_t sdcard_protocol_sync(mp_obj_t self_in) {
+    sdcard_protocol_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (sdcardio_protocol_synced(&self->protocol)) {
+        return mp_const_none;
+    }
+    return MP_OBJ_NEW_SMALL_INT(sdcardio_protocol_sync(&self->protocol));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(sdcard_protocol_sync_obj, sdcard_protocol_sync);
+
+static mp_obj_t sdcard_protocol_get_queued(mp_obj_t self_in) {
+    sdcard_protocol_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->protocol.write_queue_len);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(sdcard_protocol_get_queued_obj, sdcard_protocol_get_queued);
+
+MP_PROPERTY_GETTER(sdcard_protocol_queued_obj,
+    (mp_obj_t)&sdcard_protocol_get_queued_obj);
+
+static mp_obj_t sdcard_protocol_get_pending(mp_obj_t self_in) {
+    sdcard_protocol_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(self->pending);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(sdcard_protocol_get_pending_obj, sdcard_protocol_get_pending);
+
+MP_PROPERTY_GETTER(sdcard_protocol_pending_obj,
+    (mp_obj_t)&sdcard_protocol_get_pending_obj);
+
+static const mp_rom_map_elem_t sdcard_protocol_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&sdcard_protocol_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&sdcard_protocol_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_background), MP_ROM_PTR(&sdcard_protocol_background_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sync), MP_ROM_PTR(&sdcard_protocol_sync_obj) },
+    { MP_ROM_QSTR(MP_QSTR_queued), MP_ROM_PTR(&sdcard_protocol_queued_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pending), MP_ROM_PTR(&sdcard_protocol_pending_obj) },
+};
+static MP_DEFINE_CONST_DICT(sdcard_protocol_locals_dict, sdcard_protocol_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    sdcard_protocol_type,
+    MP_QSTR_SDCardProtocol,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, &sdcard_protocol_make_new,
+    locals_dict, &sdcard_protocol_locals_dict
+    );
+
+#endif
@@ -0,0 +1,117 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-module/socketpool/Transfer.h"
+
+#if defined(MICROPY_UNIX_COVERAGE)
+
+// Drives the loops behind socketpool.Socket's sendmsg, recvmsg_into and
+// sendfile from Python, with a simulated socket. send is a function that is
+// given the bytes to send and returns how many it took, or -1 for a broken
+// connection. recv is given the most bytes wanted and returns the bytes
+// received. readable returns whether recv would not wait. Each may raise
+// OSError.
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t send;
+    mp_obj_t recv;
+    mp_obj_t readable;
+    socketpool_transfer_t transfer;
+} socket_transfer_obj_t;
+
+const mp_obj_type_t socket_transfer_type;
+
+static mp_int_t socket_transfer_send(void *link, const uint8_t *buf, size_t len) {
+    socket_transfer_obj_t *self = link;
+    return mp_obj_get_int(mp_call_function_1(self->send, mp_obj_new_bytes(buf, len)));
+}
+
+static mp_uint_t socket_transfer_recv_into(void *link, uint8_t *buf, size_t len) {
+    socket_transfer_obj_t *self = link;
+    mp_obj_t received = mp_call_function_1(self->recv, MP_OBJ_NEW_SMALL_INT(len));
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(received, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len > len) {
+        mp_raise_ValueError(NULL);
+    }
+    memcpy(buf, bufinfo.buf, bufinfo.len);
+    return bufinfo.len;
+}
+
+static bool socket_transfer_readable(void *link) {
+    socket_transfer_obj_t *self = link;
+    return mp_obj_is_true(mp_call_function_0(self->readable));
+}
+
+static mp_obj_t socket_transfer_make_new(const mp_obj_type_t *type, size_t n_args,
+    size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_send, ARG_recv, ARG_readable };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_send, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_recv, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_readable, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    socket_transfer_obj_t *self = mp_obj_malloc(socket_transfer_obj_t, &socket_transfer_type);
+    self->send = args[ARG_send].u_obj;
+    self->recv = args[ARG_recv].u_obj;
+    self->readable = args[ARG_readable].u_obj;
+    self->transfer.link = self;
+    self->transfer.send = socket_transfer_send;
+    self->transfer.recv_into = socket_transfer_recv_into;
+    self->transfer.readable = socket_transfer_readable;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t socket_transfer_sendmsg(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socket_transfer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t n;
+    mp_obj_t *buffers;
+    mp_obj_get_array(buffers_in, &n, &buffers);
+    return mp_obj_new_int_from_uint(socketpool_transfer_sendmsg(&self->transfer, n, buffers));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(socket_transfer_sendmsg_obj, socket_transfer_sendmsg);
+
+static mp_obj_t socket_transfer_recvmsg_into(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socket_transfer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t n;
+    mp_obj_t *buffers;
+    mp_obj_get_array(buffers_in, &n, &buffers);
+    return mp_obj_new_int_from_uint(socketpool_transfer_recvmsg_into(&self->transfer, n, buffers));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(socket_transfer_recvmsg_into_obj, socket_transfer_recvmsg_into);
+
+// Unlike Socket.sendfile(), offset and count are required.
+static mp_obj_t socket_transfer_sendfile(size_t n_args, const mp_obj_t *args) {
+    socket_transfer_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    return mp_obj_new_int_from_uint(socketpool_transfer_sendfile(&self->transfer, args[1], mp_obj_get_int(args[2]), mp_obj_get_int(args[3])));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socket_transfer_sendfile_obj, 4, 4, socket_transfer_sendfile);
+
+static const mp_rom_map_elem_t socket_transfer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_sendmsg), MP_ROM_PTR(&socket_transfer_sendmsg_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvmsg_into), MP_ROM_PTR(&socket_transfer_recvmsg_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendfile), MP_ROM_PTR(&socket_transfer_sendfile_obj) },
+};
+static MP_DEFINE_CONST_DICT(socket_transfer_locals_dict, socket_transfer_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    socket_transfer_type,
+    MP_QSTR_SocketTransfer,
+    MP_TYPE_FLAG_NONE,
+    make_new, &socket_transfer_make_new,
+    locals_dict, &socket_transfer_locals_dict
+    );
+
+#endif
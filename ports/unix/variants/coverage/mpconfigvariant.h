@@ -40,6 +40,10 @@
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_TRACKED_ALLOC          (1)
+#define MICROPY_CURRENT_CODE_STATE     (1)
+#define MICROPY_GC_ALLOC_KIND          (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (1)
+#define MICROPY_FATFS_CACHE_SECTORS    (8)
 #define MICROPY_WARNINGS_CATEGORY      (1)
 
 // CIRCUITPY-CHANGE: Disable things never used in circuitpython
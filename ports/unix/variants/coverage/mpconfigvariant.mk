@@ -1,6 +1,10 @@
 # Disable optimisations and enable assert() on coverage builds.
 DEBUG ?= 1
 
+# CIRCUITPY-CHANGE: test littlefs, which CIRCUITPY can optionally use.
+MICROPY_VFS_LFS1 = 1
+MICROPY_VFS_LFS2 = 1
+
 CFLAGS += \
 	-fprofile-arcs -ftest-coverage \
 	-Wformat -Wmissing-declarations -Wmissing-prototypes \
@@ -24,6 +28,7 @@ $(BUILD)/lib/tjpgd/src/tjpgd.o: CFLAGS += -Wno-shadow -Wno-cast-align
 
 SRC_BITMAP := \
 	shared/runtime/context_manager_helpers.c \
+	busio_min.c \
 	displayio_min.c \
 	shared-bindings/__future__/__init__.c \
 	shared-bindings/aesio/aes.c \
@@ -38,6 +43,7 @@ SRC_BITMAP := \
 	shared-bindings/audiomp3/MP3Decoder.c \
 	shared-bindings/bitmapfilter/__init__.c \
 	shared-bindings/bitmaptools/__init__.c \
+	shared-bindings/busio/Transaction.c \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
@@ -46,6 +52,12 @@ SRC_BITMAP := \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
+	shared-bindings/memorymonitor/__init__.c \
+	shared-bindings/memorymonitor/AllocationAlarm.c \
+	shared-bindings/memorymonitor/AllocationProfiler.c \
+	shared-bindings/memorymonitor/AllocationSize.c \
+	shared-bindings/profiler/__init__.c \
+	shared-bindings/profiler/SamplingProfiler.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
 	shared-bindings/synthio/__init__.c \
@@ -60,6 +72,7 @@ SRC_BITMAP := \
 	shared-bindings/zlib/__init__.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
+	shared-module/analogbufio/SampleRing.c \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
 	shared-module/audiocore/WaveFile.c \
@@ -69,6 +82,7 @@ SRC_BITMAP := \
 	shared-module/audiomixer/MixerVoice.c \
 	shared-module/bitmapfilter/__init__.c \
 	shared-module/bitmaptools/__init__.c \
+	shared-module/busio/Transaction.c \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
@@ -76,8 +90,16 @@ SRC_BITMAP := \
 	shared-module/floppyio/__init__.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
+	shared-module/memorymonitor/__init__.c \
+	shared-module/memorymonitor/AllocationAlarm.c \
+	shared-module/memorymonitor/AllocationProfiler.c \
+	shared-module/memorymonitor/AllocationSize.c \
 	shared-module/os/getenv.c \
+	shared-module/profiler/__init__.c \
+	shared-module/profiler/SamplingProfiler.c \
 	shared-module/rainbowio/__init__.c \
+	shared-module/sdcardio/Protocol.c \
+	shared-module/socketpool/Transfer.c \
 	shared-module/struct/__init__.c \
 	shared-module/synthio/__init__.c \
 	shared-module/synthio/Math.c \
@@ -126,7 +148,10 @@ CFLAGS += \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_LOCALE=1 \
+	-DCIRCUITPY_MEMORYMONITOR=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
+	-DCIRCUITPY_PROFILER=1 \
+	-DCIRCUITPY_PROFILER_PORT_TIMER=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
@@ -135,6 +160,6 @@ CFLAGS += \
 	-DCIRCUITPY_ZLIB=1
 
 # CIRCUITPY-CHANGE: test native base classes.
-SRC_C += coverage.c native_base_class.c
+SRC_C += coverage.c native_base_class.c profiler_timer.c sample_ring.c sdcard_protocol.c socket_transfer.c
 SRC_CXX += coveragecpp.cpp
 CIRCUITPY_MESSAGE_COMPRESSION_LEVEL = 1
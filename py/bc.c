@@ -326,8 +326,11 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
     #if MICROPY_STACKLESS
     code_state->prev = NULL;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    // CIRCUITPY-CHANGE
+    #if MICROPY_CURRENT_CODE_STATE
     code_state->prev_state = NULL;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     code_state->frame = NULL;
     #endif
     mp_setup_code_state_helper(code_state, n_args, n_kw, args);
@@ -344,3 +347,26 @@ void mp_setup_code_state_native(mp_code_state_native_t *code_state, size_t n_arg
     mp_setup_code_state_helper((mp_code_state_t *)code_state, n_args, n_kw, args);
 }
 #endif
+
+// CIRCUITPY-CHANGE: Used by profilers to say where a sample was taken. ip is
+// an opcode within the bytecode function whose prelude starts at bytecode;
+// returns its source line and sets the file and function name.
+size_t mp_bytecode_get_location(const byte *bytecode, const mp_module_context_t *context, const byte *ip, qstr *source_file, qstr *block_name) {
+    const byte *p = bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(p);
+    MP_BC_PRELUDE_SIZE_DECODE(p);
+    const byte *line_info_top = p + n_info;
+    const byte *bytecode_start = p + n_info + n_cell;
+    qstr name = mp_decode_uint_value(p);
+    for (size_t i = 0; i < 1 + n_pos_args + n_kwonly_args; ++i) {
+        p = mp_decode_uint_skip(p);
+    }
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    *block_name = context->constants.qstr_table[name];
+    *source_file = context->constants.qstr_table[0];
+    #else
+    *block_name = name;
+    *source_file = context->constants.source_file;
+    #endif
+    return mp_bytecode_get_source_line(p, line_info_top, ip - bytecode_start);
+}
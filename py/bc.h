@@ -28,6 +28,8 @@
 #define MICROPY_INCLUDED_PY_BC_H
 
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 
 // bytecode layout:
 //
@@ -215,6 +217,10 @@ typedef struct _mp_module_constants_t {
 typedef struct _mp_module_context_t {
     mp_obj_module_t module;
     mp_module_constants_t constants;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    qstr lazy_filename; // .mpy file that functions not loaded yet are read from
+    #endif
 } mp_module_context_t;
 
 // Outer level struct defining a compiled module.
@@ -226,6 +232,10 @@ typedef struct _mp_compiled_module_t {
     size_t n_qstr;
     size_t n_obj;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    const struct _mp_raw_code_t **tier_table; // native scopes by number, see py/nativetier.c
+    #endif
 } mp_compiled_module_t;
 
 // Outer level struct defining a frozen module.
@@ -249,8 +259,11 @@ typedef struct _mp_code_state_t {
     #if MICROPY_STACKLESS
     struct _mp_code_state_t *prev;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    // CIRCUITPY-CHANGE: prev_state is also used by MICROPY_CURRENT_CODE_STATE
+    #if MICROPY_CURRENT_CODE_STATE
     struct _mp_code_state_t *prev_state;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     struct _mp_obj_frame_t *frame;
     #endif
     // Variable-length
@@ -283,9 +296,16 @@ mp_vm_return_kind_t mp_execute_bytecode(mp_code_state_t *code_state,
     volatile
 #endif
     mp_obj_t inject_exc);
+// CIRCUITPY-CHANGE
+#if MICROPY_DEBUG_VM_OPCODE_PAIRS
+// Indexed by [first opcode][following opcode].
+extern uint32_t mp_vm_opcode_pairs[256][256];
+#endif
 mp_code_state_t *mp_obj_fun_bc_prepare_codestate(mp_obj_t func, size_t n_args, size_t n_kw, const mp_obj_t *args);
 void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args);
 void mp_setup_code_state_native(mp_code_state_native_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args);
+// CIRCUITPY-CHANGE
+size_t mp_bytecode_get_location(const byte *bytecode, const mp_module_context_t *context, const byte *ip, qstr *source_file, qstr *block_name);
 void mp_bytecode_print(const mp_print_t *print, const struct _mp_raw_code_t *rc, const mp_module_constants_t *cm);
 void mp_bytecode_print2(const mp_print_t *print, const byte *ip, size_t len, struct _mp_raw_code_t *const *child_table, const mp_module_constants_t *cm);
 const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start, const byte *ip, struct _mp_raw_code_t *const *child_table, const mp_module_constants_t *cm);
@@ -302,6 +322,8 @@ static inline void mp_module_context_alloc_tables(mp_module_context_t *context,
     size_t nq = (n_qstr * sizeof(qstr_short_t) + sizeof(mp_uint_t) - 1) / sizeof(mp_uint_t);
     size_t no = n_obj;
     mp_uint_t *mem = m_new(mp_uint_t, nq + no);
+    // CIRCUITPY-CHANGE
+    GC_SET_ALLOC_KIND(mem, CONSTANTS);
     context->constants.qstr_table = (qstr_short_t *)mem;
     context->constants.obj_table = (mp_obj_t *)(mem + nq);
     #else
@@ -309,6 +331,8 @@ static inline void mp_module_context_alloc_tables(mp_module_context_t *context,
         context->constants.obj_table = NULL;
     } else {
         context->constants.obj_table = m_new(mp_obj_t, n_obj);
+        // CIRCUITPY-CHANGE
+        GC_SET_ALLOC_KIND(context->constants.obj_table, CONSTANTS);
     }
     #endif
 }
@@ -52,11 +52,12 @@
 #define MP_BC_FORMAT(op) ((0x000003a4 >> (2 * ((op) >> 4))) & 3)
 
 // Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op
+// CIRCUITPY-CHANGE: and fused opcodes (X), see below
 #define MP_BC_BASE_RESERVED                 (0x00) // ----------------
-#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDII---
+#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDIIXXX
 #define MP_BC_BASE_VINT_E                   (0x20) // MMLLLLSSDDBBBBBB
-#define MP_BC_BASE_VINT_O                   (0x30) // UUMMCCCC--------
-#define MP_BC_BASE_JUMP_E                   (0x40) // J-JJJJJEEEEF----
+#define MP_BC_BASE_VINT_O                   (0x30) // UUMMCCCCXXX-----
+#define MP_BC_BASE_JUMP_E                   (0x40) // JXJJJJJEEEEF----
 #define MP_BC_BASE_BYTE_O                   (0x50) // LLLLSSDTTTTTEEFF
 #define MP_BC_BASE_BYTE_E                   (0x60) // --BREEEYYI------
 #define MP_BC_LOAD_CONST_SMALL_INT_MULTI    (0x70) // LLLLLLLLLLLLLLLL
@@ -159,4 +160,25 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// CIRCUITPY-CHANGE: Fused opcodes ("superinstructions"). Each one does the
+// work of a common sequence of two opcodes with a single dispatch. They are
+// only emitted by py/emitbc.c, which picks sequences based on the profile
+// from MICROPY_DEBUG_VM_OPCODE_PAIRS, and never span a label or a line.
+// LOAD_FAST n; LOAD_ATTR/LOAD_METHOD/STORE_ATTR qstr
+#define MP_BC_LOAD_FAST_ATTR                (MP_BC_BASE_QSTR_O + 0x0d) // qstr; then a byte (local num)
+#define MP_BC_LOAD_FAST_METHOD              (MP_BC_BASE_QSTR_O + 0x0e) // qstr; then a byte (local num)
+#define MP_BC_LOAD_FAST_STORE_ATTR          (MP_BC_BASE_QSTR_O + 0x0f) // qstr; then a byte (local num)
+// LOAD_CONST_SMALL_INT k; BINARY_OP op
+#define MP_BC_BINARY_OP_SMALL_INT           (MP_BC_BASE_VINT_O + 0x08) // uint (op | (k + 16) << 6)
+// STORE_FAST n; LOAD_FAST n
+#define MP_BC_STORE_LOAD_FAST               (MP_BC_BASE_VINT_O + 0x09) // uint
+// LOAD_FAST n; BINARY_OP op
+#define MP_BC_BINARY_OP_FAST                (MP_BC_BASE_VINT_O + 0x0a) // uint (op | n << 6)
+// BINARY_OP op; POP_JUMP_IF_TRUE/POP_JUMP_IF_FALSE
+#define MP_BC_BINARY_OP_POP_JUMP_IF         (MP_BC_BASE_JUMP_E + 0x01) // signed relative bytecode offset; then a byte (op | 0x80 if jump on true)
+
+#define MP_BC_BINARY_OP_FUSED_SHIFT         (6)
+#define MP_BC_BINARY_OP_FUSED_MASK          ((1 << MP_BC_BINARY_OP_FUSED_SHIFT) - 1)
+#define MP_BC_POP_JUMP_IF_TRUE_FLAG         (0x80)
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
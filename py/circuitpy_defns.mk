@@ -315,6 +315,9 @@ endif
 ifeq ($(CIRCUITPY_PICODVI),1)
 SRC_PATTERNS += picodvi/%
 endif
+ifeq ($(CIRCUITPY_PROFILER),1)
+SRC_PATTERNS += profiler/%
+endif
 ifeq ($(CIRCUITPY_PS2IO),1)
 SRC_PATTERNS += ps2io/%
 endif
@@ -638,6 +641,7 @@ SRC_SHARED_MODULE_ALL = \
 	adafruit_bus_device/spi_device/SPIDevice.c \
 	busdisplay/__init__.c \
 	busdisplay/BusDisplay.c \
+	busio/Transaction.c \
 	canio/Match.c \
 	canio/Message.c \
 	canio/RemoteTransmissionRequest.c \
@@ -683,6 +687,7 @@ SRC_SHARED_MODULE_ALL = \
 	max3421e/Max3421E.c \
 	memorymonitor/__init__.c \
 	memorymonitor/AllocationAlarm.c \
+	memorymonitor/AllocationProfiler.c \
 	memorymonitor/AllocationSize.c \
 	network/__init__.c \
 	msgpack/__init__.c \
@@ -690,6 +695,8 @@ SRC_SHARED_MODULE_ALL = \
 	onewireio/OneWire.c \
 	os/__init__.c \
 	paralleldisplaybus/ParallelBus.c \
+	profiler/__init__.c \
+	profiler/SamplingProfiler.c \
 	qrio/__init__.c \
 	qrio/QRDecoder.c \
 	rainbowio/__init__.c \
@@ -697,11 +704,13 @@ SRC_SHARED_MODULE_ALL = \
 	rgbmatrix/RGBMatrix.c \
 	rgbmatrix/__init__.c \
 	rotaryio/IncrementalEncoder.c \
+	sdcardio/Protocol.c \
 	sdcardio/SDCard.c \
 	sdcardio/__init__.c \
 	sharpdisplay/SharpMemoryFramebuffer.c \
 	sharpdisplay/__init__.c \
 	socket/__init__.c \
+	socketpool/Transfer.c \
 	storage/__init__.c \
 	struct/__init__.c \
 	supervisor/__init__.c \
@@ -812,10 +821,12 @@ endif
 ifeq ($(CIRCUITPY_HASHLIB_MBEDTLS_ONLY),1)
 SRC_MOD += $(addprefix lib/mbedtls/library/, \
         sha1.c \
-        sha256.c \
         sha512.c \
         platform_util.c \
 	)
+ifeq ($(CIRCUITPY_HASHLIB_SHA256_SOFTWARE),0)
+SRC_MOD += lib/mbedtls/library/sha256.c
+endif
 CFLAGS += \
 	  -isystem $(TOP)/lib/mbedtls/include \
 	  -DMBEDTLS_CONFIG_FILE='"$(TOP)/lib/mbedtls_config/mbedtls_config_hashlib.h"' \
@@ -853,6 +864,7 @@ endif
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE_INTERNAL = \
 $(filter $(SRC_PATTERNS), \
+	analogbufio/SampleRing.c \
 	displayio/bus_core.c \
 	displayio/display_core.c \
 	os/getenv.c \
@@ -48,7 +48,10 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_OS_DUPTERM            (0)
 #define MICROPY_ROM_TEXT_COMPRESSION     (0)
 #define MICROPY_VFS_LFS1                 (0)
+// CIRCUITPY-CHANGE: Set by the makefile when CIRCUITPY is littlefs.
+#ifndef MICROPY_VFS_LFS2
 #define MICROPY_VFS_LFS2                 (0)
+#endif
 
 // Sorted alphabetically for easy finding.
 //
@@ -61,6 +64,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_MODULE_CONST        (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
+#define MICROPY_CURRENT_CODE_STATE       (CIRCUITPY_MEMORYMONITOR || CIRCUITPY_PROFILER)
 #define MICROPY_DEBUG_PRINTERS           (0)
 #define MICROPY_EMIT_INLINE_THUMB        (CIRCUITPY_ENABLE_MPY_NATIVE)
 #define MICROPY_EMIT_THUMB               (CIRCUITPY_ENABLE_MPY_NATIVE)
@@ -75,6 +79,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_ERROR_REPORTING          (CIRCUITPY_FULL_BUILD ? MICROPY_ERROR_REPORTING_NORMAL : MICROPY_ERROR_REPORTING_TERSE)
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
+#define MICROPY_GC_ALLOC_KIND            (CIRCUITPY_MEMORYMONITOR)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
@@ -90,10 +95,13 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
+#define MICROPY_OPT_BINARY_OP_FLOAT_FAST_PATH (CIRCUITPY_OPT_BINARY_OP_FLOAT_FAST_PATH)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_MPZ_FAST_ARITH       (CIRCUITPY_FULL_BUILD)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (CIRCUITPY_FULL_BUILD)
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
@@ -164,13 +172,40 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_FATFS_USE_LABEL       (1)
 #define MICROPY_FATFS_RPATH           (2)
 #define MICROPY_FATFS_MULTI_PARTITION (1)
+#define MICROPY_FATFS_USE_EXPAND      (CIRCUITPY_FULL_BUILD)
 #define MICROPY_FATFS_LFN_UNICODE      2  // UTF-8
 
 // Only enable this if you really need it. It allocates a byte cache of this size.
 // #define MICROPY_FATFS_MAX_SS           (4096)
 
+// Sectors of RAM for caching the filesystem, so that files written or read at
+// the same time don't evict each other. Boards can set a size to suit their RAM.
+#ifndef MICROPY_FATFS_CACHE_SECTORS
+#define MICROPY_FATFS_CACHE_SECTORS   (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#endif
+
 #define FILESYSTEM_BLOCK_SIZE       (512)
 
+// Geometry and tuning of CIRCUITPY when it is littlefs. A littlefs block is a
+// flash erase sector. The caches hold whole filesystem blocks of 512 bytes.
+// Lookahead is in bytes, one bit per littlefs block, so 32 bytes cover 1MB.
+// After block cycles erases, littlefs moves a metadata block so that its
+// wear is spread across the flash.
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+#ifndef CIRCUITPY_LITTLEFS_BLOCK_SIZE
+#define CIRCUITPY_LITTLEFS_BLOCK_SIZE (4096)
+#endif
+#ifndef CIRCUITPY_LITTLEFS_CACHE_SIZE
+#define CIRCUITPY_LITTLEFS_CACHE_SIZE (FILESYSTEM_BLOCK_SIZE)
+#endif
+#ifndef CIRCUITPY_LITTLEFS_LOOKAHEAD_SIZE
+#define CIRCUITPY_LITTLEFS_LOOKAHEAD_SIZE (32)
+#endif
+#ifndef CIRCUITPY_LITTLEFS_BLOCK_CYCLES
+#define CIRCUITPY_LITTLEFS_BLOCK_CYCLES (500)
+#endif
+#endif
+
 #define MICROPY_VFS                 (1)
 #define MICROPY_VFS_FAT             (MICROPY_VFS)
 #define MICROPY_READER_VFS          (MICROPY_VFS)
@@ -417,6 +452,13 @@ void background_callback_run_all(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// Blocks of RAM used by USB mass storage to read ahead of sequential reads and
+// to gather the pieces of a WRITE10 command into larger writes. 8 blocks match
+// the 4kB erase sector of most external flash chips.
+#ifndef CIRCUITPY_USB_MSC_CACHE_BLOCKS
+#define CIRCUITPY_USB_MSC_CACHE_BLOCKS (CIRCUITPY_FULL_BUILD ? 8 : 0)
+#endif
+
 #ifndef CIRCUITPY_PYSTACK_SIZE
 #define CIRCUITPY_PYSTACK_SIZE 1536
 #endif
@@ -446,7 +488,10 @@ void background_callback_run_all(void);
 #define CIRCUITPY_STATUS_LED_POWER_INVERTED (0)
 #endif
 
+// boot_out.txt is written with FatFs, and is there for USB hosts to read.
+#if !CIRCUITPY_FILESYSTEM_LITTLEFS
 #define CIRCUITPY_BOOT_OUTPUT_FILE "/boot_out.txt"
+#endif
 
 #ifndef CIRCUITPY_BOOT_COUNTER
 #define CIRCUITPY_BOOT_COUNTER 0
@@ -286,6 +286,15 @@ CFLAGS += -DCIRCUITPY_ESPCAMERA=$(CIRCUITPY_ESPCAMERA)
 CIRCUITPY__EVE ?= 0
 CFLAGS += -DCIRCUITPY__EVE=$(CIRCUITPY__EVE)
 
+# Format CIRCUITPY as littlefs instead of FAT. littlefs spreads writes over the
+# whole flash, instead of rewriting the FAT on every change. Hosts can't read
+# it, so USB mass storage is turned off.
+CIRCUITPY_FILESYSTEM_LITTLEFS ?= 0
+CFLAGS += -DCIRCUITPY_FILESYSTEM_LITTLEFS=$(CIRCUITPY_FILESYSTEM_LITTLEFS)
+ifeq ($(CIRCUITPY_FILESYSTEM_LITTLEFS),1)
+MICROPY_VFS_LFS2 = 1
+endif
+
 CIRCUITPY_FLOPPYIO ?= 0
 CFLAGS += -DCIRCUITPY_FLOPPYIO=$(CIRCUITPY_FLOPPYIO)
 
@@ -314,6 +323,11 @@ CFLAGS += -DCIRCUITPY_HASHLIB_MBEDTLS=$(CIRCUITPY_HASHLIB_MBEDTLS)
 CIRCUITPY_HASHLIB_MBEDTLS_ONLY ?= $(call enable-if-all,$(CIRCUITPY_HASHLIB_MBEDTLS) $(call enable-if-not,$(CIRCUITPY_SSL)))
 CFLAGS += -DCIRCUITPY_HASHLIB_MBEDTLS_ONLY=$(CIRCUITPY_HASHLIB_MBEDTLS_ONLY)
 
+# SHA-256 from lib/crypto-algorithms instead of mbedtls, for ports without SHA
+# hardware. The port must link lib/crypto-algorithms/sha256.c.
+CIRCUITPY_HASHLIB_SHA256_SOFTWARE ?= 0
+CFLAGS += -DCIRCUITPY_HASHLIB_SHA256_SOFTWARE=$(CIRCUITPY_HASHLIB_SHA256_SOFTWARE)
+
 CIRCUITPY_I2CTARGET ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_I2CTARGET=$(CIRCUITPY_I2CTARGET)
 
@@ -388,6 +402,9 @@ CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 CIRCUITPY_ONEWIREIO ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 
+CIRCUITPY_OPT_BINARY_OP_FLOAT_FAST_PATH ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_BINARY_OP_FLOAT_FAST_PATH=$(CIRCUITPY_OPT_BINARY_OP_FLOAT_FAST_PATH)
+
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
@@ -415,6 +432,9 @@ CFLAGS += -DCIRCUITPY_PIXELMAP=$(CIRCUITPY_PIXELMAP)
 CIRCUITPY_PS2IO ?= 0
 CFLAGS += -DCIRCUITPY_PS2IO=$(CIRCUITPY_PS2IO)
 
+CIRCUITPY_PROFILER ?= 0
+CFLAGS += -DCIRCUITPY_PROFILER=$(CIRCUITPY_PROFILER)
+
 CIRCUITPY_PULSEIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_PULSEIO=$(CIRCUITPY_PULSEIO)
 
@@ -518,7 +538,7 @@ CFLAGS += -DCIRCUITPY_STATUS_BAR=$(CIRCUITPY_STATUS_BAR)
 CIRCUITPY_STORAGE ?= 1
 CFLAGS += -DCIRCUITPY_STORAGE=$(CIRCUITPY_STORAGE)
 
-CIRCUITPY_STORAGE_EXTEND ?= $(CIRCUITPY_DUALBANK)
+CIRCUITPY_STORAGE_EXTEND ?= $(call enable-if-all,$(CIRCUITPY_DUALBANK) $(call enable-if-not,$(CIRCUITPY_FILESYSTEM_LITTLEFS)))
 CFLAGS += -DCIRCUITPY_STORAGE_EXTEND=$(CIRCUITPY_STORAGE_EXTEND)
 
 CIRCUITPY_STRUCT ?= 1
@@ -610,7 +630,7 @@ CFLAGS += -DCIRCUITPY_USB_MIDI=$(CIRCUITPY_USB_MIDI)
 CIRCUITPY_USB_MIDI_ENABLED_DEFAULT ?= $(USB_NUM_ENDPOINT_PAIRS_8_OR_GREATER)
 CFLAGS += -DCIRCUITPY_USB_MIDI_ENABLED_DEFAULT=$(CIRCUITPY_USB_MIDI_ENABLED_DEFAULT)
 
-CIRCUITPY_USB_MSC ?= $(CIRCUITPY_USB_DEVICE)
+CIRCUITPY_USB_MSC ?= $(call enable-if-all,$(CIRCUITPY_USB_DEVICE) $(call enable-if-not,$(CIRCUITPY_FILESYSTEM_LITTLEFS)))
 CFLAGS += -DCIRCUITPY_USB_MSC=$(CIRCUITPY_USB_MSC)
 CIRCUITPY_USB_MSC_ENABLED_DEFAULT ?= $(CIRCUITPY_USB_MSC)
 CFLAGS += -DCIRCUITPY_USB_MSC_ENABLED_DEFAULT=$(CIRCUITPY_USB_MSC_ENABLED_DEFAULT)
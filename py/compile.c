@@ -38,6 +38,8 @@
 #include "py/nativeglue.h"
 #include "py/persistentcode.h"
 #include "py/smallint.h"
+// CIRCUITPY-CHANGE
+#include "py/nativetier.h"
 
 #if MICROPY_ENABLE_COMPILER
 
@@ -185,6 +187,12 @@ typedef struct _compiler_t {
     scope_t *scope_head;
     scope_t *scope_cur;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    uint16_t tier_num_scopes; // scopes created so far
+    uint16_t tier_target; // scope to compile as native code, see py/nativetier.c
+    #endif
+
     emit_t *emit;                                   // current emitter
     #if NEED_METHOD_TABLE
     const emit_method_table_t *emit_method_table;   // current emit method table
@@ -220,6 +228,8 @@ STATIC void mp_emit_common_start_pass(mp_emit_common_t *emit, pass_kind_t pass)
             emit->children = NULL;
         } else {
             emit->children = m_new0(mp_raw_code_t *, emit->ct_cur_child);
+            // CIRCUITPY-CHANGE
+            GC_SET_ALLOC_KIND(emit->children, BYTECODE);
         }
     }
     emit->ct_cur_child = 0;
@@ -298,7 +308,28 @@ STATIC void compile_decrease_except_level(compiler_t *comp) {
 }
 
 STATIC scope_t *scope_new_and_link(compiler_t *comp, scope_kind_t kind, mp_parse_node_t pn, uint emit_options) {
+    // CIRCUITPY-CHANGE: scopes being promoted must be native from MP_PASS_SCOPE
+    // onwards so that they reserve the extra labels the native emitter needs
+    #if MICROPY_NATIVE_TIER
+    ++comp->tier_num_scopes;
+    bool tier = false;
+    if (comp->scope_cur != NULL && (comp->scope_cur->scope_flags & MP_SCOPE_FLAG_NATIVE_TIER)) {
+        // nested in a scope being promoted, from which it inherited its emitter
+        tier = emit_options == MP_EMIT_OPT_NATIVE_PYTHON;
+    } else if (emit_options == MP_EMIT_OPT_NONE || emit_options == MP_EMIT_OPT_BYTECODE) {
+        tier = comp->tier_target == comp->tier_num_scopes
+            || (comp->tier_target == MP_NATIVE_TIER_ALL && (kind == SCOPE_FUNCTION || kind == SCOPE_LAMBDA));
+    }
+    if (tier) {
+        emit_options = MP_EMIT_OPT_NATIVE_PYTHON;
+    }
+    #endif
     scope_t *scope = scope_new(kind, pn, emit_options);
+    #if MICROPY_NATIVE_TIER
+    if (tier) {
+        scope->scope_flags |= MP_SCOPE_FLAG_NATIVE_TIER;
+    }
+    #endif
     scope->parent = comp->scope_cur;
     scope->next = NULL;
     if (comp->scope_head == NULL) {
@@ -349,6 +380,13 @@ STATIC void compile_load_id(compiler_t *comp, qstr qst) {
         mp_emit_common_id_op(comp->emit, &mp_emit_bc_method_table_load_id_ops, comp->scope_cur, qst);
         #endif
     }
+    // CIRCUITPY-CHANGE: used by native's unbound local check, which is only
+    // emitted for scopes being promoted
+    #if MICROPY_NATIVE_TIER
+    if (comp->scope_cur->scope_flags & MP_SCOPE_FLAG_NATIVE_TIER) {
+        reserve_labels_for_native(comp, 1);
+    }
+    #endif
 }
 
 STATIC void compile_store_id(compiler_t *comp, qstr qst) {
@@ -365,6 +403,14 @@ STATIC void compile_store_id(compiler_t *comp, qstr qst) {
 
 STATIC void compile_delete_id(compiler_t *comp, qstr qst) {
     if (comp->pass == MP_PASS_SCOPE) {
+        // CIRCUITPY-CHANGE: native code doesn't unbind deleted variables, so a
+        // scope that deletes any can't be promoted
+        #if MICROPY_NATIVE_TIER
+        if (comp->scope_cur->scope_flags & MP_SCOPE_FLAG_NATIVE_TIER) {
+            comp->scope_cur->emit_options = MP_EMIT_OPT_BYTECODE;
+            comp->scope_cur->scope_flags &= ~MP_SCOPE_FLAG_NATIVE_TIER;
+        }
+        #endif
         mp_emit_common_get_id_for_modification(comp->scope_cur, qst);
     } else {
         #if NEED_METHOD_TABLE
@@ -1053,6 +1099,15 @@ STATIC void compile_yield_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
 }
 
 STATIC void compile_raise_stmt(compiler_t *comp, mp_parse_node_struct_t *pns) {
+    // CIRCUITPY-CHANGE: the native emitter only supports "raise x", so a scope
+    // with any other form of raise can't be promoted
+    #if MICROPY_NATIVE_TIER
+    if (comp->pass == MP_PASS_SCOPE && (comp->scope_cur->scope_flags & MP_SCOPE_FLAG_NATIVE_TIER)
+        && (MP_PARSE_NODE_IS_NULL(pns->nodes[0]) || MP_PARSE_NODE_IS_STRUCT_KIND(pns->nodes[0], PN_raise_stmt_arg))) {
+        comp->scope_cur->emit_options = MP_EMIT_OPT_BYTECODE;
+        comp->scope_cur->scope_flags &= ~MP_SCOPE_FLAG_NATIVE_TIER;
+    }
+    #endif
     if (MP_PARSE_NODE_IS_NULL(pns->nodes[0])) {
         // raise
         EMIT_ARG(raise_varargs, 0);
@@ -3460,7 +3515,8 @@ STATIC void scope_compute_things(scope_t *scope) {
     }
 }
 
-#if !MICROPY_PERSISTENT_CODE_SAVE
+// CIRCUITPY-CHANGE
+#if !MICROPY_PERSISTENT_CODE_SAVE && !MICROPY_NATIVE_TIER
 STATIC
 #endif
 void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
@@ -3473,6 +3529,15 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
     comp->continue_label = INVALID_LABEL;
     mp_emit_common_init(&comp->emit_common, source_file);
 
+    // CIRCUITPY-CHANGE: number the scopes of modules whose source is retained
+    #if MICROPY_NATIVE_TIER
+    const bool tier_numbered = parse_tree->tier_source != MP_OBJ_NULL && !is_repl;
+    if (tier_numbered) {
+        comp->tier_target = MP_STATE_VM(native_tier_target);
+    }
+    cm->tier_table = NULL;
+    #endif
+
     // create the module scope
     #if MICROPY_EMIT_NATIVE
     const uint emit_opt = MP_STATE_VM(default_emit_opt);
@@ -3517,16 +3582,39 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
     // compute some things related to scope and identifiers
     for (scope_t *s = comp->scope_head; s != NULL && comp->compile_error == MP_OBJ_NULL; s = s->next) {
         scope_compute_things(s);
+        // CIRCUITPY-CHANGE: generators and async functions are never promoted
+        #if MICROPY_NATIVE_TIER
+        if ((s->scope_flags & MP_SCOPE_FLAG_NATIVE_TIER)
+            && (s->scope_flags & (MP_SCOPE_FLAG_GENERATOR | MP_SCOPE_FLAG_ASYNC))) {
+            s->emit_options = MP_EMIT_OPT_BYTECODE;
+            s->scope_flags &= ~MP_SCOPE_FLAG_NATIVE_TIER;
+        }
+        #endif
     }
 
     // set max number of labels now that it's calculated
     emit_bc_set_max_num_labels(emit_bc, max_num_labels);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    if (comp->tier_target != 0) {
+        cm->tier_table = m_new0(const mp_raw_code_t *, comp->tier_num_scopes + 1);
+    }
+    #endif
+
     // compile MP_PASS_STACK_SIZE, MP_PASS_CODE_SIZE, MP_PASS_EMIT
     #if MICROPY_EMIT_NATIVE
     emit_t *emit_native = NULL;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    uint16_t tier_scope = 0;
+    #endif
     for (scope_t *s = comp->scope_head; s != NULL && comp->compile_error == MP_OBJ_NULL; s = s->next) {
+        // CIRCUITPY-CHANGE: scopes are numbered in the order they were created
+        #if MICROPY_NATIVE_TIER
+        ++tier_scope;
+        #endif
         #if MICROPY_EMIT_INLINE_ASM
         if (s->emit_options == MP_EMIT_OPT_ASM) {
             // inline assembly
@@ -3592,6 +3680,22 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
                 }
             }
         }
+
+        // CIRCUITPY-CHANGE
+        #if MICROPY_NATIVE_TIER
+        if (tier_numbered && SCOPE_IS_FUNC_LIKE(s->kind)
+            && (s->scope_flags & (MP_SCOPE_FLAG_GENERATOR | MP_SCOPE_FLAG_ASYNC)) == 0) {
+            if (s->emit_options == MP_EMIT_OPT_NONE || s->emit_options == MP_EMIT_OPT_BYTECODE) {
+                s->raw_code->tier_scope = tier_scope;
+            } else if (s->scope_flags & MP_SCOPE_FLAG_NATIVE_TIER) {
+                s->raw_code->tier_scope = tier_scope;
+                s->raw_code->tier_name = s->simple_name;
+                if (comp->tier_target == tier_scope || comp->tier_target == MP_NATIVE_TIER_ALL) {
+                    cm->tier_table[tier_scope] = s->raw_code;
+                }
+            }
+        }
+        #endif
     }
 
     if (comp->compile_error != MP_OBJ_NULL) {
@@ -3667,6 +3771,14 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
 
 mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl) {
     mp_compiled_module_t cm;
+    // CIRCUITPY-CHANGE: functions that may be promoted need to find their source
+    #if MICROPY_NATIVE_TIER
+    if (parse_tree->tier_source != MP_OBJ_NULL && !is_repl) {
+        mp_native_tier_context_t *context = m_new0(mp_native_tier_context_t, 1);
+        context->source = parse_tree->tier_source;
+        cm.context = &context->context;
+    } else
+    #endif
     cm.context = m_new_obj(mp_module_context_t);
     cm.context->module.globals = mp_globals_get();
     mp_compile_to_raw_code(parse_tree, source_file, is_repl, &cm);
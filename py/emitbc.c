@@ -32,6 +32,8 @@
 #include <assert.h>
 
 #include "py/mpstate.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 #include "py/smallint.h"
 #include "py/emit.h"
 #include "py/bc0.h"
@@ -73,6 +75,14 @@ struct _emit_t {
 
     size_t n_info;
     size_t n_cell;
+
+    // CIRCUITPY-CHANGE: The last opcode written and where it starts, if the
+    // next opcode may be fused with it. last_op is the generic form of the
+    // opcode (eg MP_BC_LOAD_FAST_N for any LOAD_FAST) and last_op_arg its
+    // argument. Any other write, a label or a new source line clears it.
+    byte last_op;
+    mp_uint_t last_op_arg;
+    size_t last_op_offset;
 };
 
 emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
@@ -145,6 +155,7 @@ STATIC void emit_write_code_info_bytes_lines(emit_t *emit, mp_uint_t bytes_to_sk
 // all functions must go through this one to emit byte code
 STATIC uint8_t *emit_get_cur_to_write_bytecode(void *emit_in, size_t num_bytes_to_write) {
     emit_t *emit = emit_in;
+    emit->last_op = MP_BC_BASE_RESERVED;
     if (emit->suppress) {
         return emit->dummy_data;
     }
@@ -159,6 +170,29 @@ STATIC uint8_t *emit_get_cur_to_write_bytecode(void *emit_in, size_t num_bytes_t
     }
 }
 
+// CIRCUITPY-CHANGE: Record that the opcode just written, which started at
+// offset, may be fused with the next one. Must be called after the write.
+STATIC void emit_bc_set_last_op(emit_t *emit, size_t offset, byte op, mp_uint_t arg) {
+    if (!emit->suppress) {
+        emit->last_op = op;
+        emit->last_op_arg = arg;
+        emit->last_op_offset = offset;
+    }
+}
+
+STATIC bool emit_bc_last_op_is(emit_t *emit, byte op, mp_uint_t max_arg) {
+    return emit->last_op == op && emit->last_op_arg <= max_arg;
+}
+
+// Remove the last opcode so it can be replaced by a fused one. Its stack
+// adjustment has already been applied, so the fused opcode only needs to
+// apply the difference.
+STATIC mp_uint_t emit_bc_rewind_last_op(emit_t *emit) {
+    emit->bytecode_offset = emit->last_op_offset;
+    emit->last_op = MP_BC_BASE_RESERVED;
+    return emit->last_op_arg;
+}
+
 STATIC void emit_write_bytecode_raw_byte(emit_t *emit, byte b1) {
     byte *c = emit_get_cur_to_write_bytecode(emit, 1);
     c[0] = b1;
@@ -290,6 +324,7 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
     emit->overflow = false;
+    emit->last_op = MP_BC_BASE_RESERVED;
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -374,6 +409,8 @@ bool mp_emit_bc_end_pass(emit_t *emit) {
         emit->code_info_size = emit->code_info_offset;
         emit->bytecode_size = emit->bytecode_offset;
         emit->code_base = m_new0(byte, emit->code_info_size + emit->bytecode_size);
+        // CIRCUITPY-CHANGE
+        GC_SET_ALLOC_KIND(emit->code_base, BYTECODE);
 
     } else if (emit->pass == MP_PASS_EMIT) {
         // Code info and/or bytecode can shrink during this pass.
@@ -431,6 +468,8 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
         emit->last_source_line_offset = emit->bytecode_offset;
         emit->last_source_line = source_line;
+        // CIRCUITPY-CHANGE: don't fuse opcodes across lines
+        emit->last_op = MP_BC_BASE_RESERVED;
     }
     #else
     (void)emit;
@@ -442,6 +481,8 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
     // Assigning a label ends any dead-code region, and all following opcodes
     // should be emitted (until another unconditional flow control).
     emit->suppress = false;
+    // CIRCUITPY-CHANGE: don't fuse opcodes across a jump target
+    emit->last_op = MP_BC_BASE_RESERVED;
 
     mp_emit_bc_adjust_stack_size(emit, 0);
     if (emit->pass == MP_PASS_SCOPE) {
@@ -484,8 +525,11 @@ void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
     assert(MP_SMALL_INT_FITS(arg));
     if (-MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS <= arg
         && arg < MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS) {
+        size_t offset = emit->bytecode_offset;
         emit_write_bytecode_byte(emit, 1,
             MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS + arg);
+        // CIRCUITPY-CHANGE
+        emit_bc_set_last_op(emit, offset, MP_BC_LOAD_CONST_SMALL_INT, arg + MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS);
     } else {
         emit_write_bytecode_byte_int(emit, 1, MP_BC_LOAD_CONST_SMALL_INT, arg);
     }
@@ -507,11 +551,21 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_FAST == MP_BC_LOAD_FAST_N);
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
+    // CIRCUITPY-CHANGE: STORE_FAST n; LOAD_FAST n leaves the value on the stack
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST && emit->last_op == MP_BC_STORE_FAST_N && emit->last_op_arg == local_num) {
+        emit_bc_rewind_last_op(emit);
+        emit_write_bytecode_byte_uint(emit, 1, MP_BC_STORE_LOAD_FAST, local_num);
+        return;
+    }
+    size_t offset = emit->bytecode_offset;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
         emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
     } else {
         emit_write_bytecode_byte_uint(emit, 1, MP_BC_LOAD_FAST_N + kind, local_num);
     }
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
+        emit_bc_set_last_op(emit, offset, MP_BC_LOAD_FAST_N, local_num);
+    }
 }
 
 void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
@@ -522,6 +576,13 @@ void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
 }
 
 void mp_emit_bc_load_method(emit_t *emit, qstr qst, bool is_super) {
+    // CIRCUITPY-CHANGE
+    if (!is_super && emit_bc_last_op_is(emit, MP_BC_LOAD_FAST_N, 255)) {
+        byte local_num = emit_bc_rewind_last_op(emit);
+        emit_write_bytecode_byte_qstr(emit, 1, MP_BC_LOAD_FAST_METHOD, qst);
+        emit_write_bytecode_raw_byte(emit, local_num);
+        return;
+    }
     int stack_adj = 1 - 2 * is_super;
     emit_write_bytecode_byte_qstr(emit, stack_adj, is_super ? MP_BC_LOAD_SUPER_METHOD : MP_BC_LOAD_METHOD, qst);
 }
@@ -543,6 +604,17 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 }
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
+    // CIRCUITPY-CHANGE
+    if (kind != MP_EMIT_ATTR_DELETE && emit_bc_last_op_is(emit, MP_BC_LOAD_FAST_N, 255)) {
+        byte local_num = emit_bc_rewind_last_op(emit);
+        if (kind == MP_EMIT_ATTR_LOAD) {
+            emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_FAST_ATTR, qst);
+        } else {
+            emit_write_bytecode_byte_qstr(emit, -2, MP_BC_LOAD_FAST_STORE_ATTR, qst);
+        }
+        emit_write_bytecode_raw_byte(emit, local_num);
+        return;
+    }
     if (kind == MP_EMIT_ATTR_LOAD) {
         emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
     } else {
@@ -558,11 +630,16 @@ void mp_emit_bc_store_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kin
     MP_STATIC_ASSERT(MP_BC_STORE_FAST_N + MP_EMIT_IDOP_LOCAL_FAST == MP_BC_STORE_FAST_N);
     MP_STATIC_ASSERT(MP_BC_STORE_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_STORE_DEREF);
     (void)qst;
+    size_t offset = emit->bytecode_offset;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
         emit_write_bytecode_byte(emit, -1, MP_BC_STORE_FAST_MULTI + local_num);
     } else {
         emit_write_bytecode_byte_uint(emit, -1, MP_BC_STORE_FAST_N + kind, local_num);
     }
+    // CIRCUITPY-CHANGE
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
+        emit_bc_set_last_op(emit, offset, MP_BC_STORE_FAST_N, local_num);
+    }
 }
 
 void mp_emit_bc_store_global(emit_t *emit, qstr qst, int kind) {
@@ -610,6 +687,13 @@ void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
 }
 
 void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
+    // CIRCUITPY-CHANGE: compare (or any binary op) and branch
+    if (emit_bc_last_op_is(emit, MP_BC_BINARY_OP_MULTI, MP_BINARY_OP_NUM_BYTECODE)) {
+        byte op = emit_bc_rewind_last_op(emit);
+        emit_write_bytecode_byte_label(emit, -1, MP_BC_BINARY_OP_POP_JUMP_IF, label);
+        emit_write_bytecode_raw_byte(emit, op | (cond ? MP_BC_POP_JUMP_IF_TRUE_FLAG : 0));
+        return;
+    }
     if (cond) {
         emit_write_bytecode_byte_label(emit, -1, MP_BC_POP_JUMP_IF_TRUE, label);
     } else {
@@ -698,7 +782,18 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         invert = true;
         op = MP_BINARY_OP_IS;
     }
-    emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
+    // CIRCUITPY-CHANGE: fuse with a preceding load of the right-hand operand
+    if (emit_bc_last_op_is(emit, MP_BC_LOAD_CONST_SMALL_INT, MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - 1)) {
+        mp_uint_t arg = emit_bc_rewind_last_op(emit);
+        emit_write_bytecode_byte_uint(emit, -1, MP_BC_BINARY_OP_SMALL_INT, op | arg << MP_BC_BINARY_OP_FUSED_SHIFT);
+    } else if (emit_bc_last_op_is(emit, MP_BC_LOAD_FAST_N, ~(mp_uint_t)0 >> MP_BC_BINARY_OP_FUSED_SHIFT)) {
+        mp_uint_t local_num = emit_bc_rewind_last_op(emit);
+        emit_write_bytecode_byte_uint(emit, -1, MP_BC_BINARY_OP_FAST, op | local_num << MP_BC_BINARY_OP_FUSED_SHIFT);
+    } else {
+        size_t offset = emit->bytecode_offset;
+        emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
+        emit_bc_set_last_op(emit, offset, MP_BC_BINARY_OP_MULTI, op);
+    }
     if (invert) {
         emit_write_bytecode_byte(emit, 0, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
     }
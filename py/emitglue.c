@@ -54,6 +54,8 @@ mp_uint_t mp_verbose_flag = 0;
 
 mp_raw_code_t *mp_emit_glue_new_raw_code(void) {
     mp_raw_code_t *rc = m_new0(mp_raw_code_t, 1);
+    // CIRCUITPY-CHANGE
+    GC_SET_ALLOC_KIND(rc, BYTECODE);
     rc->kind = MP_CODE_RESERVED;
     #if MICROPY_PY_SYS_SETTRACE
     rc->line_of_definition = 0;
@@ -194,6 +196,14 @@ mp_obj_t mp_make_function_from_raw_code(const mp_raw_code_t *rc, const mp_module
             } else if ((rc->scope_flags & MP_SCOPE_FLAG_GENERATOR) != 0) {
                 ((mp_obj_base_t *)MP_OBJ_TO_PTR(fun))->type = &mp_type_native_gen_wrap;
             }
+            // CIRCUITPY-CHANGE: functions nested in promoted ones keep their name
+            #if MICROPY_NATIVE_TIER
+            if (rc->tier_scope != 0) {
+                mp_obj_fun_bc_t *self_fun = (mp_obj_fun_bc_t *)MP_OBJ_TO_PTR(fun);
+                self_fun->tier_scope = rc->tier_scope;
+                self_fun->tier.name = rc->tier_name;
+            }
+            #endif
             break;
         #endif
         #if MICROPY_EMIT_INLINE_ASM
@@ -203,8 +213,16 @@ mp_obj_t mp_make_function_from_raw_code(const mp_raw_code_t *rc, const mp_module
         #endif
         default:
             // rc->kind should always be set and BYTECODE is the only remaining case
-            assert(rc->kind == MP_CODE_BYTECODE);
-            fun = mp_obj_new_fun_bc(def_args, rc->fun_data, context, rc->children);
+            // CIRCUITPY-CHANGE: the function loads its bytecode when first used
+            #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+            if (rc->kind == MP_CODE_BYTECODE_LAZY) {
+                fun = mp_obj_new_fun_bc(def_args, mp_obj_fun_bc_lazy_bytecode, context, (mp_raw_code_t *const *)rc);
+            } else
+            #endif
+            {
+                assert(rc->kind == MP_CODE_BYTECODE);
+                fun = mp_obj_new_fun_bc(def_args, rc->fun_data, context, rc->children);
+            }
             // check for generator functions and if so change the type of the object
             // A generator is MP_SCOPE_FLAG_ASYNC | MP_SCOPE_FLAG_GENERATOR,
             // so check for ASYNC first.
@@ -222,6 +240,11 @@ mp_obj_t mp_make_function_from_raw_code(const mp_raw_code_t *rc, const mp_module
             self_fun->rc = rc;
             #endif
 
+            // CIRCUITPY-CHANGE
+            #if MICROPY_NATIVE_TIER
+            ((mp_obj_fun_bc_t *)MP_OBJ_TO_PTR(fun))->tier_scope = rc->tier_scope;
+            #endif
+
             break;
     }
 
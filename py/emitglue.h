@@ -47,6 +47,12 @@ typedef enum {
     MP_CODE_NATIVE_PY,
     MP_CODE_NATIVE_VIPER,
     MP_CODE_NATIVE_ASM,
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    // Bytecode still in the .mpy file of its module. The raw code is an
+    // mp_raw_code_lazy_t, which records where to find it in the file.
+    MP_CODE_BYTECODE_LAZY,
+    #endif
 } mp_raw_code_kind_t;
 
 // compiled bytecode: instance in RAM, referenced by outer scope, usually freed after first (and only) use
@@ -78,8 +84,24 @@ typedef struct _mp_raw_code_t {
     #if MICROPY_EMIT_MACHINE_CODE
     mp_uint_t type_sig; // for viper, compressed as 2-bit types; ret is MSB, then arg0, arg1, etc
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    uint16_t tier_scope; // position of the scope in its module if it can be promoted, else 0
+    qstr tier_name; // name of a function compiled by the native tier
+    #endif
 } mp_raw_code_t;
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+// An MP_CODE_BYTECODE_LAZY raw code. Its fun_data and children are NULL until
+// it is loaded in place, after which the extra fields are no longer used.
+typedef struct _mp_raw_code_lazy_t {
+    mp_raw_code_t rc;
+    size_t offset; // of the raw code in the .mpy file
+    uint32_t checksum; // of the bytes of the raw code in the file
+} mp_raw_code_lazy_t;
+#endif
+
 mp_raw_code_t *mp_emit_glue_new_raw_code(void);
 
 void mp_emit_glue_assign_bytecode(mp_raw_code_t *rc, const byte *code,
@@ -1420,23 +1420,54 @@ STATIC void emit_native_load_null(emit_t *emit) {
     emit_post_push_imm(emit, VTYPE_PYOBJ, 0);
 }
 
-STATIC void emit_native_load_fast(emit_t *emit, qstr qst, mp_uint_t local_num) {
+// CIRCUITPY-CHANGE
+#if MICROPY_NATIVE_TIER
+// Code promoted by the native tier must behave like the bytecode it replaces,
+// so reading an unbound variable raises NameError instead of yielding NULL.
+// Only the raising path, which doesn't return, touches registers here, so the
+// emitter's view of the stack is unchanged.
+// Note: 1 label is reserved for this function, starting at *emit->label_slot
+STATIC void emit_native_check_bound(emit_t *emit, int reg) {
+    mp_uint_t label = *emit->label_slot;
+    ASM_JUMP_IF_REG_NONZERO(emit->as, reg, label, false);
+    emit_native_mov_reg_qstr(emit, REG_ARG_1, MP_QSTR_NameError);
+    ASM_CALL_IND(emit->as, MP_F_LOAD_GLOBAL);
+    ASM_MOV_REG_REG(emit->as, REG_ARG_1, REG_RET);
+    ASM_CALL_IND(emit->as, MP_F_NATIVE_RAISE);
+    mp_asm_base_label_assign(&emit->as->base, label);
+}
+#endif
+
+STATIC void emit_native_load_fast_checked(emit_t *emit, qstr qst, mp_uint_t local_num, bool check) {
     DEBUG_printf("load_fast(%s, " UINT_FMT ")\n", qstr_str(qst), local_num);
     vtype_kind_t vtype = emit->local_vtype[local_num];
     if (vtype == VTYPE_UNBOUND) {
         EMIT_NATIVE_VIPER_TYPE_ERROR(emit, MP_ERROR_TEXT("local '%q' used before type known"), qst);
     }
     emit_native_pre(emit);
+    int reg;
     if (local_num < MAX_REGS_FOR_LOCAL_VARS && CAN_USE_REGS_FOR_LOCALS(emit)) {
-        emit_post_push_reg(emit, vtype, reg_local_table[local_num]);
+        reg = reg_local_table[local_num];
     } else {
         need_reg_single(emit, REG_TEMP0, 0);
         emit_native_mov_reg_state(emit, REG_TEMP0, LOCAL_IDX_LOCAL_VAR(emit, local_num));
-        emit_post_push_reg(emit, vtype, REG_TEMP0);
+        reg = REG_TEMP0;
+    }
+    #if MICROPY_NATIVE_TIER
+    if (check) {
+        emit_native_check_bound(emit, reg);
     }
+    #else
+    (void)check;
+    #endif
+    emit_post_push_reg(emit, vtype, reg);
 }
 
-STATIC void emit_native_load_deref(emit_t *emit, qstr qst, mp_uint_t local_num) {
+STATIC void emit_native_load_fast(emit_t *emit, qstr qst, mp_uint_t local_num) {
+    emit_native_load_fast_checked(emit, qst, local_num, false);
+}
+
+STATIC void emit_native_load_deref(emit_t *emit, qstr qst, mp_uint_t local_num, bool check) {
     DEBUG_printf("load_deref(%s, " UINT_FMT ")\n", qstr_str(qst), local_num);
     need_reg_single(emit, REG_RET, 0);
     emit_native_load_fast(emit, qst, local_num);
@@ -1444,15 +1475,31 @@ STATIC void emit_native_load_deref(emit_t *emit, qstr qst, mp_uint_t local_num)
     int reg_base = REG_RET;
     emit_pre_pop_reg_flexible(emit, &vtype, &reg_base, -1, -1);
     ASM_LOAD_REG_REG_OFFSET(emit->as, REG_RET, reg_base, 1);
+    #if MICROPY_NATIVE_TIER
+    if (check) {
+        emit_native_check_bound(emit, REG_RET);
+    }
+    #else
+    (void)check;
+    #endif
     // closed over vars are always Python objects
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
 STATIC void emit_native_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind) {
+    // CIRCUITPY-CHANGE
+    bool check = false;
+    #if MICROPY_NATIVE_TIER
+    if (emit->scope->scope_flags & MP_SCOPE_FLAG_NATIVE_TIER) {
+        // cell objects are loaded with LOAD_FAST too, but those are always bound
+        id_info_t *id = scope_find(emit->scope, qst);
+        check = kind == MP_EMIT_IDOP_LOCAL_DEREF || (id != NULL && id->kind == ID_INFO_KIND_LOCAL);
+    }
+    #endif
     if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
-        emit_native_load_fast(emit, qst, local_num);
+        emit_native_load_fast_checked(emit, qst, local_num, check);
     } else {
-        emit_native_load_deref(emit, qst, local_num);
+        emit_native_load_deref(emit, qst, local_num, check);
     }
 }
 
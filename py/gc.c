@@ -123,6 +123,30 @@
 #define FTB_CLEAR(area, block) do { area->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] &= (~(1 << ((block) & 7))); } while (0)
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_ALLOC_KIND
+// KTB = kind table byte
+// 4 bits per block, holding the gc_alloc_kind_t of each head block
+
+#define BLOCKS_PER_KTB (2)
+
+#define KTB_SHIFT(block) (4 * ((block) & 1))
+#define KTB_GET(area, block) ((area->gc_kind_table_start[(block) / BLOCKS_PER_KTB] >> KTB_SHIFT(block)) & 0xf)
+#define KTB_SET(area, block, kind) do { \
+        byte *ktb = &area->gc_kind_table_start[(block) / BLOCKS_PER_KTB]; \
+        *ktb = (*ktb & ~(0xf << KTB_SHIFT(block))) | ((kind) << KTB_SHIFT(block)); \
+} while (0)
+
+const char *const gc_alloc_kind_names[GC_ALLOC_KIND_NUM] = {
+    "other", "qstr", "bytecode", "constants", "globals", "display", "audio",
+};
+
+// Shown for head blocks in gc_dump_alloc_table.
+STATIC const char gc_alloc_kind_chars[GC_ALLOC_KIND_NUM] = {
+    '*', 'Q', 'C', 'K', 'G', 'P', 'W',
+};
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_ENTER() mp_thread_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
 #define GC_EXIT() mp_thread_mutex_unlock(&MP_STATE_MEM(gc_mutex))
@@ -150,6 +174,7 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     //     F = A * BLOCKS_PER_ATB / BLOCKS_PER_FTB
     //     P = A * BLOCKS_PER_ATB * BYTES_PER_BLOCK
     // => T = A * (1 + BLOCKS_PER_ATB / BLOCKS_PER_FTB + BLOCKS_PER_ATB * BYTES_PER_BLOCK)
+    // CIRCUITPY-CHANGE: plus K = A * BLOCKS_PER_ATB / BLOCKS_PER_KTB for the kind table
     size_t total_byte_len = (byte *)end - (byte *)start;
     #if MICROPY_ENABLE_FINALISER
     area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE)
@@ -157,10 +182,17 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
         / (
             MP_BITS_PER_BYTE
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB
+            #if MICROPY_GC_ALLOC_KIND
+            + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_KTB
+            #endif
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK
             );
     #else
-    area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE) / (1 + MP_BITS_PER_BYTE / 2 * BYTES_PER_BLOCK);
+    area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE) / (1 + MP_BITS_PER_BYTE / 2 * BYTES_PER_BLOCK
+        #if MICROPY_GC_ALLOC_KIND
+        + BLOCKS_PER_ATB / BLOCKS_PER_KTB
+        #endif
+        );
     #endif
 
     area->gc_alloc_table_start = (byte *)start;
@@ -170,6 +202,16 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     area->gc_finaliser_table_start = area->gc_alloc_table_start + area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ALLOC_KIND
+    size_t gc_kind_table_byte_len = (area->gc_alloc_table_byte_len * BLOCKS_PER_ATB + BLOCKS_PER_KTB - 1) / BLOCKS_PER_KTB;
+    #if MICROPY_ENABLE_FINALISER
+    area->gc_kind_table_start = area->gc_finaliser_table_start + gc_finaliser_table_byte_len;
+    #else
+    area->gc_kind_table_start = area->gc_alloc_table_start + area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE;
+    #endif
+    #endif
+
     size_t gc_pool_block_len = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
     area->gc_pool_start = (byte *)end - gc_pool_block_len * BYTES_PER_BLOCK;
     area->gc_pool_end = end;
@@ -186,6 +228,12 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     memset(area->gc_alloc_table_start, 0, area->gc_alloc_table_byte_len + ALLOC_TABLE_GAP_BYTE);
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ALLOC_KIND
+    assert(area->gc_pool_start >= area->gc_kind_table_start + gc_kind_table_byte_len);
+    memset(area->gc_kind_table_start, 0, gc_kind_table_byte_len);
+    #endif
+
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
 
@@ -267,10 +315,22 @@ STATIC bool gc_try_add_heap(size_t failed_alloc) {
     // the additional metadata overheads as calculated in gc_setup_area().
     //
     // Rather than reproduce all of that logic here, we approximate that adding
-    // (13/512) is enough overhead for sufficiently large heap areas (the
-    // overhead converges to 3/128, but there's some fixed overhead and some
-    // rounding up of partial block sizes).
-    size_t needed = failed_alloc + MAX(2048, failed_alloc * 13 / 512);
+    // the table bytes per pool byte plus 1/512 is enough overhead for
+    // sufficiently large heap areas (there's some fixed overhead and some
+    // rounding up of partial block sizes). Without the kind table this is
+    // 13/512, as the overhead converges to 3/128.
+    // CIRCUITPY-CHANGE: derived from the table sizes, as the kind table
+    // more than doubles the overhead.
+    const size_t table_bits = MP_BITS_PER_BYTE
+        #if MICROPY_ENABLE_FINALISER
+        + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB
+        #endif
+        #if MICROPY_GC_ALLOC_KIND
+        + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_KTB
+        #endif
+    ;
+    const size_t pool_bits = MP_BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK;
+    size_t needed = failed_alloc + MAX(2048, failed_alloc / pool_bits * table_bits + failed_alloc / 512);
 
     size_t avail = gc_get_max_new_split();
 
@@ -890,6 +950,11 @@ found:
     // mark first block as used head
     ATB_FREE_TO_HEAD(area, start_block);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ALLOC_KIND
+    KTB_SET(area, start_block, GC_ALLOC_KIND_OTHER);
+    #endif
+
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
     for (size_t bl = start_block + 1; bl <= end_block; bl++) {
@@ -1257,11 +1322,72 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
 
     DEBUG_printf("gc_realloc(%p -> %p)\n", ptr_in, ptr_out);
     memcpy(ptr_out, ptr_in, n_blocks * BYTES_PER_BLOCK);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ALLOC_KIND
+    gc_set_alloc_kind(ptr_out, gc_get_alloc_kind(ptr_in));
+    #endif
     gc_free(ptr_in);
     return ptr_out;
 }
 #endif // Alternative gc_realloc impl
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_ALLOC_KIND
+// Returns the area of ptr if it is the start of a heap allocation.
+STATIC mp_state_mem_area_t *gc_get_head_area(const void *ptr) {
+    mp_state_mem_area_t *area;
+    #if MICROPY_GC_SPLIT_HEAP
+    area = gc_get_ptr_area(ptr);
+    #else
+    area = VERIFY_PTR(ptr) ? &MP_STATE_MEM(area) : NULL;
+    #endif
+    if (area != NULL && ATB_GET_KIND(area, BLOCK_FROM_PTR(area, ptr)) != AT_HEAD) {
+        area = NULL;
+    }
+    return area;
+}
+
+void gc_set_alloc_kind(const void *ptr, gc_alloc_kind_t kind) {
+    GC_ENTER();
+    mp_state_mem_area_t *area = gc_get_head_area(ptr);
+    if (area != NULL) {
+        KTB_SET(area, BLOCK_FROM_PTR(area, ptr), kind);
+    }
+    GC_EXIT();
+}
+
+gc_alloc_kind_t gc_get_alloc_kind(const void *ptr) {
+    GC_ENTER();
+    gc_alloc_kind_t kind = GC_ALLOC_KIND_OTHER;
+    mp_state_mem_area_t *area = gc_get_head_area(ptr);
+    if (area != NULL) {
+        kind = KTB_GET(area, BLOCK_FROM_PTR(area, ptr));
+    }
+    GC_EXIT();
+    return kind;
+}
+
+void gc_alloc_kind_info(size_t bytes[GC_ALLOC_KIND_NUM]) {
+    GC_ENTER();
+    memset(bytes, 0, GC_ALLOC_KIND_NUM * sizeof(size_t));
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t kind = GC_ALLOC_KIND_OTHER;
+        for (size_t bl = 0; bl <= area->gc_last_used_block; bl++) {
+            switch (ATB_GET_KIND(area, bl)) {
+                case AT_HEAD:
+                case AT_MARK:
+                    kind = KTB_GET(area, bl);
+                    MP_FALLTHROUGH
+                case AT_TAIL:
+                    bytes[kind] += BYTES_PER_BLOCK;
+                    break;
+            }
+        }
+    }
+    GC_EXIT();
+}
+#endif
+
 void gc_dump_info(const mp_print_t *print) {
     gc_info_t info;
     gc_info(&info);
@@ -1401,11 +1527,27 @@ void gc_dump_alloc_table(const mp_print_t *print) {
                     c = 'm';
                     break;
             }
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_ALLOC_KIND
+            if (ATB_GET_KIND(area, bl) == AT_HEAD && KTB_GET(area, bl) != GC_ALLOC_KIND_OTHER) {
+                c = gc_alloc_kind_chars[KTB_GET(area, bl)];
+            }
+            #endif
             mp_printf(print, "%c", c);
         }
         mp_print_str(print, "\n");
     }
     GC_EXIT();
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ALLOC_KIND
+    size_t bytes[GC_ALLOC_KIND_NUM];
+    gc_alloc_kind_info(bytes);
+    mp_print_str(print, "GC allocation kinds:\n");
+    for (size_t kind = 0; kind < GC_ALLOC_KIND_NUM; kind++) {
+        mp_printf(print, "  %c %s %u\n", gc_alloc_kind_chars[kind], gc_alloc_kind_names[kind], (uint)bytes[kind]);
+    }
+    #endif
 }
 
 #if 0
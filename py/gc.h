@@ -107,4 +107,32 @@ void gc_info(gc_info_t *info);
 void gc_dump_info(const mp_print_t *print);
 void gc_dump_alloc_table(const mp_print_t *print);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_ALLOC_KIND
+// What a heap allocation is used for. New allocations are
+// GC_ALLOC_KIND_OTHER until tagged with GC_SET_ALLOC_KIND.
+typedef enum {
+    GC_ALLOC_KIND_OTHER,
+    GC_ALLOC_KIND_QSTR,
+    GC_ALLOC_KIND_BYTECODE,
+    GC_ALLOC_KIND_CONSTANTS,
+    GC_ALLOC_KIND_MODULE_GLOBALS,
+    GC_ALLOC_KIND_DISPLAY,
+    GC_ALLOC_KIND_AUDIO,
+    GC_ALLOC_KIND_NUM,
+} gc_alloc_kind_t;
+
+extern const char *const gc_alloc_kind_names[GC_ALLOC_KIND_NUM];
+
+// ptr may be NULL or not on the heap, in which case nothing is recorded.
+void gc_set_alloc_kind(const void *ptr, gc_alloc_kind_t kind);
+gc_alloc_kind_t gc_get_alloc_kind(const void *ptr);
+// Fills in the number of bytes allocated for each kind.
+void gc_alloc_kind_info(size_t bytes[GC_ALLOC_KIND_NUM]);
+
+#define GC_SET_ALLOC_KIND(ptr, kind) gc_set_alloc_kind((ptr), GC_ALLOC_KIND_##kind)
+#else
+#define GC_SET_ALLOC_KIND(ptr, kind) ((void)0)
+#endif
+
 #endif // MICROPY_INCLUDED_PY_GC_H
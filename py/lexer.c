@@ -31,6 +31,8 @@
 #include "py/reader.h"
 #include "py/lexer.h"
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE
+#include "py/nativetier.h"
 
 #if MICROPY_ENABLE_COMPILER
 
@@ -832,6 +834,11 @@ void mp_lexer_to_next(mp_lexer_t *lex) {
 }
 
 mp_lexer_t *mp_lexer_new(qstr src_name, mp_reader_t reader) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    mp_native_tier_capture_reader(&reader);
+    #endif
+
     mp_lexer_t *lex = m_new_obj(mp_lexer_t);
 
     lex->source_name = src_name;
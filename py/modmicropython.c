@@ -25,12 +25,14 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "py/builtin.h"
 #include "py/stackctrl.h"
 #include "py/runtime.h"
 #include "py/gc.h"
 #include "py/mphal.h"
+#include "py/bc.h"
 
 #if MICROPY_PY_MICROPYTHON
 
@@ -49,6 +51,50 @@ STATIC mp_obj_t mp_micropython_opt_level(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_opt_level_obj, 0, 1, mp_micropython_opt_level);
 #endif
 
+// CIRCUITPY-CHANGE
+#if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_NATIVE_TIER
+STATIC mp_obj_t mp_micropython_native_tier(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(MP_STATE_VM(native_tier_threshold));
+    } else {
+        mp_int_t threshold = mp_obj_get_int(args[0]);
+        if (threshold < 0) {
+            mp_raise_ValueError(NULL);
+        }
+        MP_STATE_VM(native_tier_threshold) = threshold;
+        return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_native_tier_obj, 0, 1, mp_micropython_native_tier);
+#endif
+
+// CIRCUITPY-CHANGE
+#if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_DEBUG_VM_OPCODE_PAIRS
+// Returns a list of (count, opcode, next_opcode) for every pair of opcodes
+// executed so far, and clears the counts if reset is true.
+STATIC mp_obj_t mp_micropython_opcode_pairs(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    for (size_t first = 1; first < 256; ++first) {
+        for (size_t second = 0; second < 256; ++second) {
+            uint32_t count = mp_vm_opcode_pairs[first][second];
+            if (count != 0) {
+                mp_obj_t items[3] = {
+                    mp_obj_new_int_from_uint(count),
+                    MP_OBJ_NEW_SMALL_INT(first),
+                    MP_OBJ_NEW_SMALL_INT(second),
+                };
+                mp_obj_list_append(list, mp_obj_new_tuple(3, items));
+            }
+        }
+    }
+    if (n_args == 1 && mp_obj_is_true(args[0])) {
+        memset(mp_vm_opcode_pairs, 0, sizeof(mp_vm_opcode_pairs));
+    }
+    return list;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_opcode_pairs_obj, 0, 1, mp_micropython_opcode_pairs);
+#endif
+
 #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_PY_MICROPYTHON_MEM_INFO
 
 #if MICROPY_MEM_STATS
@@ -172,6 +218,13 @@ STATIC const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_ENABLE_COMPILER
     { MP_ROM_QSTR(MP_QSTR_opt_level), MP_ROM_PTR(&mp_micropython_opt_level_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_NATIVE_TIER
+    { MP_ROM_QSTR(MP_QSTR_native_tier), MP_ROM_PTR(&mp_micropython_native_tier_obj) },
+    #endif
+    #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_DEBUG_VM_OPCODE_PAIRS
+    { MP_ROM_QSTR(MP_QSTR_opcode_pairs), MP_ROM_PTR(&mp_micropython_opcode_pairs_obj) },
+    #endif
     #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_PY_MICROPYTHON_MEM_INFO
     #if MICROPY_MEM_STATS
     { MP_ROM_QSTR(MP_QSTR_mem_total), MP_ROM_PTR(&mp_micropython_mem_total_obj) },
@@ -323,6 +323,13 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether functions nested in an imported .mpy file are left on the filesystem
+// until first called, instead of being loaded into RAM when the file is imported
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_LAZY
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (0)
+#endif
+
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
 // objects which is also required for sys.settrace.
@@ -413,6 +420,14 @@
 // Convenience definition for whether any native or inline assembler emitter is enabled
 #define MICROPY_EMIT_MACHINE_CODE (MICROPY_EMIT_NATIVE || MICROPY_EMIT_INLINE_ASM)
 
+// CIRCUITPY-CHANGE
+// Whether bytecode functions count their calls and backward jumps so that hot
+// ones can be recompiled with the native emitter at runtime, see py/nativetier.c.
+// Nothing is promoted until MP_STATE_VM(native_tier_threshold) is made non-zero.
+#ifndef MICROPY_NATIVE_TIER
+#define MICROPY_NATIVE_TIER (0)
+#endif
+
 // Whether native relocatable code loaded from .mpy files is explicitly tracked
 // so that the GC cannot reclaim it.  Needed on architectures that allocate
 // executable memory on the MicroPython heap and don't explicitly track this
@@ -433,6 +448,11 @@
 #define MICROPY_ENABLE_COMPILER (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_NATIVE_TIER && (!MICROPY_EMIT_NATIVE || !MICROPY_ENABLE_COMPILER || MICROPY_STACKLESS)
+#error "MICROPY_NATIVE_TIER requires a native emitter and the compiler, and does not support MICROPY_STACKLESS"
+#endif
+
 // Whether the compiler is dynamically configurable (ie at runtime)
 // This will disable the ability to execute native/viper code
 #ifndef MICROPY_DYNAMIC_COMPILER
@@ -523,6 +543,13 @@
 #define MICROPY_DEBUG_VM_STACK_OVERFLOW (0)
 #endif
 
+// CIRCUITPY-CHANGE: Whether the VM counts how often each opcode follows each
+// other opcode (see micropython.opcode_pairs()). This is used to pick which
+// opcode sequences the bytecode emitter fuses, and slows down the VM.
+#ifndef MICROPY_DEBUG_VM_OPCODE_PAIRS
+#define MICROPY_DEBUG_VM_OPCODE_PAIRS (0)
+#endif
+
 // Whether to enable extra instrumentation for valgrind
 #ifndef MICROPY_DEBUG_VALGRIND
 #define MICROPY_DEBUG_VALGRIND (0)
@@ -555,6 +582,14 @@
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE: Have the VM do + - * / and comparisons of floats (and a
+// float with a small int) itself, rather than going through mp_binary_op and
+// the float type. With MICROPY_OBJ_REPR_C the result is stored in the object
+// word, so such arithmetic does not allocate at all.
+#ifndef MICROPY_OPT_BINARY_OP_FLOAT_FAST_PATH
+#define MICROPY_OPT_BINARY_OP_FLOAT_FAST_PATH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Use extra RAM to cache map lookups by remembering the likely location of
 // the index. Avoids the hash computation on unordered maps, and avoids the
 // linear search on ordered (especially in-ROM) maps. Can provide a +10-15%
@@ -575,6 +610,14 @@
 #define MICROPY_OPT_MPZ_BITWISE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to use Karatsuba multiplication for large mpz operands and Montgomery
+// reduction with a sliding window for pow() with an odd modulus.  Trades
+// code size and temporary heap use for speed on large integers.
+#ifndef MICROPY_OPT_MPZ_FAST_ARITH
+#define MICROPY_OPT_MPZ_FAST_ARITH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 
 // Whether math.factorial is large, fast and recursive (1) or small and slow (0).
 #ifndef MICROPY_OPT_MATH_FACTORIAL
@@ -612,6 +655,12 @@
 #define MICROPY_FATFS_NUM_PERSISTENT (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Number of FF_MIN_SS byte sectors in the write-back cache below FatFs.
+#ifndef MICROPY_FATFS_CACHE_SECTORS
+#define MICROPY_FATFS_CACHE_SECTORS (0)
+#endif
+
 // Hook for the VM at the start of the opcode loop (can contain variable
 // definitions usable by the other hook functions)
 #ifndef MICROPY_VM_HOOK_INIT
@@ -644,6 +693,14 @@
 #define MICROPY_GC_SPLIT_HEAP (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to record what each heap allocation is used for (qstrs, bytecode,
+// display buffers, ...) so memory use can be broken down by kind. Costs 4
+// bits of RAM per heap block.
+#ifndef MICROPY_GC_ALLOC_KIND
+#define MICROPY_GC_ALLOC_KIND (0)
+#endif
+
 // Whether regions should be added/removed from the split heap as needed.
 #ifndef MICROPY_GC_SPLIT_HEAP_AUTO
 #define MICROPY_GC_SPLIT_HEAP_AUTO (0)
@@ -1510,6 +1567,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// CIRCUITPY-CHANGE: Whether MP_STATE_THREAD(current_code_state) follows the
+// innermost running bytecode function, so that profilers can tell which line
+// of Python is executing. Costs a word per frame and two stores per call.
+#ifndef MICROPY_CURRENT_CODE_STATE
+#define MICROPY_CURRENT_CODE_STATE (MICROPY_PY_SYS_SETTRACE)
+#endif
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
@@ -99,6 +99,10 @@ typedef struct _mp_state_mem_area_t {
     #if MICROPY_ENABLE_FINALISER
     byte *gc_finaliser_table_start;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ALLOC_KIND
+    byte *gc_kind_table_start;
+    #endif
     byte *gc_pool_start;
     byte *gc_pool_end;
 
@@ -229,6 +233,11 @@ typedef struct _mp_state_vm_t {
     #if MICROPY_EMIT_NATIVE
     uint8_t default_emit_opt; // one of MP_EMIT_OPT_xxx
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    mp_uint_t native_tier_threshold; // 0 disables promotion to native code
+    uint16_t native_tier_target; // scope being recompiled, see py/nativetier.c
+    #endif
     #endif
 
     // size of the emergency exception buf, if it's dynamically allocated
@@ -313,6 +322,10 @@ typedef struct _mp_state_thread_t {
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_CURRENT_CODE_STATE
     struct _mp_code_state_t *current_code_state;
     #endif
 
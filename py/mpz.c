@@ -461,6 +461,222 @@ STATIC size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+// CIRCUITPY-CHANGE: subquadratic multiplication and Montgomery arithmetic
+#if MICROPY_OPT_MPZ_FAST_ARITH
+
+// Operands with fewer digits than this are multiplied with mpn_mul.
+#ifndef MPZ_KARATSUBA_THRESHOLD
+#define MPZ_KARATSUBA_THRESHOLD (32)
+#endif
+
+/* computes i += j, where i has a fixed length of ilen digits
+   returns the carry out of the top digit of i
+   assumes ilen >= jlen; i and j need not be normalised
+*/
+STATIC mpz_dig_t mpn_add_fixed(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_t carry = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        carry += (mpz_dbl_dig_t)*idig + (mpz_dbl_dig_t)*jdig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; carry != 0 && ilen > 0; --ilen, ++idig) {
+        carry += *idig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    return carry;
+}
+
+/* computes i -= j, where i has a fixed length of ilen digits
+   assumes ilen >= jlen and i >= j; i and j need not be normalised
+*/
+STATIC void mpn_sub_fixed(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        borrow += (mpz_dbl_dig_t)*idig - (mpz_dbl_dig_t)*jdig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+
+    for (; borrow != 0 && ilen > 0; --ilen, ++idig) {
+        borrow += *idig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+}
+
+/* returns the number of scratch digits mpn_mul_karatsuba needs for operands
+   of at most n digits
+*/
+STATIC size_t mpn_mul_karatsuba_scratch(size_t n) {
+    size_t len = 0;
+    while (n >= MPZ_KARATSUBA_THRESHOLD) {
+        // each level holds both half sums and their product
+        n = n / 2 + 2;
+        len += 4 * n;
+    }
+    return len;
+}
+
+/* computes i = j * k
+   assumes i has jlen + klen digits, all zero; assumes jlen >= klen
+   j and k need not be normalised; tmp holds mpn_mul_karatsuba_scratch(jlen) digits
+*/
+STATIC void mpn_mul_karatsuba(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen, mpz_dig_t *tmp) {
+    if (klen < MPZ_KARATSUBA_THRESHOLD) {
+        mpn_mul(idig, jdig, jlen, kdig, klen);
+        return;
+    }
+
+    if (jlen >= 2 * klen) {
+        // very unbalanced: multiply k by klen-sized pieces of j
+        mpz_dig_t *prod = tmp;
+        tmp += 2 * klen;
+        for (size_t ilen = jlen + klen; jlen > 0;) {
+            size_t n = MIN(jlen, klen);
+            memset(prod, 0, (n + klen) * sizeof(mpz_dig_t));
+            if (n == klen) {
+                mpn_mul_karatsuba(prod, jdig, n, kdig, klen, tmp);
+            } else {
+                mpn_mul_karatsuba(prod, kdig, klen, jdig, n, tmp);
+            }
+            mpn_add_fixed(idig, ilen, prod, n + klen);
+            idig += n;
+            ilen -= n;
+            jdig += n;
+            jlen -= n;
+        }
+        return;
+    }
+
+    // split j = j1 * B**m + j0 and k = k1 * B**m + k0; klen > m because jlen < 2 * klen
+    size_t m = jlen / 2;
+    size_t j1len = jlen - m;
+    size_t k1len = klen - m;
+    size_t slen = j1len + 1;
+    mpz_dig_t *jsum = tmp;
+    mpz_dig_t *ksum = jsum + slen;
+    mpz_dig_t *mid = ksum + slen;
+    tmp = mid + 2 * slen;
+
+    // j0 * k0 and j1 * k1 land in disjoint halves of the result
+    mpn_mul_karatsuba(idig, jdig, m, kdig, m, tmp);
+    mpn_mul_karatsuba(idig + 2 * m, jdig + m, j1len, kdig + m, k1len, tmp);
+
+    // (j0 + j1) * (k0 + k1) - j0 * k0 - j1 * k1 = j0 * k1 + j1 * k0
+    memcpy(jsum, jdig + m, j1len * sizeof(mpz_dig_t));
+    jsum[j1len] = mpn_add_fixed(jsum, j1len, jdig, m);
+    memset(ksum, 0, slen * sizeof(mpz_dig_t));
+    memcpy(ksum, kdig, m * sizeof(mpz_dig_t));
+    mpn_add_fixed(ksum, slen, kdig + m, k1len);
+    memset(mid, 0, 2 * slen * sizeof(mpz_dig_t));
+    mpn_mul_karatsuba(mid, jsum, slen, ksum, slen, tmp);
+    mpn_sub_fixed(mid, 2 * slen, idig, 2 * m);
+    mpn_sub_fixed(mid, 2 * slen, idig + 2 * m, j1len + k1len);
+
+    size_t midlen = mpn_remove_trailing_zeros(mid, mid + 2 * slen);
+    mpn_add_fixed(idig + m, jlen + klen - m, mid, midlen);
+}
+
+/* computes i = j * k
+   returns number of digits in i
+   assumes enough memory in i; assumes i is zeroed; assumes normalised j, k
+   can have j, k point to same memory
+*/
+STATIC size_t mpn_mul_fast(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen) {
+    if (jlen < klen) {
+        mpz_dig_t *t = jdig;
+        jdig = kdig;
+        kdig = t;
+        size_t tlen = jlen;
+        jlen = klen;
+        klen = tlen;
+    }
+
+    size_t tmp_len = klen < MPZ_KARATSUBA_THRESHOLD ? 0 : mpn_mul_karatsuba_scratch(jlen);
+    mpz_dig_t *tmp = NULL;
+    if (tmp_len > 0) {
+        tmp = m_new_maybe(mpz_dig_t, tmp_len);
+    }
+    if (tmp == NULL) {
+        // small operands, or no room for the scratch space
+        return mpn_mul(idig, jdig, jlen, kdig, klen);
+    }
+
+    mpn_mul_karatsuba(idig, jdig, jlen, kdig, klen, tmp);
+    m_del(mpz_dig_t, tmp, tmp_len);
+
+    return mpn_remove_trailing_zeros(idig, idig + jlen + klen);
+}
+
+/* computes -1 / m mod 2**DIG_SIZE
+   assumes m is odd
+*/
+STATIC mpz_dig_t mpn_mont_inverse(mpz_dig_t m) {
+    // m * m == 1 mod 8, and each Newton step doubles the number of correct bits
+    mpz_dbl_dig_t inv = m;
+    for (unsigned int bits = 3; bits < DIG_SIZE; bits *= 2) {
+        inv = (inv * (2 - (mpz_dbl_dig_t)m * inv)) & DIG_MASK;
+    }
+    return (0 - inv) & DIG_MASK;
+}
+
+/* computes i = j * k / B**n mod m (Montgomery multiplication)
+   j, k, m and i have a fixed length of n digits, with j, k < m and m odd
+   minv is mpn_mont_inverse(m[0]); t is scratch space of n + 2 digits
+   can have i, j, k point to same memory
+*/
+STATIC void mpn_mont_mul(mpz_dig_t *idig, const mpz_dig_t *jdig, const mpz_dig_t *kdig, const mpz_dig_t *mdig, size_t n, mpz_dig_t minv, mpz_dig_t *t) {
+    memset(t, 0, (n + 2) * sizeof(mpz_dig_t));
+
+    for (size_t i = 0; i < n; ++i) {
+        // t += j * k[i]
+        mpz_dbl_dig_t carry = 0;
+        mpz_dbl_dig_t ki = kdig[i];
+        for (size_t x = 0; x < n; ++x) {
+            carry += (mpz_dbl_dig_t)t[x] + (mpz_dbl_dig_t)jdig[x] * ki;
+            t[x] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[n];
+        t[n] = carry & DIG_MASK;
+        t[n + 1] = carry >> DIG_SIZE;
+
+        // t = (t + q * m) / B, with q chosen so the low digit cancels
+        mpz_dbl_dig_t q = ((mpz_dbl_dig_t)t[0] * minv) & DIG_MASK;
+        carry = ((mpz_dbl_dig_t)t[0] + q * mdig[0]) >> DIG_SIZE;
+        for (size_t x = 1; x < n; ++x) {
+            carry += (mpz_dbl_dig_t)t[x] + q * mdig[x];
+            t[x - 1] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[n];
+        t[n - 1] = carry & DIG_MASK;
+        t[n] = t[n + 1] + (carry >> DIG_SIZE);
+    }
+
+    // t < 2 * m
+    if (t[n] != 0 || mpn_cmp(t, n, mdig, n) >= 0) {
+        mpn_sub_fixed(t, n + 1, mdig, n);
+    }
+    memcpy(idig, t, n * sizeof(mpz_dig_t));
+
+    #ifdef RUN_BACKGROUND_TASKS
+    RUN_BACKGROUND_TASKS;
+    #endif
+}
+
+#endif // MICROPY_OPT_MPZ_FAST_ARITH
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -833,6 +1049,10 @@ size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigne
     }
 
     z->len = 0;
+    // CIRCUITPY-CHANGE: gather as many characters as fit in a digit before
+    // folding them into z
+    mpz_dig_t chunk = 0;
+    mpz_dig_t chunk_base = 1;
     for (; cur < top; ++cur) { // XXX UTF8 next char
         // mp_uint_t v = char_to_numeric(cur#); // XXX UTF8 get char
         mp_uint_t v = *cur;
@@ -848,7 +1068,16 @@ size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigne
         if (v >= base) {
             break;
         }
-        z->len = mpn_mul_dig_add_dig(z->dig, z->len, base, v);
+        if ((mpz_dbl_dig_t)chunk_base * base > DIG_MASK) {
+            z->len = mpn_mul_dig_add_dig(z->dig, z->len, chunk_base, chunk);
+            chunk = 0;
+            chunk_base = 1;
+        }
+        chunk = chunk * base + v;
+        chunk_base *= base;
+    }
+    if (chunk_base > 1) {
+        z->len = mpn_mul_dig_add_dig(z->dig, z->len, chunk_base, chunk);
     }
 
     return cur - str;
@@ -1311,7 +1540,12 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
     memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+    // CIRCUITPY-CHANGE: Karatsuba for large operands
+    #if MICROPY_OPT_MPZ_FAST_ARITH
+    dest->len = mpn_mul_fast(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    #else
     dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    #endif
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1356,6 +1590,107 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_MPZ_FAST_ARITH
+STATIC bool mpz_test_bit(const mpz_t *z, size_t bit) {
+    return (z->dig[bit / DIG_SIZE] >> (bit % DIG_SIZE)) & 1;
+}
+
+/* computes dest = (lhs ** rhs) % mod for odd mod, using Montgomery reduction
+   assumes rhs > 0; lhs, rhs are only read before dest is written
+*/
+STATIC void mpz_pow3_mont(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    size_t n = mod->len;
+    const mpz_dig_t *mdig = mod->dig;
+    mpz_t m;
+    mpz_init_zero(&m);
+    mpz_abs_inpl(&m, mod);
+
+    // number of bits in the exponent, and a window size that balances table
+    // size against the number of multiplications
+    size_t ebits = (rhs->len - 1) * DIG_SIZE;
+    for (mpz_dig_t top = rhs->dig[rhs->len - 1]; top != 0; top >>= 1) {
+        ++ebits;
+    }
+    unsigned int window = ebits > 239 ? 5 : ebits > 79 ? 4 : ebits > 23 ? 3 : ebits > 6 ? 2 : 1;
+    size_t table_len = (size_t)1 << (window - 1);
+
+    // layout: odd powers table, accumulator, product scratch
+    size_t buf_len = (table_len + 1) * n + n + 2;
+    mpz_dig_t *buf = m_new0(mpz_dig_t, buf_len);
+    mpz_dig_t *table = buf;
+    mpz_dig_t *acc = table + table_len * n;
+    mpz_dig_t *t = acc + n;
+    mpz_dig_t minv = mpn_mont_inverse(mdig[0]);
+
+    // base in Montgomery form: (lhs mod m) * B**n mod m
+    mpz_t x, quo;
+    mpz_init_zero(&x);
+    mpz_init_zero(&quo);
+    mpz_divmod_inpl(&quo, &x, lhs, &m);
+    mpz_shl_inpl(&x, &x, n * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &x, &x, &m);
+    memcpy(table, x.dig, x.len * sizeof(mpz_dig_t));
+    mpz_deinit(&x);
+    mpz_deinit(&quo);
+
+    // table[i] = base ** (2 * i + 1)
+    if (table_len > 1) {
+        mpn_mont_mul(acc, table, table, mdig, n, minv, t);
+        for (size_t i = 1; i < table_len; ++i) {
+            mpn_mont_mul(table + i * n, table + (i - 1) * n, acc, mdig, n, minv, t);
+        }
+    }
+
+    // left-to-right sliding window over the exponent bits
+    bool started = false;
+    for (size_t i = ebits; i > 0;) {
+        --i;
+        if (!mpz_test_bit(rhs, i)) {
+            mpn_mont_mul(acc, acc, acc, mdig, n, minv, t);
+            continue;
+        }
+        // longest window ending at a set bit
+        size_t lo = i + 1 > window ? i + 1 - window : 0;
+        while (!mpz_test_bit(rhs, lo)) {
+            ++lo;
+        }
+        size_t val = 0;
+        for (size_t b = i + 1; b > lo;) {
+            --b;
+            val = (val << 1) | mpz_test_bit(rhs, b);
+        }
+        if (started) {
+            for (size_t b = lo; b <= i; ++b) {
+                mpn_mont_mul(acc, acc, acc, mdig, n, minv, t);
+            }
+            mpn_mont_mul(acc, acc, table + (val >> 1) * n, mdig, n, minv, t);
+        } else {
+            memcpy(acc, table + (val >> 1) * n, n * sizeof(mpz_dig_t));
+            started = true;
+        }
+        i = lo;
+    }
+
+    // leave Montgomery form by multiplying by 1
+    memset(table, 0, n * sizeof(mpz_dig_t));
+    table[0] = 1;
+    mpn_mont_mul(acc, acc, table, mdig, n, minv, t);
+
+    mpz_need_dig(dest, n);
+    memcpy(dest->dig, acc, n * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + n);
+    dest->neg = 0;
+    m_del(mpz_dig_t, buf, buf_len);
+
+    // Python style modulo for a negative modulus
+    if (mod->neg && dest->len != 0) {
+        mpz_sub_inpl(dest, dest, &m);
+    }
+    mpz_deinit(&m);
+}
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1371,6 +1706,14 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    // CIRCUITPY-CHANGE: odd moduli use Montgomery reduction with a sliding window
+    #if MICROPY_OPT_MPZ_FAST_ARITH
+    if ((mod->dig[0] & 1) != 0) {
+        mpz_pow3_mont(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_t *x = mpz_clone(lhs);
     mpz_t *n = mpz_clone(rhs);
     mpz_t quo;
@@ -1682,48 +2025,83 @@ size_t mpz_as_str_inpl(const mpz_t *i, unsigned int base, const char *prefix, ch
         return s - str;
     }
 
-    // make a copy of mpz digits, so we can do the div/mod calculation
-    mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
-    memcpy(dig, i->dig, ilen * sizeof(mpz_dig_t));
-
-    // convert
+    // CIRCUITPY-CHANGE: emit several characters per pass over the digits
     char *last_comma = str;
-    bool done;
-    do {
-        mpz_dig_t *d = dig + ilen;
-        mpz_dbl_dig_t a = 0;
-
-        // compute next remainder
-        while (--d >= dig) {
-            a = (a << DIG_SIZE) | *d;
-            *d = a / base;
-            a %= base;
+    if ((base & (base - 1)) == 0) {
+        // power of two base: read the characters straight out of the bits
+        unsigned int shift = 0;
+        while ((1u << shift) < base) {
+            ++shift;
         }
-
-        // convert to character
-        a += '0';
-        if (a > '9') {
-            a += base_char - '9' - 1;
+        size_t nbits = (ilen - 1) * DIG_SIZE;
+        for (mpz_dig_t top = i->dig[ilen - 1]; top != 0; top >>= 1) {
+            ++nbits;
         }
-        *s++ = a;
-
-        // check if number is zero
-        done = true;
-        for (d = dig; d < dig + ilen; ++d) {
-            if (*d != 0) {
-                done = false;
-                break;
+        for (size_t pos = 0; pos < nbits; pos += shift) {
+            size_t d = pos / DIG_SIZE;
+            mpz_dbl_dig_t a = i->dig[d];
+            if (d + 1 < ilen) {
+                a |= (mpz_dbl_dig_t)i->dig[d + 1] << DIG_SIZE;
+            }
+            a = (a >> (pos % DIG_SIZE)) & (base - 1);
+            if (comma && (s - last_comma) == 3) {
+                *s++ = comma;
+                last_comma = s;
             }
+            a += '0';
+            if (a > '9') {
+                a += base_char - '9' - 1;
+            }
+            *s++ = a;
         }
-        if (comma && (s - last_comma) == 3) {
-            *s++ = comma;
-            last_comma = s;
+    } else {
+        // divide by the largest power of base that fits in a digit
+        mpz_dbl_dig_t chunk_base = base;
+        unsigned int chunk_len = 1;
+        while (chunk_base * base <= DIG_MASK) {
+            chunk_base *= base;
+            ++chunk_len;
         }
-    }
-    while (!done);
 
-    // free the copy of the digits array
-    m_del(mpz_dig_t, dig, ilen);
+        // make a copy of mpz digits, so we can do the div/mod calculation
+        mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
+        memcpy(dig, i->dig, ilen * sizeof(mpz_dig_t));
+
+        // convert
+        size_t len = ilen;
+        do {
+            mpz_dig_t *d = dig + len;
+            mpz_dbl_dig_t a = 0;
+
+            // compute next remainder
+            while (--d >= dig) {
+                a = (a << DIG_SIZE) | *d;
+                *d = a / chunk_base;
+                a %= chunk_base;
+            }
+            while (len > 0 && dig[len - 1] == 0) {
+                --len;
+            }
+
+            // convert to characters; the last chunk has no leading zeros
+            for (unsigned int n = 0; n < chunk_len && (len > 0 || a > 0); ++n) {
+                if (comma && (s - last_comma) == 3) {
+                    *s++ = comma;
+                    last_comma = s;
+                }
+                mpz_dig_t c = a % base + '0';
+                a /= base;
+                if (c > '9') {
+                    c += base_char - '9' - 1;
+                }
+                *s++ = c;
+            }
+        }
+        while (len > 0);
+
+        // free the copy of the digits array
+        m_del(mpz_dig_t, dig, ilen);
+    }
 
     if (prefix) {
         const char *p = &prefix[strlen(prefix)];
@@ -0,0 +1,142 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+// Native code tier.
+//
+// When MP_STATE_VM(native_tier_threshold) is non-zero, the lexer keeps a copy
+// of every file it reads, and the compiler numbers each plain function scope
+// in such a module (mp_raw_code_t.tier_scope). Bytecode functions count their
+// calls and backward jumps; once a function has crossed the threshold and is
+// not running, fun_bc_call switches the function object over to machine code.
+// That code comes from recompiling the module from the retained source with
+// its functions sent through the native emitter: all at once the first time,
+// or, if the native emitter rejects part of the module, one scope at a time.
+// Scopes that can't be native stay bytecode and are not tried again.
+
+#include <string.h>
+
+#include "py/compile.h"
+#include "py/lexer.h"
+#include "py/nativetier.h"
+#include "py/objfun.h"
+#include "py/parse.h"
+#include "py/runtime.h"
+
+#if MICROPY_NATIVE_TIER
+
+typedef struct _native_tier_reader_t {
+    mp_reader_t reader;
+    vstr_t source;
+} native_tier_reader_t;
+
+STATIC mp_uint_t native_tier_readbyte(void *data) {
+    native_tier_reader_t *self = data;
+    mp_uint_t c = self->reader.readbyte(self->reader.data);
+    if (c != MP_READER_EOF) {
+        vstr_add_byte(&self->source, c);
+    }
+    return c;
+}
+
+STATIC void native_tier_close(void *data) {
+    native_tier_reader_t *self = data;
+    self->reader.close(self->reader.data);
+    vstr_clear(&self->source);
+    m_del_obj(native_tier_reader_t, self);
+}
+
+void mp_native_tier_capture_reader(mp_reader_t *reader) {
+    if (MP_STATE_VM(native_tier_threshold) == 0) {
+        return;
+    }
+    native_tier_reader_t *self = m_new_obj(native_tier_reader_t);
+    self->reader = *reader;
+    vstr_init(&self->source, 64);
+    reader->data = self;
+    reader->readbyte = native_tier_readbyte;
+    reader->close = native_tier_close;
+}
+
+mp_obj_t mp_native_tier_take_source(mp_reader_t *reader) {
+    if (reader->readbyte != native_tier_readbyte) {
+        return MP_OBJ_NULL;
+    }
+    native_tier_reader_t *self = reader->data;
+    return mp_obj_new_bytes_from_vstr(&self->source);
+}
+
+// Compile the module again with target (a scope number or MP_NATIVE_TIER_ALL)
+// as native code. Returns the native raw code by scope number, or NULL if the
+// native emitter rejected the code.
+STATIC const mp_raw_code_t **native_tier_compile_module(const mp_native_tier_context_t *tier_context, uint16_t target, const mp_module_context_t **context) {
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    qstr source_file = tier_context->context.constants.qstr_table[0];
+    #else
+    qstr source_file = tier_context->context.constants.source_file;
+    #endif
+
+    // The source is already retained, so don't capture it again while lexing.
+    mp_uint_t threshold = MP_STATE_VM(native_tier_threshold);
+    MP_STATE_VM(native_tier_threshold) = 0;
+    MP_STATE_VM(native_tier_target) = target;
+
+    const mp_raw_code_t **table = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        size_t len;
+        const char *source = mp_obj_str_get_data(tier_context->source, &len);
+        mp_lexer_t *lex = mp_lexer_new_from_str_len(source_file, source, len, 0);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        parse_tree.tier_source = tier_context->source;
+
+        // Same globals, but the constant tables of the new compilation.
+        mp_native_tier_context_t *new_context = m_new0(mp_native_tier_context_t, 1);
+        new_context->context.module = tier_context->context.module;
+        new_context->source = tier_context->source;
+
+        mp_compiled_module_t cm;
+        cm.context = &new_context->context;
+        mp_compile_to_raw_code(&parse_tree, source_file, false, &cm);
+        nlr_pop();
+
+        // Bytecode functions nested in the new native code can be promoted
+        // too, and must find what was already compiled here.
+        if (target == MP_NATIVE_TIER_ALL) {
+            new_context->native_table = cm.tier_table;
+            new_context->native_context = cm.context;
+        } else {
+            new_context->native_failed = true;
+        }
+
+        table = cm.tier_table;
+        *context = cm.context;
+    }
+
+    MP_STATE_VM(native_tier_threshold) = threshold;
+    MP_STATE_VM(native_tier_target) = 0;
+    return table;
+}
+
+const mp_raw_code_t *mp_native_tier_compile(const mp_obj_fun_bc_t *fun, const mp_module_context_t **context) {
+    // Only ever reached through fun_bc_call, which owns the context.
+    mp_native_tier_context_t *tier_context = (mp_native_tier_context_t *)fun->context;
+
+    // The first hot function pays for compiling the whole module, after which
+    // every function in it can switch over without compiling again.
+    if (tier_context->native_table == NULL && !tier_context->native_failed) {
+        tier_context->native_table = native_tier_compile_module(tier_context, MP_NATIVE_TIER_ALL, &tier_context->native_context);
+        tier_context->native_failed = tier_context->native_table == NULL;
+    }
+    if (tier_context->native_table != NULL) {
+        *context = tier_context->native_context;
+        return tier_context->native_table[fun->tier_scope];
+    }
+
+    const mp_raw_code_t **table = native_tier_compile_module(tier_context, fun->tier_scope, context);
+    return table == NULL ? NULL : table[fun->tier_scope];
+}
+
+#endif // MICROPY_NATIVE_TIER
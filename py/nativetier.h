@@ -0,0 +1,42 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/bc.h"
+#include "py/emitglue.h"
+#include "py/reader.h"
+
+#if MICROPY_NATIVE_TIER
+
+// Value of MP_STATE_VM(native_tier_target) that compiles every function scope
+// of the module as native code.
+#define MP_NATIVE_TIER_ALL (0xffff)
+
+// Context of a module compiled from retained source. Only functions whose raw
+// code has a non-zero tier_scope have one of these as their context.
+typedef struct _mp_native_tier_context_t {
+    mp_module_context_t context;
+    mp_obj_t source;
+    // Set by the first promotion in the module: its function scopes compiled
+    // as native code, indexed by tier_scope, and the context they share.
+    const mp_raw_code_t **native_table;
+    const mp_module_context_t *native_context;
+    bool native_failed; // the whole module can't be native, go scope by scope
+} mp_native_tier_context_t;
+
+// Called by the lexer: while promotion is enabled, record the text it reads.
+void mp_native_tier_capture_reader(mp_reader_t *reader);
+
+// Called by the parser: the text recorded for reader, or MP_OBJ_NULL.
+mp_obj_t mp_native_tier_take_source(mp_reader_t *reader);
+
+// Native code for fun, compiled from the retained source of its module. Sets
+// *context to the module context it needs, or returns NULL if fun can't be
+// native.
+const mp_raw_code_t *mp_native_tier_compile(const struct _mp_obj_fun_bc_t *fun, const mp_module_context_t **context);
+
+#endif // MICROPY_NATIVE_TIER
@@ -33,6 +33,10 @@
 #include "py/runtime.h"
 #include "py/bc.h"
 #include "py/stackctrl.h"
+// CIRCUITPY-CHANGE
+#include "py/persistentcode.h"
+// CIRCUITPY-CHANGE
+#include "py/nativetier.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -145,11 +149,19 @@ qstr mp_obj_fun_get_name(mp_const_obj_t fun_in) {
     const mp_obj_fun_bc_t *fun = MP_OBJ_TO_PTR(fun_in);
     #if MICROPY_EMIT_NATIVE
     if (fun->base.type == &mp_type_fun_native || fun->base.type == &mp_type_native_gen_wrap) {
+        // CIRCUITPY-CHANGE: promoted functions remember the name they had as bytecode
+        #if MICROPY_NATIVE_TIER
+        if (fun->tier_scope != 0) {
+            return fun->tier.name;
+        }
+        #endif
         // TODO native functions don't have name stored
         return MP_QSTR_;
     }
     #endif
 
+    // CIRCUITPY-CHANGE
+    MP_OBJ_FUN_BC_ENSURE_LOADED(fun);
     const byte *bc = fun->bytecode;
     MP_BC_PRELUDE_SIG_DECODE(bc);
     return mp_obj_code_get_name(fun, bc);
@@ -202,6 +214,8 @@ STATIC void dump_args(const mp_obj_t *a, size_t sz) {
 mp_code_state_t *mp_obj_fun_bc_prepare_codestate(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     MP_STACK_CHECK();
     mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(self_in);
+    // CIRCUITPY-CHANGE
+    MP_OBJ_FUN_BC_ENSURE_LOADED(self);
 
     size_t n_state, state_size;
     DECODE_CODESTATE_SIZE(self->bytecode, n_state, state_size);
@@ -230,9 +244,48 @@ mp_code_state_t *mp_obj_fun_bc_prepare_codestate(mp_obj_t self_in, size_t n_args
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_NATIVE_TIER
+// Switch a hot function over to native code. Only done while no call of the
+// function is running, because bytecode frames keep using the fields replaced
+// here (bytecode, context, child_table).
+STATIC bool fun_bc_tier_up(mp_obj_fun_bc_t *self) {
+    #if MICROPY_PY_SYS_SETTRACE
+    if (MP_STATE_THREAD(prof_trace_callback) != MP_OBJ_NULL) {
+        return false;
+    }
+    #endif
+    qstr name = mp_obj_fun_get_name(MP_OBJ_FROM_PTR(self));
+    const mp_module_context_t *context;
+    const mp_raw_code_t *rc = mp_native_tier_compile(self, &context);
+    if (rc == NULL) {
+        self->tier_scope = 0;
+        return false;
+    }
+    self->base.type = &mp_type_fun_native;
+    self->context = context;
+    self->child_table = rc->children;
+    self->bytecode = rc->fun_data;
+    self->tier.name = name;
+    return true;
+}
+#endif
+
 STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     MP_STACK_CHECK();
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    {
+        mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(self_in);
+        mp_uint_t threshold = MP_STATE_VM(native_tier_threshold);
+        if (self->tier_scope != 0 && threshold != 0 && ++self->tier.count >= threshold
+            && self->tier_active == 0 && fun_bc_tier_up(self)) {
+            return mp_call_function_n_kw(self_in, n_args, n_kw, args);
+        }
+    }
+    #endif
+
     DEBUG_printf("Input n_args: " UINT_FMT ", n_kw: " UINT_FMT "\n", n_args, n_kw);
     DEBUG_printf("Input pos args: ");
     dump_args(args, n_args);
@@ -240,6 +293,8 @@ STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
     dump_args(args + n_args, n_kw * 2);
 
     mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(self_in);
+    // CIRCUITPY-CHANGE
+    MP_OBJ_FUN_BC_ENSURE_LOADED(self);
 
     size_t n_state, state_size;
     DECODE_CODESTATE_SIZE(self->bytecode, n_state, state_size);
@@ -270,7 +325,14 @@ STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
 
     // execute the byte code with the correct globals context
     mp_globals_set(self->context->module.globals);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    ++self->tier_active;
+    #endif
     mp_vm_return_kind_t vm_return_kind = mp_execute_bytecode(code_state, MP_OBJ_NULL);
+    #if MICROPY_NATIVE_TIER
+    --self->tier_active;
+    #endif
     mp_globals_set(code_state->old_globals);
 
     #if MICROPY_DEBUG_VM_STACK_OVERFLOW
@@ -368,6 +430,22 @@ MP_DEFINE_CONST_OBJ_TYPE(
     call, fun_bc_call
     );
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+const byte mp_obj_fun_bc_lazy_bytecode[1];
+
+void mp_obj_fun_bc_load_lazy(const mp_obj_fun_bc_t *self) {
+    mp_obj_fun_bc_t *fun = (mp_obj_fun_bc_t *)self;
+    mp_raw_code_t *rc = (mp_raw_code_t *)fun->child_table;
+    // Other functions made from the same raw code may have loaded it already.
+    if (rc->kind == MP_CODE_BYTECODE_LAZY) {
+        mp_raw_code_load_lazy(rc, fun->context);
+    }
+    fun->child_table = rc->children;
+    fun->bytecode = rc->fun_data;
+}
+#endif
+
 mp_obj_t mp_obj_new_fun_bc(const mp_obj_t *def_args, const byte *code, const mp_module_context_t *context, struct _mp_raw_code_t *const *child_table) {
     size_t n_def_args = 0;
     size_t n_extra_args = 0;
@@ -388,6 +466,12 @@ mp_obj_t mp_obj_new_fun_bc(const mp_obj_t *def_args, const byte *code, const mp_
     o->bytecode = code;
     o->context = context;
     o->child_table = child_table;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    o->tier.count = 0;
+    o->tier_scope = 0;
+    o->tier_active = 0;
+    #endif
     if (def_pos_args != NULL) {
         memcpy(o->extra_args, def_pos_args->items, n_def_args * sizeof(mp_obj_t));
     }
@@ -37,6 +37,15 @@ typedef struct _mp_obj_fun_bc_t {
     #if MICROPY_PY_SYS_SETTRACE
     const struct _mp_raw_code_t *rc;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    union {
+        uint32_t count; // calls and backward jumps while running as bytecode
+        uint32_t name; // qstr of the function name once promoted to native code
+    } tier;
+    uint16_t tier_scope; // see mp_raw_code_t; 0 if the function can't be promoted
+    uint16_t tier_active; // number of calls of the function currently running
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
@@ -48,4 +57,20 @@ mp_obj_t mp_obj_new_fun_native(const mp_obj_t *def_args, const void *fun_data, c
 mp_obj_t mp_obj_new_fun_asm(size_t n_args, const void *fun_data, mp_uint_t type_sig);
 void mp_obj_fun_bc_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+// A function made from an MP_CODE_BYTECODE_LAZY raw code has this as its
+// bytecode and the raw code as its child_table, until it is first used.
+extern const byte mp_obj_fun_bc_lazy_bytecode[];
+void mp_obj_fun_bc_load_lazy(const mp_obj_fun_bc_t *self);
+#define MP_OBJ_FUN_BC_ENSURE_LOADED(self) \
+    do { \
+        if ((self)->bytecode == mp_obj_fun_bc_lazy_bytecode) { \
+            mp_obj_fun_bc_load_lazy(self); \
+        } \
+    } while (0)
+#else
+#define MP_OBJ_FUN_BC_ENSURE_LOADED(self) ((void)0)
+#endif
+
 #endif // MICROPY_INCLUDED_PY_OBJFUN_H
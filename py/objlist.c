@@ -301,39 +301,364 @@ STATIC mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return mp_obj_list_pop(self, index);
 }
 
-STATIC void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
+// CIRCUITPY-CHANGE: stable sort
+// list.sort() is a natural merge sort in the style of timsort. Runs that are
+// already in order, or strictly in reverse order, are found and extended to a
+// minimum length with binary insertion sort, then merged so that the pending
+// runs stay balanced. Sorted and reverse sorted input take linear time and
+// equal elements keep their order. With key=, each key is computed once into
+// a temporary array that is sorted alongside the items.
+//
+// If there is no memory for the keys, they are recomputed at each comparison,
+// and if there is no memory for the merge buffer, runs are merged in place by
+// rotation. Either way the sort still succeeds on a tight heap.
+
+#define LIST_SORT_MAX_RUNS (48)
+
+typedef struct _list_sort_t {
+    // The values compared, and the items moved along with them, or NULL if
+    // the items are the values compared.
+    mp_obj_t *keys;
+    mp_obj_t *items;
+    // Applied at each comparison when keys could not be precomputed.
+    mp_obj_t key_fn;
+    mp_obj_t *tmp_keys;
+    mp_obj_t *tmp_items;
+    // Elements parked in the merge buffer, put back if a comparison raises.
+    size_t pending_tmp;
+    size_t pending_len;
+    size_t pending_dest;
+    bool reverse;
+    size_t n_runs;
+    size_t run_base[LIST_SORT_MAX_RUNS];
+    size_t run_len[LIST_SORT_MAX_RUNS];
+} list_sort_t;
+
+STATIC bool list_sort_lt(list_sort_t *s, mp_obj_t a, mp_obj_t b) {
+    if (s->key_fn != MP_OBJ_NULL) {
+        a = mp_call_function_1(s->key_fn, a);
+        b = mp_call_function_1(s->key_fn, b);
+    }
+    if (s->reverse) {
+        mp_obj_t t = a;
+        a = b;
+        b = t;
+    }
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a, b));
+}
+
+STATIC void list_sort_reverse(list_sort_t *s, size_t lo, size_t hi) {
+    while (lo + 1 < hi) {
+        hi--;
+        mp_obj_t t = s->keys[lo];
+        s->keys[lo] = s->keys[hi];
+        s->keys[hi] = t;
+        if (s->items) {
+            t = s->items[lo];
+            s->items[lo] = s->items[hi];
+            s->items[hi] = t;
+        }
+        lo++;
+    }
+}
+
+// Index of the first element of [lo, hi) that v sorts before.
+STATIC size_t list_sort_upper_bound(list_sort_t *s, size_t lo, size_t hi, mp_obj_t v) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (list_sort_lt(s, v, s->keys[mid])) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// Index of the first element of [lo, hi) that doesn't sort before v.
+STATIC size_t list_sort_lower_bound(list_sort_t *s, size_t lo, size_t hi, mp_obj_t v) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (list_sort_lt(s, s->keys[mid], v)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Sort [lo, hi) given that [lo, start) is already sorted.
+STATIC void list_sort_insertion(list_sort_t *s, size_t lo, size_t hi, size_t start) {
+    for (size_t i = start; i < hi; i++) {
+        mp_obj_t key = s->keys[i];
+        size_t pos = list_sort_upper_bound(s, lo, i, key);
+        memmove(&s->keys[pos + 1], &s->keys[pos], (i - pos) * sizeof(mp_obj_t));
+        s->keys[pos] = key;
+        if (s->items) {
+            mp_obj_t item = s->items[i];
+            memmove(&s->items[pos + 1], &s->items[pos], (i - pos) * sizeof(mp_obj_t));
+            s->items[pos] = item;
+        }
+    }
+}
+
+// Length of the run starting at lo, which is left in ascending order.
+STATIC size_t list_sort_count_run(list_sort_t *s, size_t lo, size_t hi) {
+    size_t i = lo + 1;
+    if (i == hi) {
+        return 1;
+    }
+    if (list_sort_lt(s, s->keys[i], s->keys[lo])) {
+        // Only a strictly descending run can be reversed without losing stability.
+        for (i++; i < hi && list_sort_lt(s, s->keys[i], s->keys[i - 1]); i++) {
+        }
+        list_sort_reverse(s, lo, i);
+    } else {
+        for (i++; i < hi && !list_sort_lt(s, s->keys[i], s->keys[i - 1]); i++) {
+        }
+    }
+    return i - lo;
+}
+
+// Between 16 and 32, chosen so that n / min_run is close to a power of two.
+STATIC size_t list_sort_min_run(size_t n) {
+    size_t r = 0;
+    while (n >= 32) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+STATIC void list_sort_rotate(list_sort_t *s, size_t lo, size_t mid, size_t hi) {
+    list_sort_reverse(s, lo, mid);
+    list_sort_reverse(s, mid, hi);
+    list_sort_reverse(s, lo, hi);
+}
+
+// Merge [lo, mid) and [mid, hi) without a buffer.
+STATIC void list_sort_merge_in_place(list_sort_t *s, size_t lo, size_t mid, size_t hi) {
     MP_STACK_CHECK();
-    while (head < tail) {
-        mp_obj_t *h = head - 1;
-        mp_obj_t *t = tail;
-        mp_obj_t v = key_fn == MP_OBJ_NULL ? tail[0] : mp_call_function_1(key_fn, tail[0]); // get pivot using key_fn
-        for (;;) {
-            do {++h;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, key_fn == MP_OBJ_NULL ? h[0] : mp_call_function_1(key_fn, h[0]), v) == binop_less_result);
-            do {--t;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, v, key_fn == MP_OBJ_NULL ? t[0] : mp_call_function_1(key_fn, t[0])) == binop_less_result);
-            if (h >= t) {
-                break;
+    while (lo < mid && mid < hi) {
+        if (hi - lo == 2) {
+            if (list_sort_lt(s, s->keys[mid], s->keys[lo])) {
+                list_sort_reverse(s, lo, hi);
             }
-            mp_obj_t x = h[0];
-            h[0] = t[0];
-            t[0] = x;
+            return;
         }
-        mp_obj_t x = h[0];
-        h[0] = tail[0];
-        tail[0] = x;
-        // do the smaller recursive call first, to keep stack within O(log(N))
-        if (t - head < tail - h - 1) {
-            mp_quicksort(head, t, key_fn, binop_less_result);
-            head = h + 1;
+        size_t cut1, cut2;
+        if (mid - lo >= hi - mid) {
+            cut1 = lo + (mid - lo) / 2;
+            cut2 = list_sort_lower_bound(s, mid, hi, s->keys[cut1]);
         } else {
-            mp_quicksort(h + 1, tail, key_fn, binop_less_result);
-            tail = t;
+            cut2 = mid + (hi - mid) / 2;
+            cut1 = list_sort_upper_bound(s, lo, mid, s->keys[cut2]);
         }
+        list_sort_rotate(s, cut1, mid, cut2);
+        size_t new_mid = cut1 + (cut2 - mid);
+        list_sort_merge_in_place(s, lo, cut1, new_mid);
+        lo = new_mid;
+        mid = cut2;
+    }
+}
+
+STATIC void list_sort_park(list_sort_t *s, size_t tmp, size_t len, size_t dest) {
+    s->pending_tmp = tmp;
+    s->pending_len = len;
+    s->pending_dest = dest;
+}
+
+STATIC void list_sort_unpark(list_sort_t *s) {
+    memcpy(&s->keys[s->pending_dest], &s->tmp_keys[s->pending_tmp], s->pending_len * sizeof(mp_obj_t));
+    if (s->items) {
+        memcpy(&s->items[s->pending_dest], &s->tmp_items[s->pending_tmp], s->pending_len * sizeof(mp_obj_t));
+    }
+    s->pending_len = 0;
+}
+
+// Merge [lo, mid) and [mid, hi), where the first run is the shorter one.
+STATIC void list_sort_merge_lo(list_sort_t *s, size_t lo, size_t mid, size_t hi) {
+    size_t n = mid - lo;
+    memcpy(s->tmp_keys, &s->keys[lo], n * sizeof(mp_obj_t));
+    if (s->items) {
+        memcpy(s->tmp_items, &s->items[lo], n * sizeof(mp_obj_t));
+    }
+    size_t i = 0, j = mid, k = lo;
+    while (i < n && j < hi) {
+        // Between comparisons, the hole at [k, j) is exactly the size of what is left in tmp.
+        list_sort_park(s, i, n - i, k);
+        if (list_sort_lt(s, s->keys[j], s->tmp_keys[i])) {
+            s->keys[k] = s->keys[j];
+            if (s->items) {
+                s->items[k] = s->items[j];
+            }
+            j++;
+        } else {
+            s->keys[k] = s->tmp_keys[i];
+            if (s->items) {
+                s->items[k] = s->tmp_items[i];
+            }
+            i++;
+        }
+        k++;
+    }
+    list_sort_park(s, i, n - i, k);
+    list_sort_unpark(s);
+}
+
+// Merge [lo, mid) and [mid, hi), where the second run is the shorter one.
+STATIC void list_sort_merge_hi(list_sort_t *s, size_t lo, size_t mid, size_t hi) {
+    size_t n = hi - mid;
+    memcpy(s->tmp_keys, &s->keys[mid], n * sizeof(mp_obj_t));
+    if (s->items) {
+        memcpy(s->tmp_items, &s->items[mid], n * sizeof(mp_obj_t));
+    }
+    size_t i = n, j = mid, k = hi;
+    while (i > 0 && j > lo) {
+        // The hole at [j, k) is exactly the size of what is left in tmp.
+        list_sort_park(s, 0, i, j);
+        k--;
+        if (list_sort_lt(s, s->tmp_keys[i - 1], s->keys[j - 1])) {
+            j--;
+            s->keys[k] = s->keys[j];
+            if (s->items) {
+                s->items[k] = s->items[j];
+            }
+        } else {
+            i--;
+            s->keys[k] = s->tmp_keys[i];
+            if (s->items) {
+                s->items[k] = s->tmp_items[i];
+            }
+        }
+    }
+    list_sort_park(s, 0, i, j);
+    list_sort_unpark(s);
+}
+
+// Merge pending runs r and r + 1.
+STATIC void list_sort_merge_at(list_sort_t *s, size_t r) {
+    size_t lo = s->run_base[r];
+    size_t mid = lo + s->run_len[r];
+    size_t hi = mid + s->run_len[r + 1];
+    s->run_len[r] += s->run_len[r + 1];
+    if (r + 2 < s->n_runs) {
+        s->run_base[r + 1] = s->run_base[r + 2];
+        s->run_len[r + 1] = s->run_len[r + 2];
+    }
+    s->n_runs--;
+
+    // Elements of the first run that sort before the whole second run, and
+    // elements of the second run that sort after the whole first run, are
+    // already in place.
+    lo = list_sort_upper_bound(s, lo, mid, s->keys[mid]);
+    if (lo == mid) {
+        return;
+    }
+    hi = list_sort_lower_bound(s, mid, hi, s->keys[mid - 1]);
+    if (s->tmp_keys == NULL) {
+        list_sort_merge_in_place(s, lo, mid, hi);
+    } else if (mid - lo <= hi - mid) {
+        list_sort_merge_lo(s, lo, mid, hi);
+    } else {
+        list_sort_merge_hi(s, lo, mid, hi);
+    }
+}
+
+// Merge pending runs until their lengths shrink faster than the Fibonacci
+// sequence from the bottom of the stack up, which bounds the stack depth.
+STATIC void list_sort_merge_collapse(list_sort_t *s) {
+    while (s->n_runs > 1) {
+        size_t n = s->n_runs - 2;
+        size_t *len = s->run_len;
+        if ((n > 0 && len[n - 1] <= len[n] + len[n + 1]) ||
+            (n > 1 && len[n - 2] <= len[n - 1] + len[n])) {
+            if (len[n - 1] < len[n + 1]) {
+                n--;
+            }
+        } else if (len[n] > len[n + 1]) {
+            break;
+        }
+        list_sort_merge_at(s, n);
+    }
+}
+
+STATIC void list_sort_run(list_sort_t *s, size_t n) {
+    size_t min_run = list_sort_min_run(n);
+    size_t lo = 0;
+    while (lo < n) {
+        size_t len = list_sort_count_run(s, lo, n);
+        if (len < min_run) {
+            size_t forced = MIN(min_run, n - lo);
+            list_sort_insertion(s, lo, lo + forced, lo + len);
+            len = forced;
+        }
+        if (s->n_runs == LIST_SORT_MAX_RUNS) {
+            // Can't happen while the run lengths are balanced, but be safe.
+            list_sort_merge_at(s, s->n_runs - 2);
+        }
+        s->run_base[s->n_runs] = lo;
+        s->run_len[s->n_runs] = len;
+        s->n_runs++;
+        list_sort_merge_collapse(s);
+        lo += len;
+    }
+    while (s->n_runs > 1) {
+        size_t r = s->n_runs - 2;
+        if (r > 0 && s->run_len[r - 1] < s->run_len[r + 1]) {
+            r--;
+        }
+        list_sort_merge_at(s, r);
+    }
+}
+
+STATIC void list_sort_items(mp_obj_t *items, size_t n, mp_obj_t key_fn, bool reverse) {
+    list_sort_t s = {
+        .keys = items,
+        .items = NULL,
+        .key_fn = key_fn,
+        .reverse = reverse,
+    };
+    mp_obj_t *keys = NULL;
+    if (key_fn != MP_OBJ_NULL) {
+        keys = m_new_maybe(mp_obj_t, n);
+        if (keys != NULL) {
+            for (size_t i = 0; i < n; i++) {
+                keys[i] = mp_call_function_1(key_fn, items[i]);
+            }
+            s.keys = keys;
+            s.items = items;
+            s.key_fn = MP_OBJ_NULL;
+        }
+    }
+    // A merge never needs more than half the elements in the buffer.
+    size_t tmp_len = (n / 2) * (s.items ? 2 : 1);
+    s.tmp_keys = m_new_maybe(mp_obj_t, tmp_len);
+    if (s.tmp_keys != NULL) {
+        s.tmp_items = s.tmp_keys + n / 2;
+    }
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        list_sort_run(&s, n);
+        nlr_pop();
+    } else {
+        // Leave every item in the list, in some order.
+        if (s.pending_len > 0) {
+            list_sort_unpark(&s);
+        }
+        nlr_jump(nlr.ret_val);
+    }
+
+    if (s.tmp_keys != NULL) {
+        m_del(mp_obj_t, s.tmp_keys, tmp_len);
+    }
+    if (keys != NULL) {
+        m_del(mp_obj_t, keys, n);
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
@@ -351,9 +676,9 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = native_list(pos_args[0]);
 
     if (self->len > 1) {
-        mp_quicksort(self->items, self->items + self->len - 1,
+        list_sort_items(self->items, self->len,
             args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
-            args.reverse.u_bool ? mp_const_false : mp_const_true);
+            args.reverse.u_bool);
     }
 
     return mp_const_none;
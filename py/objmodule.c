@@ -162,6 +162,10 @@ mp_obj_t mp_obj_new_module(qstr module_name) {
     mp_module_context_t *o = m_new_obj(mp_module_context_t);
     o->module.base.type = &mp_type_module;
     o->module.globals = MP_OBJ_TO_PTR(mp_obj_new_dict(MICROPY_MODULE_DICT_SIZE));
+    // CIRCUITPY-CHANGE
+    GC_SET_ALLOC_KIND(o, MODULE_GLOBALS);
+    GC_SET_ALLOC_KIND(o->module.globals, MODULE_GLOBALS);
+    GC_SET_ALLOC_KIND(o->module.globals->map.table, MODULE_GLOBALS);
 
     // store __name__ entry in the module
     mp_obj_dict_store(MP_OBJ_FROM_PTR(o->module.globals), MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(module_name));
@@ -38,6 +38,8 @@
 #include "py/objint.h"
 #include "py/objstr.h"
 #include "py/builtin.h"
+// CIRCUITPY-CHANGE
+#include "py/nativetier.h"
 
 #if MICROPY_ENABLE_COMPILER
 
@@ -1399,6 +1401,14 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     m_del(rule_stack_t, parser.rule_stack, parser.rule_stack_alloc);
     m_del(mp_parse_node_t, parser.result_stack, parser.result_stack_alloc);
 
+    // CIRCUITPY-CHANGE: keep the source of whole files for native recompilation
+    #if MICROPY_NATIVE_TIER
+    parser.tree.tier_source = MP_OBJ_NULL;
+    if (input_kind == MP_PARSE_FILE_INPUT) {
+        parser.tree.tier_source = mp_native_tier_take_source(&lex->reader);
+    }
+    #endif
+
     // Deregister exception handler and free the lexer.
     nlr_pop_jump_callback(true);
 
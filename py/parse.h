@@ -106,6 +106,10 @@ typedef enum {
 typedef struct _mp_parse_t {
     mp_parse_node_t root;
     struct _mp_parse_chunk_t *chunk;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    mp_obj_t tier_source; // retained source text, see py/nativetier.c
+    #endif
 } mp_parse_tree_t;
 
 // the parser will raise an exception if an error occurred
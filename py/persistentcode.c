@@ -223,7 +223,119 @@ STATIC mp_obj_t load_obj(mp_reader_t *reader) {
     }
 }
 
-STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *context) {
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+
+// Reads an .mpy file, keeping track of the position and a running checksum so
+// that functions can be skipped at import and found again when first called.
+typedef struct _lazy_reader_t {
+    mp_reader_t file;
+    size_t pos;
+    // Native code relocations are read up to the end of the file, but when
+    // loading a function the end means the file was cut short since import.
+    bool eof_is_error;
+    // Fletcher-style sums of all bytes read. The checksum of any run of bytes
+    // can be worked out from the sums at its start and end.
+    uint32_t sum1;
+    uint32_t sum2;
+} lazy_reader_t;
+
+STATIC mp_uint_t lazy_reader_readbyte(void *data) {
+    lazy_reader_t *lr = data;
+    mp_uint_t b = lr->file.readbyte(lr->file.data);
+    if (b == MP_READER_EOF && lr->eof_is_error) {
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+    lr->pos += 1;
+    lr->sum1 += (byte)b;
+    lr->sum2 += lr->sum1;
+    return b;
+}
+
+STATIC void lazy_reader_close(void *data) {
+    lazy_reader_t *lr = data;
+    lr->file.close(lr->file.data);
+}
+
+STATIC void lazy_reader_open(lazy_reader_t *lr, mp_reader_t *reader, const char *filename, size_t offset) {
+    mp_reader_new_file_at(&lr->file, filename, offset);
+    lr->pos = offset;
+    lr->eof_is_error = offset != 0; // functions are never at the start of the file
+    lr->sum1 = 0;
+    lr->sum2 = 0;
+    reader->data = lr;
+    reader->readbyte = lazy_reader_readbyte;
+    reader->close = lazy_reader_close;
+}
+
+STATIC uint32_t lazy_reader_checksum(const lazy_reader_t *lr, size_t start, uint32_t sum1, uint32_t sum2) {
+    uint32_t s1 = lr->sum1 - sum1;
+    uint32_t s2 = lr->sum2 - sum2 - (uint32_t)(lr->pos - start) * sum1;
+    return (s2 << 16) ^ s1;
+}
+
+STATIC void skip_raw_code(mp_reader_t *reader) {
+    size_t kind_len = read_uint(reader);
+    for (size_t n = kind_len >> 3; n > 0; n--) {
+        read_byte(reader);
+    }
+    if (kind_len & 4) {
+        for (size_t n = read_uint(reader); n > 0; n--) {
+            skip_raw_code(reader);
+        }
+    }
+}
+
+// Create a raw code for a bytecode function without loading it. Only its scope
+// flags are read, because they decide the type of the function object.
+STATIC mp_raw_code_t *load_raw_code_lazy(mp_reader_t *reader) {
+    lazy_reader_t *lr = reader->data;
+    size_t start = lr->pos;
+    uint32_t sum1 = lr->sum1;
+    uint32_t sum2 = lr->sum2;
+
+    size_t kind_len = read_uint(reader);
+    size_t fun_data_len = kind_len >> 3;
+    if (kind_len & 3) {
+        // Not bytecode.
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+    byte sig[16];
+    size_t sig_len = 0;
+    do {
+        if (sig_len == sizeof(sig) || sig_len == fun_data_len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+        }
+        sig[sig_len] = read_byte(reader);
+    } while (sig[sig_len++] & 0x80);
+    for (size_t n = fun_data_len - sig_len; n > 0; n--) {
+        read_byte(reader);
+    }
+    if (kind_len & 4) {
+        for (size_t n = read_uint(reader); n > 0; n--) {
+            skip_raw_code(reader);
+        }
+    }
+
+    const byte *ip = sig;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    mp_raw_code_lazy_t *lazy = m_new0(mp_raw_code_lazy_t, 1);
+    GC_SET_ALLOC_KIND(lazy, BYTECODE);
+    lazy->rc.kind = MP_CODE_BYTECODE_LAZY;
+    lazy->rc.scope_flags = scope_flags;
+    lazy->offset = start;
+    lazy->checksum = lazy_reader_checksum(lr, start, sum1, sum2);
+    return &lazy->rc;
+}
+
+#endif
+
+STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *context
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    , bool lazy
+    #endif
+    ) {
     // Load function kind and data length
     size_t kind_len = read_uint(reader);
     int kind = (kind_len & 3) + MP_CODE_BYTECODE;
@@ -235,6 +347,12 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
         mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
     }
     #endif
+    // CIRCUITPY-CHANGE: the children of a lazy raw code are all bytecode
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    if (lazy && kind != MP_CODE_BYTECODE) {
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+    #endif
 
     uint8_t *fun_data = NULL;
     #if MICROPY_EMIT_MACHINE_CODE
@@ -247,6 +365,8 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     if (kind == MP_CODE_BYTECODE) {
         // Allocate memory for the bytecode
         fun_data = m_new(uint8_t, fun_data_len);
+        // CIRCUITPY-CHANGE
+        GC_SET_ALLOC_KIND(fun_data, BYTECODE);
         // Load bytecode
         read_bytes(reader, fun_data, fun_data_len);
 
@@ -314,8 +434,19 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     if (has_children) {
         n_children = read_uint(reader);
         children = m_new(mp_raw_code_t *, n_children + (kind == MP_CODE_NATIVE_PY));
+        // CIRCUITPY-CHANGE
+        GC_SET_ALLOC_KIND(children, BYTECODE);
         for (size_t i = 0; i < n_children; ++i) {
+            // CIRCUITPY-CHANGE
+            #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+            if (lazy) {
+                children[i] = load_raw_code_lazy(reader);
+                continue;
+            }
+            children[i] = load_raw_code(reader, context, false);
+            #else
             children[i] = load_raw_code(reader, context);
+            #endif
         }
     }
 
@@ -397,7 +528,12 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     return rc;
 }
 
+// CIRCUITPY-CHANGE: lazy is set when reader is a lazy_reader_t
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+STATIC void raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm, bool lazy) {
+#else
 void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
+#endif
     // Set exception handler to close the reader if an exception is raised.
     MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, reader->close, reader->data);
     nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
@@ -439,7 +575,12 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
     }
 
     // Load top-level module.
+    // CIRCUITPY-CHANGE: with its functions left in the file if it is all bytecode
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    cm->rc = load_raw_code(reader, cm->context, lazy && arch == MP_NATIVE_ARCH_NONE);
+    #else
     cm->rc = load_raw_code(reader, cm->context);
+    #endif
 
     #if MICROPY_PERSISTENT_CODE_SAVE
     cm->has_native = MPY_FEATURE_DECODE_ARCH(header[2]) != MP_NATIVE_ARCH_NONE;
@@ -451,6 +592,13 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
     nlr_pop_jump_callback(true);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
+    raw_code_load(reader, cm, false);
+}
+#endif
+
 void mp_raw_code_load_mem(const byte *buf, size_t len, mp_compiled_module_t *context) {
     mp_reader_t reader;
     mp_reader_new_mem(&reader, buf, len, 0);
@@ -461,10 +609,44 @@ void mp_raw_code_load_mem(const byte *buf, size_t len, mp_compiled_module_t *con
 
 void mp_raw_code_load_file(const char *filename, mp_compiled_module_t *context) {
     mp_reader_t reader;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    // A relative path would stop working if the current directory changed.
+    bool lazy = filename[0] == '/';
+    if (lazy) {
+        context->context->lazy_filename = qstr_from_str(filename);
+    }
+    lazy_reader_t lr;
+    lazy_reader_open(&lr, &reader, filename, 0);
+    raw_code_load(&reader, context, lazy);
+    #else
     mp_reader_new_file(&reader, filename);
     mp_raw_code_load(&reader, context);
+    #endif
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+void mp_raw_code_load_lazy(mp_raw_code_t *rc, const mp_module_context_t *context) {
+    mp_raw_code_lazy_t *lazy = (mp_raw_code_lazy_t *)rc;
+    size_t offset = lazy->offset;
+    mp_reader_t reader;
+    lazy_reader_t lr;
+    lazy_reader_open(&lr, &reader, qstr_str(context->lazy_filename), offset);
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, reader.close, reader.data);
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+
+    mp_raw_code_t *loaded = load_raw_code(&reader, (mp_module_context_t *)context, true);
+    if (lazy_reader_checksum(&lr, offset, 0, 0) != lazy->checksum) {
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+
+    nlr_pop_jump_callback(true);
+    *rc = *loaded;
+    m_del_obj(mp_raw_code_t, loaded);
+}
+#endif
+
 #endif // MICROPY_HAS_FILE_READER
 
 #endif // MICROPY_PERSISTENT_CODE_LOAD
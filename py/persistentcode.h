@@ -34,7 +34,8 @@
 // as long as MPY_VERSION matches, but a native .mpy (i.e. one with an arch
 // set) must also match MPY_SUB_VERSION. This allows 3 additional updates to
 // the native ABI per bytecode revision.
-#define MPY_VERSION 6
+// CIRCUITPY-CHANGE: version 7 adds the fused opcodes in py/bc0.h.
+#define MPY_VERSION 7
 #define MPY_SUB_VERSION 1
 
 // Macros to encode/decode sub-version to/from the feature byte. This replaces
@@ -114,6 +115,11 @@ enum {
 void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *ctx);
 void mp_raw_code_load_mem(const byte *buf, size_t len, mp_compiled_module_t *ctx);
 void mp_raw_code_load_file(const char *filename, mp_compiled_module_t *ctx);
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+// Load the bytecode of an MP_CODE_BYTECODE_LAZY raw code from its file, in place.
+void mp_raw_code_load_lazy(mp_raw_code_t *rc, const mp_module_context_t *context);
+#endif
 
 void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print);
 void mp_raw_code_save_file(mp_compiled_module_t *cm, const char *filename);
@@ -135,6 +135,7 @@ PY_CORE_O_BASENAME = $(addprefix py/,\
 	parsenum.o \
 	proto.o \
 	emitglue.o \
+	nativetier.o \
 	persistentcode.o \
 	runtime.o \
 	runtime_utils.o \
@@ -171,6 +171,8 @@ STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
             QSTR_EXIT();
             m_malloc_fail(new_alloc);
         }
+        // CIRCUITPY-CHANGE
+        GC_SET_ALLOC_KIND(pool, QSTR);
         pool->hashes = (qstr_hash_t *)(pool->qstrs + new_alloc);
         pool->lengths = (qstr_len_t *)(pool->hashes + new_alloc);
         pool->prev = MP_STATE_VM(last_pool);
@@ -258,6 +260,8 @@ qstr qstr_from_strn(const char *str, size_t len) {
                 }
                 al = n_bytes;
             }
+            // CIRCUITPY-CHANGE
+            GC_SET_ALLOC_KIND(MP_STATE_VM(qstr_last_chunk), QSTR);
             MP_STATE_VM(qstr_last_alloc) = al;
             MP_STATE_VM(qstr_last_used) = 0;
         }
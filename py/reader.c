@@ -134,9 +134,18 @@ void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd) {
 
 #if !MICROPY_VFS_POSIX
 // If MICROPY_VFS_POSIX is defined then this function is provided by the VFS layer
+// CIRCUITPY-CHANGE: allow starting part way into the file
 void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
+    mp_reader_new_file_at(reader, filename, 0);
+}
+
+void mp_reader_new_file_at(mp_reader_t *reader, const char *filename, size_t offset) {
     MP_THREAD_GIL_EXIT();
     int fd = open(filename, O_RDONLY, 0644);
+    if (fd >= 0 && offset != 0 && lseek(fd, offset, SEEK_SET) < 0) {
+        close(fd);
+        fd = -1;
+    }
     MP_THREAD_GIL_ENTER();
     if (fd < 0) {
         mp_raise_OSError_with_filename(errno, filename);
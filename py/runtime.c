@@ -110,6 +110,11 @@ void mp_init(void) {
     #if MICROPY_EMIT_NATIVE
     MP_STATE_VM(default_emit_opt) = MP_EMIT_OPT_NONE;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_NATIVE_TIER
+    MP_STATE_VM(native_tier_threshold) = 0;
+    MP_STATE_VM(native_tier_target) = 0;
+    #endif
     #endif
 
     // init global module dict
@@ -170,6 +175,10 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_CURRENT_CODE_STATE
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
 
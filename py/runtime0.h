@@ -43,6 +43,8 @@
 #define MP_SCOPE_FLAG_VIPERRELOC   (0x20) // used only when loading viper from .mpy
 #define MP_SCOPE_FLAG_VIPERRODATA  (0x40) // used only when loading viper from .mpy
 #define MP_SCOPE_FLAG_VIPERBSS     (0x80) // used only when loading viper from .mpy
+// CIRCUITPY-CHANGE
+#define MP_SCOPE_FLAG_NATIVE_TIER  (0x400) // used only by the compiler, see py/nativetier.c
 
 // types for native (viper) function signature
 #define MP_NATIVE_TYPE_OBJ  (0x00)
@@ -526,6 +526,53 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        // CIRCUITPY-CHANGE: fused opcodes
+        case MP_BC_LOAD_FAST_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_ATTR %d %s", *ip++, qstr_str(qst));
+            break;
+
+        case MP_BC_LOAD_FAST_METHOD:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_METHOD %d %s", *ip++, qstr_str(qst));
+            break;
+
+        case MP_BC_LOAD_FAST_STORE_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_STORE_ATTR %d %s", *ip++, qstr_str(qst));
+            break;
+
+        case MP_BC_BINARY_OP_SMALL_INT: {
+            DECODE_UINT;
+            mp_uint_t op = unum & MP_BC_BINARY_OP_FUSED_MASK;
+            mp_printf(print, "BINARY_OP_SMALL_INT " UINT_FMT " %s " INT_FMT, op, qstr_str(mp_binary_op_method_name[op]),
+                (mp_int_t)(unum >> MP_BC_BINARY_OP_FUSED_SHIFT) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS);
+            break;
+        }
+
+        case MP_BC_STORE_LOAD_FAST:
+            DECODE_UINT;
+            mp_printf(print, "STORE_LOAD_FAST " UINT_FMT, unum);
+            break;
+
+        case MP_BC_BINARY_OP_FAST: {
+            DECODE_UINT;
+            mp_uint_t op = unum & MP_BC_BINARY_OP_FUSED_MASK;
+            mp_printf(print, "BINARY_OP_FAST " UINT_FMT " %s " UINT_FMT, op, qstr_str(mp_binary_op_method_name[op]),
+                unum >> MP_BC_BINARY_OP_FUSED_SHIFT);
+            break;
+        }
+
+        case MP_BC_BINARY_OP_POP_JUMP_IF: {
+            DECODE_SLABEL;
+            mp_uint_t op = *ip & ~MP_BC_POP_JUMP_IF_TRUE_FLAG;
+            mp_printf(print, "BINARY_OP_POP_JUMP_IF_%s " UINT_FMT " %s " UINT_FMT,
+                *ip & MP_BC_POP_JUMP_IF_TRUE_FLAG ? "TRUE" : "FALSE", op, qstr_str(mp_binary_op_method_name[op]),
+                (mp_uint_t)(ip + unum - ip_start));
+            ip += 1;
+            break;
+        }
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
@@ -35,6 +35,7 @@
 #include "py/runtime.h"
 #include "py/bc0.h"
 #include "py/profile.h"
+#include "py/smallint.h"
 
 // *FORMAT-OFF*
 
@@ -86,6 +87,30 @@
         } \
     } while (0)
 
+// CIRCUITPY-CHANGE: taken backward jumps count towards promotion to native code
+#if MICROPY_NATIVE_TIER
+#define TIER_COUNT_JUMP(slab) \
+    do { \
+        if ((mp_int_t)(slab) < 0) { \
+            ++code_state->fun_bc->tier.count; \
+        } \
+    } while (0)
+#else
+#define TIER_COUNT_JUMP(slab) (void)0
+#endif
+
+// CIRCUITPY-CHANGE: opcode pair histogram, see micropython.opcode_pairs()
+#if MICROPY_DEBUG_VM_OPCODE_PAIRS
+uint32_t mp_vm_opcode_pairs[256][256];
+#define COUNT_OPCODE_PAIR(ip) \
+    do { \
+        ++mp_vm_opcode_pairs[prev_opcode][*(ip)]; \
+        prev_opcode = *(ip); \
+    } while (0)
+#else
+#define COUNT_OPCODE_PAIR(ip)
+#endif
+
 #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
 
 #define DECODE_QSTR \
@@ -187,6 +212,24 @@
     } \
 } while(0)
 
+// CIRCUITPY-CHANGE: track the current frame without any tracing
+#elif MICROPY_CURRENT_CODE_STATE
+
+#define FRAME_SETUP() do { \
+    MP_STATE_THREAD(current_code_state) = code_state; \
+} while (0)
+
+#define FRAME_ENTER() do { \
+    code_state->prev_state = MP_STATE_THREAD(current_code_state); \
+} while (0)
+
+#define FRAME_LEAVE() do { \
+    MP_STATE_THREAD(current_code_state) = code_state->prev_state; \
+} while (0)
+
+#define FRAME_UPDATE()
+#define TRACE_TICK(current_ip, current_sp, is_exception)
+
 #else // MICROPY_PY_SYS_SETTRACE
 #define FRAME_SETUP()
 #define FRAME_ENTER()
@@ -205,6 +248,129 @@ STATIC mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+// CIRCUITPY-CHANGE: shared by MP_BC_LOAD_ATTR and MP_BC_LOAD_FAST_ATTR
+static inline mp_obj_t vm_load_attr(mp_obj_t top, qstr qst) {
+    #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
+    // For the specific case of an instance type, it implements .attr
+    // and forwards to its members map. Attribute lookups on instance
+    // types are extremely common, so avoid all the other checks and
+    // calls that normally happen first.
+    if (mp_obj_is_instance_type(mp_obj_get_type(top))) {
+        mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
+        mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+        if (elem) {
+            return elem->value;
+        }
+    }
+    #endif
+    return mp_load_attr(top, qst);
+}
+
+#if MICROPY_OPT_BINARY_OP_FLOAT_FAST_PATH && MICROPY_PY_BUILTINS_FLOAT
+// CIRCUITPY-CHANGE: + - * / and comparisons where each operand is a float or
+// a small int. Returns MP_OBJ_NULL for anything else, including division by
+// zero, so that mp_binary_op can handle it (and raise).
+STATIC MP_NOINLINE mp_obj_t vm_binary_op_float(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    mp_float_t lhs_val, rhs_val;
+    if (mp_obj_is_float(lhs)) {
+        lhs_val = mp_obj_float_get(lhs);
+    } else if (mp_obj_is_small_int(lhs)) {
+        lhs_val = (mp_float_t)MP_OBJ_SMALL_INT_VALUE(lhs);
+    } else {
+        return MP_OBJ_NULL;
+    }
+    if (mp_obj_is_float(rhs)) {
+        rhs_val = mp_obj_float_get(rhs);
+    } else if (mp_obj_is_small_int(rhs)) {
+        rhs_val = (mp_float_t)MP_OBJ_SMALL_INT_VALUE(rhs);
+    } else {
+        return MP_OBJ_NULL;
+    }
+    switch (op) {
+        case MP_BINARY_OP_LESS:
+            return mp_obj_new_bool(lhs_val < rhs_val);
+        case MP_BINARY_OP_MORE:
+            return mp_obj_new_bool(lhs_val > rhs_val);
+        case MP_BINARY_OP_EQUAL:
+            return mp_obj_new_bool(lhs_val == rhs_val);
+        case MP_BINARY_OP_LESS_EQUAL:
+            return mp_obj_new_bool(lhs_val <= rhs_val);
+        case MP_BINARY_OP_MORE_EQUAL:
+            return mp_obj_new_bool(lhs_val >= rhs_val);
+        case MP_BINARY_OP_NOT_EQUAL:
+            return mp_obj_new_bool(lhs_val != rhs_val);
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_INPLACE_ADD:
+            return mp_obj_new_float(lhs_val + rhs_val);
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_INPLACE_SUBTRACT:
+            return mp_obj_new_float(lhs_val - rhs_val);
+        case MP_BINARY_OP_MULTIPLY:
+        case MP_BINARY_OP_INPLACE_MULTIPLY:
+            return mp_obj_new_float(lhs_val * rhs_val);
+        case MP_BINARY_OP_TRUE_DIVIDE:
+        case MP_BINARY_OP_INPLACE_TRUE_DIVIDE:
+            if (rhs_val == 0) {
+                break;
+            }
+            return mp_obj_new_float(lhs_val / rhs_val);
+        default:
+            break;
+    }
+    return MP_OBJ_NULL;
+}
+#endif
+
+// CIRCUITPY-CHANGE: Binary op for the BINARY_OP opcodes. Loop counters and
+// comparisons of small ints are handled inline, and floats are handled by
+// vm_binary_op_float, before falling back to mp_binary_op.
+static inline mp_obj_t vm_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+        mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+        switch (op) {
+            case MP_BINARY_OP_LESS:
+                return mp_obj_new_bool(lhs_val < rhs_val);
+            case MP_BINARY_OP_MORE:
+                return mp_obj_new_bool(lhs_val > rhs_val);
+            case MP_BINARY_OP_EQUAL:
+                return mp_obj_new_bool(lhs_val == rhs_val);
+            case MP_BINARY_OP_LESS_EQUAL:
+                return mp_obj_new_bool(lhs_val <= rhs_val);
+            case MP_BINARY_OP_MORE_EQUAL:
+                return mp_obj_new_bool(lhs_val >= rhs_val);
+            case MP_BINARY_OP_NOT_EQUAL:
+                return mp_obj_new_bool(lhs_val != rhs_val);
+            case MP_BINARY_OP_ADD:
+            case MP_BINARY_OP_INPLACE_ADD:
+                // Can't overflow mp_int_t, because small ints are narrower.
+                lhs_val += rhs_val;
+                if (MP_SMALL_INT_FITS(lhs_val)) {
+                    return MP_OBJ_NEW_SMALL_INT(lhs_val);
+                }
+                break;
+            case MP_BINARY_OP_SUBTRACT:
+            case MP_BINARY_OP_INPLACE_SUBTRACT:
+                lhs_val -= rhs_val;
+                if (MP_SMALL_INT_FITS(lhs_val)) {
+                    return MP_OBJ_NEW_SMALL_INT(lhs_val);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    #if MICROPY_OPT_BINARY_OP_FLOAT_FAST_PATH && MICROPY_PY_BUILTINS_FLOAT
+    if (mp_obj_is_float(lhs) || mp_obj_is_float(rhs)) {
+        mp_obj_t res = vm_binary_op_float(op, lhs, rhs);
+        if (res != MP_OBJ_NULL) {
+            return res;
+        }
+    }
+    #endif
+    return mp_binary_op(op, lhs, rhs);
+}
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -241,6 +407,7 @@ mp_vm_return_kind_t MICROPY_WRAP_MP_EXECUTE_BYTECODE(mp_execute_bytecode)(mp_cod
     #if MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE
     #define ONE_TRUE_DISPATCH() one_true_dispatch : do { \
         TRACE(ip); \
+        COUNT_OPCODE_PAIR(ip); \
         MARK_EXC_IP_GLOBAL(); \
         goto *(void *)((char *) && entry_MP_BC_LOAD_CONST_FALSE + entry_table[*ip++]); \
 } while (0)
@@ -249,6 +416,7 @@ mp_vm_return_kind_t MICROPY_WRAP_MP_EXECUTE_BYTECODE(mp_execute_bytecode)(mp_cod
     #define ONE_TRUE_DISPATCH() DISPATCH()
     #define DISPATCH() do { \
         TRACE(ip); \
+        COUNT_OPCODE_PAIR(ip); \
         MARK_EXC_IP_GLOBAL(); \
         TRACE_TICK(ip, sp, false); \
         goto *entry_table[*ip++]; \
@@ -310,6 +478,10 @@ outer_dispatch_loop:
             const qstr_short_t *qstr_table = code_state->fun_bc->context->constants.qstr_table;
             #endif
             mp_obj_t obj_shared;
+            #if MICROPY_DEBUG_VM_OPCODE_PAIRS
+            // Opcode 0x00 is unused, so it marks the start of a run of opcodes.
+            byte prev_opcode = MP_BC_BASE_RESERVED;
+            #endif
             MICROPY_VM_HOOK_INIT
 
             // If we have exception to inject, now that we finish setting up
@@ -332,6 +504,7 @@ dispatch_loop:
                 ONE_TRUE_DISPATCH();
                 #else
                 TRACE(ip);
+                COUNT_OPCODE_PAIR(ip);
                 MARK_EXC_IP_GLOBAL();
                 TRACE_TICK(ip, sp, false);
                 switch (*ip++) {
@@ -417,26 +590,8 @@ dispatch_loop:
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
-                    mp_obj_t top = TOP();
-                    mp_obj_t obj;
-                    #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
-                    // For the specific case of an instance type, it implements .attr
-                    // and forwards to its members map. Attribute lookups on instance
-                    // types are extremely common, so avoid all the other checks and
-                    // calls that normally happen first.
-                    mp_map_elem_t *elem = NULL;
-                    if (mp_obj_is_instance_type(mp_obj_get_type(top))) {
-                        mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
-                        elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
-                    }
-                    if (elem) {
-                        obj = elem->value;
-                    } else
-                    #endif
-                    {
-                        obj = mp_load_attr(top, qst);
-                    }
-                    SET_TOP(obj);
+                    // CIRCUITPY-CHANGE: fast path moved to vm_load_attr()
+                    SET_TOP(vm_load_attr(TOP(), qst));
                     DISPATCH();
                 }
 
@@ -577,6 +732,7 @@ dispatch_loop:
                 ENTRY(MP_BC_JUMP): {
                     DECODE_SLABEL;
                     ip += slab;
+                    TIER_COUNT_JUMP(slab);
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
 
@@ -584,6 +740,7 @@ dispatch_loop:
                     DECODE_SLABEL;
                     if (mp_obj_is_true(POP())) {
                         ip += slab;
+                        TIER_COUNT_JUMP(slab);
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -592,6 +749,7 @@ dispatch_loop:
                     DECODE_SLABEL;
                     if (!mp_obj_is_true(POP())) {
                         ip += slab;
+                        TIER_COUNT_JUMP(slab);
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -1283,6 +1441,87 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                // CIRCUITPY-CHANGE: fused opcodes, see py/bc0.h
+                ENTRY(MP_BC_LOAD_FAST_ATTR): {
+                    FRAME_UPDATE();
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_QSTR;
+                    mp_obj_t obj = fastn[-(mp_int_t)*ip++];
+                    if (obj == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(vm_load_attr(obj, qst));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_LOAD_FAST_METHOD): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_QSTR;
+                    mp_obj_t obj = fastn[-(mp_int_t)*ip++];
+                    if (obj == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    sp += 1;
+                    mp_load_method(obj, qst, sp);
+                    sp += 1;
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_LOAD_FAST_STORE_ATTR): {
+                    FRAME_UPDATE();
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_QSTR;
+                    mp_obj_t obj = fastn[-(mp_int_t)*ip++];
+                    if (obj == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    mp_store_attr(obj, qst, TOP());
+                    sp -= 1;
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_UINT;
+                    mp_obj_t rhs = MP_OBJ_NEW_SMALL_INT((mp_int_t)(unum >> MP_BC_BINARY_OP_FUSED_SHIFT) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS);
+                    SET_TOP(vm_binary_op(unum & MP_BC_BINARY_OP_FUSED_MASK, TOP(), rhs));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_STORE_LOAD_FAST): {
+                    DECODE_UINT;
+                    fastn[-unum] = TOP();
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_FAST): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_UINT;
+                    mp_obj_t rhs = fastn[-(mp_int_t)(unum >> MP_BC_BINARY_OP_FUSED_SHIFT)];
+                    if (rhs == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    SET_TOP(vm_binary_op(unum & MP_BC_BINARY_OP_FUSED_MASK, TOP(), rhs));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_POP_JUMP_IF): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_SLABEL;
+                    // As for MP_BC_UNWIND_JUMP, the offset is relative to the extra byte.
+                    byte arg = *ip;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = POP();
+                    mp_obj_t res = vm_binary_op(arg & ~MP_BC_POP_JUMP_IF_TRUE_FLAG, lhs, rhs);
+                    if (mp_obj_is_true(res) == ((arg & MP_BC_POP_JUMP_IF_TRUE_FLAG) != 0)) {
+                        ip += slab;
+                        TIER_COUNT_JUMP(slab);
+                    } else {
+                        ip += 1;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+
                 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS));
@@ -1305,7 +1544,7 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
-                    SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    SET_TOP(vm_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                     DISPATCH();
                 }
 
@@ -1328,7 +1567,7 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
-                        SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                        SET_TOP(vm_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                         DISPATCH();
                     } else
                 #endif // MICROPY_OPT_COMPUTED_GOTO
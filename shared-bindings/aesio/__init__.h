@@ -14,12 +14,14 @@ void common_hal_aesio_aes_construct(aesio_aes_obj_t *self,
     const uint8_t *key,
     uint32_t key_length,
     const uint8_t *iv,
+    size_t iv_length,
     int mode,
     int counter);
 void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self,
     const uint8_t *key,
     uint32_t key_length,
-    const uint8_t *iv);
+    const uint8_t *iv,
+    size_t iv_length);
 void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self,
     int mode);
 void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self,
@@ -28,3 +30,9 @@ void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self,
 void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self,
     uint8_t *buffer,
     size_t len);
+// MODE_GCM only
+void common_hal_aesio_aes_update(aesio_aes_obj_t *self,
+    const uint8_t *buffer,
+    size_t len);
+void common_hal_aesio_aes_get_tag(aesio_aes_obj_t *self,
+    uint8_t *tag);
@@ -18,6 +18,7 @@
 //| MODE_ECB: int
 //| MODE_CBC: int
 //| MODE_CTR: int
+//| MODE_GCM: int
 //|
 //| class AES:
 //|     """Encrypt and decrypt AES streams"""
@@ -32,9 +33,11 @@
 //|         """Create a new AES state with the given key.
 //|
 //|         :param ~circuitpython_typing.ReadableBuffer key: A 16-, 24-, or 32-byte key
-//|         :param int mode: AES mode to use.  One of: `MODE_ECB`, `MODE_CBC`, or
-//|                          `MODE_CTR`
-//|         :param ~circuitpython_typing.ReadableBuffer IV: Initialization vector to use for CBC or CTR mode
+//|         :param int mode: AES mode to use.  One of: `MODE_ECB`, `MODE_CBC`,
+//|                          `MODE_CTR`, or `MODE_GCM`
+//|         :param ~circuitpython_typing.ReadableBuffer IV: Initialization vector to use for CBC or CTR mode,
+//|                                                         or the nonce for GCM mode, which is required and
+//|                                                         is usually 12 bytes long
 //|
 //|         Additional arguments are supported for legacy reasons.
 //|
@@ -48,9 +51,51 @@
 //|           outp = bytearray(len(inp))
 //|           cipher = aesio.AES(key, aesio.MODE_ECB)
 //|           cipher.encrypt_into(inp, outp)
-//|           hexlify(outp)"""
+//|           hexlify(outp)
+//|
+//|         GCM mode also authenticates the message. Pass any data that is sent
+//|         unencrypted, such as a header, to `update` first, then encrypt and send
+//|         the tag from `digest` with the message::
+//|
+//|           cipher = aesio.AES(key, aesio.MODE_GCM, IV=nonce)
+//|           cipher.update(header)
+//|           cipher.encrypt_into(frame, frame)
+//|           tag = cipher.digest()
+//|
+//|         The receiver checks the tag with `verify` after decrypting."""
 //|         ...
 
+static void validate_mode(int mode) {
+    switch (mode) {
+        case AES_MODE_CBC:
+        case AES_MODE_ECB:
+        case AES_MODE_CTR:
+        case AES_MODE_GCM:
+            break;
+        default:
+            mp_raise_NotImplementedError(MP_ERROR_TEXT("Requested AES mode is unsupported"));
+    }
+}
+
+// The GCM nonce may be any length but must be given. The other modes take a
+// full block, and CBC and CTR start from zero without one.
+static const uint8_t *get_iv(int mode, mp_obj_t iv_obj, size_t *iv_length) {
+    mp_buffer_info_t bufinfo;
+    if (iv_obj == MP_OBJ_NULL || !mp_get_buffer(iv_obj, &bufinfo, MP_BUFFER_READ)) {
+        if (mode == AES_MODE_GCM) {
+            mp_arg_error_invalid(MP_QSTR_IV);
+        }
+        *iv_length = 0;
+        return NULL;
+    }
+    if (mode == AES_MODE_GCM) {
+        *iv_length = mp_arg_validate_length_min(bufinfo.len, 1, MP_QSTR_IV);
+    } else {
+        *iv_length = mp_arg_validate_length(bufinfo.len, AES_BLOCKLEN, MP_QSTR_IV);
+    }
+    return bufinfo.buf;
+}
+
 static mp_obj_t aesio_aes_make_new(const mp_obj_type_t *type, size_t n_args,
     size_t n_kw, const mp_obj_t *all_args) {
     aesio_aes_obj_t *self = mp_obj_malloc(aesio_aes_obj_t, &aesio_aes_type);
@@ -80,25 +125,12 @@ static mp_obj_t aesio_aes_make_new(const mp_obj_type_t *type, size_t n_args,
     key_length = bufinfo.len;
 
     int mode = args[ARG_mode].u_int;
-    switch (args[ARG_mode].u_int) {
-        case AES_MODE_CBC:
-        case AES_MODE_ECB:
-        case AES_MODE_CTR:
-            break;
-        default:
-            mp_raise_NotImplementedError(MP_ERROR_TEXT("Requested AES mode is unsupported"));
-    }
+    validate_mode(mode);
 
-    // IV is required for CBC mode and is ignored for other modes.
-    const uint8_t *iv = NULL;
-    if (args[ARG_IV].u_obj != NULL &&
-        mp_get_buffer(args[ARG_IV].u_obj, &bufinfo, MP_BUFFER_READ)) {
-        (void)mp_arg_validate_length(bufinfo.len, AES_BLOCKLEN, MP_QSTR_IV);
+    size_t iv_length;
+    const uint8_t *iv = get_iv(mode, args[ARG_IV].u_obj, &iv_length);
 
-        iv = bufinfo.buf;
-    }
-
-    common_hal_aesio_aes_construct(self, key, key_length, iv, mode,
+    common_hal_aesio_aes_construct(self, key, key_length, iv, iv_length, mode,
         args[ARG_counter].u_int);
     return MP_OBJ_FROM_PTR(self);
 }
@@ -107,19 +139,25 @@ static mp_obj_t aesio_aes_make_new(const mp_obj_type_t *type, size_t n_args,
 //|         self,
 //|         key: ReadableBuffer,
 //|         IV: Optional[ReadableBuffer] = None,
+//|         *,
+//|         mode: Optional[int] = None,
 //|     ) -> None:
 //|         """Update the AES state with the given key.
 //|
 //|         :param ~circuitpython_typing.ReadableBuffer key: A 16-, 24-, or 32-byte key
 //|         :param ~circuitpython_typing.ReadableBuffer IV: Initialization vector to use
-//|                                                         for CBC or CTR mode"""
+//|                                                         for CBC or CTR mode, or the nonce
+//|                                                         for GCM mode
+//|         :param int mode: AES mode to change to. This is the only way to change to or
+//|                          from `MODE_GCM`, as GCM needs a new nonce."""
 //|         ...
 static mp_obj_t aesio_aes_rekey(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
-    enum { ARG_key, ARG_IV };
+    enum { ARG_key, ARG_IV, ARG_mode };
     static const mp_arg_t allowed_args[] = {
         {MP_QSTR_key, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
         {MP_QSTR_IV, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_mode, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -134,15 +172,17 @@ static mp_obj_t aesio_aes_rekey(size_t n_args, const mp_obj_t *pos_args, mp_map_
         mp_raise_ValueError(MP_ERROR_TEXT("Key must be 16, 24, or 32 bytes long"));
     }
 
-    const uint8_t *iv = NULL;
-    if (args[ARG_IV].u_obj != NULL &&
-        mp_get_buffer(args[ARG_IV].u_obj, &bufinfo, MP_BUFFER_READ)) {
-        (void)mp_arg_validate_length(bufinfo.len, AES_BLOCKLEN, MP_QSTR_IV);
-
-        iv = bufinfo.buf;
+    int mode = self->mode;
+    if (args[ARG_mode].u_obj != mp_const_none) {
+        mode = mp_obj_get_int(args[ARG_mode].u_obj);
+        validate_mode(mode);
     }
 
-    common_hal_aesio_aes_rekey(self, key, key_length, iv);
+    size_t iv_length;
+    const uint8_t *iv = get_iv(mode, args[ARG_IV].u_obj, &iv_length);
+
+    common_hal_aesio_aes_set_mode(self, mode);
+    common_hal_aesio_aes_rekey(self, key, key_length, iv, iv_length);
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(aesio_aes_rekey_obj, 1, aesio_aes_rekey);
@@ -166,6 +206,7 @@ static void validate_length(aesio_aes_obj_t *self, size_t src_length,
             }
             break;
         case AES_MODE_CTR:
+        case AES_MODE_GCM:
             break;
     }
 }
@@ -175,7 +216,11 @@ static void validate_length(aesio_aes_obj_t *self, size_t src_length,
 //|
 //|         For ECB mode, the buffers must be 16 bytes long.  For CBC mode, the
 //|         buffers must be a multiple of 16 bytes, and must be equal length.  For
-//|         CTR mode, there are no restrictions."""
+//|         CTR and GCM modes, there are no restrictions.
+//|
+//|         ``src`` and ``dest`` may be the same buffer, to encrypt in place. In
+//|         CBC, CTR and GCM modes a long message may be passed in pieces: each
+//|         call carries on from where the last one stopped."""
 //|         ...
 static mp_obj_t aesio_aes_encrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t dest) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -185,7 +230,7 @@ static mp_obj_t aesio_aes_encrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t
     mp_get_buffer_raise(dest, &destbufinfo, MP_BUFFER_WRITE);
     validate_length(self, srcbufinfo.len, destbufinfo.len);
 
-    memcpy(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
+    memmove(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
 
     common_hal_aesio_aes_encrypt(self, (uint8_t *)destbufinfo.buf, destbufinfo.len);
     return mp_const_none;
@@ -197,9 +242,10 @@ static MP_DEFINE_CONST_FUN_OBJ_3(aesio_aes_encrypt_into_obj, aesio_aes_encrypt_i
 //|         """Decrypt the buffer from ``src`` into ``dest``.
 //|         For ECB mode, the buffers must be 16 bytes long.  For CBC mode, the
 //|         buffers must be a multiple of 16 bytes, and must be equal length.  For
-//|         CTR mode, there are no restrictions."""
-//|         ...
+//|         CTR and GCM modes, there are no restrictions.
 //|
+//|         ``src`` and ``dest`` may be the same buffer, to decrypt in place."""
+//|         ...
 static mp_obj_t aesio_aes_decrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t dest) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -208,7 +254,7 @@ static mp_obj_t aesio_aes_decrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t
     mp_get_buffer_raise(dest, &destbufinfo, MP_BUFFER_WRITE);
     validate_length(self, srcbufinfo.len, destbufinfo.len);
 
-    memcpy(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
+    memmove(destbufinfo.buf, srcbufinfo.buf, srcbufinfo.len);
 
     common_hal_aesio_aes_decrypt(self, (uint8_t *)destbufinfo.buf, destbufinfo.len);
     return mp_const_none;
@@ -216,6 +262,78 @@ static mp_obj_t aesio_aes_decrypt_into(mp_obj_t self_in, mp_obj_t src, mp_obj_t
 
 static MP_DEFINE_CONST_FUN_OBJ_3(aesio_aes_decrypt_into_obj, aesio_aes_decrypt_into);
 
+static void check_gcm(aesio_aes_obj_t *self) {
+    if (self->mode != AES_MODE_GCM) {
+        mp_arg_error_invalid(MP_QSTR_mode);
+    }
+}
+
+//|     def update(self, data: ReadableBuffer) -> None:
+//|         """Authenticate ``data`` without encrypting it, in `MODE_GCM` only.
+//|
+//|         All such data must be passed before the first call to `encrypt_into`
+//|         or `decrypt_into`. It may be split across several calls."""
+//|         ...
+static mp_obj_t aesio_aes_update(mp_obj_t self_in, mp_obj_t data) {
+    aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_gcm(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    common_hal_aesio_aes_update(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(aesio_aes_update_obj, aesio_aes_update);
+
+//|     def digest(self) -> bytes:
+//|         """Return the 16-byte tag for the data passed so far, in `MODE_GCM` only."""
+//|         ...
+static mp_obj_t aesio_aes_digest(mp_obj_t self_in) {
+    aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_gcm(self);
+
+    uint8_t tag[AES_BLOCKLEN];
+    common_hal_aesio_aes_get_tag(self, tag);
+    return mp_obj_new_bytes(tag, sizeof(tag));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(aesio_aes_digest_obj, aesio_aes_digest);
+
+//|     def verify(self, tag: ReadableBuffer) -> None:
+//|         """Check a received tag against the data decrypted so far, in `MODE_GCM`
+//|         only. Raise `ValueError` if they do not match, in which case the
+//|         decrypted data must not be used.
+//|
+//|         A tag truncated to between 4 and 16 bytes is checked against the same
+//|         number of bytes."""
+//|         ...
+//|
+static mp_obj_t aesio_aes_verify(mp_obj_t self_in, mp_obj_t tag_in) {
+    aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_gcm(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(tag_in, &bufinfo, MP_BUFFER_READ);
+    mp_arg_validate_length_range(bufinfo.len, 4, AES_BLOCKLEN, MP_QSTR_tag);
+
+    uint8_t tag[AES_BLOCKLEN];
+    common_hal_aesio_aes_get_tag(self, tag);
+    // Compare every byte, so the time taken doesn't say where they differ.
+    const uint8_t *received = bufinfo.buf;
+    uint8_t diff = 0;
+    for (size_t i = 0; i < bufinfo.len; i++) {
+        diff |= tag[i] ^ received[i];
+    }
+    if (diff != 0) {
+        mp_arg_error_invalid(MP_QSTR_tag);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(aesio_aes_verify_obj, aesio_aes_verify);
+
+//|     mode: int
+//|     """The AES mode. It can't be set to or from `MODE_GCM`, which needs a new key
+//|     and nonce: use `rekey` with ``mode`` instead."""
+//|
 static mp_obj_t aesio_aes_get_mode(mp_obj_t self_in) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -227,13 +345,9 @@ static mp_obj_t aesio_aes_set_mode(mp_obj_t self_in, mp_obj_t mode_obj) {
     aesio_aes_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
     int mode = mp_obj_get_int(mode_obj);
-    switch (mode) {
-        case AES_MODE_CBC:
-        case AES_MODE_ECB:
-        case AES_MODE_CTR:
-            break;
-        default:
-            mp_raise_NotImplementedError(MP_ERROR_TEXT("Requested AES mode is unsupported"));
+    validate_mode(mode);
+    if ((mode == AES_MODE_GCM) != (self->mode == AES_MODE_GCM)) {
+        mp_arg_error_invalid(MP_QSTR_mode);
     }
 
     common_hal_aesio_aes_set_mode(self, mode);
@@ -251,6 +365,9 @@ static const mp_rom_map_elem_t aesio_locals_dict_table[] = {
     {MP_ROM_QSTR(MP_QSTR_encrypt_into), (mp_obj_t)&aesio_aes_encrypt_into_obj},
     {MP_ROM_QSTR(MP_QSTR_decrypt_into), (mp_obj_t)&aesio_aes_decrypt_into_obj},
     {MP_ROM_QSTR(MP_QSTR_rekey), (mp_obj_t)&aesio_aes_rekey_obj},
+    {MP_ROM_QSTR(MP_QSTR_update), (mp_obj_t)&aesio_aes_update_obj},
+    {MP_ROM_QSTR(MP_QSTR_digest), (mp_obj_t)&aesio_aes_digest_obj},
+    {MP_ROM_QSTR(MP_QSTR_verify), (mp_obj_t)&aesio_aes_verify_obj},
     {MP_ROM_QSTR(MP_QSTR_mode), (mp_obj_t)&aesio_aes_mode_obj},
 };
 static MP_DEFINE_CONST_DICT(aesio_locals_dict, aesio_locals_dict_table);
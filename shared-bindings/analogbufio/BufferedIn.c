@@ -6,9 +6,11 @@
 
 #include <string.h>
 #include "shared/runtime/context_manager_helpers.h"
+#include "shared/runtime/interrupt_char.h"
 #include "py/binary.h"
 #include "py/mphal.h"
 #include "py/nlr.h"
+#include "py/objproperty.h"
 #include "py/runtime.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/analogbufio/BufferedIn.h"
@@ -106,11 +108,14 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(analogbufio_bufferedin___exit___obj,
 //|         For 16-bit samples, if loop=False, the 12-bit ADC values are scaled up to fill the 16 bit range.
 //|         If loop=True, ADC values are stored without scaling.
 //|
+//|         After `start`, samples are read from the continuous capture instead, waiting
+//|         until the buffer is full. The buffer must have the same typecode as the one
+//|         given to `start`, and ``loop`` must be False.
+//|
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer: A buffer for samples
 //|         :param ~bool loop: loop: Set to true for continuous conversions, False to fill buffer once then stop
 //|         """
 //|         ...
-//|
 static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_buffer, ARG_loop };
     static const mp_arg_t allowed_args[] = {
@@ -131,17 +136,113 @@ static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_
     } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'H' or 'B'"), MP_QSTR_buffer);
     }
+    analogbufio_ring_t *ring = common_hal_analogbufio_bufferedin_get_ring(self);
+    if (ring != NULL) {
+        if (args[ARG_loop].u_bool) {
+            mp_arg_error_invalid(MP_QSTR_loop);
+        }
+        if (bytes_per_sample != ring->bytes_per_sample) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Mismatched data size"));
+        }
+        size_t len = bufinfo.len / bytes_per_sample;
+        size_t captured = 0;
+        while (true) {
+            captured += analogbufio_ring_readinto(ring, (uint8_t *)bufinfo.buf + captured * bytes_per_sample, len - captured);
+            if (captured == len || mp_hal_is_interrupted()) {
+                break;
+            }
+            RUN_BACKGROUND_TASKS;
+        }
+        return MP_OBJ_NEW_SMALL_INT(captured);
+    }
     mp_uint_t captured = common_hal_analogbufio_bufferedin_readinto(self, bufinfo.buf, bufinfo.len, bytes_per_sample, args[ARG_loop].u_bool);
     return MP_OBJ_NEW_SMALL_INT(captured);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(analogbufio_bufferedin_readinto_obj, 1, analogbufio_bufferedin_obj_readinto);
 
+//|     def start(self, buffer: WriteableBuffer, *, blocks: int = 3, decimation: int = 1) -> None:
+//|         """Start capturing continuously, with no gaps between reads.
+//|
+//|         ``buffer`` is split into ``blocks`` equal blocks that are filled one after
+//|         the other while earlier ones are read with `readinto`. If the blocks
+//|         are all full, new samples are dropped and counted in `overflow_count`.
+//|         16-bit samples are scaled as for `readinto` with ``loop=False``.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer buffer: A bytearray or array of type 'B' or 'H'
+//|         :param int blocks: The number of blocks, up to 255. Some ports fill two blocks
+//|             at once, so at least three are needed for one to be read meanwhile.
+//|         :param int decimation: Average this many samples into each one read, to
+//|             reduce the sample rate and the noise
+//|         """
+//|         ...
+static mp_obj_t analogbufio_bufferedin_obj_start(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_blocks, ARG_decimation };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_blocks,     MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 3} },
+        { MP_QSTR_decimation, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+    };
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    common_hal_analogbufio_bufferedin_stop(self);
+    common_hal_analogbufio_bufferedin_start(self, args[ARG_buffer].u_obj, args[ARG_blocks].u_int, args[ARG_decimation].u_int);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(analogbufio_bufferedin_start_obj, 1, analogbufio_bufferedin_obj_start);
+
+//|     def stop(self) -> None:
+//|         """Stop capturing continuously. Samples that haven't been read are discarded."""
+//|         ...
+static mp_obj_t analogbufio_bufferedin_obj_stop(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_analogbufio_bufferedin_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_stop_obj, analogbufio_bufferedin_obj_stop);
+
+//|     in_waiting: int
+//|     """The number of samples that `readinto` can return without waiting. Always 0
+//|     when not capturing continuously. (read-only)"""
+static mp_obj_t analogbufio_bufferedin_obj_get_in_waiting(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    analogbufio_ring_t *ring = common_hal_analogbufio_bufferedin_get_ring(self);
+    return mp_obj_new_int_from_uint(ring == NULL ? 0 : analogbufio_ring_get_in_waiting(ring));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_in_waiting_obj, analogbufio_bufferedin_obj_get_in_waiting);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_in_waiting_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_in_waiting_obj);
+
+//|     overflow_count: int
+//|     """The number of samples dropped since `start` because the blocks were all
+//|     full. (read-only)"""
+//|
+static mp_obj_t analogbufio_bufferedin_obj_get_overflow_count(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    analogbufio_ring_t *ring = common_hal_analogbufio_bufferedin_get_ring(self);
+    return mp_obj_new_int_from_uint(ring == NULL ? 0 : ring->overflow_count);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_overflow_count_obj, analogbufio_bufferedin_obj_get_overflow_count);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_overflow_count_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_overflow_count_obj);
+
 static const mp_rom_map_elem_t analogbufio_bufferedin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___del__),    MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit),     MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),  MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),   MP_ROM_PTR(&analogbufio_bufferedin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto),   MP_ROM_PTR(&analogbufio_bufferedin_readinto_obj)},
+    { MP_ROM_QSTR(MP_QSTR_start),      MP_ROM_PTR(&analogbufio_bufferedin_start_obj)},
+    { MP_ROM_QSTR(MP_QSTR_stop),       MP_ROM_PTR(&analogbufio_bufferedin_stop_obj)},
+    { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&analogbufio_bufferedin_in_waiting_obj)},
+    { MP_ROM_QSTR(MP_QSTR_overflow_count), MP_ROM_PTR(&analogbufio_bufferedin_overflow_count_obj)},
 };
 
 static MP_DEFINE_CONST_DICT(analogbufio_bufferedin_locals_dict, analogbufio_bufferedin_locals_dict_table);
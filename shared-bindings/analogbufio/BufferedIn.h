@@ -8,6 +8,7 @@
 
 #include "common-hal/microcontroller/Pin.h"
 #include "common-hal/analogbufio/BufferedIn.h"
+#include "shared-module/analogbufio/SampleRing.h"
 
 extern const mp_obj_type_t analogbufio_bufferedin_type;
 
@@ -15,3 +16,10 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
 void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self);
 bool common_hal_analogbufio_bufferedin_deinited(analogbufio_bufferedin_obj_t *self);
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample, bool loop);
+
+// Continuous capture into a ring of blocks. Ports that can't do this raise
+// NotImplementedError from start().
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self, mp_obj_t buffer, mp_int_t block_count, mp_int_t decimation);
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self);
+// NULL when not capturing continuously.
+analogbufio_ring_t *common_hal_analogbufio_bufferedin_get_ring(analogbufio_bufferedin_obj_t *self);
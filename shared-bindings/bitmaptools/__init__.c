@@ -1082,6 +1082,110 @@ static mp_obj_t bitmaptools_obj_blit(size_t n_args, const mp_obj_t *pos_args, mp
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_blit_obj, 1, bitmaptools_obj_blit);
 
+//| def blit2x(
+//|     dest_bitmap: displayio.Bitmap,
+//|     source_bitmap: displayio.Bitmap,
+//|     x: int,
+//|     y: int,
+//|     *,
+//|     x1: int = 0,
+//|     y1: int = 0,
+//|     x2: int | None = None,
+//|     y2: int | None = None,
+//|     skip_source_index: int | None = None,
+//|     colorspace: displayio.Colorspace | None = None
+//| ) -> None:
+//|     """Inserts the source_bitmap region defined by rectangular boundaries
+//|     (x1,y1) and (x2,y2) into the bitmap at the specified (x,y) location,
+//|     scaled up by a factor of two in both directions.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap that the area will be copied into.
+//|     :param bitmap source_bitmap: Source bitmap that contains the graphical region to be copied
+//|     :param int x: Horizontal pixel location in bitmap where source_bitmap upper-left
+//|                   corner will be placed
+//|     :param int y: Vertical pixel location in bitmap where source_bitmap upper-left
+//|                   corner will be placed
+//|     :param int x1: Minimum x-value for rectangular bounding box to be copied from the source bitmap
+//|     :param int y1: Minimum y-value for rectangular bounding box to be copied from the source bitmap
+//|     :param int x2: Maximum x-value (exclusive) for rectangular bounding box to be copied from the source bitmap. If unspecified or `None`, the source bitmap width is used.
+//|     :param int y2: Maximum y-value (exclusive) for rectangular bounding box to be copied from the source bitmap. If unspecified or `None`, the source bitmap height is used.
+//|     :param int skip_source_index: bitmap palette index in the source that will not be copied,
+//|                            set to None to copy all pixels
+//|     :param displayio.Colorspace colorspace: If `None`, each source pixel is copied into a 2x2 block
+//|            (nearest neighbor). Otherwise the added pixels are bilinearly interpolated in this colorspace.
+//|            Only ``L8``, ``RGB565``, ``RGB565_SWAPPED``, ``BGR565`` and ``BGR565_SWAPPED`` are permitted,
+//|            and both bitmaps must then have 8 (for ``L8``) or 16 bits per value."""
+//|     ...
+//|
+static mp_obj_t bitmaptools_obj_blit2x(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum {ARG_destination, ARG_source, ARG_x, ARG_y, ARG_x1, ARG_y1, ARG_x2, ARG_y2, ARG_skip_source_index, ARG_colorspace};
+    static const mp_arg_t allowed_args[] = {
+        {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_source_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT, {.u_obj = MP_OBJ_NULL} },
+        {MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT, {.u_obj = MP_OBJ_NULL} },
+        ALLOWED_ARGS_X1_Y1_X2_Y2(0, 0),
+        {MP_QSTR_skip_source_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        {MP_QSTR_colorspace, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *destination = mp_arg_validate_type(args[ARG_destination].u_obj, &displayio_bitmap_type, MP_QSTR_dest_bitmap);
+
+    uint16_t x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, destination->width, MP_QSTR_x);
+    uint16_t y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, destination->height, MP_QSTR_y);
+
+    displayio_bitmap_t *source = mp_arg_validate_type(args[ARG_source].u_obj, &displayio_bitmap_type, MP_QSTR_source_bitmap);
+
+    bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], source->width, source->height);
+
+    bool bilinear = args[ARG_colorspace].u_obj != mp_const_none;
+    displayio_colorspace_t colorspace = DISPLAYIO_COLORSPACE_RGB565;
+    if (bilinear) {
+        colorspace = (displayio_colorspace_t)cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace);
+        switch (colorspace) {
+            case DISPLAYIO_COLORSPACE_L8:
+                if (destination->bits_per_value != 8 || source->bits_per_value != 8) {
+                    mp_raise_ValueError(MP_ERROR_TEXT("For L8 colorspace, input bitmap must have 8 bits per pixel"));
+                }
+                break;
+
+            case DISPLAYIO_COLORSPACE_RGB565:
+            case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            case DISPLAYIO_COLORSPACE_BGR565:
+            case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+                if (destination->bits_per_value != 16 || source->bits_per_value != 16) {
+                    mp_raise_ValueError(MP_ERROR_TEXT("For RGB colorspaces, input bitmap must have 16 bits per pixel"));
+                }
+                break;
+
+            default:
+                mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+        }
+    } else if (destination->bits_per_value < source->bits_per_value) {
+        // ensure that the target bitmap (self) has at least as many `bits_per_value` as the source
+        mp_raise_ValueError(MP_ERROR_TEXT("source palette too large"));
+    }
+
+    uint32_t skip_source_index;
+    bool skip_source_index_none; // flag whether skip_value was None
+
+    if (args[ARG_skip_source_index].u_obj == mp_const_none) {
+        skip_source_index = 0;
+        skip_source_index_none = true;
+    } else {
+        skip_source_index = mp_obj_get_int(args[ARG_skip_source_index].u_obj);
+        skip_source_index_none = false;
+    }
+
+    common_hal_bitmaptools_blit2x(destination, source, x, y, lim.x1, lim.y1, lim.x2, lim.y2, skip_source_index, skip_source_index_none,
+        bilinear, colorspace);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_blit2x_obj, 1, bitmaptools_obj_blit2x);
+
 
 static const mp_rom_map_elem_t bitmaptools_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_bitmaptools) },
@@ -1095,6 +1199,7 @@ static const mp_rom_map_elem_t bitmaptools_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_draw_polygon), MP_ROM_PTR(&bitmaptools_draw_polygon_obj) },
     { MP_ROM_QSTR(MP_QSTR_draw_circle), MP_ROM_PTR(&bitmaptools_draw_circle_obj) },
     { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&bitmaptools_blit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit2x), MP_ROM_PTR(&bitmaptools_blit2x_obj) },
     { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&bitmaptools_dither_obj) },
     { MP_ROM_QSTR(MP_QSTR_BlendMode), MP_ROM_PTR(&bitmaptools_blendmode_type) },
     { MP_ROM_QSTR(MP_QSTR_DitherAlgorithm), MP_ROM_PTR(&bitmaptools_dither_algorithm_type) },
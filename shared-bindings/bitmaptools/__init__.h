@@ -60,6 +60,10 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
     int16_t x1, int16_t y1, int16_t x2, int16_t y2,
     uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index, bool skip_dest_index_none);
 
+void common_hal_bitmaptools_blit2x(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+    uint32_t skip_source_index, bool skip_source_index_none, bool bilinear, displayio_colorspace_t colorspace);
+
 void common_hal_bitmaptools_draw_polygon(displayio_bitmap_t *destination, void *xs, void *ys, size_t points_len, int point_size, uint32_t value, bool close);
 void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, int element_size, int bits_per_pixel, bool reverse_pixels_in_word, bool swap_bytes, bool reverse_rows);
 void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int element_size, int x1, int y1, int x2, int y2, bool skip_specified, uint32_t skip_index);
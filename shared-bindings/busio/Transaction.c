@@ -0,0 +1,214 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/busio/Transaction.h"
+
+#include "py/runtime.h"
+
+//| class Transaction:
+//|     """A recorded sequence of bus operations that is replayed with one call"""
+//|
+//|     def __init__(
+//|         self,
+//|         bus: Union[busio.I2C, busio.SPI],
+//|         address: Optional[int] = None,
+//|         *,
+//|         chip_select: Optional[digitalio.DigitalInOut] = None,
+//|         cs_active_value: bool = False,
+//|         baudrate: int = 100000,
+//|         polarity: int = 0,
+//|         phase: int = 0
+//|     ) -> None:
+//|         """Record the steps once with `write`, `readinto`, `write_then_readinto` and
+//|         `delay_us`, then call `run` as often as needed. `run` locks the bus,
+//|         configures it and performs every step without returning to Python, so
+//|         polling a sensor costs one call instead of several.
+//|
+//|         Buffers are kept by reference: the data written is whatever is in the
+//|         buffer when `run` is called, and data read is left in the buffers given.
+//|
+//|         ``bus`` is usually a `busio.I2C` or `busio.SPI`. Other objects with the
+//|         same methods, such as `bitbangio.I2C`, are called through those methods.
+//|
+//|         :param bus: The bus the device is on
+//|         :param int address: 7-bit I2C device address. ``None`` for an SPI bus.
+//|         :param ~digitalio.DigitalInOut chip_select: The SPI chip select pin, already an output.
+//|             It is asserted around each step. ``None`` if a chip select pin is not being used.
+//|         :param bool cs_active_value: Set to true if your device requires CS to be active high.
+//|         :param int baudrate: SPI clock rate, set at the start of each `run`
+//|         :param int polarity: SPI clock polarity
+//|         :param int phase: SPI clock phase
+//|
+//|         Example::
+//|
+//|             import board
+//|             import busio
+//|
+//|             accel = bytearray(6)
+//|             gyro = bytearray(6)
+//|             poll = busio.Transaction(board.I2C(), 0x6A)
+//|             poll.write_then_readinto(b"\\x28", accel)
+//|             poll.write_then_readinto(b"\\x22", gyro)
+//|             while True:
+//|                 poll.run()"""
+//|         ...
+static mp_obj_t busio_transaction_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_bus, ARG_address, ARG_chip_select, ARG_cs_active_value, ARG_baudrate, ARG_polarity, ARG_phase };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_bus, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_address, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_chip_select, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_cs_active_value, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_baudrate, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100000} },
+        { MP_QSTR_polarity, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_phase, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t address = -1;
+    if (args[ARG_address].u_obj != mp_const_none) {
+        address = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_address].u_obj), 0, 0x7f, MP_QSTR_address);
+    }
+    uint32_t baudrate = mp_arg_validate_int_min(args[ARG_baudrate].u_int, 1, MP_QSTR_baudrate);
+    uint8_t polarity = (uint8_t)mp_arg_validate_int_range(args[ARG_polarity].u_int, 0, 1, MP_QSTR_polarity);
+    uint8_t phase = (uint8_t)mp_arg_validate_int_range(args[ARG_phase].u_int, 0, 1, MP_QSTR_phase);
+
+    busio_transaction_obj_t *self = mp_obj_malloc(busio_transaction_obj_t, &busio_transaction_type);
+    common_hal_busio_transaction_construct(self, args[ARG_bus].u_obj, address, args[ARG_chip_select].u_obj,
+        args[ARG_cs_active_value].u_bool, baudrate, polarity, phase);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t validate_buffer(mp_obj_t obj, mp_uint_t flags) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, flags);
+    return obj;
+}
+
+//|     def write(self, buffer: ReadableBuffer) -> None:
+//|         """Add a step that writes ``buffer``. On I2C it ends with a stop bit.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer buffer: buffer containing the bytes to write
+//|         """
+//|         ...
+static mp_obj_t busio_transaction_write(mp_obj_t self_in, mp_obj_t buffer) {
+    busio_transaction_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_busio_transaction_add(self, BUSIO_TRANSACTION_WRITE,
+        validate_buffer(buffer, MP_BUFFER_READ), MP_OBJ_NULL, 0);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(busio_transaction_write_obj, busio_transaction_write);
+
+//|     def readinto(self, buffer: WriteableBuffer, *, write_value: int = 0) -> None:
+//|         """Add a step that reads into ``buffer``.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer to read into
+//|         :param int write_value: value to write while reading from an SPI bus
+//|         """
+//|         ...
+static mp_obj_t busio_transaction_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_write_value };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_write_value, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    busio_transaction_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint8_t write_value = (uint8_t)mp_arg_validate_int_range(args[ARG_write_value].u_int, 0, 0xff, MP_QSTR_write_value);
+    common_hal_busio_transaction_add(self, BUSIO_TRANSACTION_READINTO,
+        MP_OBJ_NULL, validate_buffer(args[ARG_buffer].u_obj, MP_BUFFER_WRITE), write_value);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(busio_transaction_readinto_obj, 1, busio_transaction_readinto);
+
+//|     def write_then_readinto(self, out_buffer: ReadableBuffer, in_buffer: WriteableBuffer) -> None:
+//|         """Add a step that writes ``out_buffer`` and then reads into ``in_buffer``.
+//|         On I2C there is a repeated start between the two, as in
+//|         `busio.I2C.writeto_then_readfrom`. On SPI chip select stays asserted.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer out_buffer: buffer containing the bytes to write
+//|         :param ~circuitpython_typing.WriteableBuffer in_buffer: buffer to read into
+//|         """
+//|         ...
+static mp_obj_t busio_transaction_write_then_readinto(mp_obj_t self_in, mp_obj_t out_buffer, mp_obj_t in_buffer) {
+    busio_transaction_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_busio_transaction_add(self, BUSIO_TRANSACTION_WRITE_THEN_READINTO,
+        validate_buffer(out_buffer, MP_BUFFER_READ), validate_buffer(in_buffer, MP_BUFFER_WRITE), 0);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(busio_transaction_write_then_readinto_obj, busio_transaction_write_then_readinto);
+
+//|     def delay_us(self, delay: int) -> None:
+//|         """Add a step that waits for ``delay`` microseconds, such as for a conversion to finish."""
+//|         ...
+static mp_obj_t busio_transaction_delay_us(mp_obj_t self_in, mp_obj_t delay_in) {
+    busio_transaction_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint32_t delay = mp_arg_validate_int_min(mp_obj_get_int(delay_in), 0, MP_QSTR_delay);
+    common_hal_busio_transaction_add(self, BUSIO_TRANSACTION_DELAY, MP_OBJ_NULL, MP_OBJ_NULL, delay);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(busio_transaction_delay_us_obj, busio_transaction_delay_us);
+
+//|     def clear(self) -> None:
+//|         """Remove all of the steps."""
+//|         ...
+static mp_obj_t busio_transaction_clear(mp_obj_t self_in) {
+    busio_transaction_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_busio_transaction_clear(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(busio_transaction_clear_obj, busio_transaction_clear);
+
+//|     def run(self) -> None:
+//|         """Lock the bus, perform every step in order and unlock it again. Waits
+//|         for the bus if another user has it locked. If a step fails, the rest
+//|         are skipped and the error is raised."""
+//|         ...
+static mp_obj_t busio_transaction_run(mp_obj_t self_in) {
+    busio_transaction_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_busio_transaction_run(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(busio_transaction_run_obj, busio_transaction_run);
+
+//|     def __len__(self) -> int:
+//|         """The number of steps recorded."""
+//|         ...
+//|
+static mp_obj_t busio_transaction_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    busio_transaction_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t len = common_hal_busio_transaction_get_len(self);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(len);
+        default:
+            return MP_OBJ_NULL; // op not supported
+    }
+}
+
+static const mp_rom_map_elem_t busio_transaction_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_transaction_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_transaction_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_then_readinto), MP_ROM_PTR(&busio_transaction_write_then_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delay_us), MP_ROM_PTR(&busio_transaction_delay_us_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&busio_transaction_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_run), MP_ROM_PTR(&busio_transaction_run_obj) },
+};
+static MP_DEFINE_CONST_DICT(busio_transaction_locals_dict, busio_transaction_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    busio_transaction_type,
+    MP_QSTR_Transaction,
+    MP_TYPE_FLAG_NONE,
+    make_new, busio_transaction_make_new,
+    unary_op, busio_transaction_unary_op,
+    locals_dict, &busio_transaction_locals_dict
+    );
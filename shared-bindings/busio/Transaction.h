@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/busio/Transaction.h"
+
+extern const mp_obj_type_t busio_transaction_type;
+
+void common_hal_busio_transaction_construct(busio_transaction_obj_t *self, mp_obj_t bus, mp_int_t address,
+    mp_obj_t chip_select, bool cs_active_value, uint32_t baudrate, uint8_t polarity, uint8_t phase);
+void common_hal_busio_transaction_add(busio_transaction_obj_t *self, busio_transaction_step_kind_t kind,
+    mp_obj_t out_obj, mp_obj_t in_obj, uint32_t value);
+void common_hal_busio_transaction_clear(busio_transaction_obj_t *self);
+size_t common_hal_busio_transaction_get_len(busio_transaction_obj_t *self);
+void common_hal_busio_transaction_run(busio_transaction_obj_t *self);
@@ -13,6 +13,7 @@
 #include "shared-bindings/busio/__init__.h"
 #include "shared-bindings/busio/I2C.h"
 #include "shared-bindings/busio/SPI.h"
+#include "shared-bindings/busio/Transaction.h"
 #include "shared-bindings/busio/UART.h"
 
 #include "py/runtime.h"
@@ -69,6 +70,7 @@ static const mp_rom_map_elem_t busio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_I2C),   MP_ROM_PTR(&busio_i2c_type) },
     { MP_ROM_QSTR(MP_QSTR_SPI),   MP_ROM_PTR(&busio_spi_type) },
     { MP_ROM_QSTR(MP_QSTR_UART),   MP_ROM_PTR(&busio_uart_type) },
+    { MP_ROM_QSTR(MP_QSTR_Transaction), MP_ROM_PTR(&busio_transaction_type) },
 };
 
 static MP_DEFINE_CONST_DICT(busio_module_globals, busio_module_globals_table);
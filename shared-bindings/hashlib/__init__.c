@@ -8,7 +8,10 @@
 
 #include "py/obj.h"
 #include "py/mpconfig.h"
+#include "py/objarray.h"
+#include "py/objtuple.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/hashlib/__init__.h"
 #include "shared-bindings/hashlib/Hash.h"
 
@@ -49,9 +52,89 @@ static mp_obj_t hashlib_new(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(hashlib_new_obj, 1, hashlib_new);
 
+// Large enough that the per block overhead doesn't matter, small enough not to strain the heap.
+#define FILE_DIGEST_BLOCK_SIZE (4096)
+
+//| def file_digest(
+//|     fileobj: BinaryIO,
+//|     digest: Union[str, Callable[[], object], Sequence[Union[str, Callable[[], object]]]],
+//| ) -> object:
+//|     """Returns a Hash object for the named algorithm, updated with the rest of a file opened
+//|        in binary mode. The file is read in large blocks into a single buffer that is reused
+//|        for every block.
+//|
+//|        As in CPython, ``digest`` may instead be a callable that returns a new object with an
+//|        ``update()`` method. Unlike CPython, ``digest`` may also be a tuple or list of these.
+//|        The file is then read once and a tuple of hash objects is returned, in the same order.
+//|
+//|     :param BinaryIO fileobj: file to read
+//|     :param str digest: name of the algorithm, as for `new`, or a callable
+//|     :return: a hash object, or a tuple of them"""
+//|     ...
+//|
+static mp_obj_t hashlib_file_digest_new(mp_obj_t digest) {
+    if (!mp_obj_is_str(digest)) {
+        return mp_call_function_0(digest);
+    }
+    hashlib_hash_obj_t *hash = mp_obj_malloc(hashlib_hash_obj_t, &hashlib_hash_type);
+    if (!common_hal_hashlib_new(hash, mp_obj_str_get_str(digest))) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported hash algorithm"));
+    }
+    return MP_OBJ_FROM_PTR(hash);
+}
+
+static mp_obj_t hashlib_file_digest(mp_obj_t fileobj, mp_obj_t digest) {
+    mp_get_stream_raise(fileobj, MP_STREAM_OP_READ);
+    bool single = !mp_obj_is_type(digest, &mp_type_tuple) && !mp_obj_is_type(digest, &mp_type_list);
+    size_t n = 1;
+    mp_obj_t *digests = &digest;
+    if (!single) {
+        mp_obj_get_array(digest, &n, &digests);
+    }
+    mp_obj_tuple_t *hashes = MP_OBJ_TO_PTR(mp_obj_new_tuple(n, NULL));
+    for (size_t i = 0; i < n; i++) {
+        hashes->items[i] = hashlib_file_digest_new(digests[i]);
+    }
+
+    // Hash objects of this module are updated directly. Others are given a
+    // bytearray over the buffer through their update method. They may keep
+    // it, so then the buffer is left for the GC to free.
+    bool shared = false;
+    uint8_t *buf = m_new(uint8_t, FILE_DIGEST_BLOCK_SIZE);
+    mp_obj_t view = mp_obj_new_bytearray_by_ref(FILE_DIGEST_BLOCK_SIZE, buf);
+    while (true) {
+        int errcode;
+        mp_uint_t len = mp_stream_read_exactly(fileobj, buf, FILE_DIGEST_BLOCK_SIZE, &errcode);
+        if (errcode != 0) {
+            mp_raise_OSError(errcode);
+        }
+        ((mp_obj_array_t *)MP_OBJ_TO_PTR(view))->len = len;
+        for (size_t i = 0; i < n; i++) {
+            if (mp_obj_is_type(hashes->items[i], &hashlib_hash_type)) {
+                common_hal_hashlib_hash_update(MP_OBJ_TO_PTR(hashes->items[i]), buf, len);
+            } else {
+                mp_obj_t dest[3];
+                mp_load_method(hashes->items[i], MP_QSTR_update, dest);
+                dest[2] = view;
+                shared = true;
+                mp_call_method_n_kw(1, 0, dest);
+            }
+        }
+        if (len < FILE_DIGEST_BLOCK_SIZE) {
+            break;
+        }
+    }
+    if (!shared) {
+        m_del(uint8_t, buf, FILE_DIGEST_BLOCK_SIZE);
+    }
+    return single ? hashes->items[0] : MP_OBJ_FROM_PTR(hashes);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(hashlib_file_digest_obj, hashlib_file_digest);
+
 static const mp_rom_map_elem_t hashlib_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_hashlib) },
 
+    { MP_ROM_QSTR(MP_QSTR_file_digest), MP_ROM_PTR(&hashlib_file_digest_obj) },
     { MP_ROM_QSTR(MP_QSTR_new), MP_ROM_PTR(&hashlib_new_obj) },
 
     // Hash is deliberately omitted here because CPython doesn't expose the
@@ -0,0 +1,238 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/memorymonitor/AllocationProfiler.h"
+#include "shared-bindings/util.h"
+
+//| class AllocationProfiler:
+//|     def __init__(
+//|         self, *, every: int = 1, min_size: int = 0, max_sites: int = 32, depth: int = 4
+//|     ) -> None:
+//|         """Records which lines of Python code allocate heap memory.
+//|
+//|         While active, every ``every``-th allocation, and every allocation of at least
+//|         ``min_size`` bytes, is sampled. A sample records the size of the allocation and
+//|         the innermost ``depth`` frames of the Python call stack. Samples with the same
+//|         call stack are added together, in a table of up to ``max_sites`` entries that
+//|         is allocated up front. Samples that don't fit are counted in `dropped`.
+//|
+//|         Set ``every`` to 0 to only sample allocations of at least ``min_size`` bytes.
+//|         Sizes are in bytes but always a multiple of the heap block size.
+//|
+//|         Only one AllocationProfiler can be active at a time.
+//|
+//|         Find where a loop allocates::
+//|
+//|           import memorymonitor
+//|
+//|           profiler = memorymonitor.AllocationProfiler(every=4)
+//|           with profiler:
+//|               main_loop()
+//|
+//|           for count, size, stack in sorted(profiler.sites(), key=lambda s: -s[1]):
+//|               print(size, count, stack[-1])
+//|
+//|         Write the results for a flame graph::
+//|
+//|           with open("/allocations.folded", "w") as f:
+//|               profiler.dump(f)
+//|
+//|         :param int every: sample every Nth allocation
+//|         :param int min_size: also sample every allocation of at least this many bytes
+//|         :param int max_sites: maximum number of distinct call stacks to record
+//|         :param int depth: number of call stack frames to record, from 1 to 8
+//|         """
+//|         ...
+static mp_obj_t memorymonitor_allocationprofiler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_every, ARG_min_size, ARG_max_sites, ARG_depth };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_every, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+        { MP_QSTR_min_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_max_sites, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
+        { MP_QSTR_depth, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 4} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t every = mp_arg_validate_int_min(args[ARG_every].u_int, 0, MP_QSTR_every);
+    mp_int_t min_size = mp_arg_validate_int_min(args[ARG_min_size].u_int, 0, MP_QSTR_min_size);
+    mp_int_t max_sites = mp_arg_validate_int_range(args[ARG_max_sites].u_int, 1, UINT16_MAX, MP_QSTR_max_sites);
+    mp_int_t depth = mp_arg_validate_int_range(args[ARG_depth].u_int, 1, ALLOCATION_PROFILER_MAX_DEPTH, MP_QSTR_depth);
+
+    memorymonitor_allocationprofiler_obj_t *self =
+        mp_obj_malloc(memorymonitor_allocationprofiler_obj_t, &memorymonitor_allocationprofiler_type);
+
+    common_hal_memorymonitor_allocationprofiler_construct(self, every, min_size, max_sites, depth);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def __enter__(self) -> AllocationProfiler:
+//|         """Clears the results and starts sampling."""
+//|         ...
+static mp_obj_t memorymonitor_allocationprofiler_obj___enter__(mp_obj_t self_in) {
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_memorymonitor_allocationprofiler_clear(self);
+    common_hal_memorymonitor_allocationprofiler_resume(self);
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationprofiler___enter___obj, memorymonitor_allocationprofiler_obj___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Automatically stops sampling when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+static mp_obj_t memorymonitor_allocationprofiler_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_memorymonitor_allocationprofiler_pause(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(memorymonitor_allocationprofiler___exit___obj, 4, 4, memorymonitor_allocationprofiler_obj___exit__);
+
+//|     def clear(self) -> None:
+//|         """Discards the results recorded so far."""
+//|         ...
+static mp_obj_t memorymonitor_allocationprofiler_obj_clear(mp_obj_t self_in) {
+    common_hal_memorymonitor_allocationprofiler_clear(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationprofiler_clear_obj, memorymonitor_allocationprofiler_obj_clear);
+
+//|     dropped: int
+//|     """Number of samples that were not recorded because the table was full."""
+static mp_obj_t memorymonitor_allocationprofiler_obj_get_dropped(mp_obj_t self_in) {
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_memorymonitor_allocationprofiler_get_dropped(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationprofiler_get_dropped_obj, memorymonitor_allocationprofiler_obj_get_dropped);
+
+MP_PROPERTY_GETTER(memorymonitor_allocationprofiler_dropped_obj,
+    (mp_obj_t)&memorymonitor_allocationprofiler_get_dropped_obj);
+
+//|     def sites(self) -> List[Tuple[int, int, Tuple[Tuple[str, str, int], ...]]]:
+//|         """Returns a list of ``(count, size, stack)`` tuples, one for each distinct call
+//|         stack, where ``count`` is the number of samples and ``size`` their total size
+//|         in bytes. ``stack`` is a tuple of ``(filename, function, line)`` tuples, outermost
+//|         call first. An empty stack means the allocation was not made by Python code.
+//|         Stacks are told apart by bytecode position, so two entries may show the same
+//|         lines."""
+//|         ...
+static mp_obj_t memorymonitor_allocationprofiler_obj_sites(mp_obj_t self_in) {
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Don't sample the allocations made here.
+    bool running = common_hal_memorymonitor_allocationprofiler_get_running(self);
+    common_hal_memorymonitor_allocationprofiler_pause(self);
+
+    size_t n_sites = common_hal_memorymonitor_allocationprofiler_get_site_count(self);
+    mp_obj_t result = mp_obj_new_list(0, NULL);
+    memorymonitor_allocationprofiler_location_t stack[ALLOCATION_PROFILER_MAX_DEPTH];
+    for (size_t i = 0; i < n_sites; i++) {
+        uint32_t count, bytes;
+        size_t depth = common_hal_memorymonitor_allocationprofiler_get_site(self, i, &count, &bytes, stack);
+        mp_obj_tuple_t *frames = MP_OBJ_TO_PTR(mp_obj_new_tuple(depth, NULL));
+        for (size_t j = 0; j < depth; j++) {
+            mp_obj_t location[3] = {
+                MP_OBJ_NEW_QSTR(stack[j].source_file),
+                MP_OBJ_NEW_QSTR(stack[j].block_name),
+                MP_OBJ_NEW_SMALL_INT(stack[j].line),
+            };
+            frames->items[j] = mp_obj_new_tuple(3, location);
+        }
+        mp_obj_t site[3] = {
+            mp_obj_new_int_from_uint(count),
+            mp_obj_new_int_from_uint(bytes),
+            MP_OBJ_FROM_PTR(frames),
+        };
+        mp_obj_list_append(result, mp_obj_new_tuple(3, site));
+    }
+
+    if (running) {
+        common_hal_memorymonitor_allocationprofiler_resume(self);
+    }
+    return result;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationprofiler_sites_obj, memorymonitor_allocationprofiler_obj_sites);
+
+//|     def dump(self, file: Optional[io.IOBase] = None, *, count: bool = False) -> None:
+//|         """Writes the results in the "folded stacks" text format read by flame graph
+//|         tools such as ``flamegraph.pl`` and speedscope. Each line is a call stack, outermost
+//|         call first, with frames written as ``filename:function:line`` and separated by
+//|         ``;``, followed by the total size in bytes, or the number of samples if ``count``
+//|         is True.
+//|
+//|         :param file: stream to write to. Defaults to the console.
+//|         :param bool count: weight each call stack by number of samples rather than bytes
+//|         """
+//|         ...
+//|
+static mp_obj_t memorymonitor_allocationprofiler_obj_dump(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_count, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_print_t print = mp_plat_print;
+    if (args[ARG_file].u_obj != mp_const_none) {
+        mp_get_stream_raise(args[ARG_file].u_obj, MP_STREAM_OP_WRITE);
+        print.data = MP_OBJ_TO_PTR(args[ARG_file].u_obj);
+        print.print_strn = mp_stream_write_adaptor;
+    }
+
+    // Writing to a stream may allocate, so don't sample while dumping.
+    bool running = common_hal_memorymonitor_allocationprofiler_get_running(self);
+    common_hal_memorymonitor_allocationprofiler_pause(self);
+
+    size_t n_sites = common_hal_memorymonitor_allocationprofiler_get_site_count(self);
+    memorymonitor_allocationprofiler_location_t stack[ALLOCATION_PROFILER_MAX_DEPTH];
+    for (size_t i = 0; i < n_sites; i++) {
+        uint32_t count, bytes;
+        size_t depth = common_hal_memorymonitor_allocationprofiler_get_site(self, i, &count, &bytes, stack);
+        if (depth == 0) {
+            mp_print_str(&print, "<native>");
+        }
+        for (size_t j = 0; j < depth; j++) {
+            mp_printf(&print, "%s%q:%q:%u", j == 0 ? "" : ";", stack[j].source_file, stack[j].block_name, (uint)stack[j].line);
+        }
+        mp_printf(&print, " %u\n", (uint)(args[ARG_count].u_bool ? count : bytes));
+    }
+
+    if (running) {
+        common_hal_memorymonitor_allocationprofiler_resume(self);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(memorymonitor_allocationprofiler_dump_obj, 1, memorymonitor_allocationprofiler_obj_dump);
+
+static const mp_rom_map_elem_t memorymonitor_allocationprofiler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&memorymonitor_allocationprofiler___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&memorymonitor_allocationprofiler___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&memorymonitor_allocationprofiler_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sites), MP_ROM_PTR(&memorymonitor_allocationprofiler_sites_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&memorymonitor_allocationprofiler_dump_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_dropped), MP_ROM_PTR(&memorymonitor_allocationprofiler_dropped_obj) },
+};
+static MP_DEFINE_CONST_DICT(memorymonitor_allocationprofiler_locals_dict, memorymonitor_allocationprofiler_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    memorymonitor_allocationprofiler_type,
+    MP_QSTR_AllocationProfiler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, memorymonitor_allocationprofiler_make_new,
+    locals_dict, &memorymonitor_allocationprofiler_locals_dict
+    );
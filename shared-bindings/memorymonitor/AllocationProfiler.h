@@ -0,0 +1,30 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/memorymonitor/AllocationProfiler.h"
+
+extern const mp_obj_type_t memorymonitor_allocationprofiler_type;
+
+typedef struct {
+    qstr source_file;
+    qstr block_name;
+    size_t line;
+} memorymonitor_allocationprofiler_location_t;
+
+extern void common_hal_memorymonitor_allocationprofiler_construct(memorymonitor_allocationprofiler_obj_t *self,
+    uint32_t every, size_t min_size, uint16_t max_sites, uint8_t depth);
+extern void common_hal_memorymonitor_allocationprofiler_pause(memorymonitor_allocationprofiler_obj_t *self);
+extern void common_hal_memorymonitor_allocationprofiler_resume(memorymonitor_allocationprofiler_obj_t *self);
+extern bool common_hal_memorymonitor_allocationprofiler_get_running(memorymonitor_allocationprofiler_obj_t *self);
+extern void common_hal_memorymonitor_allocationprofiler_clear(memorymonitor_allocationprofiler_obj_t *self);
+extern uint32_t common_hal_memorymonitor_allocationprofiler_get_dropped(memorymonitor_allocationprofiler_obj_t *self);
+extern size_t common_hal_memorymonitor_allocationprofiler_get_site_count(memorymonitor_allocationprofiler_obj_t *self);
+// Fills in stack (which must have room for the profiler's depth) outermost
+// first and returns how many frames were recorded.
+extern size_t common_hal_memorymonitor_allocationprofiler_get_site(memorymonitor_allocationprofiler_obj_t *self,
+    size_t index, uint32_t *count, uint32_t *bytes, memorymonitor_allocationprofiler_location_t *stack);
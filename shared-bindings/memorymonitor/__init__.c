@@ -4,13 +4,18 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <stdarg.h>
 #include <stdint.h>
+#include <string.h>
 
+#include "py/gc.h"
 #include "py/obj.h"
+#include "py/objexcept.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/memorymonitor/__init__.h"
 #include "shared-bindings/memorymonitor/AllocationAlarm.h"
+#include "shared-bindings/memorymonitor/AllocationProfiler.h"
 #include "shared-bindings/memorymonitor/AllocationSize.h"
 
 //| """Memory monitoring helpers"""
@@ -31,10 +36,38 @@ NORETURN void mp_raise_memorymonitor_AllocationError(mp_rom_error_text_t fmt, ..
     nlr_raise(exception);
 }
 
+#if MICROPY_GC_ALLOC_KIND
+//| def heap_usage() -> Dict[str, int]:
+//|     """Return the number of heap bytes currently used by each kind of allocation.
+//|
+//|     The kinds are ``"qstr"`` for interned strings, ``"bytecode"`` and ``"constants"``
+//|     for compiled and imported code, ``"globals"`` for module objects and their
+//|     dictionaries, ``"display"`` and ``"audio"`` for buffers held by displayio and
+//|     the audio modules, and ``"other"`` for everything else. Run `gc.collect()` first
+//|     to exclude garbage that has not been freed yet."""
+//|     ...
+//|
+static mp_obj_t memorymonitor_heap_usage(void) {
+    size_t bytes[GC_ALLOC_KIND_NUM];
+    gc_alloc_kind_info(bytes);
+    mp_obj_t usage = mp_obj_new_dict(GC_ALLOC_KIND_NUM);
+    for (size_t i = 0; i < GC_ALLOC_KIND_NUM; i++) {
+        mp_obj_dict_store(usage, mp_obj_new_str(gc_alloc_kind_names[i], strlen(gc_alloc_kind_names[i])),
+            mp_obj_new_int_from_uint(bytes[i]));
+    }
+    return usage;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(memorymonitor_heap_usage_obj, memorymonitor_heap_usage);
+#endif
+
 static const mp_rom_map_elem_t memorymonitor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_memorymonitor) },
     { MP_ROM_QSTR(MP_QSTR_AllocationAlarm), MP_ROM_PTR(&memorymonitor_allocationalarm_type) },
+    { MP_ROM_QSTR(MP_QSTR_AllocationProfiler), MP_ROM_PTR(&memorymonitor_allocationprofiler_type) },
     { MP_ROM_QSTR(MP_QSTR_AllocationSize), MP_ROM_PTR(&memorymonitor_allocationsize_type) },
+    #if MICROPY_GC_ALLOC_KIND
+    { MP_ROM_QSTR(MP_QSTR_heap_usage), MP_ROM_PTR(&memorymonitor_heap_usage_obj) },
+    #endif
 
     // Errors
     { MP_ROM_QSTR(MP_QSTR_AllocationError),      MP_ROM_PTR(&mp_type_memorymonitor_AllocationError) },
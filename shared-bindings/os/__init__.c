@@ -9,8 +9,10 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
 #include "lib/oofatfs/ff.h"
 #include "lib/oofatfs/diskio.h"
+#include "py/mperrno.h"
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/objstr.h"
@@ -223,13 +225,23 @@ static mp_obj_t os_statvfs(mp_obj_t path_in) {
 MP_DEFINE_CONST_FUN_OBJ_1(os_statvfs_obj, os_statvfs);
 
 //| def sync() -> None:
-//|     """Sync all filesystems."""
+//|     """Sync all filesystems. Raises OSError if a block device reports that
+//|     a write failed, after syncing the others."""
 //|     ...
 //|
 static mp_obj_t os_sync(void) {
+    bool ok = true;
     for (mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table); vfs != NULL; vfs = vfs->next) {
-        // this assumes that vfs->obj is fs_user_mount_t with block device functions
-        disk_ioctl(MP_OBJ_TO_PTR(vfs->obj), CTRL_SYNC, NULL);
+        // littlefs syncs its block device itself as files are closed.
+        if (!mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+            continue;
+        }
+        if (disk_ioctl(MP_OBJ_TO_PTR(vfs->obj), CTRL_SYNC, NULL) != RES_OK) {
+            ok = false;
+        }
+    }
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
     }
     return mp_const_none;
 }
@@ -0,0 +1,206 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/profiler/SamplingProfiler.h"
+#include "shared-bindings/util.h"
+
+//| class SamplingProfiler:
+//|     def __init__(self, *, interval: float = 0.01, max_samples: int = 256, depth: int = 4) -> None:
+//|         """Periodically records which lines of Python code are running.
+//|
+//|         While active, a timer interrupt records the innermost ``depth`` frames of the
+//|         running Python call stack every ``interval`` seconds. The samples are kept in a
+//|         ring buffer of ``max_samples`` entries that is allocated up front, so once it is
+//|         full the oldest samples are replaced. Lines that run for longer show up in more
+//|         samples.
+//|
+//|         Taking a sample doesn't allocate and doesn't slow down the code between samples.
+//|         Samples are only turned into filenames and line numbers when the results are read.
+//|
+//|         The interval is rounded to whole milliseconds on microcontrollers. On the unix
+//|         port, samples are taken every ``interval`` seconds of CPU time.
+//|
+//|         Only one SamplingProfiler can be active at a time.
+//|
+//|         Find the slowest part of a loop::
+//|
+//|           import profiler
+//|
+//|           p = profiler.SamplingProfiler(interval=0.005)
+//|           with p:
+//|               main_loop()
+//|
+//|           for count, stack in sorted(p.stacks(), reverse=True):
+//|               print(count, stack[-1])
+//|
+//|         Write the results for a flame graph::
+//|
+//|           with open("/profile.folded", "w") as f:
+//|               p.dump(f)
+//|
+//|         :param float interval: seconds between samples, up to 1
+//|         :param int max_samples: number of samples to keep
+//|         :param int depth: number of call stack frames to record, from 1 to 8
+//|         """
+//|         ...
+static mp_obj_t profiler_samplingprofiler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_interval, ARG_max_samples, ARG_depth };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_interval, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_max_samples, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 256} },
+        { MP_QSTR_depth, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 4} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const mp_float_t interval = args[ARG_interval].u_obj == MP_OBJ_NULL
+        ? MICROPY_FLOAT_CONST(0.01)
+        : mp_arg_validate_obj_float_range(args[ARG_interval].u_obj, 0, 1, MP_QSTR_interval);
+    mp_int_t interval_us = mp_arg_validate_int_min((mp_int_t)(interval * 1000000), 1, MP_QSTR_interval);
+    mp_int_t max_samples = mp_arg_validate_int_range(args[ARG_max_samples].u_int, 1, UINT16_MAX, MP_QSTR_max_samples);
+    mp_int_t depth = mp_arg_validate_int_range(args[ARG_depth].u_int, 1, SAMPLING_PROFILER_MAX_DEPTH, MP_QSTR_depth);
+
+    profiler_samplingprofiler_obj_t *self =
+        mp_obj_malloc(profiler_samplingprofiler_obj_t, &profiler_samplingprofiler_type);
+
+    common_hal_profiler_samplingprofiler_construct(self, interval_us, max_samples, depth);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def __enter__(self) -> SamplingProfiler:
+//|         """Clears the results and starts sampling."""
+//|         ...
+static mp_obj_t profiler_samplingprofiler_obj___enter__(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_profiler_samplingprofiler_clear(self);
+    common_hal_profiler_samplingprofiler_start(self);
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler___enter___obj, profiler_samplingprofiler_obj___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Automatically stops sampling when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+static mp_obj_t profiler_samplingprofiler_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_profiler_samplingprofiler_stop(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(profiler_samplingprofiler___exit___obj, 4, 4, profiler_samplingprofiler_obj___exit__);
+
+//|     def clear(self) -> None:
+//|         """Discards the samples taken so far."""
+//|         ...
+static mp_obj_t profiler_samplingprofiler_obj_clear(mp_obj_t self_in) {
+    common_hal_profiler_samplingprofiler_clear(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_clear_obj, profiler_samplingprofiler_obj_clear);
+
+//|     samples: int
+//|     """Number of samples taken since the results were cleared, including ones that
+//|     have since been replaced."""
+static mp_obj_t profiler_samplingprofiler_obj_get_samples(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_profiler_samplingprofiler_get_sample_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_get_samples_obj, profiler_samplingprofiler_obj_get_samples);
+
+MP_PROPERTY_GETTER(profiler_samplingprofiler_samples_obj,
+    (mp_obj_t)&profiler_samplingprofiler_get_samples_obj);
+
+//|     def stacks(self) -> List[Tuple[int, Tuple[Tuple[str, str, int], ...]]]:
+//|         """Returns a list of ``(count, stack)`` tuples, one for each distinct call stack
+//|         among the kept samples, where ``count`` is the number of samples. ``stack`` is a
+//|         tuple of ``(filename, function, line)`` tuples, outermost call first. An empty
+//|         stack means no Python code was running."""
+//|         ...
+static mp_obj_t profiler_samplingprofiler_obj_stacks(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Don't sample while reading the results.
+    bool running = common_hal_profiler_samplingprofiler_get_running(self);
+    common_hal_profiler_samplingprofiler_stop(self);
+
+    mp_obj_t result = mp_obj_new_list(0, NULL);
+    size_t index = 0;
+    uint32_t count;
+    size_t depth;
+    profiler_samplingprofiler_location_t stack[SAMPLING_PROFILER_MAX_DEPTH];
+    while (common_hal_profiler_samplingprofiler_next_stack(self, &index, &count, &depth, stack)) {
+        mp_obj_tuple_t *frames = MP_OBJ_TO_PTR(mp_obj_new_tuple(depth, NULL));
+        for (size_t j = 0; j < depth; j++) {
+            mp_obj_t location[3] = {
+                MP_OBJ_NEW_QSTR(stack[j].source_file),
+                MP_OBJ_NEW_QSTR(stack[j].block_name),
+                MP_OBJ_NEW_SMALL_INT(stack[j].line),
+            };
+            frames->items[j] = mp_obj_new_tuple(3, location);
+        }
+        mp_obj_t item[2] = {
+            mp_obj_new_int_from_uint(count),
+            MP_OBJ_FROM_PTR(frames),
+        };
+        mp_obj_list_append(result, mp_obj_new_tuple(2, item));
+    }
+
+    if (running) {
+        common_hal_profiler_samplingprofiler_start(self);
+    }
+    return result;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_stacks_obj, profiler_samplingprofiler_obj_stacks);
+
+//|     def dump(self, file: Optional[io.IOBase] = None) -> None:
+//|         """Writes the kept samples in the "folded stacks" text format read by flame graph
+//|         tools such as ``flamegraph.pl`` and speedscope. Each line is a call stack, outermost
+//|         call first, with frames written as ``filename:function:line`` and separated by
+//|         ``;``, followed by the number of samples.
+//|
+//|         :param file: stream to write to. Defaults to the console.
+//|         """
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_obj_dump(size_t n_args, const mp_obj_t *args) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_print_t print = mp_plat_print;
+    if (n_args > 1 && args[1] != mp_const_none) {
+        mp_get_stream_raise(args[1], MP_STREAM_OP_WRITE);
+        print.data = MP_OBJ_TO_PTR(args[1]);
+        print.print_strn = mp_stream_write_adaptor;
+    }
+    profiler_samplingprofiler_print_folded(self, &print);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(profiler_samplingprofiler_dump_obj, 1, 2, profiler_samplingprofiler_obj_dump);
+
+static const mp_rom_map_elem_t profiler_samplingprofiler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&profiler_samplingprofiler___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&profiler_samplingprofiler___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&profiler_samplingprofiler_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stacks), MP_ROM_PTR(&profiler_samplingprofiler_stacks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&profiler_samplingprofiler_dump_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_samples), MP_ROM_PTR(&profiler_samplingprofiler_samples_obj) },
+};
+static MP_DEFINE_CONST_DICT(profiler_samplingprofiler_locals_dict, profiler_samplingprofiler_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    profiler_samplingprofiler_type,
+    MP_QSTR_SamplingProfiler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, profiler_samplingprofiler_make_new,
+    locals_dict, &profiler_samplingprofiler_locals_dict
+    );
@@ -0,0 +1,34 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/profiler/SamplingProfiler.h"
+
+extern const mp_obj_type_t profiler_samplingprofiler_type;
+
+typedef struct {
+    qstr source_file;
+    qstr block_name;
+    size_t line;
+} profiler_samplingprofiler_location_t;
+
+extern void common_hal_profiler_samplingprofiler_construct(profiler_samplingprofiler_obj_t *self,
+    uint32_t interval_us, uint16_t max_samples, uint8_t depth);
+extern void common_hal_profiler_samplingprofiler_start(profiler_samplingprofiler_obj_t *self);
+extern void common_hal_profiler_samplingprofiler_stop(profiler_samplingprofiler_obj_t *self);
+extern bool common_hal_profiler_samplingprofiler_get_running(profiler_samplingprofiler_obj_t *self);
+extern void common_hal_profiler_samplingprofiler_clear(profiler_samplingprofiler_obj_t *self);
+extern uint32_t common_hal_profiler_samplingprofiler_get_sample_count(profiler_samplingprofiler_obj_t *self);
+// Finds the next distinct call stack among the stored samples, starting at
+// *index. Fills in stack (which must have room for the profiler's depth)
+// outermost first. Returns false when there are no more. Sampling must be
+// stopped.
+extern bool common_hal_profiler_samplingprofiler_next_stack(profiler_samplingprofiler_obj_t *self,
+    size_t *index, uint32_t *count, size_t *depth, profiler_samplingprofiler_location_t *stack);
+
+// Writes the stored samples as folded stacks. Also used by the web workflow.
+extern void profiler_samplingprofiler_print_folded(profiler_samplingprofiler_obj_t *self, const mp_print_t *print);
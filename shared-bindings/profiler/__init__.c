@@ -0,0 +1,33 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/profiler/SamplingProfiler.h"
+
+//| """Find where Python code spends its time
+//|
+//| The `profiler` module samples the running Python call stack at a regular
+//| interval. Unlike ``sys.settrace``, it doesn't slow down the code being profiled.
+//|
+//| The results of the most recently started profiler can also be read over the
+//| web workflow, from ``/cp/profile.txt``.
+//| """
+
+static const mp_rom_map_elem_t profiler_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_profiler) },
+    { MP_ROM_QSTR(MP_QSTR_SamplingProfiler), MP_ROM_PTR(&profiler_samplingprofiler_type) },
+};
+
+static MP_DEFINE_CONST_DICT(profiler_module_globals, profiler_module_globals_table);
+
+const mp_obj_module_t profiler_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&profiler_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_profiler, profiler_module);
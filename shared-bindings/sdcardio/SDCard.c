@@ -128,6 +128,12 @@ MP_DEFINE_CONST_FUN_OBJ_3(sdcardio_sdcard_readblocks_obj, _sdcardio_sdcard_readb
 //|     def sync(self) -> None:
 //|         """Ensure all blocks written are actually committed to the SD card
 //|
+//|         This needs the SPI bus when blocks are still queued. If the bus is
+//|         locked by someone else, it raises ``OSError(EAGAIN)`` and the blocks
+//|         stay queued, to be sent in the background once the bus is free.
+//|         Syncs done by the filesystem, such as when a file is closed, do not
+//|         raise in this case.
+//|
 //|         :return: None"""
 //|         ...
 static mp_obj_t sdcardio_sdcard_sync(mp_obj_t self_in) {
@@ -145,6 +151,10 @@ MP_DEFINE_CONST_FUN_OBJ_1(sdcardio_sdcard_sync_obj, sdcardio_sdcard_sync);
 //|     def writeblocks(self, start_block: int, buf: ReadableBuffer) -> None:
 //|         """Write one or more blocks to the card
 //|
+//|         A few blocks are kept in RAM and sent to the card in the background,
+//|         so this can return before the card has them. An error in sending
+//|         them is raised by the next `writeblocks` or `sync`.
+//|
 //|         :param int start_block: The block to start writing from
 //|         :param ~circuitpython_typing.ReadableBuffer buf: The buffer to read from.  Length must be multiple of 512.
 //|
@@ -17,6 +17,7 @@
 #include "py/runtime.h"
 #include "py/stream.h"
 
+#include "shared-module/socketpool/Transfer.h"
 #include "shared/netutils/netutils.h"
 #include "shared/runtime/context_manager_helpers.h"
 #include "shared/runtime/interrupt_char.h"
@@ -206,6 +207,55 @@ static mp_obj_t _socketpool_socket_recv_into(size_t n_args, const mp_obj_t *args
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_socket_recv_into_obj, 2, 3, _socketpool_socket_recv_into);
 
+static mp_int_t _socketpool_socket_transfer_send(void *link, const uint8_t *buf, size_t len) {
+    return common_hal_socketpool_socket_send(link, buf, len);
+}
+
+static mp_uint_t _socketpool_socket_transfer_recv_into(void *link, uint8_t *buf, size_t len) {
+    return common_hal_socketpool_socket_recv_into(link, buf, len);
+}
+
+static bool _socketpool_socket_transfer_readable(void *link) {
+    return common_hal_socketpool_readable(link);
+}
+
+static void _socketpool_socket_transfer(socketpool_socket_obj_t *self, socketpool_transfer_t *transfer) {
+    transfer->link = self;
+    transfer->send = _socketpool_socket_transfer_send;
+    transfer->recv_into = _socketpool_socket_transfer_recv_into;
+    transfer->readable = _socketpool_socket_transfer_readable;
+}
+
+//|     def recvmsg_into(self, buffers: Sequence[WriteableBuffer]) -> int:
+//|         """Reads bytes from the connected remote address into several buffers
+//|         in turn, without joining or copying them.
+//|
+//|         Only the first buffer waits for data, like `recv_into`. The rest are filled
+//|         from data that has already arrived, stopping at the first one that isn't filled.
+//|
+//|         Suits sockets of type SOCK_STREAM
+//|         Returns an int of the total number of bytes read. If an error occurs after
+//|         some bytes have been read, their number is returned instead of raising.
+//|         Unlike CPython, no ancillary data, flags or address are returned.
+//|
+//|         :param Sequence[WriteableBuffer] buffers: buffers to receive into"""
+//|         ...
+static mp_obj_t _socketpool_socket_recvmsg_into(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_socketpool_socket_get_closed(self)) {
+        // Bad file number.
+        mp_raise_OSError(MP_EBADF);
+    }
+    size_t n;
+    mp_obj_t *buffers;
+    mp_obj_get_array(buffers_in, &n, &buffers);
+
+    socketpool_transfer_t transfer;
+    _socketpool_socket_transfer(self, &transfer);
+    return mp_obj_new_int_from_uint(socketpool_transfer_recvmsg_into(&transfer, n, buffers));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvmsg_into_obj, _socketpool_socket_recvmsg_into);
+
 //|     def send(self, bytes: ReadableBuffer) -> int:
 //|         """Send some bytes to the connected remote address.
 //|         Suits sockets of type SOCK_STREAM
@@ -271,6 +321,81 @@ static mp_obj_t _socketpool_socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_sendall_obj, _socketpool_socket_sendall);
 
+//|     def sendfile(self, file: BinaryIO, offset: int = 0, count: Optional[int] = None) -> int:
+//|         """Send the contents of a file opened in binary mode to the connected
+//|         remote address. The file is read in large blocks straight into a single
+//|         buffer that is reused for every block.
+//|         Suits sockets of type SOCK_STREAM
+//|
+//|         Like `sendall`, this sends until the end of the file or ``count`` bytes.
+//|         The file position is left after the last byte sent.
+//|         Returns an int of the number of bytes sent. If an error occurs after some
+//|         bytes have been sent, their number is returned instead of raising.
+//|
+//|         :param BinaryIO file: file to send
+//|         :param int offset: position in the file to start from
+//|         :param int count: the most bytes to send. If not given, send to the end of the file."""
+//|         ...
+static mp_obj_t _socketpool_socket_sendfile(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_offset, ARG_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_count, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (common_hal_socketpool_socket_get_closed(self)) {
+        // Bad file number.
+        mp_raise_OSError(MP_EBADF);
+    }
+    if (!common_hal_socketpool_socket_get_connected(self)) {
+        mp_raise_BrokenPipeError();
+    }
+    mp_int_t offset = mp_arg_validate_int_min(args[ARG_offset].u_int, 0, MP_QSTR_offset);
+    size_t count = SIZE_MAX;
+    if (args[ARG_count].u_obj != mp_const_none) {
+        count = mp_arg_validate_int_min(mp_obj_get_int(args[ARG_count].u_obj), 0, MP_QSTR_count);
+    }
+    socketpool_transfer_t transfer;
+    _socketpool_socket_transfer(self, &transfer);
+    return mp_obj_new_int_from_uint(socketpool_transfer_sendfile(&transfer, args[ARG_file].u_obj, offset, count));
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(socketpool_socket_sendfile_obj, 1, _socketpool_socket_sendfile);
+
+//|     def sendmsg(self, buffers: Sequence[ReadableBuffer]) -> int:
+//|         """Send bytes from several buffers in turn to the connected remote
+//|         address, without joining or copying them.
+//|         Suits sockets of type SOCK_STREAM
+//|
+//|         Like `send`, this may send less than all of the bytes. It stops at the
+//|         first buffer that isn't sent completely.
+//|         Returns an int of the total number of bytes sent. If an error occurs after
+//|         some bytes have been sent, their number is returned instead of raising.
+//|
+//|         :param Sequence[ReadableBuffer] buffers: buffers to send"""
+//|         ...
+static mp_obj_t _socketpool_socket_sendmsg(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_socketpool_socket_get_closed(self)) {
+        // Bad file number.
+        mp_raise_OSError(MP_EBADF);
+    }
+    if (!common_hal_socketpool_socket_get_connected(self)) {
+        mp_raise_BrokenPipeError();
+    }
+    size_t n;
+    mp_obj_t *buffers;
+    mp_obj_get_array(buffers_in, &n, &buffers);
+
+    socketpool_transfer_t transfer;
+    _socketpool_socket_transfer(self, &transfer);
+    return mp_obj_new_int_from_uint(socketpool_transfer_sendmsg(&transfer, n, buffers));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_sendmsg_obj, _socketpool_socket_sendmsg);
+
 //|     def sendto(self, bytes: ReadableBuffer, address: Tuple[str, int]) -> int:
 //|         """Send some bytes to a specific address.
 //|         Suits sockets of type SOCK_DGRAM
@@ -398,7 +523,10 @@ static const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_listen), MP_ROM_PTR(&socketpool_socket_listen_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom_into), MP_ROM_PTR(&socketpool_socket_recvfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&socketpool_socket_recv_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvmsg_into), MP_ROM_PTR(&socketpool_socket_recvmsg_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&socketpool_socket_sendall_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendfile), MP_ROM_PTR(&socketpool_socket_sendfile_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendmsg), MP_ROM_PTR(&socketpool_socket_sendmsg_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&socketpool_socket_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&socketpool_socket_sendto_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socketpool_socket_setblocking_obj) },
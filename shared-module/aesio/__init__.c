@@ -12,17 +12,20 @@
 #include "shared-module/aesio/__init__.h"
 
 void common_hal_aesio_aes_construct(aesio_aes_obj_t *self, const uint8_t *key,
-    uint32_t key_length, const uint8_t *iv,
+    uint32_t key_length, const uint8_t *iv, size_t iv_length,
     int mode, int counter) {
     self->mode = mode;
     self->counter = counter;
-    common_hal_aesio_aes_rekey(self, key, key_length, iv);
+    common_hal_aesio_aes_rekey(self, key, key_length, iv, iv_length);
 }
 
 void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self, const uint8_t *key,
-    uint32_t key_length, const uint8_t *iv) {
+    uint32_t key_length, const uint8_t *iv, size_t iv_length) {
     memset(&self->ctx, 0, sizeof(self->ctx));
-    if (iv != NULL) {
+    if (self->mode == AES_MODE_GCM) {
+        AES_init_ctx(&self->ctx, key, key_length);
+        AES_GCM_start(&self->ctx, iv, iv_length);
+    } else if (iv != NULL) {
         AES_init_ctx_iv(&self->ctx, key, key_length, iv);
     } else {
         AES_init_ctx(&self->ctx, key, key_length);
@@ -33,6 +36,19 @@ void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
     self->mode = mode;
 }
 
+void common_hal_aesio_aes_update(aesio_aes_obj_t *self, const uint8_t *buffer,
+    size_t length) {
+    // Associated data has to come before the text.
+    if (self->ctx.TextLength != 0) {
+        mp_arg_error_invalid(MP_QSTR_update);
+    }
+    AES_GCM_update_aad(&self->ctx, buffer, length);
+}
+
+void common_hal_aesio_aes_get_tag(aesio_aes_obj_t *self, uint8_t *tag) {
+    AES_GCM_tag(&self->ctx, tag);
+}
+
 void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
     size_t length) {
     switch (self->mode) {
@@ -45,6 +61,9 @@ void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
         case AES_MODE_CTR:
             AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
             break;
+        case AES_MODE_GCM:
+            AES_GCM_encrypt_buffer(&self->ctx, buffer, length);
+            break;
     }
 }
 
@@ -60,5 +79,8 @@ void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
         case AES_MODE_CTR:
             AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
             break;
+        case AES_MODE_GCM:
+            AES_GCM_decrypt_buffer(&self->ctx, buffer, length);
+            break;
     }
 }
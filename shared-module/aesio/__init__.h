@@ -20,6 +20,7 @@ enum AES_MODE {
     AES_MODE_ECB = 1,
     AES_MODE_CBC = 2,
     AES_MODE_CTR = 6,
+    AES_MODE_GCM = 11,
 };
 
 typedef struct {
@@ -2,7 +2,7 @@
 // From https://github.com/kokke/tiny-AES-c
 /*
 
-This is an implementation of the AES algorithm, specifically ECB, CTR and CBC mode.
+This is an implementation of the AES algorithm, specifically ECB, CTR, CBC and GCM mode.
 Block size can be chosen in aes.h - available choices are AES128, AES192, AES256.
 
 The implementation is verified against the test vectors in:
@@ -101,6 +101,44 @@ static const uint8_t sbox[256] = {
     0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
 };
 
+// Te0[x] is the column (2, 1, 1, 3) * sbox[x], big-endian, which does
+// SubBytes and MixColumns for one byte at once. Rotating it gives the columns
+// for the other rows, so one table is enough.
+static const uint32_t Te0[256] = {
+    0xc66363a5, 0xf87c7c84, 0xee777799, 0xf67b7b8d, 0xfff2f20d, 0xd66b6bbd, 0xde6f6fb1, 0x91c5c554,
+    0x60303050, 0x02010103, 0xce6767a9, 0x562b2b7d, 0xe7fefe19, 0xb5d7d762, 0x4dababe6, 0xec76769a,
+    0x8fcaca45, 0x1f82829d, 0x89c9c940, 0xfa7d7d87, 0xeffafa15, 0xb25959eb, 0x8e4747c9, 0xfbf0f00b,
+    0x41adadec, 0xb3d4d467, 0x5fa2a2fd, 0x45afafea, 0x239c9cbf, 0x53a4a4f7, 0xe4727296, 0x9bc0c05b,
+    0x75b7b7c2, 0xe1fdfd1c, 0x3d9393ae, 0x4c26266a, 0x6c36365a, 0x7e3f3f41, 0xf5f7f702, 0x83cccc4f,
+    0x6834345c, 0x51a5a5f4, 0xd1e5e534, 0xf9f1f108, 0xe2717193, 0xabd8d873, 0x62313153, 0x2a15153f,
+    0x0804040c, 0x95c7c752, 0x46232365, 0x9dc3c35e, 0x30181828, 0x379696a1, 0x0a05050f, 0x2f9a9ab5,
+    0x0e070709, 0x24121236, 0x1b80809b, 0xdfe2e23d, 0xcdebeb26, 0x4e272769, 0x7fb2b2cd, 0xea75759f,
+    0x1209091b, 0x1d83839e, 0x582c2c74, 0x341a1a2e, 0x361b1b2d, 0xdc6e6eb2, 0xb45a5aee, 0x5ba0a0fb,
+    0xa45252f6, 0x763b3b4d, 0xb7d6d661, 0x7db3b3ce, 0x5229297b, 0xdde3e33e, 0x5e2f2f71, 0x13848497,
+    0xa65353f5, 0xb9d1d168, 0x00000000, 0xc1eded2c, 0x40202060, 0xe3fcfc1f, 0x79b1b1c8, 0xb65b5bed,
+    0xd46a6abe, 0x8dcbcb46, 0x67bebed9, 0x7239394b, 0x944a4ade, 0x984c4cd4, 0xb05858e8, 0x85cfcf4a,
+    0xbbd0d06b, 0xc5efef2a, 0x4faaaae5, 0xedfbfb16, 0x864343c5, 0x9a4d4dd7, 0x66333355, 0x11858594,
+    0x8a4545cf, 0xe9f9f910, 0x04020206, 0xfe7f7f81, 0xa05050f0, 0x783c3c44, 0x259f9fba, 0x4ba8a8e3,
+    0xa25151f3, 0x5da3a3fe, 0x804040c0, 0x058f8f8a, 0x3f9292ad, 0x219d9dbc, 0x70383848, 0xf1f5f504,
+    0x63bcbcdf, 0x77b6b6c1, 0xafdada75, 0x42212163, 0x20101030, 0xe5ffff1a, 0xfdf3f30e, 0xbfd2d26d,
+    0x81cdcd4c, 0x180c0c14, 0x26131335, 0xc3ecec2f, 0xbe5f5fe1, 0x359797a2, 0x884444cc, 0x2e171739,
+    0x93c4c457, 0x55a7a7f2, 0xfc7e7e82, 0x7a3d3d47, 0xc86464ac, 0xba5d5de7, 0x3219192b, 0xe6737395,
+    0xc06060a0, 0x19818198, 0x9e4f4fd1, 0xa3dcdc7f, 0x44222266, 0x542a2a7e, 0x3b9090ab, 0x0b888883,
+    0x8c4646ca, 0xc7eeee29, 0x6bb8b8d3, 0x2814143c, 0xa7dede79, 0xbc5e5ee2, 0x160b0b1d, 0xaddbdb76,
+    0xdbe0e03b, 0x64323256, 0x743a3a4e, 0x140a0a1e, 0x924949db, 0x0c06060a, 0x4824246c, 0xb85c5ce4,
+    0x9fc2c25d, 0xbdd3d36e, 0x43acacef, 0xc46262a6, 0x399191a8, 0x319595a4, 0xd3e4e437, 0xf279798b,
+    0xd5e7e732, 0x8bc8c843, 0x6e373759, 0xda6d6db7, 0x018d8d8c, 0xb1d5d564, 0x9c4e4ed2, 0x49a9a9e0,
+    0xd86c6cb4, 0xac5656fa, 0xf3f4f407, 0xcfeaea25, 0xca6565af, 0xf47a7a8e, 0x47aeaee9, 0x10080818,
+    0x6fbabad5, 0xf0787888, 0x4a25256f, 0x5c2e2e72, 0x381c1c24, 0x57a6a6f1, 0x73b4b4c7, 0x97c6c651,
+    0xcbe8e823, 0xa1dddd7c, 0xe874749c, 0x3e1f1f21, 0x964b4bdd, 0x61bdbddc, 0x0d8b8b86, 0x0f8a8a85,
+    0xe0707090, 0x7c3e3e42, 0x71b5b5c4, 0xcc6666aa, 0x904848d8, 0x06030305, 0xf7f6f601, 0x1c0e0e12,
+    0xc26161a3, 0x6a35355f, 0xae5757f9, 0x69b9b9d0, 0x17868691, 0x99c1c158, 0x3a1d1d27, 0x279e9eb9,
+    0xd9e1e138, 0xebf8f813, 0x2b9898b3, 0x22111133, 0xd26969bb, 0xa9d9d970, 0x078e8e89, 0x339494a7,
+    0x2d9b9bb6, 0x3c1e1e22, 0x15878792, 0xc9e9e920, 0x87cece49, 0xaa5555ff, 0x50282878, 0xa5dfdf7a,
+    0x038c8c8f, 0x59a1a1f8, 0x09898980, 0x1a0d0d17, 0x65bfbfda, 0xd7e6e631, 0x844242c6, 0xd06868b8,
+    0x824141c3, 0x299999b0, 0x5a2d2d77, 0x1e0f0f11, 0x7bb0b0cb, 0xa85454fc, 0x6dbbbbd6, 0x2c16163a
+};
+
 static const uint8_t rsbox[256] = {
     0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
     0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
@@ -281,6 +319,9 @@ void AES_init_ctx(struct AES_ctx *ctx, const uint8_t *key, uint32_t keylen) {
             break;
     }
     KeyExpansion(ctx, key);
+    #if (defined(CTR) && (CTR == 1)) || (defined(GCM) && (GCM == 1))
+    ctx->KeystreamLeft = 0;
+    #endif
 }
 #if (defined(CBC) && (CBC == 1)) || (defined(CTR) && (CTR == 1))
 void AES_init_ctx_iv(struct AES_ctx *ctx, const uint8_t *key, uint32_t keylen, const uint8_t *iv) {
@@ -289,6 +330,9 @@ void AES_init_ctx_iv(struct AES_ctx *ctx, const uint8_t *key, uint32_t keylen, c
 }
 void AES_ctx_set_iv(struct AES_ctx *ctx, const uint8_t *iv) {
     memcpy(ctx->Iv, iv, AES_BLOCKLEN);
+    #if defined(CTR) && (CTR == 1)
+    ctx->KeystreamLeft = 0;
+    #endif
 }
 #endif
 
@@ -305,76 +349,10 @@ static void AddRoundKey(uint8_t round, state_t *state, const uint8_t *RoundKey)
     }
 }
 
-// The SubBytes Function Substitutes the values in the state matrix with values
-// in an S-box.
-static void SubBytes(state_t *state) {
-    uint8_t i, j;
-    for (i = 0; i < 4; ++i)
-    {
-        for (j = 0; j < 4; ++j)
-        {
-            (*state)[j][i] = getSBoxValue((*state)[j][i]);
-        }
-    }
-}
-
-// The ShiftRows() function shifts the rows in the state to the left. Each row
-// is shifted with different offset. Offset = Row number. So the first row is
-// not shifted.
-static void ShiftRows(state_t *state) {
-    uint8_t temp;
-
-    // Rotate first row 1 columns to left
-    temp = (*state)[0][1];
-    (*state)[0][1] = (*state)[1][1];
-    (*state)[1][1] = (*state)[2][1];
-    (*state)[2][1] = (*state)[3][1];
-    (*state)[3][1] = temp;
-
-    // Rotate second row 2 columns to left
-    temp = (*state)[0][2];
-    (*state)[0][2] = (*state)[2][2];
-    (*state)[2][2] = temp;
-
-    temp = (*state)[1][2];
-    (*state)[1][2] = (*state)[3][2];
-    (*state)[3][2] = temp;
-
-    // Rotate third row 3 columns to left
-    temp = (*state)[0][3];
-    (*state)[0][3] = (*state)[3][3];
-    (*state)[3][3] = (*state)[2][3];
-    (*state)[2][3] = (*state)[1][3];
-    (*state)[1][3] = temp;
-}
-
 static uint8_t xtime(uint8_t x) {
     return (x << 1) ^ (((x >> 7) & 1) * 0x1b);
 }
 
-// MixColumns function mixes the columns of the state matrix
-static void MixColumns(state_t *state) {
-    uint8_t i;
-    uint8_t Tmp, Tm, t;
-    for (i = 0; i < 4; ++i)
-    {
-        t = (*state)[i][0];
-        Tmp = (*state)[i][0] ^ (*state)[i][1] ^ (*state)[i][2] ^ (*state)[i][3];
-        Tm = (*state)[i][0] ^ (*state)[i][1];
-        Tm = xtime(Tm);
-        (*state)[i][0] ^= Tm ^ Tmp;
-        Tm = (*state)[i][1] ^ (*state)[i][2];
-        Tm = xtime(Tm);
-        (*state)[i][1] ^= Tm ^ Tmp;
-        Tm = (*state)[i][2] ^ (*state)[i][3];
-        Tm = xtime(Tm);
-        (*state)[i][2] ^= Tm ^ Tmp;
-        Tm = (*state)[i][3] ^ t;
-        Tm = xtime(Tm);
-        (*state)[i][3] ^= Tm ^ Tmp;
-    }
-}
-
 // Multiply is used to multiply numbers in the field GF(2^8)
 // Note: The last call to xtime() is unneeded, but often ends up generating a smaller binary
 //       The compiler seems to be able to vectorize the operation better this way.
@@ -460,28 +438,63 @@ static void InvShiftRows(state_t *state) {
 }
 #endif // #if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
 
-// Cipher is the main function that encrypts the PlainText.
+#define GETU32(p) (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+#define PUTU32(p, v) \
+    do { \
+        (p)[0] = (uint8_t)((v) >> 24); \
+        (p)[1] = (uint8_t)((v) >> 16); \
+        (p)[2] = (uint8_t)((v) >> 8); \
+        (p)[3] = (uint8_t)(v); \
+    } while (0)
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+// One output column of a full round. ShiftRows is done by picking each row's
+// byte from the next column along.
+#define ROUND_COLUMN(a, b, c, d) \
+    (Te0[(a) >> 24] ^ ROTR(Te0[((b) >> 16) & 0xff], 8) ^ \
+    ROTR(Te0[((c) >> 8) & 0xff], 16) ^ ROTR(Te0[(d) & 0xff], 24))
+
+// The last round has no MixColumns, so only the S-box is used.
+#define FINAL_COLUMN(a, b, c, d) \
+    (((uint32_t)getSBoxValue((a) >> 24) << 24) | ((uint32_t)getSBoxValue(((b) >> 16) & 0xff) << 16) | \
+    ((uint32_t)getSBoxValue(((c) >> 8) & 0xff) << 8) | (uint32_t)getSBoxValue((d) & 0xff))
+
+// Cipher is the main function that encrypts the PlainText. The state is kept
+// as four big-endian column words so that a round is sixteen table lookups.
 static void Cipher(state_t *state, const struct AES_ctx *ctx) {
+    uint8_t *buf = (uint8_t *)state;
     const uint8_t *RoundKey = GetRoundKey(ctx);
-    uint8_t round = 0;
+    uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+    uint8_t round;
 
     // Add the First round key to the state before starting the rounds.
-    AddRoundKey(0, state, RoundKey);
+    s0 = GETU32(buf) ^ GETU32(RoundKey);
+    s1 = GETU32(buf + 4) ^ GETU32(RoundKey + 4);
+    s2 = GETU32(buf + 8) ^ GETU32(RoundKey + 8);
+    s3 = GETU32(buf + 12) ^ GETU32(RoundKey + 12);
 
-    // There will be Nr rounds. The first Nr-1 rounds are identical. These Nr
-    // rounds are executed in the loop below. Last one without MixColumns()
-    for (round = 1; ; ++round)
+    for (round = 1; round < ctx->Nr; ++round)
     {
-        SubBytes(state);
-        ShiftRows(state);
-        if (round == ctx->Nr) {
-            break;
-        }
-        MixColumns(state);
-        AddRoundKey(round, state, RoundKey);
+        RoundKey += Nb * 4;
+        t0 = ROUND_COLUMN(s0, s1, s2, s3) ^ GETU32(RoundKey);
+        t1 = ROUND_COLUMN(s1, s2, s3, s0) ^ GETU32(RoundKey + 4);
+        t2 = ROUND_COLUMN(s2, s3, s0, s1) ^ GETU32(RoundKey + 8);
+        t3 = ROUND_COLUMN(s3, s0, s1, s2) ^ GETU32(RoundKey + 12);
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
     }
-    // Add round key to last round
-    AddRoundKey(ctx->Nr, state, RoundKey);
+
+    RoundKey += Nb * 4;
+    t0 = FINAL_COLUMN(s0, s1, s2, s3) ^ GETU32(RoundKey);
+    t1 = FINAL_COLUMN(s1, s2, s3, s0) ^ GETU32(RoundKey + 4);
+    t2 = FINAL_COLUMN(s2, s3, s0, s1) ^ GETU32(RoundKey + 8);
+    t3 = FINAL_COLUMN(s3, s0, s1, s2) ^ GETU32(RoundKey + 12);
+    PUTU32(buf, t0);
+    PUTU32(buf + 4, t1);
+    PUTU32(buf + 8, t2);
+    PUTU32(buf + 12, t3);
 }
 
 #if (defined(CBC) && CBC == 1) || (defined(ECB) && ECB == 1)
@@ -576,37 +589,235 @@ void AES_CBC_decrypt_buffer(struct AES_ctx *ctx, uint8_t *buf,  uint32_t length)
 
 
 
+#if (defined(CTR) && (CTR == 1)) || (defined(GCM) && (GCM == 1))
+
+/* XOR the keystream into buf, incrementing the last counter_bytes of Iv for
+each block. Unused keystream is kept in ctx so that the next call carries on
+where this one stopped, whatever the lengths of the pieces. */
+static void CTR_xcrypt(struct AES_ctx *ctx, uint8_t *buf, size_t length, int counter_bytes) {
+    while (length > 0) {
+        if (ctx->KeystreamLeft == 0) {
+            memcpy(ctx->Keystream, ctx->Iv, AES_BLOCKLEN);
+            Cipher((state_t *)ctx->Keystream, ctx);
+
+            /* Increment Iv and handle overflow */
+            for (int bi = AES_BLOCKLEN - 1; bi >= AES_BLOCKLEN - counter_bytes; --bi)
+            {
+                if (++ctx->Iv[bi] != 0) {
+                    break;
+                }
+            }
+            ctx->KeystreamLeft = AES_BLOCKLEN;
+        }
+
+        const uint8_t *keystream = ctx->Keystream + (AES_BLOCKLEN - ctx->KeystreamLeft);
+        size_t n = length < ctx->KeystreamLeft ? length : ctx->KeystreamLeft;
+        for (size_t i = 0; i < n; ++i)
+        {
+            buf[i] ^= keystream[i];
+        }
+        buf += n;
+        length -= n;
+        ctx->KeystreamLeft -= n;
+    }
+}
+
+#endif // #if (defined(CTR) && (CTR == 1)) || (defined(GCM) && (GCM == 1))
+
+
+
 #if defined(CTR) && (CTR == 1)
 
 /* Symmetrical operation: same function for encrypting as for decrypting. Note
 any IV/nonce should never be reused with the same key */
 void AES_CTR_xcrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length) {
-    uint8_t buffer[AES_BLOCKLEN];
+    CTR_xcrypt(ctx, buf, length, AES_BLOCKLEN);
+}
 
-    unsigned i;
-    int bi;
-    for (i = 0, bi = AES_BLOCKLEN; i < length; ++i, ++bi)
+#endif // #if defined(CTR) && (CTR == 1)
+
+
+
+#if defined(GCM) && (GCM == 1)
+
+/* GHASH multiplies by H in GF(2^128) using Shoup's method: HL/HH hold the
+products of H with every 4-bit value, and last4 reduces the four bits
+shifted out at each step. See NIST Special Publication 800-38D. */
+static const uint16_t last4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+static uint64_t GETU64(const uint8_t *p) {
+    return ((uint64_t)GETU32(p) << 32) | GETU32(p + 4);
+}
+
+static void PUTU64(uint8_t *p, uint64_t v) {
+    PUTU32(p, (uint32_t)(v >> 32));
+    PUTU32(p + 4, (uint32_t)v);
+}
+
+static void GHASH_init_table(struct AES_ctx *ctx, const uint8_t *h) {
+    uint64_t vh = GETU64(h);
+    uint64_t vl = GETU64(h + 8);
+
+    ctx->HL[0] = 0;
+    ctx->HH[0] = 0;
+    ctx->HL[8] = vl;
+    ctx->HH[8] = vh;
+    for (int i = 4; i > 0; i >>= 1)
     {
-        if (bi == AES_BLOCKLEN) { /* we need to regen xor compliment in buffer */
-            memcpy(buffer, ctx->Iv, AES_BLOCKLEN);
-            Cipher((state_t *)buffer, ctx);
+        uint32_t T = (vl & 1) * 0xe1000000U;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ ((uint64_t)T << 32);
+        ctx->HL[i] = vl;
+        ctx->HH[i] = vh;
+    }
+    for (int i = 2; i <= 8; i *= 2)
+    {
+        for (int j = 1; j < i; j++)
+        {
+            ctx->HH[i + j] = ctx->HH[i] ^ ctx->HH[j];
+            ctx->HL[i + j] = ctx->HL[i] ^ ctx->HL[j];
+        }
+    }
+}
 
-            /* Increment Iv and handle overflow */
-            for (bi = (AES_BLOCKLEN - 1); bi >= 0; --bi)
-            {
-                /* inc will overflow */
-                if (ctx->Iv[bi] == 255) {
-                    ctx->Iv[bi] = 0;
-                    continue;
-                }
-                ctx->Iv[bi] += 1;
-                break;
-            }
-            bi = 0;
+// x = x * H
+static void GHASH_mult(const struct AES_ctx *ctx, uint8_t *x) {
+    uint8_t lo = x[15] & 0xf;
+    uint64_t zh = ctx->HH[lo];
+    uint64_t zl = ctx->HL[lo];
+
+    for (int i = 15; i >= 0; i--)
+    {
+        uint8_t hi = x[i] >> 4;
+        uint8_t rem;
+        lo = x[i] & 0xf;
+        if (i != 15) {
+            rem = zl & 0xf;
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ ((uint64_t)last4[rem] << 48);
+            zh ^= ctx->HH[lo];
+            zl ^= ctx->HL[lo];
         }
+        rem = zl & 0xf;
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ ((uint64_t)last4[rem] << 48);
+        zh ^= ctx->HH[hi];
+        zl ^= ctx->HL[hi];
+    }
+    PUTU64(x, zh);
+    PUTU64(x + 8, zl);
+}
 
-        buf[i] = (buf[i] ^ buffer[bi]);
+// Absorb data into the hash. A partial block is held in Ghash until it is
+// completed by the next call or padded by GHASH_flush().
+static void GHASH_update(struct AES_ctx *ctx, const uint8_t *data, size_t length) {
+    while (length > 0) {
+        size_t n = AES_BLOCKLEN - ctx->GhashUsed;
+        if (n > length) {
+            n = length;
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            ctx->Ghash[ctx->GhashUsed + i] ^= data[i];
+        }
+        data += n;
+        length -= n;
+        ctx->GhashUsed += n;
+        if (ctx->GhashUsed == AES_BLOCKLEN) {
+            GHASH_mult(ctx, ctx->Ghash);
+            ctx->GhashUsed = 0;
+        }
     }
 }
 
-#endif // #if defined(CTR) && (CTR == 1)
+static void GHASH_flush(struct AES_ctx *ctx) {
+    if (ctx->GhashUsed != 0) {
+        GHASH_mult(ctx, ctx->Ghash);
+        ctx->GhashUsed = 0;
+    }
+}
+
+void AES_GCM_start(struct AES_ctx *ctx, const uint8_t *iv, size_t iv_length) {
+    uint8_t h[AES_BLOCKLEN] = { 0 };
+    Cipher((state_t *)h, ctx);
+    GHASH_init_table(ctx, h);
+
+    memset(ctx->Ghash, 0, AES_BLOCKLEN);
+    ctx->GhashUsed = 0;
+    ctx->AadLength = 0;
+    ctx->TextLength = 0;
+
+    // Work out the pre-counter block J0, kept in Iv.
+    if (iv_length == 12) {
+        memcpy(ctx->Iv, iv, 12);
+        memset(ctx->Iv + 12, 0, 3);
+        ctx->Iv[15] = 1;
+    } else {
+        uint8_t length_block[AES_BLOCKLEN] = { 0 };
+        PUTU64(length_block + 8, (uint64_t)iv_length * 8);
+        GHASH_update(ctx, iv, iv_length);
+        GHASH_flush(ctx);
+        GHASH_update(ctx, length_block, AES_BLOCKLEN);
+        memcpy(ctx->Iv, ctx->Ghash, AES_BLOCKLEN);
+        memset(ctx->Ghash, 0, AES_BLOCKLEN);
+    }
+
+    // E(K, J0) masks the tag; the text is encrypted from J0 + 1.
+    memcpy(ctx->EkJ0, ctx->Iv, AES_BLOCKLEN);
+    Cipher((state_t *)ctx->EkJ0, ctx);
+    for (int bi = AES_BLOCKLEN - 1; bi >= AES_BLOCKLEN - 4; --bi)
+    {
+        if (++ctx->Iv[bi] != 0) {
+            break;
+        }
+    }
+    ctx->KeystreamLeft = 0;
+}
+
+void AES_GCM_update_aad(struct AES_ctx *ctx, const uint8_t *aad, size_t length) {
+    GHASH_update(ctx, aad, length);
+    ctx->AadLength += length;
+}
+
+void AES_GCM_encrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, size_t length) {
+    if (ctx->TextLength == 0) {
+        GHASH_flush(ctx);
+    }
+    CTR_xcrypt(ctx, buf, length, 4);
+    GHASH_update(ctx, buf, length);
+    ctx->TextLength += length;
+}
+
+void AES_GCM_decrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, size_t length) {
+    if (ctx->TextLength == 0) {
+        GHASH_flush(ctx);
+    }
+    GHASH_update(ctx, buf, length);
+    CTR_xcrypt(ctx, buf, length, 4);
+    ctx->TextLength += length;
+}
+
+void AES_GCM_tag(const struct AES_ctx *ctx, uint8_t *tag) {
+    // Work on a copy so that more text may follow.
+    memcpy(tag, ctx->Ghash, AES_BLOCKLEN);
+    if (ctx->GhashUsed != 0) {
+        GHASH_mult(ctx, tag);
+    }
+    uint8_t length_block[AES_BLOCKLEN];
+    PUTU64(length_block, ctx->AadLength * 8);
+    PUTU64(length_block + 8, ctx->TextLength * 8);
+    for (int i = 0; i < AES_BLOCKLEN; ++i)
+    {
+        tag[i] ^= length_block[i];
+    }
+    GHASH_mult(ctx, tag);
+    for (int i = 0; i < AES_BLOCKLEN; ++i)
+    {
+        tag[i] ^= ctx->EkJ0[i];
+    }
+}
+
+#endif // #if defined(GCM) && (GCM == 1)
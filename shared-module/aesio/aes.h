@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 // #define the macros below to 1/0 to enable/disable the mode of operation.
 //
 // CBC enables AES encryption in CBC-mode of operation.
 // CTR enables encryption in counter-mode.
+// GCM enables authenticated encryption in Galois/counter-mode.
 // ECB enables the basic ECB 16-byte block algorithm. All can be enabled simultaneously.
 
 // The #ifndef-guard allows it to be configured before #include'ing or at compile time.
@@ -27,6 +29,10 @@
   #define CTR 1
 #endif
 
+#ifndef GCM
+  #define GCM 1
+#endif
+
 
 #define AES128 1
 #define AES192 1
@@ -60,9 +66,25 @@ struct AES_ctx
         uint8_t RoundKey128[AES_keyExpSize128];
         #endif
     };
-    #if (defined(CBC) && (CBC == 1)) || (defined(CTR) && (CTR == 1))
+    #if (defined(CBC) && (CBC == 1)) || (defined(CTR) && (CTR == 1)) || (defined(GCM) && (GCM == 1))
     uint8_t Iv[AES_BLOCKLEN];
     #endif
+    #if (defined(CTR) && (CTR == 1)) || (defined(GCM) && (GCM == 1))
+    // The last block of keystream and how many of its bytes are still unused.
+    uint8_t Keystream[AES_BLOCKLEN];
+    uint8_t KeystreamLeft;
+    #endif
+    #if defined(GCM) && (GCM == 1)
+    // Multiples of the hash key H for GHASH, set up by AES_GCM_start().
+    uint64_t HL[16];
+    uint64_t HH[16];
+    uint8_t EkJ0[AES_BLOCKLEN];
+    // The running hash, with GhashUsed bytes of a partial block XORed in.
+    uint8_t Ghash[AES_BLOCKLEN];
+    uint8_t GhashUsed;
+    uint64_t AadLength;
+    uint64_t TextLength;
+    #endif
     uint32_t KeyLength;
     uint8_t Nr;
     uint8_t Nk;
@@ -99,9 +121,27 @@ void AES_CBC_decrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length);
 
 // Same function for encrypting as for decrypting.
 // IV is incremented for every block, and used after encryption as XOR-compliment for output
+// The stream may be processed in pieces of any length: unused keystream is kept in ctx
 // Suggesting https://en.wikipedia.org/wiki/Padding_(cryptography)#PKCS7 for padding scheme
 // NOTES: you need to set IV in ctx with AES_init_ctx_iv() or AES_ctx_set_iv()
 //        no IV should ever be reused with the same key
 void AES_CTR_xcrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, uint32_t length);
 
 #endif // #if defined(CTR) && (CTR == 1)
+
+
+#if defined(GCM) && (GCM == 1)
+
+// Call AES_GCM_start() after AES_init_ctx() with a nonce of any length; 12
+// bytes is the usual choice. Then authenticate any associated data with
+// AES_GCM_update_aad() before encrypting or decrypting the text in place, in
+// pieces of any length. AES_GCM_tag() writes the AES_BLOCKLEN byte tag for
+// everything so far.
+// NOTES: no nonce should ever be reused with the same key
+void AES_GCM_start(struct AES_ctx *ctx, const uint8_t *iv, size_t iv_length);
+void AES_GCM_update_aad(struct AES_ctx *ctx, const uint8_t *aad, size_t length);
+void AES_GCM_encrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, size_t length);
+void AES_GCM_decrypt_buffer(struct AES_ctx *ctx, uint8_t *buf, size_t length);
+void AES_GCM_tag(const struct AES_ctx *ctx, uint8_t *tag);
+
+#endif // #if defined(GCM) && (GCM == 1)
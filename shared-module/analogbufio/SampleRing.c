@@ -0,0 +1,121 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "shared-module/analogbufio/SampleRing.h"
+
+#include "py/binary.h"
+#include "py/runtime.h"
+
+void analogbufio_ring_init(analogbufio_ring_t *ring, mp_obj_t buffer, mp_int_t block_count, mp_int_t decimation, size_t in_flight) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    uint8_t bytes_per_sample = 1;
+    if (bufinfo.typecode == 'H') {
+        bytes_per_sample = 2;
+    } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'H' or 'B'"), MP_QSTR_buffer);
+    }
+    block_count = mp_arg_validate_int_range(block_count, in_flight + 1, 255, MP_QSTR_blocks);
+    decimation = mp_arg_validate_int_range(decimation, 1, 65535, MP_QSTR_decimation);
+    size_t block_bytes = bufinfo.len / block_count;
+    if (block_bytes == 0 || block_bytes % bytes_per_sample != 0) {
+        mp_arg_error_invalid(MP_QSTR_blocks);
+    }
+
+    ring->buffer_obj = buffer;
+    ring->buffer = bufinfo.buf;
+    ring->scratch = m_malloc(block_bytes);
+    ring->block_samples = block_bytes / bytes_per_sample;
+    ring->issued = 0;
+    ring->filled = 0;
+    ring->read = 0;
+    ring->overflow_count = 0;
+    ring->read_offset = 0;
+    ring->sum = 0;
+    ring->sum_count = 0;
+    ring->decimation = decimation;
+    ring->block_count = block_count;
+    ring->bytes_per_sample = bytes_per_sample;
+}
+
+void analogbufio_ring_deinit(analogbufio_ring_t *ring) {
+    ring->buffer_obj = MP_OBJ_NULL;
+    ring->buffer = NULL;
+    m_del(uint8_t, ring->scratch, ring->block_samples * ring->bytes_per_sample);
+    ring->scratch = NULL;
+}
+
+static uint8_t *block_at(analogbufio_ring_t *ring, uint32_t n) {
+    return ring->buffer + (n % ring->block_count) * ring->block_samples * ring->bytes_per_sample;
+}
+
+uint8_t *analogbufio_ring_issue(analogbufio_ring_t *ring) {
+    // Never hand out a block that hasn't been read.
+    if (ring->issued - ring->read >= ring->block_count) {
+        return ring->scratch;
+    }
+    return block_at(ring, ring->issued++);
+}
+
+void analogbufio_ring_complete(analogbufio_ring_t *ring, uint8_t *block) {
+    // Blocks are filled in the order they were issued, so only the count is needed.
+    if (block == ring->scratch) {
+        ring->overflow_count += ring->block_samples;
+    } else {
+        ring->filled++;
+    }
+}
+
+size_t analogbufio_ring_get_in_waiting(analogbufio_ring_t *ring) {
+    size_t samples = (ring->filled - ring->read) * ring->block_samples - ring->read_offset;
+    return (samples + ring->sum_count) / ring->decimation;
+}
+
+size_t analogbufio_ring_readinto(analogbufio_ring_t *ring, uint8_t *out, size_t len) {
+    uint32_t filled = ring->filled;
+    size_t count = 0;
+    while (count < len && ring->read != filled) {
+        uint8_t *block = block_at(ring, ring->read);
+        size_t offset = ring->read_offset;
+        if (ring->decimation == 1) {
+            // Nothing to average, so copy as much as possible in one go.
+            size_t n = MIN(ring->block_samples - offset, len - count);
+            memcpy(out + count * ring->bytes_per_sample, block + offset * ring->bytes_per_sample, n * ring->bytes_per_sample);
+            offset += n;
+            count += n;
+        } else {
+            while (offset < ring->block_samples && count < len) {
+                if (ring->bytes_per_sample == 2) {
+                    ring->sum += ((uint16_t *)block)[offset];
+                } else {
+                    ring->sum += block[offset];
+                }
+                offset++;
+                if (++ring->sum_count == ring->decimation) {
+                    uint32_t average = ring->sum / ring->decimation;
+                    if (ring->bytes_per_sample == 2) {
+                        ((uint16_t *)out)[count] = average;
+                    } else {
+                        out[count] = average;
+                    }
+                    count++;
+                    ring->sum = 0;
+                    ring->sum_count = 0;
+                }
+            }
+        }
+        if (offset == ring->block_samples) {
+            // Give the block back to the producer.
+            ring->read_offset = 0;
+            ring->read++;
+        } else {
+            ring->read_offset = offset;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,58 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// A ring of equal sized blocks that a port fills continuously, usually with
+// DMA, while Python reads samples out of it. The producer side may be called
+// from an interrupt and never allocates.
+//
+// Blocks are handed to the producer in order. When the reader has fallen so
+// far behind that every block is full or being filled, the producer is given
+// a scratch block instead and the samples written to it are counted as lost.
+typedef struct {
+    // Kept so that the buffer isn't collected while it is being filled.
+    mp_obj_t buffer_obj;
+    uint8_t *buffer;
+    uint8_t *scratch;
+    size_t block_samples;
+    // Counts of blocks, which wrap around.
+    uint32_t issued;
+    volatile uint32_t filled;
+    volatile uint32_t read;
+    volatile uint32_t overflow_count;
+    // Samples already read from the block at read.
+    size_t read_offset;
+    // The partial average carried between blocks and reads.
+    uint32_t sum;
+    uint16_t sum_count;
+    uint16_t decimation;
+    uint8_t block_count;
+    uint8_t bytes_per_sample;
+} analogbufio_ring_t;
+
+// buffer must be a bytearray or an array of type 'B' or 'H'. in_flight is the
+// number of blocks that the producer keeps issued at once, such as one per
+// chained DMA channel. There must be at least one more block than that, or
+// every block after the first few would go to scratch.
+void analogbufio_ring_init(analogbufio_ring_t *ring, mp_obj_t buffer, mp_int_t block_count, mp_int_t decimation, size_t in_flight);
+void analogbufio_ring_deinit(analogbufio_ring_t *ring);
+
+// Producer: the block to fill after those already handed out.
+uint8_t *analogbufio_ring_issue(analogbufio_ring_t *ring);
+// Producer: a block from analogbufio_ring_issue() has been filled.
+void analogbufio_ring_complete(analogbufio_ring_t *ring, uint8_t *block);
+
+// Reader: samples that can be read now, after decimation.
+size_t analogbufio_ring_get_in_waiting(analogbufio_ring_t *ring);
+// Reader: copy up to len samples, averaging every decimation samples, without
+// waiting. Returns the number of samples stored in out.
+size_t analogbufio_ring_readinto(analogbufio_ring_t *ring, uint8_t *out, size_t len);
@@ -9,6 +9,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "py/gc.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -108,6 +109,8 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
             common_hal_audioio_wavefile_deinit(self);
             m_malloc_fail(self->len);
         }
+        GC_SET_ALLOC_KIND(self->buffer, AUDIO);
+        GC_SET_ALLOC_KIND(self->second_buffer, AUDIO);
     }
 }
 
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
 
@@ -36,6 +37,8 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
         common_hal_audiomixer_mixer_deinit(self);
         m_malloc_fail(self->len);
     }
+    GC_SET_ALLOC_KIND(self->first_buffer, AUDIO);
+    GC_SET_ALLOC_KIND(self->second_buffer, AUDIO);
 
     self->bits_per_sample = bits_per_sample;
     self->samples_signed = samples_signed;
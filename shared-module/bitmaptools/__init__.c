@@ -23,6 +23,157 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// Row-level pixel access for the inner loops below. Unlike the per-pixel bitmap accessors
+// these don't bounds check or recompute the row address; callers clip once and look up
+// each row once. When bits_per_value is a constant the switch folds away.
+static inline __attribute__((always_inline)) uint32_t row_get_pixel(const uint32_t *row, int x, int bits_per_value) {
+    switch (bits_per_value) {
+        case 32:
+            return row[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 8:
+            return ((const uint8_t *)row)[x];
+        default: {
+            int values_per_byte = 8 / bits_per_value;
+            uint8_t bits = ((const uint8_t *)row)[x / values_per_byte];
+            int bit_position = (values_per_byte - (x % values_per_byte) - 1) * bits_per_value;
+            return (bits >> bit_position) & ((1u << bits_per_value) - 1);
+        }
+    }
+}
+
+static inline __attribute__((always_inline)) void row_set_pixel(uint32_t *row, int x, int bits_per_value, uint32_t value) {
+    switch (bits_per_value) {
+        case 32:
+            row[x] = value;
+            break;
+        case 16:
+            ((uint16_t *)row)[x] = value;
+            break;
+        case 8:
+            ((uint8_t *)row)[x] = value;
+            break;
+        default: {
+            int values_per_byte = 8 / bits_per_value;
+            uint8_t mask = (1u << bits_per_value) - 1;
+            uint8_t *bits = &((uint8_t *)row)[x / values_per_byte];
+            int bit_position = (values_per_byte - (x % values_per_byte) - 1) * bits_per_value;
+            *bits = (*bits & ~(mask << bit_position)) | ((value & mask) << bit_position);
+            break;
+        }
+    }
+}
+
+static inline uint32_t *bitmap_row(displayio_bitmap_t *bitmap, int y) {
+    return bitmap->data + y * bitmap->stride;
+}
+
+// One destination row of a rotozoom. Source coordinates are 16.16 fixed point and advance by
+// (du, dv) per destination pixel.
+typedef struct {
+    uint32_t *dest_row;
+    const displayio_bitmap_t *source;
+    int32_t u, v, du, dv;
+    int32_t u_min, v_min;
+    uint32_t u_span, v_span;
+    uint32_t skip_index;
+    bool skip_index_none;
+    uint8_t dest_bits_per_value;
+} rotozoom_row_t;
+
+typedef void rotozoom_row_fun(const rotozoom_row_t *r, int dest_x, int count);
+
+static inline __attribute__((always_inline)) void rotozoom_row(const rotozoom_row_t *r, int dest_x, int count, int source_bits_per_value, int dest_bits_per_value) {
+    int32_t u = r->u;
+    int32_t v = r->v;
+    const uint32_t *source_data = r->source->data;
+    uint16_t source_stride = r->source->stride;
+    for (int i = 0; i < count; i++) {
+        // One unsigned compare per axis covers both ends of the clip window.
+        if ((uint32_t)(u - r->u_min) < r->u_span && (uint32_t)(v - r->v_min) < r->v_span) {
+            const uint32_t *source_row = source_data + (v >> 16) * source_stride;
+            uint32_t c = row_get_pixel(source_row, u >> 16, source_bits_per_value);
+            if (r->skip_index_none || c != r->skip_index) {
+                row_set_pixel(r->dest_row, dest_x + i, dest_bits_per_value, c);
+            }
+        }
+        u += r->du;
+        v += r->dv;
+    }
+}
+
+#define ROTOZOOM_ROW(source_bits_per_value, dest_bits_per_value) \
+    static void rotozoom_row_##source_bits_per_value##_##dest_bits_per_value(const rotozoom_row_t *r, int dest_x, int count) { \
+        rotozoom_row(r, dest_x, count, source_bits_per_value, dest_bits_per_value); \
+    }
+
+// Specialized loops for the common same-depth copies and for paletted sprites drawn into
+// RGB565 buffers. Everything else goes through the generic loop.
+ROTOZOOM_ROW(1, 1)
+ROTOZOOM_ROW(2, 2)
+ROTOZOOM_ROW(4, 4)
+ROTOZOOM_ROW(8, 8)
+ROTOZOOM_ROW(16, 16)
+ROTOZOOM_ROW(32, 32)
+ROTOZOOM_ROW(1, 16)
+ROTOZOOM_ROW(2, 16)
+ROTOZOOM_ROW(4, 16)
+ROTOZOOM_ROW(8, 16)
+
+static void rotozoom_row_generic(const rotozoom_row_t *r, int dest_x, int count) {
+    rotozoom_row(r, dest_x, count, r->source->bits_per_value, r->dest_bits_per_value);
+}
+
+static rotozoom_row_fun *rotozoom_select_row_fun(int source_bits_per_value, int dest_bits_per_value) {
+    #define ROTOZOOM_CASE(s, d) \
+    if (source_bits_per_value == s && dest_bits_per_value == d) { \
+        return rotozoom_row_##s##_##d; \
+    }
+    ROTOZOOM_CASE(1, 1)
+    ROTOZOOM_CASE(2, 2)
+    ROTOZOOM_CASE(4, 4)
+    ROTOZOOM_CASE(8, 8)
+    ROTOZOOM_CASE(16, 16)
+    ROTOZOOM_CASE(32, 32)
+    ROTOZOOM_CASE(1, 16)
+    ROTOZOOM_CASE(2, 16)
+    ROTOZOOM_CASE(4, 16)
+    ROTOZOOM_CASE(8, 16)
+    #undef ROTOZOOM_CASE
+    return rotozoom_row_generic;
+}
+
+// Rounds to 16.16 fixed point. Rounding rather than truncating keeps coordinates that are
+// exact in floating point, like every seventh step at scale 0.7, from landing just short.
+static inline int32_t to_fixed(mp_float_t value) {
+    return (int32_t)MICROPY_FLOAT_C_FUN(floor)(value * 65536 + MICROPY_FLOAT_CONST(0.5));
+}
+
+// Narrows the steps [*first, *last) to those where lo <= start + k * step < hi, widened by
+// one step on each side so rounding never drops a pixel; the row loop does the exact test.
+static void rotozoom_clip_steps(mp_float_t start, mp_float_t step, mp_float_t lo, mp_float_t hi, int *first, int *last) {
+    if (step == 0) {
+        if (start < lo || start >= hi) {
+            *last = *first;
+        }
+        return;
+    }
+    mp_float_t k_lo = (lo - start) / step;
+    mp_float_t k_hi = (hi - start) / step;
+    if (step < 0) {
+        mp_float_t swap = k_lo;
+        k_lo = k_hi;
+        k_hi = swap;
+    }
+    if (k_lo > *first + 1) {
+        *first = k_lo >= *last ? *last : (int)k_lo - 1;
+    }
+    if (k_hi < *last - 1) {
+        *last = k_hi < *first ? *first : (int)k_hi + 2;
+    }
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -186,18 +337,50 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
+    // Within a row, only the pixels whose source coordinates land in the source clip window
+    // are visited, so the fixed point coordinates only need to cover that window plus a step.
+    mp_float_t max_step = MAX(MICROPY_FLOAT_C_FUN(fabs)(duRow), MICROPY_FLOAT_C_FUN(fabs)(dvRow));
+    bool fixed_point = MAX(source_clip1_x, source_clip1_y) + max_step + 2 < 32767;
+    rotozoom_row_fun *row_fun = rotozoom_select_row_fun(source->bits_per_value, self->bits_per_value);
+
+    rotozoom_row_t r = {
+        .source = source,
+        .du = to_fixed(duRow),
+        .dv = to_fixed(dvRow),
+        .u_min = source_clip0_x << 16,
+        .v_min = source_clip0_y << 16,
+        .u_span = (uint32_t)(source_clip1_x - source_clip0_x) << 16,
+        .v_span = (uint32_t)(source_clip1_y - source_clip0_y) << 16,
+        .skip_index = skip_index,
+        .skip_index_none = skip_index_none,
+        .dest_bits_per_value = self->bits_per_value,
+    };
+
     for (y = miny; y <= maxy; y++) {
         mp_float_t u = rowu + minx * duRow;
         mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
+        int first = 0;
+        int last = maxx - minx + 1;
+        rotozoom_clip_steps(u, duRow, source_clip0_x, source_clip1_x, &first, &last);
+        rotozoom_clip_steps(v, dvRow, source_clip0_y, source_clip1_y, &first, &last);
+        if (first < last && fixed_point) {
+            r.dest_row = bitmap_row(self, y);
+            r.u = to_fixed(u + first * duRow);
+            r.v = to_fixed(v + first * dvRow);
+            row_fun(&r, minx + first, last - first);
+        } else if (first < last) {
+            u += first * duRow;
+            v += first * dvRow;
+            for (x = minx + first; x < minx + last; x++) {
+                if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
+                    uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
+                    if ((skip_index_none) || (c != skip_index)) {
+                        displayio_bitmap_write_pixel(self, x, y, c);
+                    }
                 }
+                u += duRow;
+                v += dvRow;
             }
-            u += duRow;
-            v += dvRow;
         }
         rowu += duCol;
         rowv += dvCol;
@@ -1034,6 +1217,24 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// One row of a blit: count pixels from source_x onward into dest_x onward, walking right to
+// left when reverse is set so that overlapping copies within one bitmap are safe.
+static inline __attribute__((always_inline)) void blit_row(uint32_t *dest_row, const uint32_t *source_row, int dest_x, int source_x, int count, bool reverse,
+    uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index, bool skip_dest_index_none,
+    int source_bits_per_value, int dest_bits_per_value) {
+    for (int k = 0; k < count; k++) {
+        int i = reverse ? count - k - 1 : k;
+        uint32_t value = row_get_pixel(source_row, source_x + i, source_bits_per_value);
+        if (!skip_source_index_none && value == skip_source_index) {
+            continue;
+        }
+        if (!skip_dest_index_none && row_get_pixel(dest_row, dest_x + i, dest_bits_per_value) == skip_dest_index) {
+            continue;
+        }
+        row_set_pixel(dest_row, dest_x + i, dest_bits_per_value, value);
+    }
+}
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1059,44 +1260,158 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
     displayio_area_t a = { x, y, dirty_x_max, dirty_y_max, NULL};
     displayio_bitmap_set_dirty_area(destination, &a);
 
-    bool x_reverse = false;
-    bool y_reverse = false;
+    // Clip the copy to the destination once, up front, rather than per pixel.
+    int start_x = MAX(0, -x);
+    int start_y = MAX(0, -y);
+    int width = MIN(x2 - x1, destination->width - x) - start_x;
+    int height = MIN(y2 - y1, destination->height - y) - start_y;
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    x += start_x;
+    x1 += start_x;
+    y += start_y;
+    y1 += start_y;
 
     // Add reverse direction option to protect blitting of destination bitmap back into destination bitmap
-    if (x > x1) {
-        x_reverse = true;
-    }
-    if (y > y1) {
-        y_reverse = true;
-    }
-
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < destination->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
-
-                if ((yd_index >= 0) && (yd_index < destination->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if (skip_dest_index_none) { // if skip_dest_index is none, then only check source skip
-                        if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                            displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                        }
-                    } else { // check dest_value index against skip_dest_index and skip if they match
-                        uint32_t dest_value = common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index);
-                        if (dest_value != skip_dest_index) {
-                            if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                            }
-                        }
+    bool x_reverse = x > x1;
+    bool y_reverse = y > y1;
+
+    int source_bits_per_value = source->bits_per_value;
+    int dest_bits_per_value = destination->bits_per_value;
+    // Same-depth copies without skipping are plain byte moves when rows start on byte boundaries.
+    bool move_bytes = source_bits_per_value == dest_bits_per_value && skip_source_index_none && skip_dest_index_none &&
+        (x * dest_bits_per_value) % 8 == 0 && (x1 * dest_bits_per_value) % 8 == 0 && (width * dest_bits_per_value) % 8 == 0;
+
+    for (int j = 0; j < height; j++) {
+        int row = y_reverse ? height - j - 1 : j;
+        uint32_t *dest_row = bitmap_row(destination, y + row);
+        const uint32_t *source_row = bitmap_row(source, y1 + row);
+        if (move_bytes) {
+            memmove((uint8_t *)dest_row + x * dest_bits_per_value / 8,
+                (const uint8_t *)source_row + x1 * dest_bits_per_value / 8,
+                width * dest_bits_per_value / 8);
+            continue;
+        }
+        #define BLIT_ROW(s, d) \
+    blit_row(dest_row, source_row, x, x1, width, x_reverse, skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none, s, d)
+        if (source_bits_per_value == 16 && dest_bits_per_value == 16) {
+            BLIT_ROW(16, 16);
+        } else if (source_bits_per_value == 8 && dest_bits_per_value == 8) {
+            BLIT_ROW(8, 8);
+        } else if (source_bits_per_value == 8 && dest_bits_per_value == 16) {
+            BLIT_ROW(8, 16);
+        } else if (source_bits_per_value == 1 && dest_bits_per_value == 1) {
+            BLIT_ROW(1, 1);
+        } else {
+            BLIT_ROW(source_bits_per_value, dest_bits_per_value);
+        }
+        #undef BLIT_ROW
+    }
+}
+
+// Averages two or four RGB565 or L8 pixels channel by channel.
+static uint32_t blit2x_average(uint32_t a, uint32_t b, uint32_t c, uint32_t d, displayio_colorspace_t colorspace) {
+    if (colorspace == DISPLAYIO_COLORSPACE_L8) {
+        return (a + b + c + d + 2) / 4;
+    }
+    bool swap = (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) || (colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED);
+    if (swap) {
+        a = __builtin_bswap16(a);
+        b = __builtin_bswap16(b);
+        c = __builtin_bswap16(c);
+        d = __builtin_bswap16(d);
+    }
+    const uint32_t r_mask = 0xf800; // (or b mask, if BGR)
+    const uint32_t g_mask = 0x07e0;
+    const uint32_t b_mask = 0x001f; // (or r mask, if BGR)
+    uint32_t r = (((a & r_mask) + (b & r_mask) + (c & r_mask) + (d & r_mask) + (2 << 11)) / 4) & r_mask;
+    uint32_t g = (((a & g_mask) + (b & g_mask) + (c & g_mask) + (d & g_mask) + (2 << 5)) / 4) & g_mask;
+    uint32_t bl = (((a & b_mask) + (b & b_mask) + (c & b_mask) + (d & b_mask) + 2) / 4) & b_mask;
+    uint32_t result = r | g | bl;
+    if (swap) {
+        result = __builtin_bswap16(result);
+    }
+    return result;
+}
+
+void common_hal_bitmaptools_blit2x(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none,
+    bool bilinear, displayio_colorspace_t colorspace) {
+
+    if (destination->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+
+    // Each source pixel (i, j) becomes the 2x2 destination block at (x + 2i, y + 2j).
+    int width = MIN(x2 - x1, (destination->width - x + 1) / 2);
+    int height = MIN(y2 - y1, (destination->height - y + 1) / 2);
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    displayio_area_t a = { x, y, MIN(x + 2 * width, destination->width), MIN(y + 2 * height, destination->height), NULL};
+    displayio_bitmap_set_dirty_area(destination, &a);
+
+    int source_bits_per_value = source->bits_per_value;
+    int dest_bits_per_value = destination->bits_per_value;
+    int last_x = x2 - 1;
+    int last_y = y2 - 1;
+
+    for (int j = 0; j < height; j++) {
+        const uint32_t *source_row = bitmap_row(source, y1 + j);
+        // Bilinear samples the next source row too, clamped at the edge of the region.
+        const uint32_t *next_source_row = bitmap_row(source, MIN(y1 + j + 1, last_y));
+        int dest_y = y + 2 * j;
+        uint32_t *dest_row0 = bitmap_row(destination, dest_y);
+        uint32_t *dest_row1 = dest_y + 1 < destination->height ? bitmap_row(destination, dest_y + 1) : NULL;
+
+        if (!bilinear && skip_source_index_none && source_bits_per_value == 16 && dest_bits_per_value == 16 && (x & 1) == 0 && x + 2 * width <= destination->width) {
+            // Each doubled RGB565 pixel is one aligned 32 bit word.
+            const uint16_t *src = (const uint16_t *)source_row + x1;
+            uint32_t *dst = (uint32_t *)((uint16_t *)dest_row0 + x);
+            for (int i = 0; i < width; i++) {
+                dst[i] = src[i] * 0x10001u;
+            }
+            if (dest_row1 != NULL) {
+                memcpy((uint16_t *)dest_row1 + x, dst, width * 4);
+            }
+            continue;
+        }
+
+        for (int i = 0; i < width; i++) {
+            int source_x = x1 + i;
+            uint32_t c = row_get_pixel(source_row, source_x, source_bits_per_value);
+            if (!skip_source_index_none && c == skip_source_index) {
+                continue;
+            }
+            int dest_x = x + 2 * i;
+            bool has_right = dest_x + 1 < destination->width;
+            if (!bilinear) {
+                row_set_pixel(dest_row0, dest_x, dest_bits_per_value, c);
+                if (has_right) {
+                    row_set_pixel(dest_row0, dest_x + 1, dest_bits_per_value, c);
+                }
+                if (dest_row1 != NULL) {
+                    row_set_pixel(dest_row1, dest_x, dest_bits_per_value, c);
+                    if (has_right) {
+                        row_set_pixel(dest_row1, dest_x + 1, dest_bits_per_value, c);
                     }
                 }
+                continue;
+            }
+            int next_x = MIN(source_x + 1, last_x);
+            uint32_t right = row_get_pixel(source_row, next_x, source_bits_per_value);
+            uint32_t below = row_get_pixel(next_source_row, source_x, source_bits_per_value);
+            uint32_t diagonal = row_get_pixel(next_source_row, next_x, source_bits_per_value);
+            row_set_pixel(dest_row0, dest_x, dest_bits_per_value, c);
+            if (has_right) {
+                row_set_pixel(dest_row0, dest_x + 1, dest_bits_per_value, blit2x_average(c, c, right, right, colorspace));
+            }
+            if (dest_row1 != NULL) {
+                row_set_pixel(dest_row1, dest_x, dest_bits_per_value, blit2x_average(c, c, below, below, colorspace));
+                if (has_right) {
+                    row_set_pixel(dest_row1, dest_x + 1, dest_bits_per_value, blit2x_average(c, right, below, diagonal, colorspace));
+                }
             }
         }
     }
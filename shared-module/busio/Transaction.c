@@ -0,0 +1,309 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/busio/Transaction.h"
+
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "shared/runtime/interrupt_char.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_BUSIO_I2C
+#include "shared-bindings/busio/I2C.h"
+#endif
+#if CIRCUITPY_BUSIO_SPI
+#include "shared-bindings/busio/SPI.h"
+#endif
+#if CIRCUITPY_DIGITALIO
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#endif
+
+void common_hal_busio_transaction_construct(busio_transaction_obj_t *self, mp_obj_t bus, mp_int_t address,
+    mp_obj_t chip_select, bool cs_active_value, uint32_t baudrate, uint8_t polarity, uint8_t phase) {
+    self->bus = bus;
+    self->address = address;
+    // May be mp_const_none if CS not used.
+    self->chip_select = chip_select;
+    self->cs_active_value = cs_active_value;
+    self->baudrate = baudrate;
+    self->polarity = polarity;
+    self->phase = phase;
+    self->steps = NULL;
+    self->len = 0;
+    self->alloc = 0;
+}
+
+void common_hal_busio_transaction_add(busio_transaction_obj_t *self, busio_transaction_step_kind_t kind,
+    mp_obj_t out_obj, mp_obj_t in_obj, uint32_t value) {
+    if (self->len == self->alloc) {
+        size_t alloc = self->alloc ? self->alloc * 2 : 4;
+        self->steps = m_renew(busio_transaction_step_t, self->steps, self->alloc, alloc);
+        self->alloc = alloc;
+    }
+    busio_transaction_step_t *step = &self->steps[self->len++];
+    step->kind = kind;
+    step->out_obj = out_obj;
+    step->in_obj = in_obj;
+    step->out = NULL;
+    step->out_len = 0;
+    step->in = NULL;
+    step->in_len = 0;
+    step->value = value;
+}
+
+void common_hal_busio_transaction_clear(busio_transaction_obj_t *self) {
+    m_del(busio_transaction_step_t, self->steps, self->alloc);
+    self->steps = NULL;
+    self->len = 0;
+    self->alloc = 0;
+}
+
+size_t common_hal_busio_transaction_get_len(busio_transaction_obj_t *self) {
+    return self->len;
+}
+
+// Other buses, such as bitbangio's, are used through their Python methods.
+#if CIRCUITPY_BUSIO_I2C
+static bool is_native_i2c(busio_transaction_obj_t *self) {
+    return mp_obj_is_type(self->bus, &busio_i2c_type);
+}
+#endif
+
+#if CIRCUITPY_BUSIO_SPI
+static bool is_native_spi(busio_transaction_obj_t *self) {
+    return mp_obj_is_type(self->bus, &busio_spi_type);
+}
+#endif
+
+static bool try_lock(busio_transaction_obj_t *self) {
+    // A native bus may have been deinited since the transaction was made.
+    #if CIRCUITPY_BUSIO_I2C
+    if (is_native_i2c(self)) {
+        busio_i2c_obj_t *i2c = MP_OBJ_TO_PTR(self->bus);
+        if (common_hal_busio_i2c_deinited(i2c)) {
+            raise_deinited_error();
+        }
+        return common_hal_busio_i2c_try_lock(i2c);
+    }
+    #endif
+    #if CIRCUITPY_BUSIO_SPI
+    if (is_native_spi(self)) {
+        busio_spi_obj_t *spi = MP_OBJ_TO_PTR(self->bus);
+        if (common_hal_busio_spi_deinited(spi)) {
+            raise_deinited_error();
+        }
+        return common_hal_busio_spi_try_lock(spi);
+    }
+    #endif
+    mp_obj_t dest[2];
+    mp_load_method(self->bus, MP_QSTR_try_lock, dest);
+    return mp_obj_is_true(mp_call_method_n_kw(0, 0, dest));
+}
+
+static void lock(busio_transaction_obj_t *self) {
+    while (!try_lock(self)) {
+        RUN_BACKGROUND_TASKS;
+        // Break out on ctrl-C.
+        if (mp_hal_is_interrupted()) {
+            mp_handle_pending(true);
+        }
+    }
+}
+
+static void unlock(busio_transaction_obj_t *self) {
+    #if CIRCUITPY_BUSIO_I2C
+    if (is_native_i2c(self)) {
+        common_hal_busio_i2c_unlock(MP_OBJ_TO_PTR(self->bus));
+        return;
+    }
+    #endif
+    #if CIRCUITPY_BUSIO_SPI
+    if (is_native_spi(self)) {
+        common_hal_busio_spi_unlock(MP_OBJ_TO_PTR(self->bus));
+        return;
+    }
+    #endif
+    mp_obj_t dest[2];
+    mp_load_method(self->bus, MP_QSTR_unlock, dest);
+    mp_call_method_n_kw(0, 0, dest);
+}
+
+static void configure(busio_transaction_obj_t *self) {
+    #if CIRCUITPY_BUSIO_SPI
+    if (is_native_spi(self)) {
+        if (!common_hal_busio_spi_configure(MP_OBJ_TO_PTR(self->bus), self->baudrate, self->polarity, self->phase, 8)) {
+            mp_raise_OSError(MP_EIO);
+        }
+        return;
+    }
+    #endif
+    mp_obj_t dest[10];
+    mp_load_method(self->bus, MP_QSTR_configure, dest);
+    dest[2] = MP_OBJ_NEW_QSTR(MP_QSTR_baudrate);
+    dest[3] = mp_obj_new_int_from_uint(self->baudrate);
+    dest[4] = MP_OBJ_NEW_QSTR(MP_QSTR_polarity);
+    dest[5] = MP_OBJ_NEW_SMALL_INT(self->polarity);
+    dest[6] = MP_OBJ_NEW_QSTR(MP_QSTR_phase);
+    dest[7] = MP_OBJ_NEW_SMALL_INT(self->phase);
+    dest[8] = MP_OBJ_NEW_QSTR(MP_QSTR_bits);
+    dest[9] = MP_OBJ_NEW_SMALL_INT(8);
+    mp_call_method_n_kw(0, 4, dest);
+}
+
+static void set_chip_select(busio_transaction_obj_t *self, bool active) {
+    if (self->chip_select == mp_const_none) {
+        return;
+    }
+    bool value = active ? self->cs_active_value : !self->cs_active_value;
+    #if CIRCUITPY_DIGITALIO
+    if (mp_obj_is_type(self->chip_select, &digitalio_digitalinout_type)) {
+        common_hal_digitalio_digitalinout_set_value(MP_OBJ_TO_PTR(self->chip_select), value);
+        return;
+    }
+    #endif
+    mp_store_attr(self->chip_select, MP_QSTR_value, mp_obj_new_bool(value));
+}
+
+static void call_bus(busio_transaction_obj_t *self, qstr method, size_t n_args, mp_obj_t arg0, mp_obj_t arg1, mp_obj_t arg2) {
+    mp_obj_t dest[5];
+    mp_load_method(self->bus, method, dest);
+    dest[2] = arg0;
+    dest[3] = arg1;
+    dest[4] = arg2;
+    mp_call_method_n_kw(n_args, 0, dest);
+}
+
+static void run_i2c_step(busio_transaction_obj_t *self, busio_transaction_step_t *step) {
+    #if CIRCUITPY_BUSIO_I2C
+    if (is_native_i2c(self)) {
+        busio_i2c_obj_t *i2c = MP_OBJ_TO_PTR(self->bus);
+        uint8_t status = 0;
+        switch (step->kind) {
+            case BUSIO_TRANSACTION_WRITE:
+                status = common_hal_busio_i2c_write(i2c, self->address, step->out, step->out_len);
+                break;
+            case BUSIO_TRANSACTION_READINTO:
+                status = common_hal_busio_i2c_read(i2c, self->address, step->in, step->in_len);
+                break;
+            case BUSIO_TRANSACTION_WRITE_THEN_READINTO:
+                status = common_hal_busio_i2c_write_read(i2c, self->address,
+                    (uint8_t *)step->out, step->out_len, step->in, step->in_len);
+                break;
+            default:
+                break;
+        }
+        if (status != 0) {
+            mp_raise_OSError(status);
+        }
+        return;
+    }
+    #endif
+    mp_obj_t address = MP_OBJ_NEW_SMALL_INT(self->address);
+    switch (step->kind) {
+        case BUSIO_TRANSACTION_WRITE:
+            call_bus(self, MP_QSTR_writeto, 2, address, step->out_obj, MP_OBJ_NULL);
+            break;
+        case BUSIO_TRANSACTION_READINTO:
+            call_bus(self, MP_QSTR_readfrom_into, 2, address, step->in_obj, MP_OBJ_NULL);
+            break;
+        case BUSIO_TRANSACTION_WRITE_THEN_READINTO:
+            call_bus(self, MP_QSTR_writeto_then_readfrom, 3, address, step->out_obj, step->in_obj);
+            break;
+        default:
+            break;
+    }
+}
+
+static void run_spi_step(busio_transaction_obj_t *self, busio_transaction_step_t *step) {
+    #if CIRCUITPY_BUSIO_SPI
+    if (is_native_spi(self)) {
+        busio_spi_obj_t *spi = MP_OBJ_TO_PTR(self->bus);
+        bool ok = true;
+        if (step->kind == BUSIO_TRANSACTION_WRITE || step->kind == BUSIO_TRANSACTION_WRITE_THEN_READINTO) {
+            ok = common_hal_busio_spi_write(spi, step->out, step->out_len);
+        }
+        if (ok && step->kind == BUSIO_TRANSACTION_READINTO) {
+            ok = common_hal_busio_spi_read(spi, step->in, step->in_len, step->value);
+        }
+        if (ok && step->kind == BUSIO_TRANSACTION_WRITE_THEN_READINTO) {
+            ok = common_hal_busio_spi_read(spi, step->in, step->in_len, 0);
+        }
+        if (!ok) {
+            mp_raise_OSError(MP_EIO);
+        }
+        return;
+    }
+    #endif
+    if (step->kind == BUSIO_TRANSACTION_WRITE || step->kind == BUSIO_TRANSACTION_WRITE_THEN_READINTO) {
+        call_bus(self, MP_QSTR_write, 1, step->out_obj, MP_OBJ_NULL, MP_OBJ_NULL);
+    }
+    if (step->kind == BUSIO_TRANSACTION_READINTO || step->kind == BUSIO_TRANSACTION_WRITE_THEN_READINTO) {
+        mp_obj_t dest[5];
+        mp_load_method(self->bus, MP_QSTR_readinto, dest);
+        dest[2] = step->in_obj;
+        dest[3] = MP_OBJ_NEW_QSTR(MP_QSTR_write_value);
+        dest[4] = MP_OBJ_NEW_SMALL_INT(step->kind == BUSIO_TRANSACTION_READINTO ? step->value : 0);
+        mp_call_method_n_kw(1, 1, dest);
+    }
+}
+
+static void run_steps(busio_transaction_obj_t *self) {
+    for (size_t i = 0; i < self->len; i++) {
+        busio_transaction_step_t *step = &self->steps[i];
+        if (step->kind == BUSIO_TRANSACTION_DELAY) {
+            mp_hal_delay_us(step->value);
+        } else if (self->address >= 0) {
+            run_i2c_step(self, step);
+        } else {
+            // Each SPI step is framed by its own chip select.
+            set_chip_select(self, true);
+            run_spi_step(self, step);
+            set_chip_select(self, false);
+        }
+    }
+}
+
+void common_hal_busio_transaction_run(busio_transaction_obj_t *self) {
+    // Look up the buffers before taking the bus, so a bad buffer leaves it alone.
+    for (size_t i = 0; i < self->len; i++) {
+        busio_transaction_step_t *step = &self->steps[i];
+        mp_buffer_info_t bufinfo;
+        if (step->out_obj != MP_OBJ_NULL) {
+            mp_get_buffer_raise(step->out_obj, &bufinfo, MP_BUFFER_READ);
+            step->out = bufinfo.buf;
+            step->out_len = bufinfo.len;
+        }
+        if (step->in_obj != MP_OBJ_NULL) {
+            mp_get_buffer_raise(step->in_obj, &bufinfo, MP_BUFFER_WRITE);
+            step->in = bufinfo.buf;
+            step->in_len = bufinfo.len;
+        }
+    }
+
+    lock(self);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        if (self->address < 0) {
+            configure(self);
+        }
+        run_steps(self);
+        nlr_pop();
+    } else {
+        // Releasing chip select may raise too, but the bus must still be
+        // unlocked and the first exception is the one to report.
+        if (self->address < 0) {
+            nlr_buf_t cs_nlr;
+            if (nlr_push(&cs_nlr) == 0) {
+                set_chip_select(self, false);
+                nlr_pop();
+            }
+        }
+        unlock(self);
+        nlr_jump(nlr.ret_val);
+    }
+    unlock(self);
+}
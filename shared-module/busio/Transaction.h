@@ -0,0 +1,48 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+typedef enum {
+    BUSIO_TRANSACTION_WRITE,
+    BUSIO_TRANSACTION_READINTO,
+    BUSIO_TRANSACTION_WRITE_THEN_READINTO,
+    BUSIO_TRANSACTION_DELAY,
+} busio_transaction_step_kind_t;
+
+typedef struct {
+    mp_obj_t out_obj;
+    mp_obj_t in_obj;
+    // Filled in from out_obj and in_obj at the start of every run, because
+    // a buffer such as a bytearray may have moved since it was recorded.
+    const uint8_t *out;
+    size_t out_len;
+    uint8_t *in;
+    size_t in_len;
+    // Microseconds for a delay, or the byte clocked out by an SPI read.
+    uint32_t value;
+    busio_transaction_step_kind_t kind;
+} busio_transaction_step_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t bus;
+    mp_obj_t chip_select;
+    busio_transaction_step_t *steps;
+    size_t len;
+    size_t alloc;
+    uint32_t baudrate;
+    // The I2C device address, or -1 for an SPI bus.
+    int16_t address;
+    uint8_t polarity;
+    uint8_t phase;
+    bool cs_active_value;
+} busio_transaction_obj_t;
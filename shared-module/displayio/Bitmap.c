@@ -32,6 +32,7 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->data_alloc = false;
     if (!data) {
         data = m_malloc(self->stride * height * sizeof(uint32_t));
+        GC_SET_ALLOC_KIND(data, DISPLAY);
         self->data_alloc = true;
     }
     self->data = data;
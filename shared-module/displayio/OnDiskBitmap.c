@@ -19,7 +19,7 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, bool cache) {
     // Load the wave
     self->file = file;
     uint16_t bmp_header[69];
@@ -126,6 +126,65 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    // Set up the row cache when asked for. This is allocated now rather than
+    // on first use because pixels are fetched during background display
+    // refreshes.
+    self->cache = NULL;
+    self->cache_bands = 0;
+    size_t data_size = (size_t)self->stride * self->height;
+    if (cache && data_size <= CIRCUITPY_ONDISKBITMAP_CACHE_SIZE) {
+        // The whole image fits, so keep it all in one band.
+        self->cache_bands = 1;
+        self->cache_band_rows = self->height;
+    } else if (cache && self->stride <= CIRCUITPY_ONDISKBITMAP_CACHE_SIZE / DISPLAYIO_ONDISKBITMAP_CACHE_BANDS) {
+        self->cache_bands = DISPLAYIO_ONDISKBITMAP_CACHE_BANDS;
+        self->cache_band_rows = CIRCUITPY_ONDISKBITMAP_CACHE_SIZE / DISPLAYIO_ONDISKBITMAP_CACHE_BANDS / self->stride;
+    }
+    if (self->cache_bands > 0) {
+        self->cache = m_malloc_maybe((size_t)self->cache_bands * self->cache_band_rows * self->stride);
+        if (self->cache == NULL) {
+            self->cache_bands = 0;
+        }
+    }
+    for (size_t i = 0; i < DISPLAYIO_ONDISKBITMAP_CACHE_BANDS; i++) {
+        self->cache_band_start[i] = UINT16_MAX;
+    }
+    self->cache_last_band = 0;
+}
+
+// Returns the cached copy of the given file row, reading it and the rows
+// before it in one go if needed. Rows are stored bottom up, so the rows
+// before it in the file are the ones below it on the display, which is the
+// order a refresh asks for them in.
+static const uint8_t *cached_row(displayio_ondiskbitmap_t *self, uint16_t file_row) {
+    uint8_t band = self->cache_last_band;
+    uint16_t start = self->cache_band_start[band];
+    if (start != UINT16_MAX && file_row >= start && file_row - start < self->cache_band_rows) {
+        return self->cache + ((size_t)band * self->cache_band_rows + file_row - start) * self->stride;
+    }
+    for (band = 0; band < self->cache_bands; band++) {
+        start = self->cache_band_start[band];
+        if (start != UINT16_MAX && file_row >= start && file_row - start < self->cache_band_rows) {
+            self->cache_last_band = band;
+            return self->cache + ((size_t)band * self->cache_band_rows + file_row - start) * self->stride;
+        }
+    }
+
+    // Replace the band that wasn't used last.
+    band = (self->cache_last_band + 1) % self->cache_bands;
+    start = file_row + 1 >= self->cache_band_rows ? file_row + 1 - self->cache_band_rows : 0;
+    uint16_t rows = MIN(self->cache_band_rows, self->height - start);
+    uint8_t *dest = self->cache + (size_t)band * self->cache_band_rows * self->stride;
+    UINT bytes_read;
+    self->cache_band_start[band] = UINT16_MAX;
+    if (f_lseek(&self->file->fp, self->data_offset + (uint32_t)start * self->stride) != FR_OK ||
+        f_read(&self->file->fp, dest, (size_t)rows * self->stride, &bytes_read) != FR_OK ||
+        bytes_read != (size_t)rows * self->stride) {
+        return NULL;
+    }
+    self->cache_band_start[band] = start;
+    self->cache_last_band = band;
+    return dest + (size_t)(file_row - start) * self->stride;
 }
 
 
@@ -139,15 +198,24 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
     if (pixels_per_byte == 0) {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+        location = x * bytes_per_pixel;
     } else {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
+        location = x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result = FR_OK;
+    const uint8_t *row = NULL;
+    if (self->cache_bands > 0) {
+        row = cached_row(self, self->height - y - 1);
+    }
+    if (row != NULL) {
+        memcpy(&pixel_data, row + location, bytes_per_pixel);
+    } else {
+        // Without a cache, rely on the filesystem's sector cache.
+        f_lseek(&self->file->fp, self->data_offset + (self->height - y - 1) * self->stride + location);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
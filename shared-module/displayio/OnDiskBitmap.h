@@ -13,6 +13,15 @@
 
 #include "extmod/vfs_fat.h"
 
+// Bytes of file rows an OnDiskBitmap made with cache=True keeps in RAM. Images
+// whose pixel data fits are read once and kept; larger ones are read a band of
+// rows at a time.
+#ifndef CIRCUITPY_ONDISKBITMAP_CACHE_SIZE
+#define CIRCUITPY_ONDISKBITMAP_CACHE_SIZE (4096)
+#endif
+
+#define DISPLAYIO_ONDISKBITMAP_CACHE_BANDS (2)
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -28,6 +37,12 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    uint8_t *cache;
+    uint16_t cache_band_rows;
+    // First file row held by each band, or UINT16_MAX when the band is empty.
+    uint16_t cache_band_start[DISPLAYIO_ONDISKBITMAP_CACHE_BANDS];
+    uint8_t cache_bands;
+    uint8_t cache_last_band;
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
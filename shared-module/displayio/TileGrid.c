@@ -6,6 +6,7 @@
 
 #include "shared-bindings/displayio/TileGrid.h"
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
@@ -28,6 +29,7 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
         self->inline_tiles = true;
     } else {
         self->tiles = (uint8_t *)m_malloc(total_tiles);
+        GC_SET_ALLOC_KIND(self->tiles, DISPLAY);
         for (uint32_t i = 0; i < total_tiles; i++) {
             self->tiles[i] = default_tile;
         }
@@ -253,6 +255,10 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     if (tiles == NULL) {
         return;
     }
+    // Rewriting a cell with the glyph it already shows doesn't need a redraw.
+    if (tiles[y * self->width_in_tiles + x] == tile_index) {
+        return;
+    }
     tiles[y * self->width_in_tiles + x] = tile_index;
     displayio_area_t temp_area;
     displayio_area_t *tile_area;
@@ -361,6 +367,36 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Largest bitmap depth whose palette is expanded up front by fill_area.
+#define EXPANDED_PALETTE_MAX_BITS (4)
+
+// Text and other palette-indexed tiles with few colors can be shaded once per
+// palette entry instead of once per pixel, as long as the result doesn't
+// depend on pixel position.
+static bool _can_expand_palette(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace) {
+    if (!mp_obj_is_type(self->bitmap, &displayio_bitmap_type) ||
+        !mp_obj_is_type(self->pixel_shader, &displayio_palette_type) ||
+        (colorspace->depth != 8 && colorspace->depth != 16 && colorspace->depth != 32)) {
+        return false;
+    }
+    displayio_bitmap_t *bitmap = self->bitmap;
+    displayio_palette_t *palette = self->pixel_shader;
+    return bitmap->bits_per_value <= EXPANDED_PALETTE_MAX_BITS && !palette->dither;
+}
+
+static void _expand_palette(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace,
+    uint8_t bits_per_value, displayio_output_pixel_t *expanded) {
+    displayio_input_pixel_t input_pixel = { 0 };
+    for (uint32_t i = 0; i < (1u << bits_per_value); i++) {
+        expanded[i].pixel = 0;
+        expanded[i].opaque = i < palette->color_count;
+        if (expanded[i].opaque) {
+            input_pixel.pixel = i;
+            displayio_palette_get_color(palette, colorspace, &input_pixel, &expanded[i]);
+        }
+    }
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -448,6 +484,56 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    if (_can_expand_palette(self, colorspace)) {
+        displayio_bitmap_t *bitmap = self->bitmap;
+        displayio_output_pixel_t expanded[1 << EXPANDED_PALETTE_MAX_BITS];
+        _expand_palette(self->pixel_shader, colorspace, bitmap->bits_per_value, expanded);
+
+        uint8_t values_per_byte = 8 / bitmap->bits_per_value;
+        uint16_t scale = self->absolute_transform->scale;
+        uint16_t scaled_tile_width = self->tile_width * scale;
+        for (int16_t y = start_y; y < end_y; ++y) {
+            int16_t row_start = start + (y - start_y + y_shift) * y_stride; // in pixels
+            int16_t local_y = y / scale;
+            uint16_t tile_row = ((local_y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+            uint16_t tile_y = local_y % self->tile_height;
+            int16_t x = start_x;
+            // Walk the row one tile at a time so each tile is looked up once.
+            while (x < end_x) {
+                uint16_t column = x / scaled_tile_width;
+                uint8_t tile = tiles[tile_row + (column + self->top_left_x) % self->width_in_tiles];
+                const uint8_t *bitmap_row = (const uint8_t *)(bitmap->data +
+                    ((tile / self->bitmap_width_in_tiles) * self->tile_height + tile_y) * bitmap->stride);
+                // Bitmap x of the tile's left edge, less the tile's position in the grid.
+                int16_t tile_x_base = (tile % self->bitmap_width_in_tiles - column) * self->tile_width;
+                int16_t run_end = MIN(end_x, (column + 1) * scaled_tile_width);
+                for (; x < run_end; ++x) {
+                    int16_t offset = row_start + (x - start_x + x_shift) * x_stride; // in pixels
+                    if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                        continue;
+                    }
+                    uint16_t tile_x = tile_x_base + x / scale;
+                    uint8_t bits = bitmap_row[tile_x >> bitmap->x_shift];
+                    uint8_t bit_position = (values_per_byte - (tile_x & bitmap->x_mask) - 1) * bitmap->bits_per_value;
+                    const displayio_output_pixel_t *output = &expanded[(bits >> bit_position) & bitmap->bitmask];
+                    if (!output->opaque) {
+                        full_coverage = false;
+                        continue;
+                    }
+                    mask[offset / 32] |= 1 << (offset % 32);
+                    if (colorspace->depth == 16) {
+                        *(((uint16_t *)buffer) + offset) = output->pixel;
+                    } else if (colorspace->depth == 32) {
+                        *(((uint32_t *)buffer) + offset) = output->pixel;
+                    } else {
+                        *(((uint8_t *)buffer) + offset) = output->pixel;
+                    }
+                }
+            }
+        }
+        return full_coverage;
+    }
+
     uint8_t pixels_per_byte = 8 / colorspace->depth;
 
     displayio_input_pixel_t input_pixel;
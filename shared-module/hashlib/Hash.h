@@ -7,11 +7,21 @@
 #pragma once
 
 #include "mbedtls/sha1.h"
+#if CIRCUITPY_HASHLIB_SHA256_SOFTWARE
+#include "lib/crypto-algorithms/sha256.h"
+#else
+#include "mbedtls/sha256.h"
+#endif
 
 typedef struct {
     mp_obj_base_t base;
     union {
         mbedtls_sha1_context sha1;
+        #if CIRCUITPY_HASHLIB_SHA256_SOFTWARE
+        CRYAL_SHA256_CTX sha256;
+        #else
+        mbedtls_sha256_context sha256;
+        #endif
     };
     // Of MBEDTLS_SSL_HASH_*
     uint8_t hash_type;
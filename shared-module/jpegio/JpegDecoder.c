@@ -204,7 +204,22 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     self->skip_dest_index_none = skip_dest_index_none;
 
     self->dest = bitmap;
-    JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
+
+    // Only the MCUs that land in the destination need to be transformed and
+    // output; the rest of the image is huffman decoded and discarded, and
+    // decoding stops after the last row that is needed.
+    int right = MIN(lim->x2, lim->x1 + bitmap->width - x) - 1;
+    int bottom = MIN(lim->y2, lim->y1 + bitmap->height - y) - 1;
+    JRESULT result = JDR_OK;
+    if (right >= lim->x1 && bottom >= lim->y1) {
+        JRECT roi = {
+            .left = lim->x1,
+            .right = right,
+            .top = lim->y1,
+            .bottom = bottom,
+        };
+        result = jd_decomp_rect(&self->decoder, bitmap_output, scale, &roi);
+    }
     common_hal_jpegio_jpegdecoder_close(self);
     if (result != JDR_INTR) {
         check_jresult(result);
@@ -0,0 +1,134 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "shared-bindings/memorymonitor/AllocationProfiler.h"
+
+#include "py/gc.h"
+#include "py/mpstate.h"
+#include "py/objfun.h"
+#include "py/runtime.h"
+
+static memorymonitor_allocationprofiler_site_t *get_site(memorymonitor_allocationprofiler_obj_t *self, size_t index) {
+    return (memorymonitor_allocationprofiler_site_t *)(self->sites + index * self->site_size);
+}
+
+void common_hal_memorymonitor_allocationprofiler_construct(memorymonitor_allocationprofiler_obj_t *self,
+    uint32_t every, size_t min_size, uint16_t max_sites, uint8_t depth) {
+    self->every = every;
+    self->min_size = min_size;
+    self->max_sites = max_sites;
+    self->depth = depth;
+    self->site_size = sizeof(memorymonitor_allocationprofiler_site_t) + depth * sizeof(memorymonitor_allocationprofiler_frame_t);
+    self->sites = m_malloc(max_sites * self->site_size);
+    common_hal_memorymonitor_allocationprofiler_clear(self);
+}
+
+void common_hal_memorymonitor_allocationprofiler_pause(memorymonitor_allocationprofiler_obj_t *self) {
+    if (MP_STATE_VM(active_allocationprofiler) == MP_OBJ_FROM_PTR(self)) {
+        MP_STATE_VM(active_allocationprofiler) = NULL;
+    }
+}
+
+void common_hal_memorymonitor_allocationprofiler_resume(memorymonitor_allocationprofiler_obj_t *self) {
+    if (MP_STATE_VM(active_allocationprofiler) != NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+    MP_STATE_VM(active_allocationprofiler) = MP_OBJ_FROM_PTR(self);
+}
+
+bool common_hal_memorymonitor_allocationprofiler_get_running(memorymonitor_allocationprofiler_obj_t *self) {
+    return MP_STATE_VM(active_allocationprofiler) == MP_OBJ_FROM_PTR(self);
+}
+
+void common_hal_memorymonitor_allocationprofiler_clear(memorymonitor_allocationprofiler_obj_t *self) {
+    memset(self->sites, 0, self->max_sites * self->site_size);
+    self->used_sites = 0;
+    self->dropped = 0;
+    self->countdown = self->every;
+}
+
+uint32_t common_hal_memorymonitor_allocationprofiler_get_dropped(memorymonitor_allocationprofiler_obj_t *self) {
+    return self->dropped;
+}
+
+size_t common_hal_memorymonitor_allocationprofiler_get_site_count(memorymonitor_allocationprofiler_obj_t *self) {
+    return self->used_sites;
+}
+
+size_t common_hal_memorymonitor_allocationprofiler_get_site(memorymonitor_allocationprofiler_obj_t *self,
+    size_t index, uint32_t *count, uint32_t *bytes, memorymonitor_allocationprofiler_location_t *stack) {
+    memorymonitor_allocationprofiler_site_t *site = get_site(self, index);
+    *count = site->count;
+    *bytes = site->bytes;
+    size_t depth = 0;
+    while (depth < self->depth && site->frames[depth].ip != NULL) {
+        depth++;
+    }
+    // Return the stack outermost first.
+    for (size_t i = 0; i < depth; i++) {
+        memorymonitor_allocationprofiler_frame_t *frame = &site->frames[depth - 1 - i];
+        stack[i].line = mp_bytecode_get_location(frame->bytecode, frame->context, frame->ip,
+            &stack[i].source_file, &stack[i].block_name);
+    }
+    return depth;
+}
+
+// Called from the gc after every allocation while memorymonitor is enabled.
+// Must not allocate or raise.
+void memorymonitor_allocationprofiler_track_allocation(size_t block_count) {
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(active_allocationprofiler));
+    if (self == NULL) {
+        return;
+    }
+    size_t n_bytes = block_count * MICROPY_BYTES_PER_GC_BLOCK;
+    bool sample = self->min_size != 0 && n_bytes >= self->min_size;
+    if (self->every != 0 && --self->countdown == 0) {
+        self->countdown = self->every;
+        sample = true;
+    }
+    if (!sample) {
+        return;
+    }
+
+    memorymonitor_allocationprofiler_frame_t stack[ALLOCATION_PROFILER_MAX_DEPTH] = {0};
+    size_t depth = 0;
+    for (const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+         code_state != NULL && depth < self->depth;
+         code_state = code_state->prev_state) {
+        stack[depth].bytecode = code_state->fun_bc->bytecode;
+        stack[depth].context = code_state->fun_bc->context;
+        stack[depth].ip = code_state->ip;
+        depth++;
+    }
+
+    size_t stack_size = self->depth * sizeof(memorymonitor_allocationprofiler_frame_t);
+    memorymonitor_allocationprofiler_site_t *site = NULL;
+    for (size_t i = 0; i < self->used_sites; i++) {
+        memorymonitor_allocationprofiler_site_t *s = get_site(self, i);
+        if (memcmp(s->frames, stack, stack_size) == 0) {
+            site = s;
+            break;
+        }
+    }
+    if (site == NULL) {
+        if (self->used_sites == self->max_sites) {
+            self->dropped++;
+            return;
+        }
+        site = get_site(self, self->used_sites++);
+        memcpy(site->frames, stack, stack_size);
+    }
+    site->count++;
+    site->bytes += n_bytes;
+}
+
+void memorymonitor_allocationprofiler_reset(void) {
+    MP_STATE_VM(active_allocationprofiler) = NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t active_allocationprofiler);
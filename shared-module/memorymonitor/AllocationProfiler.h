@@ -0,0 +1,49 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/bc.h"
+#include "py/obj.h"
+
+// The deepest call stack that can be recorded for an allocation.
+#define ALLOCATION_PROFILER_MAX_DEPTH (8)
+
+// One level of the Python call stack. Line numbers are only worked out from
+// ip when the results are read, so recording a sample stays cheap.
+typedef struct {
+    const byte *bytecode;
+    const mp_module_context_t *context;
+    const byte *ip;
+} memorymonitor_allocationprofiler_frame_t;
+
+// An allocation site: a distinct call stack and the allocations sampled there.
+// Followed by depth frames, innermost first. Unused frames are all zero.
+typedef struct {
+    uint32_t count;
+    uint32_t bytes;
+    memorymonitor_allocationprofiler_frame_t frames[];
+} memorymonitor_allocationprofiler_site_t;
+
+typedef struct _memorymonitor_allocationprofiler_obj_t {
+    mp_obj_base_t base;
+    // max_sites entries of site_size bytes each.
+    uint8_t *sites;
+    size_t site_size;
+    size_t min_size;
+    uint32_t every;
+    uint32_t countdown;
+    uint32_t dropped;
+    uint16_t max_sites;
+    uint16_t used_sites;
+    uint8_t depth;
+} memorymonitor_allocationprofiler_obj_t;
+
+void memorymonitor_allocationprofiler_track_allocation(size_t block_count);
+void memorymonitor_allocationprofiler_reset(void);
@@ -6,14 +6,17 @@
 
 #include "shared-module/memorymonitor/__init__.h"
 #include "shared-module/memorymonitor/AllocationAlarm.h"
+#include "shared-module/memorymonitor/AllocationProfiler.h"
 #include "shared-module/memorymonitor/AllocationSize.h"
 
 void memorymonitor_track_allocation(size_t block_count) {
     memorymonitor_allocationalarms_allocation(block_count);
     memorymonitor_allocationsizes_track_allocation(block_count);
+    memorymonitor_allocationprofiler_track_allocation(block_count);
 }
 
 void memorymonitor_reset(void) {
     memorymonitor_allocationalarms_reset();
     memorymonitor_allocationsizes_reset();
+    memorymonitor_allocationprofiler_reset();
 }
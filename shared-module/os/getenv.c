@@ -27,48 +27,126 @@
 
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
-typedef FIL file_arg;
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+#include "extmod/vfs_lfs.h"
+#endif
+
+// The unix port opens settings.toml through VfsFat even when testing littlefs.
+#if CIRCUITPY_FILESYSTEM_LITTLEFS && !defined(UNIX)
+#define GETENV_LITTLEFS (1)
+#else
+#define GETENV_LITTLEFS (0)
+#endif
+
+// Reads go through a small buffer rather than asking FatFs for one byte at a time.
+#define GETENV_READ_BUFFER_SIZE (64)
+
+typedef struct {
+    #if GETENV_LITTLEFS
+    lfs2_file_t file;
+    struct lfs2_file_config cfg;
+    uint8_t cache[CIRCUITPY_LITTLEFS_CACHE_SIZE];
+    #else
+    FIL fp;
+    #endif
+    uint8_t pos;
+    uint8_t len;
+    uint8_t buf[GETENV_READ_BUFFER_SIZE];
+} file_arg;
+
 static bool open_file(const char *name, file_arg *active_file) {
+    active_file->pos = active_file->len = 0;
     #if defined(UNIX)
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
         mp_obj_t file_obj = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), mp_obj_new_str(name, strlen(name)), MP_ROM_QSTR(MP_QSTR_rb));
         mp_arg_validate_type(file_obj, &mp_type_vfs_fat_fileio, MP_QSTR_file);
         pyb_file_obj_t *file = MP_OBJ_TO_PTR(file_obj);
-        *active_file = file->fp;
+        active_file->fp = file->fp;
         nlr_pop();
         return true;
     } else {
         return false;
     }
+    #elif GETENV_LITTLEFS
+    if (!filesystem_present()) {
+        return false;
+    }
+    memset(&active_file->cfg, 0, sizeof(active_file->cfg));
+    active_file->cfg.buffer = active_file->cache;
+    return lfs2_file_opencfg(mp_vfs_lfs2_native_lfs(), &active_file->file, name, LFS2_O_RDONLY, &active_file->cfg) == 0;
     #else
     fs_user_mount_t *fs_mount = filesystem_circuitpy();
     if (fs_mount == NULL) {
         return false;
     }
     FATFS *fatfs = &fs_mount->fatfs;
-    FRESULT result = f_open(fatfs, active_file, name, FA_READ);
+    FRESULT result = f_open(fatfs, &active_file->fp, name, FA_READ);
     return result == FR_OK;
     #endif
 }
 static void close_file(file_arg *active_file) {
-    // nothing
+    #if GETENV_LITTLEFS
+    // littlefs keeps a list of open files, and this one is on the stack.
+    lfs2_file_close(mp_vfs_lfs2_native_lfs(), &active_file->file);
+    #endif
 }
 static bool is_eof(file_arg *active_file) {
-    return f_eof(active_file) || f_error(active_file);
+    #if GETENV_LITTLEFS
+    lfs2_t *lfs = mp_vfs_lfs2_native_lfs();
+    return active_file->pos == active_file->len &&
+           lfs2_file_tell(lfs, &active_file->file) >= lfs2_file_size(lfs, &active_file->file);
+    #else
+    return active_file->pos == active_file->len && (f_eof(&active_file->fp) || f_error(&active_file->fp));
+    #endif
 }
 
 // Return 0 if there is no next character (EOF).
-static uint8_t get_next_byte(FIL *active_file) {
-    uint8_t character = 0;
-    UINT quantity_read;
-    // If there's an error or quantity_read is 0, character will remain 0.
-    f_read(active_file, &character, 1, &quantity_read);
-    return character;
+static uint8_t get_next_byte(file_arg *active_file) {
+    if (active_file->pos == active_file->len) {
+        active_file->pos = 0;
+        #if GETENV_LITTLEFS
+        lfs2_ssize_t quantity_read = lfs2_file_read(mp_vfs_lfs2_native_lfs(), &active_file->file, active_file->buf, sizeof(active_file->buf));
+        if (quantity_read < 0) {
+            quantity_read = 0;
+        }
+        #else
+        UINT quantity_read;
+        // If there's an error, quantity_read is 0.
+        if (f_read(&active_file->fp, active_file->buf, sizeof(active_file->buf), &quantity_read) != FR_OK) {
+            quantity_read = 0;
+        }
+        #endif
+        active_file->len = quantity_read;
+        if (quantity_read == 0) {
+            return 0;
+        }
+    }
+    return active_file->buf[active_file->pos++];
+}
+#if GETENV_LITTLEFS
+static void seek_to(file_arg *active_file, FSIZE_t offset) {
+    lfs2_file_seek(mp_vfs_lfs2_native_lfs(), &active_file->file, offset, LFS2_SEEK_SET);
+    active_file->pos = active_file->len = 0;
+}
+static FSIZE_t tell(file_arg *active_file) {
+    return lfs2_file_tell(mp_vfs_lfs2_native_lfs(), &active_file->file) - (active_file->len - active_file->pos);
 }
 static void seek_eof(file_arg *active_file) {
-    f_lseek(active_file, f_size(active_file));
+    seek_to(active_file, lfs2_file_size(mp_vfs_lfs2_native_lfs(), &active_file->file));
 }
+#else
+static void seek_to(file_arg *active_file, FSIZE_t offset) {
+    f_lseek(&active_file->fp, offset);
+    active_file->pos = active_file->len = 0;
+}
+static FSIZE_t tell(file_arg *active_file) {
+    return f_tell(&active_file->fp) - (active_file->len - active_file->pos);
+}
+static void seek_eof(file_arg *active_file) {
+    seek_to(active_file, f_size(&active_file->fp));
+}
+#endif
 
 // For a fixed buffer, record the required size rather than throwing
 static void vstr_add_byte_nonstd(vstr_t *vstr, byte b) {
@@ -151,6 +229,127 @@ static bool key_matches(file_arg *active_file, const char *key) {
     return true;
 }
 
+#ifndef CIRCUITPY_OS_GETENV_INDEX_SIZE
+// The index is only checked against FAT, so littlefs scans the file each time.
+#if GETENV_LITTLEFS
+#define CIRCUITPY_OS_GETENV_INDEX_SIZE (0)
+#else
+#define CIRCUITPY_OS_GETENV_INDEX_SIZE (32)
+#endif
+#endif
+
+#if CIRCUITPY_OS_GETENV_INDEX_SIZE > 0
+// An index of the lines of settings.toml that assign a key, so that lookups
+// seek straight to the right line instead of scanning the whole file. It
+// lives in static memory because settings are read before the VM heap exists.
+// Values are still read from the file, so the index only needs a hash of each
+// key and the offset of its line.
+//
+// The index is rebuilt when the file is a different object or size, or
+// anything has been written to a FAT filesystem, since it was built.
+typedef struct {
+    FATFS *fs;
+    WORD fs_id;
+    DWORD sclust;
+    FSIZE_t size;
+    uint32_t write_count;
+    // Where to continue scanning for keys when the index is full.
+    FSIZE_t resume;
+    uint16_t count;
+    bool valid;
+    bool complete;
+    uint16_t hash[CIRCUITPY_OS_GETENV_INDEX_SIZE];
+    FSIZE_t offset[CIRCUITPY_OS_GETENV_INDEX_SIZE];
+} getenv_index_t;
+
+static getenv_index_t getenv_index;
+
+static uint16_t hash_step(uint16_t hash, uint8_t character) {
+    return (hash * 33) ^ character;
+}
+
+static uint16_t hash_key(const char *key) {
+    uint16_t hash = 5381;
+    while (*key) {
+        hash = hash_step(hash, *key++);
+    }
+    return hash;
+}
+
+// The index records each line as the run of characters before the first
+// whitespace or "=". A key that could match a line some other way, or match a
+// comment, is looked up with a plain scan.
+static bool key_is_indexable(const char *key) {
+    if (*key == 0 || *key == '#' || *key == '[') {
+        return false;
+    }
+    for (; *key; key++) {
+        if (*key == '=' || unichar_isspace(*key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool index_is_current(file_arg *active_file) {
+    FFOBJID *obj = &active_file->fp.obj;
+    return getenv_index.valid &&
+           getenv_index.fs == obj->fs &&
+           getenv_index.fs_id == obj->id &&
+           getenv_index.sclust == obj->sclust &&
+           getenv_index.size == obj->objsize &&
+           getenv_index.write_count == fatfs_sector_write_count;
+}
+
+static void build_index(file_arg *active_file) {
+    getenv_index_t *index = &getenv_index;
+    FFOBJID *obj = &active_file->fp.obj;
+    index->fs = obj->fs;
+    index->fs_id = obj->id;
+    index->sclust = obj->sclust;
+    index->size = obj->objsize;
+    index->write_count = fatfs_sector_write_count;
+    index->count = 0;
+    index->complete = true;
+    index->valid = true;
+
+    seek_to(active_file, 0);
+    while (!is_eof(active_file)) {
+        FSIZE_t line = tell(active_file);
+        uint8_t character = consume_whitespace(active_file);
+        if (character == '[' || character == 0) {
+            // Keys aren't looked up past the first table.
+            break;
+        }
+        if (character == '#') {
+            next_line(active_file);
+            continue;
+        }
+        uint16_t hash = 5381;
+        while (character != 0 && character != '=' && !unichar_isspace(character)) {
+            hash = hash_step(hash, character);
+            character = get_next_byte(active_file);
+        }
+        if (character != '\n' && unichar_isspace(character)) {
+            character = consume_whitespace(active_file);
+        }
+        if (character == '=') {
+            if (index->count == CIRCUITPY_OS_GETENV_INDEX_SIZE) {
+                index->complete = false;
+                index->resume = line;
+                break;
+            }
+            index->hash[index->count] = hash;
+            index->offset[index->count] = line;
+            index->count++;
+        }
+        if (character != '\n' && character != 0) {
+            next_line(active_file);
+        }
+    }
+}
+#endif
+
 static os_getenv_err_t read_unicode_escape(file_arg *active_file, int sz, vstr_t *buf) {
     char hex_buf[sz + 1];
     for (int i = 0; i < sz; i++) {
@@ -272,12 +471,37 @@ static os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t
     }
 
     os_getenv_err_t result = GETENV_ERR_NOT_FOUND;
+    #if CIRCUITPY_OS_GETENV_INDEX_SIZE > 0
+    if (strcmp(path, GETENV_PATH) == 0 && key_is_indexable(key)) {
+        if (!index_is_current(&active_file)) {
+            build_index(&active_file);
+        }
+        uint16_t hash = hash_key(key);
+        for (size_t i = 0; i < getenv_index.count; i++) {
+            if (getenv_index.hash[i] != hash) {
+                continue;
+            }
+            seek_to(&active_file, getenv_index.offset[i]);
+            if (key_matches(&active_file, key)) {
+                result = read_value(&active_file, buf, quoted);
+                goto done;
+            }
+        }
+        if (getenv_index.complete) {
+            goto done;
+        }
+        seek_to(&active_file, getenv_index.resume);
+    }
+    #endif
     while (!is_eof(&active_file)) {
         if (key_matches(&active_file, key)) {
             result = read_value(&active_file, buf, quoted);
             break;
         }
     }
+    #if CIRCUITPY_OS_GETENV_INDEX_SIZE > 0
+done:
+    #endif
     close_file(&active_file);
     return result;
 }
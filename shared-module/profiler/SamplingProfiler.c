@@ -0,0 +1,182 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "shared-bindings/profiler/SamplingProfiler.h"
+#include "shared-module/profiler/__init__.h"
+
+#include "py/mpstate.h"
+#include "py/objfun.h"
+#include "py/runtime.h"
+
+static profiler_samplingprofiler_frame_t *get_sample(profiler_samplingprofiler_obj_t *self, size_t index) {
+    return self->samples + index * self->depth;
+}
+
+static size_t stored_samples(profiler_samplingprofiler_obj_t *self) {
+    return MIN(self->sample_count, self->max_samples);
+}
+
+void common_hal_profiler_samplingprofiler_construct(profiler_samplingprofiler_obj_t *self,
+    uint32_t interval_us, uint16_t max_samples, uint8_t depth) {
+    self->interval_us = interval_us;
+    self->max_samples = max_samples;
+    self->depth = depth;
+    self->samples = m_malloc(max_samples * depth * sizeof(profiler_samplingprofiler_frame_t));
+    self->resolved = m_malloc(max_samples * sizeof(bool));
+    self->running = false;
+    common_hal_profiler_samplingprofiler_clear(self);
+}
+
+void common_hal_profiler_samplingprofiler_start(profiler_samplingprofiler_obj_t *self) {
+    profiler_samplingprofiler_obj_t *current = MP_OBJ_TO_PTR(MP_STATE_VM(sampling_profiler));
+    if (current != NULL && current->running) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+    // Remember the profiler even after it stops, so its results can be read
+    // over the web workflow.
+    MP_STATE_VM(sampling_profiler) = MP_OBJ_FROM_PTR(self);
+    self->running = true;
+    profiler_timer_start(self->interval_us);
+}
+
+void common_hal_profiler_samplingprofiler_stop(profiler_samplingprofiler_obj_t *self) {
+    if (!self->running) {
+        return;
+    }
+    profiler_timer_stop();
+    self->running = false;
+}
+
+bool common_hal_profiler_samplingprofiler_get_running(profiler_samplingprofiler_obj_t *self) {
+    return self->running;
+}
+
+void common_hal_profiler_samplingprofiler_clear(profiler_samplingprofiler_obj_t *self) {
+    bool running = self->running;
+    self->running = false;
+    memset(self->samples, 0, self->max_samples * self->depth * sizeof(profiler_samplingprofiler_frame_t));
+    memset(self->resolved, 0, self->max_samples * sizeof(bool));
+    self->sample_count = 0;
+    self->running = running;
+}
+
+uint32_t common_hal_profiler_samplingprofiler_get_sample_count(profiler_samplingprofiler_obj_t *self) {
+    return self->sample_count;
+}
+
+// Replaces the bytecode positions in every stored sample with locations, so
+// samples from the same lines compare equal. Sampling must be stopped.
+static void resolve_samples(profiler_samplingprofiler_obj_t *self) {
+    size_t n_samples = stored_samples(self);
+    for (size_t i = 0; i < n_samples; i++) {
+        if (self->resolved[i]) {
+            continue;
+        }
+        profiler_samplingprofiler_frame_t *sample = get_sample(self, i);
+        for (size_t j = 0; j < self->depth && sample[j].code.bytecode != NULL; j++) {
+            qstr source_file, block_name;
+            size_t line = mp_bytecode_get_location(sample[j].code.bytecode, sample[j].code.context,
+                sample[j].code.ip, &source_file, &block_name);
+            sample[j].location.source_file = source_file;
+            sample[j].location.block_name = block_name;
+            sample[j].location.line = line;
+        }
+        self->resolved[i] = true;
+    }
+}
+
+bool common_hal_profiler_samplingprofiler_next_stack(profiler_samplingprofiler_obj_t *self,
+    size_t *index, uint32_t *count, size_t *depth, profiler_samplingprofiler_location_t *stack) {
+    resolve_samples(self);
+
+    size_t n_samples = stored_samples(self);
+    size_t stack_size = self->depth * sizeof(profiler_samplingprofiler_frame_t);
+    for (size_t i = *index; i < n_samples; i++) {
+        profiler_samplingprofiler_frame_t *sample = get_sample(self, i);
+        // Each distinct stack is reported at its first sample, with the
+        // number of samples that match it.
+        bool seen = false;
+        for (size_t j = 0; j < i && !seen; j++) {
+            seen = memcmp(get_sample(self, j), sample, stack_size) == 0;
+        }
+        if (seen) {
+            continue;
+        }
+        *count = 1;
+        for (size_t j = i + 1; j < n_samples; j++) {
+            if (memcmp(get_sample(self, j), sample, stack_size) == 0) {
+                (*count)++;
+            }
+        }
+        size_t n = 0;
+        while (n < self->depth && sample[n].location.source_file != MP_QSTRnull) {
+            n++;
+        }
+        // Return the stack outermost first.
+        for (size_t j = 0; j < n; j++) {
+            profiler_samplingprofiler_frame_t *frame = &sample[n - 1 - j];
+            stack[j].source_file = frame->location.source_file;
+            stack[j].block_name = frame->location.block_name;
+            stack[j].line = frame->location.line;
+        }
+        *depth = n;
+        *index = i + 1;
+        return true;
+    }
+    *index = n_samples;
+    return false;
+}
+
+void profiler_samplingprofiler_print_folded(profiler_samplingprofiler_obj_t *self, const mp_print_t *print) {
+    // Printing may run background tasks, so don't sample while reading.
+    bool running = self->running;
+    self->running = false;
+
+    size_t index = 0;
+    uint32_t count;
+    size_t depth;
+    profiler_samplingprofiler_location_t stack[SAMPLING_PROFILER_MAX_DEPTH];
+    while (common_hal_profiler_samplingprofiler_next_stack(self, &index, &count, &depth, stack)) {
+        if (depth == 0) {
+            mp_print_str(print, "<native>");
+        }
+        for (size_t j = 0; j < depth; j++) {
+            mp_printf(print, "%s%q:%q:%u", j == 0 ? "" : ";", stack[j].source_file, stack[j].block_name, (uint)stack[j].line);
+        }
+        mp_printf(print, " %u\n", (uint)count);
+    }
+
+    self->running = running;
+}
+
+void profiler_samplingprofiler_sample(void) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(sampling_profiler));
+    if (self == NULL || !self->running) {
+        return;
+    }
+    size_t index = self->sample_count % self->max_samples;
+    profiler_samplingprofiler_frame_t *sample = get_sample(self, index);
+    size_t depth = 0;
+    for (const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+         code_state != NULL && depth < self->depth;
+         code_state = code_state->prev_state) {
+        sample[depth].code.bytecode = code_state->fun_bc->bytecode;
+        sample[depth].code.context = code_state->fun_bc->context;
+        sample[depth].code.ip = code_state->ip;
+        depth++;
+    }
+    memset(sample + depth, 0, (self->depth - depth) * sizeof(profiler_samplingprofiler_frame_t));
+    self->resolved[index] = false;
+    self->sample_count++;
+}
+
+void profiler_samplingprofiler_reset(void) {
+    MP_STATE_VM(sampling_profiler) = NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t sampling_profiler);
@@ -0,0 +1,52 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/bc.h"
+#include "py/obj.h"
+
+// The deepest call stack that can be recorded in a sample.
+#define SAMPLING_PROFILER_MAX_DEPTH (8)
+
+// One level of the Python call stack. A sample records the bytecode position,
+// which is cheap, and is turned into a location in place the first time the
+// results are read. Unused frames are all zero either way.
+typedef union {
+    struct {
+        const byte *bytecode;
+        const mp_module_context_t *context;
+        const byte *ip;
+    } code;
+    struct {
+        qstr source_file;
+        qstr block_name;
+        size_t line;
+    } location;
+} profiler_samplingprofiler_frame_t;
+
+typedef struct _profiler_samplingprofiler_obj_t {
+    mp_obj_base_t base;
+    // A ring of max_samples samples of depth frames each, innermost frame
+    // first.
+    profiler_samplingprofiler_frame_t *samples;
+    // Whether each sample holds locations rather than bytecode positions.
+    bool *resolved;
+    uint32_t interval_us;
+    // Samples taken since the last clear, including ones since overwritten.
+    volatile uint32_t sample_count;
+    uint16_t max_samples;
+    uint8_t depth;
+    volatile bool running;
+} profiler_samplingprofiler_obj_t;
+
+// Records the running Python call stack. Called from the profiler timer
+// interrupt or signal, so it must not allocate or raise.
+void profiler_samplingprofiler_sample(void);
+void profiler_samplingprofiler_reset(void);
@@ -0,0 +1,46 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-module/profiler/__init__.h"
+#include "shared-module/profiler/SamplingProfiler.h"
+
+#if !CIRCUITPY_PROFILER_PORT_TIMER
+#include "supervisor/shared/tick.h"
+
+// Zero when sampling is stopped.
+static volatile uint32_t tick_interval;
+static volatile uint32_t ticks_left;
+
+void profiler_timer_start(uint32_t interval_us) {
+    uint32_t interval = interval_us / 1000;
+    ticks_left = tick_interval = interval > 0 ? interval : 1;
+    supervisor_enable_tick();
+}
+
+void profiler_timer_stop(void) {
+    if (tick_interval == 0) {
+        return;
+    }
+    tick_interval = 0;
+    supervisor_disable_tick();
+}
+
+void profiler_tick(void) {
+    // Fast path. Return immediately when not sampling.
+    if (tick_interval == 0) {
+        return;
+    }
+    if (--ticks_left == 0) {
+        ticks_left = tick_interval;
+        profiler_samplingprofiler_sample();
+    }
+}
+#endif
+
+void profiler_reset(void) {
+    profiler_timer_stop();
+    profiler_samplingprofiler_reset();
+}
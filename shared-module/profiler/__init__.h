@@ -0,0 +1,23 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef CIRCUITPY_PROFILER_PORT_TIMER
+#define CIRCUITPY_PROFILER_PORT_TIMER (0)
+#endif
+
+// Call profiler_samplingprofiler_sample() about every interval_us
+// microseconds until profiler_timer_stop() is called. By default this is
+// driven by supervisor_tick(). Ports without a supervisor tick set
+// CIRCUITPY_PROFILER_PORT_TIMER and provide their own.
+void profiler_timer_start(uint32_t interval_us);
+void profiler_timer_stop(void);
+
+void profiler_tick(void);
+void profiler_reset(void);
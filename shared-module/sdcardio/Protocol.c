@@ -0,0 +1,395 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2020 Jeff Epler for Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+// This implementation largely follows the structure of adafruit_sdcard.py
+
+#include <assert.h>
+#include <string.h>
+
+#include "shared-module/sdcardio/Protocol.h"
+
+#include "py/mperrno.h"
+#include "py/mpprint.h"
+#include "py/mpconfig.h"
+
+#if 0
+#define DEBUG_PRINT(...) ((void)mp_printf(&mp_plat_print,##__VA_ARGS__))
+#else
+#define DEBUG_PRINT(...) ((void)0)
+#endif
+
+#define CMD_TIMEOUT (200)
+
+#define TOKEN_CMD25 (0xFC)
+#define TOKEN_STOP_TRAN (0xFD)
+#define TOKEN_DATA (0xFE)
+
+void sdcardio_protocol_init(sdcardio_protocol_t *self, uint8_t *write_queue) {
+    self->cdv = 512;
+    self->next_block = 0;
+    self->in_cmd25 = false;
+    self->write_queue = write_queue;
+    self->write_queue_start = 0;
+    self->write_queue_len = 0;
+    self->write_error = 0;
+}
+
+static void send_bytes(sdcardio_protocol_t *self, const void *buf, size_t len) {
+    self->exchange(self->link, buf, NULL, len);
+}
+
+static void receive_bytes(sdcardio_protocol_t *self, void *buf, size_t len) {
+    self->exchange(self->link, NULL, buf, len);
+}
+
+static uint8_t CRC7(const uint8_t *data, uint8_t n) {
+    uint8_t crc = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        uint8_t d = data[i];
+        for (uint8_t j = 0; j < 8; j++) {
+            crc <<= 1;
+            if ((d & 0x80) ^ (crc & 0x80)) {
+                crc ^= 0x09;
+            }
+            d <<= 1;
+        }
+    }
+    return (crc << 1) | 1;
+}
+
+#define READY_TIMEOUT_NS (300 * 1000 * 1000) // 300ms
+int sdcardio_protocol_wait_for_ready(sdcardio_protocol_t *self) {
+    uint64_t deadline = self->monotonic_ns(self->link) + READY_TIMEOUT_NS;
+    while (self->monotonic_ns(self->link) < deadline) {
+        uint8_t b;
+        receive_bytes(self, &b, 1);
+        if (b == 0xff) {
+            return 0;
+        }
+    }
+    return -MP_ETIMEDOUT;
+}
+
+// Note: this is never called while "in cmd25" (in fact, it's only used by `exit_cmd25`)
+static int cmd_nodata(sdcardio_protocol_t *self, int cmd, int response) {
+    uint8_t cmdbuf[2] = {cmd, 0xff};
+
+    assert(!self->in_cmd25);
+
+    send_bytes(self, cmdbuf, sizeof(cmdbuf));
+
+    // Wait for the response (response[7] == response)
+    for (int i = 0; i < CMD_TIMEOUT; i++) {
+        receive_bytes(self, cmdbuf, 1);
+        if (cmdbuf[0] == response) {
+            return 0;
+        }
+    }
+    return -MP_EIO;
+}
+
+static void set_queue_len(sdcardio_protocol_t *self, uint8_t len) {
+    bool was_pending = self->write_queue_len != 0;
+    self->write_queue_len = len;
+    if (was_pending != (len != 0)) {
+        self->set_pending(self->link, len != 0);
+    }
+}
+
+// Check the response to a data block.
+// This differs from the traditional adafruit_sdcard handling,
+// but adafruit_sdcard also ignored the return value of SDCard._write(!)
+// so nobody noticed
+//
+//
+// Response is as follows:
+//  x x x 0 STAT 1
+//  7 6 5 4 3..1 0
+// with STATUS 010 indicating "data accepted", and other status bit
+// combinations indicating failure.
+// In practice, I was seeing a response of 0xe5, indicating success
+static int read_data_response(sdcardio_protocol_t *self) {
+    uint8_t response;
+    for (int i = 0; i < CMD_TIMEOUT; i++) {
+        receive_bytes(self, &response, 1);
+        DEBUG_PRINT("i=%02d response = 0x%02x\n", i, response);
+        if ((response & 0b00010001) == 0b00000001) {
+            if ((response & 0x1f) != 0x5) {
+                return -MP_EIO;
+            } else {
+                break;
+            }
+        }
+    }
+    return 0;
+}
+
+// Send a block without waiting for the card to program it. The card keeps
+// working while it is deselected, and the next command or block waits for it.
+static int _write(sdcardio_protocol_t *self, uint8_t token, const void *buf, size_t size) {
+    int r = sdcardio_protocol_wait_for_ready(self);
+    if (r < 0) {
+        return r;
+    }
+
+    uint8_t cmd[2];
+    cmd[0] = token;
+
+    send_bytes(self, cmd, 1);
+    send_bytes(self, buf, size);
+
+    cmd[0] = cmd[1] = 0xff;
+    send_bytes(self, cmd, 2);
+
+    return read_data_response(self);
+}
+
+// Send the oldest queued block. The card must be ready.
+static int send_queued_block(sdcardio_protocol_t *self) {
+    uint8_t *frame = self->write_queue + self->write_queue_start * SDCARDIO_FRAME_SIZE;
+    send_bytes(self, frame, SDCARDIO_FRAME_SIZE);
+    self->write_queue_start = (self->write_queue_start + 1) % CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS;
+    set_queue_len(self, self->write_queue_len - 1);
+    return read_data_response(self);
+}
+
+// Drop the queue after a failed block and end the CMD25 stream, which the card
+// keeps open until it gets the stop token.
+static int note_write_error(sdcardio_protocol_t *self, int r) {
+    if (r < 0) {
+        set_queue_len(self, 0);
+        self->write_error = r;
+        if (self->in_cmd25) {
+            self->in_cmd25 = false;
+            if (sdcardio_protocol_wait_for_ready(self) == 0) {
+                cmd_nodata(self, TOKEN_STOP_TRAN, 0);
+            }
+        }
+    }
+    return r;
+}
+
+// Send all queued blocks, waiting for the card as needed.
+static int flush_write_queue(sdcardio_protocol_t *self) {
+    int r = 0;
+    while (self->write_queue_len && r == 0) {
+        r = sdcardio_protocol_wait_for_ready(self);
+        if (r == 0) {
+            r = send_queued_block(self);
+        }
+    }
+    return note_write_error(self, r);
+}
+
+static int exit_cmd25(sdcardio_protocol_t *self) {
+    // An error here is reported by the next write or sync.
+    flush_write_queue(self);
+    if (self->in_cmd25) {
+        DEBUG_PRINT("exit cmd25\n");
+        self->in_cmd25 = false;
+        // The card may still be programming the last block.
+        int r = sdcardio_protocol_wait_for_ready(self);
+        if (r < 0) {
+            return r;
+        }
+        return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
+    }
+    return 0;
+}
+
+int sdcardio_protocol_cmd(sdcardio_protocol_t *self, int cmd, int arg, void *response_buf, size_t response_len, bool data_block, bool wait) {
+    int r = exit_cmd25(self);
+    if (r < 0) {
+        return r;
+    }
+
+    DEBUG_PRINT("cmd % 3d [%02x] arg=% 11d [%08x] len=%d%s%s\n", cmd, cmd, arg, arg, response_len, data_block ? " data" : "", wait ? " wait" : "");
+    uint8_t cmdbuf[6];
+    cmdbuf[0] = cmd | 0x40;
+    cmdbuf[1] = (arg >> 24) & 0xff;
+    cmdbuf[2] = (arg >> 16) & 0xff;
+    cmdbuf[3] = (arg >> 8) & 0xff;
+    cmdbuf[4] = arg & 0xff;
+    cmdbuf[5] = CRC7(cmdbuf, 5);
+
+    if (wait) {
+        r = sdcardio_protocol_wait_for_ready(self);
+        if (r < 0) {
+            return r;
+        }
+    }
+
+    send_bytes(self, cmdbuf, sizeof(cmdbuf));
+
+    // Wait for the response (response[7] == 0)
+    bool response_received = false;
+    for (int i = 0; i < CMD_TIMEOUT; i++) {
+        receive_bytes(self, cmdbuf, 1);
+        if ((cmdbuf[0] & 0x80) == 0) {
+            response_received = true;
+            break;
+        }
+    }
+
+    if (!response_received) {
+        return -MP_EIO;
+    }
+
+    if (response_buf) {
+
+        if (data_block) {
+            cmdbuf[1] = 0xff;
+            do {
+                // Wait for the start block byte
+                receive_bytes(self, cmdbuf + 1, 1);
+            } while (cmdbuf[1] != TOKEN_DATA);
+        }
+
+        receive_bytes(self, response_buf, response_len);
+
+        if (data_block) {
+            // Read and discard the CRC-CCITT checksum
+            receive_bytes(self, cmdbuf + 1, 2);
+        }
+
+    }
+
+    return cmdbuf[0];
+}
+
+static int block_cmd(sdcardio_protocol_t *self, int cmd_, int block, void *response_buf, size_t response_len, bool data_block, bool wait) {
+    return sdcardio_protocol_cmd(self, cmd_, block * self->cdv, response_buf, response_len, true, true);
+}
+
+static int readinto(sdcardio_protocol_t *self, void *buf, size_t size) {
+    uint8_t aux[2] = {0, 0};
+    while (aux[0] != TOKEN_DATA) {
+        receive_bytes(self, aux, 1);
+    }
+
+    receive_bytes(self, buf, size);
+
+    // Read checksum and throw it away
+    receive_bytes(self, aux, sizeof(aux));
+    return 0;
+}
+
+int sdcardio_protocol_readblocks(sdcardio_protocol_t *self, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
+    int r = 0;
+    size_t buflen = 512 * nblocks;
+    if (nblocks == 1) {
+        //  Use CMD17 to read a single block
+        r = block_cmd(self, 17, start_block, buf, buflen, true, true);
+    } else {
+        //  Use CMD18 to read multiple blocks
+        r = block_cmd(self, 18, start_block, NULL, 0, true, true);
+        uint8_t *ptr = buf;
+        while (nblocks-- && r >= 0) {
+            r = readinto(self, ptr, 512);
+            if (r != 0) {
+                break;
+            }
+            ptr += 512;
+        }
+
+        // End the multi-block read
+        r = sdcardio_protocol_cmd(self, 12, 0, NULL, 0, true, false);
+
+        // Return first status 0 or last before card ready (0xff)
+        while (r != 0) {
+            uint8_t single_byte;
+            receive_bytes(self, &single_byte, 1);
+            if (single_byte & 0x80) {
+                break;
+            }
+            r = single_byte;
+        }
+    }
+    return r;
+}
+
+void sdcardio_protocol_background(sdcardio_protocol_t *self) {
+    int r = 0;
+    while (self->write_queue_len && r == 0) {
+        uint8_t b;
+        receive_bytes(self, &b, 1);
+        if (b != 0xff) {
+            // Still programming; try again on a later tick.
+            break;
+        }
+        r = send_queued_block(self);
+    }
+    note_write_error(self, r);
+}
+
+int sdcardio_protocol_writeblocks(sdcardio_protocol_t *self, const uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
+    if (self->write_error) {
+        int r = self->write_error;
+        self->write_error = 0;
+        return r;
+    }
+
+    if (!self->in_cmd25 || start_block != self->next_block) {
+        DEBUG_PRINT("entering CMD25 at %d\n", (int)start_block);
+        //  Use CMD25 to write multiple block
+        int r = block_cmd(self, 25, start_block, NULL, 0, true, true);
+        if (r < 0) {
+            return r;
+        }
+        self->in_cmd25 = true;
+    }
+
+    self->next_block = start_block;
+
+    const uint8_t *ptr = buf;
+    while (nblocks--) {
+        int r = 0;
+        if (self->write_queue == NULL) {
+            r = _write(self, TOKEN_CMD25, ptr, 512);
+        } else {
+            if (self->write_queue_len == CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS) {
+                r = sdcardio_protocol_wait_for_ready(self);
+                if (r == 0) {
+                    r = send_queued_block(self);
+                }
+            }
+            if (r == 0) {
+                size_t end = (self->write_queue_start + self->write_queue_len) % CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS;
+                uint8_t *frame = self->write_queue + end * SDCARDIO_FRAME_SIZE;
+                frame[0] = TOKEN_CMD25;
+                memcpy(frame + 1, ptr, 512);
+                frame[513] = frame[514] = 0xff;
+                set_queue_len(self, self->write_queue_len + 1);
+            }
+        }
+        if (r < 0) {
+            note_write_error(self, r);
+            self->write_error = 0;
+            return r;
+        }
+        self->next_block++;
+        ptr += 512;
+    }
+
+    return 0;
+}
+
+int sdcardio_protocol_sync(sdcardio_protocol_t *self) {
+    int r = exit_cmd25(self);
+    if (r == 0 && self->write_error) {
+        r = self->write_error;
+        self->write_error = 0;
+    }
+    return r;
+}
+
+bool sdcardio_protocol_synced(sdcardio_protocol_t *self) {
+    return !self->in_cmd25 && !self->write_queue_len && !self->write_error;
+}
+
+void sdcardio_protocol_discard(sdcardio_protocol_t *self) {
+    set_queue_len(self, 0);
+}
@@ -0,0 +1,69 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2020 Jeff Epler for Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Number of written blocks that can wait in RAM to be sent to the card in the
+// background, while it is still programming earlier ones. At least 1.
+#ifndef CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS
+#define CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS (4)
+#endif
+
+// A queued block is kept as the whole frame sent to the card: start token,
+// data and (unused) CRC, so that it goes out in a single SPI transfer.
+#define SDCARDIO_FRAME_SIZE (1 + 512 + 2)
+
+// The SD card SPI mode protocol, including the open CMD25 write stream and the
+// queue of blocks still to be sent on it. It only talks to the card through
+// the link callbacks, so that it can be tested against a simulated card.
+//
+// All the functions below expect the bus to be locked and the card selected.
+typedef struct {
+    void *link;
+    // Send len bytes from tx, or 0xff bytes if tx is NULL, and store the bytes
+    // received at the same time in rx, unless rx is NULL.
+    void (*exchange)(void *link, const uint8_t *tx, uint8_t *rx, size_t len);
+    uint64_t (*monotonic_ns)(void *link);
+    // Called when the first block is queued and when the queue empties, so
+    // that the owner can arrange for sdcardio_protocol_background() calls.
+    void (*set_pending)(void *link, bool pending);
+    int cdv;
+    // Block after the last one written or queued in the open CMD25 stream.
+    uint32_t next_block;
+    bool in_cmd25;
+    // Frames for the blocks at the end of the CMD25 stream that have not been
+    // sent yet. NULL if there was no RAM for it, in which case writes wait.
+    uint8_t *write_queue;
+    uint8_t write_queue_start;
+    uint8_t write_queue_len;
+    // Set when a queued block fails, and returned by the next write or sync.
+    int write_error;
+} sdcardio_protocol_t;
+
+// write_queue is CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS * SDCARDIO_FRAME_SIZE
+// bytes, or NULL.
+void sdcardio_protocol_init(sdcardio_protocol_t *self, uint8_t *write_queue);
+
+// Returns the R1 response, or a negative errno. In the Python API, defaults
+// are response=None, data_block=True, wait=True.
+int sdcardio_protocol_cmd(sdcardio_protocol_t *self, int cmd, int arg, void *response_buf, size_t response_len, bool data_block, bool wait);
+int sdcardio_protocol_wait_for_ready(sdcardio_protocol_t *self);
+
+int sdcardio_protocol_readblocks(sdcardio_protocol_t *self, uint8_t *buf, uint32_t start_block, uint32_t nblocks);
+// Queues the blocks when there is room, and otherwise waits for the card.
+int sdcardio_protocol_writeblocks(sdcardio_protocol_t *self, const uint8_t *buf, uint32_t start_block, uint32_t nblocks);
+// Sends queued blocks for as long as the card is ready to take them.
+void sdcardio_protocol_background(sdcardio_protocol_t *self);
+// Sends everything queued, ends the CMD25 stream and returns any delayed error.
+int sdcardio_protocol_sync(sdcardio_protocol_t *self);
+// True when sync has nothing to do.
+bool sdcardio_protocol_synced(sdcardio_protocol_t *self);
+// Drops the queued blocks.
+void sdcardio_protocol_discard(sdcardio_protocol_t *self);
@@ -14,8 +14,11 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-bindings/util.h"
 #include "shared-module/sdcardio/SDCard.h"
+#include "shared-module/sdcardio/__init__.h"
 
 #include "py/mperrno.h"
+#include "py/runtime.h"
+#include "shared/runtime/interrupt_char.h"
 
 #if 0
 #define DEBUG_PRINT(...) ((void)mp_printf(&mp_plat_print,##__VA_ARGS__))
@@ -28,10 +31,6 @@
 #define R1_IDLE_STATE (1 << 0)
 #define R1_ILLEGAL_COMMAND (1 << 2)
 
-#define TOKEN_CMD25 (0xFC)
-#define TOKEN_STOP_TRAN (0xFD)
-#define TOKEN_DATA (0xFE)
-
 static void common_hal_sdcardio_check_for_deinit(sdcardio_sdcard_obj_t *self) {
     if (!self->bus) {
         raise_deinited_error();
@@ -68,125 +67,31 @@ static void extraclock_and_unlock_bus(sdcardio_sdcard_obj_t *self) {
     common_hal_busio_spi_unlock(self->bus);
 }
 
-static uint8_t CRC7(const uint8_t *data, uint8_t n) {
-    uint8_t crc = 0;
-    for (uint8_t i = 0; i < n; i++) {
-        uint8_t d = data[i];
-        for (uint8_t j = 0; j < 8; j++) {
-            crc <<= 1;
-            if ((d & 0x80) ^ (crc & 0x80)) {
-                crc ^= 0x09;
-            }
-            d <<= 1;
-        }
+static void spi_exchange(void *link, const uint8_t *tx, uint8_t *rx, size_t len) {
+    sdcardio_sdcard_obj_t *self = link;
+    if (tx == NULL) {
+        common_hal_busio_spi_read(self->bus, rx, len, 0xff);
+    } else if (rx == NULL) {
+        common_hal_busio_spi_write(self->bus, tx, len);
+    } else {
+        common_hal_busio_spi_transfer(self->bus, tx, rx, len);
     }
-    return (crc << 1) | 1;
 }
 
-#define READY_TIMEOUT_NS (300 * 1000 * 1000) // 300ms
-static int wait_for_ready(sdcardio_sdcard_obj_t *self) {
-    uint64_t deadline = common_hal_time_monotonic_ns() + READY_TIMEOUT_NS;
-    while (common_hal_time_monotonic_ns() < deadline) {
-        uint8_t b;
-        common_hal_busio_spi_read(self->bus, &b, 1, 0xff);
-        if (b == 0xff) {
-            return 0;
-        }
-    }
-    return -ETIMEDOUT;
+static uint64_t spi_monotonic_ns(void *link) {
+    return common_hal_time_monotonic_ns();
 }
 
-// Note: this is never called while "in cmd25" (in fact, it's only used by `exit_cmd25`)
-static bool cmd_nodata(sdcardio_sdcard_obj_t *self, int cmd, int response) {
-    uint8_t cmdbuf[2] = {cmd, 0xff};
-
-    assert(!self->in_cmd25);
-
-    common_hal_busio_spi_write(self->bus, cmdbuf, sizeof(cmdbuf));
-
-    // Wait for the response (response[7] == response)
-    for (int i = 0; i < CMD_TIMEOUT; i++) {
-        common_hal_busio_spi_read(self->bus, cmdbuf, 1, 0xff);
-        if (cmdbuf[0] == response) {
-            return 0;
-        }
-    }
-    return -EIO;
-}
-
-
-static int exit_cmd25(sdcardio_sdcard_obj_t *self) {
-    if (self->in_cmd25) {
-        DEBUG_PRINT("exit cmd25\n");
-        self->in_cmd25 = false;
-        return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
+static void spi_set_pending(void *link, bool pending) {
+    if (pending) {
+        sdcardio_register_pending(link);
+    } else {
+        sdcardio_deregister_pending(link);
     }
-    return 0;
 }
 
-// In Python API, defaults are response=None, data_block=True, wait=True
 static int cmd(sdcardio_sdcard_obj_t *self, int cmd, int arg, void *response_buf, size_t response_len, bool data_block, bool wait) {
-    int r = exit_cmd25(self);
-    if (r < 0) {
-        return r;
-    }
-
-    DEBUG_PRINT("cmd % 3d [%02x] arg=% 11d [%08x] len=%d%s%s\n", cmd, cmd, arg, arg, response_len, data_block ? " data" : "", wait ? " wait" : "");
-    uint8_t cmdbuf[6];
-    cmdbuf[0] = cmd | 0x40;
-    cmdbuf[1] = (arg >> 24) & 0xff;
-    cmdbuf[2] = (arg >> 16) & 0xff;
-    cmdbuf[3] = (arg >> 8) & 0xff;
-    cmdbuf[4] = arg & 0xff;
-    cmdbuf[5] = CRC7(cmdbuf, 5);
-
-    if (wait) {
-        r = wait_for_ready(self);
-        if (r < 0) {
-            return r;
-        }
-    }
-
-    common_hal_busio_spi_write(self->bus, cmdbuf, sizeof(cmdbuf));
-
-    // Wait for the response (response[7] == 0)
-    bool response_received = false;
-    for (int i = 0; i < CMD_TIMEOUT; i++) {
-        common_hal_busio_spi_read(self->bus, cmdbuf, 1, 0xff);
-        if ((cmdbuf[0] & 0x80) == 0) {
-            response_received = true;
-            break;
-        }
-    }
-
-    if (!response_received) {
-        return -EIO;
-    }
-
-    if (response_buf) {
-
-        if (data_block) {
-            cmdbuf[1] = 0xff;
-            do {
-                // Wait for the start block byte
-                common_hal_busio_spi_read(self->bus, cmdbuf + 1, 1, 0xff);
-            } while (cmdbuf[1] != 0xfe);
-        }
-
-        common_hal_busio_spi_read(self->bus, response_buf, response_len, 0xff);
-
-        if (data_block) {
-            // Read and discard the CRC-CCITT checksum
-            common_hal_busio_spi_read(self->bus, cmdbuf + 1, 2, 0xff);
-        }
-
-    }
-
-    return cmdbuf[0];
-}
-
-static int block_cmd(sdcardio_sdcard_obj_t *self, int cmd_, int block, void *response_buf, size_t response_len, bool data_block, bool wait) {
-    return cmd(self, cmd_, block * self->cdv, response_buf, response_len, true, true);
+    return sdcardio_protocol_cmd(&self->protocol, cmd, arg, response_buf, response_len, data_block, wait);
 }
 
 static mp_rom_error_text_t init_card_v1(sdcardio_sdcard_obj_t *self) {
@@ -207,7 +112,7 @@ static mp_rom_error_text_t init_card_v2(sdcardio_sdcard_obj_t *self) {
         if (cmd(self, 41, 0x40000000, NULL, 0, true, true) == 0) {
             cmd(self, 58, 0, ocr, sizeof(ocr), false, true);
             if ((ocr[0] & 0x40) != 0) {
-                self->cdv = 1;
+                self->protocol.cdv = 1;
             }
             return NULL;
         }
@@ -220,8 +125,8 @@ static mp_rom_error_text_t init_card(sdcardio_sdcard_obj_t *self) {
 
     common_hal_digitalio_digitalinout_set_value(&self->cs, false);
 
-    assert(!self->in_cmd25);
-    self->in_cmd25 = false; // should be false already
+    assert(!self->protocol.in_cmd25);
+    self->protocol.in_cmd25 = false; // should be false already
 
     // CMD0: init card: should return _R1_IDLE_STATE (allow 5 attempts)
     {
@@ -230,7 +135,7 @@ static mp_rom_error_text_t init_card(sdcardio_sdcard_obj_t *self) {
             // do not call cmd with wait=true, because that will return
             // prematurely if the idle state is not reached. we can't depend on
             // this when the card is not yet in SPI mode
-            (void)wait_for_ready(self);
+            (void)sdcardio_protocol_wait_for_ready(&self->protocol);
             if (cmd(self, 0, 0, NULL, 0, true, false) == R1_IDLE_STATE) {
                 reached_idle_state = true;
                 break;
@@ -299,9 +204,14 @@ void common_hal_sdcardio_sdcard_construct(sdcardio_sdcard_obj_t *self, busio_spi
     common_hal_digitalio_digitalinout_construct(&self->cs, cs);
     common_hal_digitalio_digitalinout_switch_to_output(&self->cs, true, DRIVE_MODE_PUSH_PULL);
 
-    self->cdv = 512;
     self->sectors = 0;
     self->baudrate = 250000;
+    self->protocol.link = self;
+    self->protocol.exchange = spi_exchange;
+    self->protocol.monotonic_ns = spi_monotonic_ns;
+    self->protocol.set_pending = spi_set_pending;
+    sdcardio_protocol_init(&self->protocol, m_malloc_maybe(CIRCUITPY_SDCARDIO_WRITE_QUEUE_BLOCKS * SDCARDIO_FRAME_SIZE));
+    self->next_pending = NULL;
 
     lock_bus_or_throw(self);
     mp_rom_error_text_t result = init_card(self);
@@ -320,7 +230,10 @@ void common_hal_sdcardio_sdcard_deinit(sdcardio_sdcard_obj_t *self) {
         return;
     }
     common_hal_sdcardio_sdcard_sync(self);
+    // If the bus was busy, the blocks are lost.
+    sdcardio_protocol_discard(&self->protocol);
     self->bus = 0;
+    self->protocol.write_queue = NULL;
     common_hal_digitalio_digitalinout_deinit(&self->cs);
 }
 
@@ -329,55 +242,13 @@ int common_hal_sdcardio_sdcard_get_blockcount(sdcardio_sdcard_obj_t *self) {
     return self->sectors;
 }
 
-static int readinto(sdcardio_sdcard_obj_t *self, void *buf, size_t size) {
-    uint8_t aux[2] = {0, 0};
-    while (aux[0] != 0xfe) {
-        common_hal_busio_spi_read(self->bus, aux, 1, 0xff);
-    }
-
-    common_hal_busio_spi_read(self->bus, buf, size, 0xff);
-
-    // Read checksum and throw it away
-    common_hal_busio_spi_read(self->bus, aux, sizeof(aux), 0xff);
-    return 0;
-}
-
 mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
     // deinit check is in lock_and_configure_bus()
     sdcardio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
     if (!lock_and_configure_bus(self)) {
         return MP_EAGAIN;
     }
-    int r = 0;
-    size_t buflen = 512 * nblocks;
-    if (nblocks == 1) {
-        //  Use CMD17 to read a single block
-        r = block_cmd(self, 17, start_block, buf, buflen, true, true);
-    } else {
-        //  Use CMD18 to read multiple blocks
-        r = block_cmd(self, 18, start_block, NULL, 0, true, true);
-        uint8_t *ptr = buf;
-        while (nblocks-- && r >= 0) {
-            r = readinto(self, ptr, 512);
-            if (r != 0) {
-                break;
-            }
-            ptr += 512;
-        }
-
-        // End the multi-block read
-        r = cmd(self, 12, 0, NULL, 0, true, false);
-
-        // Return first status 0 or last before card ready (0xff)
-        while (r != 0) {
-            uint8_t single_byte;
-            common_hal_busio_spi_read(self->bus, &single_byte, 1, 0xff);
-            if (single_byte & 0x80) {
-                break;
-            }
-            r = single_byte;
-        }
-    }
+    int r = sdcardio_protocol_readblocks(&self->protocol, buf, start_block, nblocks);
     extraclock_and_unlock_bus(self);
     return r;
 }
@@ -390,49 +261,16 @@ int common_hal_sdcardio_sdcard_readblocks(sdcardio_sdcard_obj_t *self, uint32_t
     return sdcardio_sdcard_readblocks(MP_OBJ_FROM_PTR(self), buf->buf, start_block, buf->len / 512);
 }
 
-static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t size) {
-    wait_for_ready(self);
-
-    uint8_t cmd[2];
-    cmd[0] = token;
-
-    common_hal_busio_spi_write(self->bus, cmd, 1);
-    common_hal_busio_spi_write(self->bus, buf, size);
-
-    cmd[0] = cmd[1] = 0xff;
-    common_hal_busio_spi_write(self->bus, cmd, 2);
-
-    // Check the response
-    // This differs from the traditional adafruit_sdcard handling,
-    // but adafruit_sdcard also ignored the return value of SDCard._write(!)
-    // so nobody noticed
-    //
-    //
-    // Response is as follows:
-    //  x x x 0 STAT 1
-    //  7 6 5 4 3..1 0
-    // with STATUS 010 indicating "data accepted", and other status bit
-    // combinations indicating failure.
-    // In practice, I was seeing cmd[0] as 0xe5, indicating success
-    for (int i = 0; i < CMD_TIMEOUT; i++) {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-        DEBUG_PRINT("i=%02d cmd[0] = 0x%02x\n", i, cmd[0]);
-        if ((cmd[0] & 0b00010001) == 0b00000001) {
-            if ((cmd[0] & 0x1f) != 0x5) {
-                return -EIO;
-            } else {
-                break;
-            }
-        }
+// Send queued blocks for as long as the card is ready to take them.
+void sdcardio_sdcard_background(void *self_in) {
+    sdcardio_sdcard_obj_t *self = self_in;
+    if (!self->bus || !self->protocol.write_queue_len || !common_hal_busio_spi_try_lock(self->bus)) {
+        return;
     }
-
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
-
-    // Success
-    return 0;
+    common_hal_busio_spi_configure(self->bus, self->baudrate, 0, 0, 8);
+    common_hal_digitalio_digitalinout_set_value(&self->cs, false);
+    sdcardio_protocol_background(&self->protocol);
+    extraclock_and_unlock_bus(self);
 }
 
 mp_uint_t sdcardio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
@@ -441,40 +279,40 @@ mp_uint_t sdcardio_sdcard_writeblocks(mp_obj_t self_in, uint8_t *buf, uint32_t s
     if (!lock_and_configure_bus(self)) {
         return MP_EAGAIN;
     }
+    int r = sdcardio_protocol_writeblocks(&self->protocol, buf, start_block, nblocks);
+    extraclock_and_unlock_bus(self);
+    return r;
+}
 
-    if (!self->in_cmd25 || start_block != self->next_block) {
-        DEBUG_PRINT("entering CMD25 at %d\n", (int)start_block);
-        //  Use CMD25 to write multiple block
-        int r = block_cmd(self, 25, start_block, NULL, 0, true, true);
-        if (r < 0) {
-            extraclock_and_unlock_bus(self);
-            return r;
-        }
-        self->in_cmd25 = true;
+int common_hal_sdcardio_sdcard_sync(sdcardio_sdcard_obj_t *self) {
+    common_hal_sdcardio_check_for_deinit(self);
+    // Nothing written since the last sync, so there is no need for the bus.
+    if (sdcardio_protocol_synced(&self->protocol)) {
+        return 0;
     }
-
-    self->next_block = start_block;
-
-    uint8_t *ptr = buf;
-    while (nblocks--) {
-        int r = _write(self, TOKEN_CMD25, ptr, 512);
-        if (r < 0) {
-            self->in_cmd25 = false;
-            extraclock_and_unlock_bus(self);
-            return r;
-        }
-        self->next_block++;
-        ptr += 512;
+    if (!lock_and_configure_bus(self)) {
+        return -MP_EAGAIN;
     }
-
+    int r = sdcardio_protocol_sync(&self->protocol);
     extraclock_and_unlock_bus(self);
-    return 0;
+    return r;
 }
 
-int common_hal_sdcardio_sdcard_sync(sdcardio_sdcard_obj_t *self) {
-    // deinit check is in lock_and_configure_bus()
-    lock_and_configure_bus(self);
-    int r = exit_cmd25(self);
+// Like common_hal_sdcardio_sdcard_sync(), but waits for the bus rather than
+// leaving blocks queued. The filesystem syncs before it reports a file closed,
+// and can't try again later.
+static int sync_waiting_for_bus(sdcardio_sdcard_obj_t *self) {
+    common_hal_sdcardio_check_for_deinit(self);
+    if (sdcardio_protocol_synced(&self->protocol)) {
+        return 0;
+    }
+    while (!lock_and_configure_bus(self)) {
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return -MP_EAGAIN;
+        }
+    }
+    int r = sdcardio_protocol_sync(&self->protocol);
     extraclock_and_unlock_bus(self);
     return r;
 }
@@ -484,10 +322,7 @@ int common_hal_sdcardio_sdcard_writeblocks(sdcardio_sdcard_obj_t *self, uint32_t
     if (buf->len % 512 != 0) {
         mp_raise_ValueError(MP_ERROR_TEXT("Buffer length must be a multiple of 512"));
     }
-    lock_and_configure_bus(self);
-    int r = sdcardio_sdcard_writeblocks(MP_OBJ_FROM_PTR(self), buf->buf, start_block, buf->len / 512);
-    extraclock_and_unlock_bus(self);
-    return r;
+    return sdcardio_sdcard_writeblocks(MP_OBJ_FROM_PTR(self), buf->buf, start_block, buf->len / 512);
 }
 
 bool sdcardio_sdcard_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *out_value) {
@@ -495,10 +330,9 @@ bool sdcardio_sdcard_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *o
     *out_value = 0;
     switch (cmd) {
         case MP_BLOCKDEV_IOCTL_DEINIT:
-            common_hal_sdcardio_sdcard_sync(self);
-            break; // TODO properly
         case MP_BLOCKDEV_IOCTL_SYNC:
-            common_hal_sdcardio_sdcard_sync(self);
+            // A write that failed in the background is reported here.
+            *out_value = sync_waiting_for_bus(self);
             break;
         case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
             *out_value = common_hal_sdcardio_sdcard_get_blockcount(self);
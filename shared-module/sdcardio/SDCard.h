@@ -13,14 +13,19 @@
 
 #include "common-hal/busio/SPI.h"
 #include "common-hal/digitalio/DigitalInOut.h"
+#include "shared-module/sdcardio/Protocol.h"
+#include "supervisor/background_callback.h"
 
-typedef struct {
+typedef struct _sdcardio_sdcard_obj_t {
     mp_obj_base_t base;
     busio_spi_obj_t *bus;
     digitalio_digitalinout_obj_t cs;
-    int cdv;
     int baudrate;
     uint32_t sectors;
-    uint32_t next_block;
-    bool in_cmd25;
+    sdcardio_protocol_t protocol;
+    background_callback_t write_callback;
+    // Next card with queued blocks.
+    struct _sdcardio_sdcard_obj_t *next_pending;
 } sdcardio_sdcard_obj_t;
+
+void sdcardio_sdcard_background(void *self_in);
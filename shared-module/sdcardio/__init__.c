@@ -3,3 +3,71 @@
 // SPDX-FileCopyrightText: Copyright (c) 2024 Adafruit Industries LLC
 //
 // SPDX-License-Identifier: MIT
+
+#include "shared-module/sdcardio/__init__.h"
+
+#include "py/mpstate.h"
+#include "shared-bindings/sdcardio/SDCard.h"
+#include "supervisor/shared/lock.h"
+#include "supervisor/shared/tick.h"
+
+static supervisor_lock_t sdcardio_pending_cards_lock;
+
+// Called from the tick interrupt. Queued blocks are sent from a background
+// callback, because the card may still be programming for a while and a
+// callback must not requeue itself.
+void sdcardio_tick(void) {
+    // Fast path. Return immediately there are no queued blocks.
+    if (!MP_STATE_VM(sdcardio_pending_cards)) {
+        return;
+    }
+
+    // Skip this tick if someone else has the lock. Don't wait for the lock.
+    if (supervisor_try_lock(&sdcardio_pending_cards_lock)) {
+        sdcardio_sdcard_obj_t *card = MP_STATE_VM(sdcardio_pending_cards);
+        while (card) {
+            background_callback_add(&card->write_callback, sdcardio_sdcard_background, card);
+            card = card->next_pending;
+        }
+        supervisor_release_lock(&sdcardio_pending_cards_lock);
+    }
+}
+
+// Send everything still queued before the heap goes away.
+void sdcardio_reset(void) {
+    sdcardio_sdcard_obj_t *card = MP_STATE_VM(sdcardio_pending_cards);
+    while (card) {
+        sdcardio_sdcard_obj_t *next = card->next_pending;
+        common_hal_sdcardio_sdcard_sync(card);
+        sdcardio_deregister_pending(card);
+        card = next;
+    }
+}
+
+void sdcardio_register_pending(sdcardio_sdcard_obj_t *card) {
+    supervisor_acquire_lock(&sdcardio_pending_cards_lock);
+    card->next_pending = MP_STATE_VM(sdcardio_pending_cards);
+    MP_STATE_VM(sdcardio_pending_cards) = card;
+    supervisor_release_lock(&sdcardio_pending_cards_lock);
+
+    // One more request for ticks.
+    supervisor_enable_tick();
+}
+
+void sdcardio_deregister_pending(sdcardio_sdcard_obj_t *card) {
+    supervisor_acquire_lock(&sdcardio_pending_cards_lock);
+    sdcardio_sdcard_obj_t **link = (sdcardio_sdcard_obj_t **)&MP_STATE_VM(sdcardio_pending_cards);
+    while (*link) {
+        if (*link == card) {
+            *link = card->next_pending;
+            card->next_pending = NULL;
+            // One less request for ticks.
+            supervisor_disable_tick();
+            break;
+        }
+        link = &(*link)->next_pending;
+    }
+    supervisor_release_lock(&sdcardio_pending_cards_lock);
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t sdcardio_pending_cards);
@@ -5,3 +5,10 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+#include "shared-module/sdcardio/SDCard.h"
+
+void sdcardio_tick(void);
+void sdcardio_reset(void);
+void sdcardio_register_pending(sdcardio_sdcard_obj_t *card);
+void sdcardio_deregister_pending(sdcardio_sdcard_obj_t *card);
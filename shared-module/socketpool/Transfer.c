@@ -0,0 +1,177 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-module/socketpool/Transfer.h"
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared/runtime/interrupt_char.h"
+
+// Large enough to fill a TCP window in a few sends, small enough not to strain the heap.
+#define SENDFILE_BLOCK_SIZE (2048)
+
+static bool is_oserror(void *exc) {
+    return mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(((mp_obj_base_t *)exc)->type), MP_OBJ_FROM_PTR(&mp_type_OSError));
+}
+
+// Returns -1 instead of raising an OSError, which is stored in error. error is
+// NULL when the connection is broken.
+static mp_int_t send_catching(const socketpool_transfer_t *self, const uint8_t *buf, size_t len, void **error) {
+    *error = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_int_t ret = self->send(self->link, buf, len);
+        nlr_pop();
+        return ret;
+    }
+    if (!is_oserror(nlr.ret_val)) {
+        nlr_jump(nlr.ret_val);
+    }
+    *error = nlr.ret_val;
+    return -1;
+}
+
+static mp_int_t recv_catching(const socketpool_transfer_t *self, uint8_t *buf, size_t len, void **error) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_int_t ret = self->recv_into(self->link, buf, len);
+        nlr_pop();
+        return ret;
+    }
+    if (!is_oserror(nlr.ret_val)) {
+        nlr_jump(nlr.ret_val);
+    }
+    *error = nlr.ret_val;
+    return -1;
+}
+
+static void raise_send_error(void *error) {
+    if (error == NULL) {
+        mp_raise_BrokenPipeError();
+    }
+    nlr_jump(error);
+}
+
+mp_uint_t socketpool_transfer_sendmsg(const socketpool_transfer_t *self, size_t n, const mp_obj_t *buffers) {
+    mp_uint_t total = 0;
+    for (size_t i = 0; i < n; i++) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_READ);
+        if (bufinfo.len == 0) {
+            continue;
+        }
+        void *error;
+        mp_int_t ret = send_catching(self, bufinfo.buf, bufinfo.len, &error);
+        if (ret == -1) {
+            if (total == 0) {
+                raise_send_error(error);
+            }
+            break;
+        }
+        total += ret;
+        if ((size_t)ret < bufinfo.len) {
+            break;
+        }
+    }
+    return total;
+}
+
+mp_uint_t socketpool_transfer_recvmsg_into(const socketpool_transfer_t *self, size_t n, const mp_obj_t *buffers) {
+    mp_uint_t total = 0;
+    for (size_t i = 0; i < n; i++) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_WRITE);
+        if (bufinfo.len == 0) {
+            continue;
+        }
+        if (total > 0 && !self->readable(self->link)) {
+            break;
+        }
+        void *error;
+        mp_int_t ret = recv_catching(self, bufinfo.buf, bufinfo.len, &error);
+        if (ret == -1) {
+            if (total == 0) {
+                nlr_jump(error);
+            }
+            break;
+        }
+        total += ret;
+        if ((size_t)ret < bufinfo.len) {
+            break;
+        }
+    }
+    return total;
+}
+
+mp_uint_t socketpool_transfer_sendfile(const socketpool_transfer_t *self, mp_obj_t file, mp_int_t offset, size_t count) {
+    const mp_stream_p_t *stream = mp_get_stream_raise(file, MP_STREAM_OP_READ | MP_STREAM_OP_IOCTL);
+    int errcode;
+    struct mp_stream_seek_t seek_s = { .offset = offset, .whence = offset > 0 ? MP_SEEK_SET : MP_SEEK_CUR };
+    // Where the first byte is read from, or -1 if the file can't seek back.
+    mp_off_t start = -1;
+    if (stream->ioctl(file, MP_STREAM_SEEK, (uintptr_t)&seek_s, &errcode) != MP_STREAM_ERROR) {
+        start = seek_s.offset;
+    } else if (offset > 0) {
+        mp_raise_OSError(errcode);
+    }
+
+    size_t block_size = MIN(count, SENDFILE_BLOCK_SIZE);
+    byte *block = m_new(byte, block_size);
+    mp_uint_t total = 0;
+    bool stopped = false;
+    bool interrupted = false;
+    // The error to raise if nothing was sent: read_error, or else the send error.
+    void *error = NULL;
+    int read_error = 0;
+    while (count > 0 && !stopped) {
+        mp_uint_t len = mp_stream_read_exactly(file, block, MIN(count, block_size), &read_error);
+        if (read_error != 0) {
+            stopped = true;
+            break;
+        }
+        if (len == 0) {
+            break;
+        }
+        count -= len;
+        const byte *buf = block;
+        while (len > 0) {
+            mp_int_t ret = send_catching(self, buf, len, &error);
+            if (ret == -1) {
+                stopped = true;
+                break;
+            }
+            buf += ret;
+            len -= ret;
+            total += ret;
+            if (len > 0) {
+                RUN_BACKGROUND_TASKS;
+                // Allow user to break out of sendfile with a KeyboardInterrupt.
+                if (mp_hal_is_interrupted()) {
+                    interrupted = true;
+                    stopped = true;
+                    break;
+                }
+            }
+        }
+    }
+    m_del(byte, block, block_size);
+    if (stopped && start >= 0) {
+        // Leave the file after the last byte sent so that it can be resumed,
+        // whatever was read but not sent.
+        seek_s.offset = start + total;
+        seek_s.whence = MP_SEEK_SET;
+        stream->ioctl(file, MP_STREAM_SEEK, (uintptr_t)&seek_s, &errcode);
+    }
+    if (stopped && !interrupted && total == 0) {
+        if (read_error != 0) {
+            mp_raise_OSError(read_error);
+        }
+        raise_send_error(error);
+    }
+    return total;
+}
@@ -0,0 +1,40 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// The send and receive loops behind Socket.sendmsg, recvmsg_into and sendfile.
+// They only use the socket through the link callbacks, so that they can be
+// tested against a simulated socket.
+//
+// Once some bytes have been sent or received, an OSError from a later call is
+// not raised. The bytes so far are returned instead, and the error happens
+// again on the next call.
+typedef struct {
+    void *link;
+    // Like common_hal_socketpool_socket_send(): returns the bytes sent, or -1
+    // when the connection is broken, and raises OSError on other errors.
+    mp_int_t (*send)(void *link, const uint8_t *buf, size_t len);
+    // Like common_hal_socketpool_socket_recv_into(): returns the bytes
+    // received and raises OSError on errors.
+    mp_uint_t (*recv_into)(void *link, uint8_t *buf, size_t len);
+    // True when recv_into won't wait.
+    bool (*readable)(void *link);
+} socketpool_transfer_t;
+
+// Sends the buffers in turn, stopping at the first one that isn't sent completely.
+mp_uint_t socketpool_transfer_sendmsg(const socketpool_transfer_t *self, size_t n, const mp_obj_t *buffers);
+// Receives into the buffers in turn. Only the first buffer waits for data.
+mp_uint_t socketpool_transfer_recvmsg_into(const socketpool_transfer_t *self, size_t n, const mp_obj_t *buffers);
+// Sends up to count bytes of file from offset, or from its current position
+// when offset is 0. The file is left after the last byte sent.
+mp_uint_t socketpool_transfer_sendfile(const socketpool_transfer_t *self, mp_obj_t file, mp_int_t offset, size_t count);
@@ -9,6 +9,7 @@
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/Note.h"
+#include "py/gc.h"
 #include "py/runtime.h"
 #include <math.h>
 #include <stdlib.h>
@@ -394,6 +395,8 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
     synth->buffer_length = SYNTHIO_MAX_DUR * SYNTHIO_BYTES_PER_SAMPLE * channel_count;
     synth->buffers[0] = m_malloc(synth->buffer_length);
     synth->buffers[1] = m_malloc(synth->buffer_length);
+    GC_SET_ALLOC_KIND(synth->buffers[0], AUDIO);
+    GC_SET_ALLOC_KIND(synth->buffers[1], AUDIO);
     synth->channel_count = channel_count;
     synth->other_channel = -1;
     synth->waveform_obj = waveform_obj;
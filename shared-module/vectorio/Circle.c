@@ -44,6 +44,37 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+uint32_t common_hal_vectorio_circle_get_span(void *obj, int16_t y, int16_t x, int16_t *out_x1, int16_t *out_x2) {
+    vectorio_circle_t *self = obj;
+    int32_t radius = self->radius;
+    y = abs(y);
+    if (y > radius) {
+        return 0;
+    }
+    // The widest half-span h with h*h + y*y <= radius*radius, which is exactly the set of
+    // pixels get_pixel covers on this row.
+    uint32_t remainder = radius * radius - (int32_t)y * y;
+    uint32_t half_width = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > remainder) {
+        bit >>= 2;
+    }
+    for (; bit != 0; bit >>= 2) {
+        if (remainder >= half_width + bit) {
+            remainder -= half_width + bit;
+            half_width = (half_width >> 1) + bit;
+        } else {
+            half_width >>= 1;
+        }
+    }
+    if (x > (int32_t)half_width) {
+        return 0;
+    }
+    *out_x1 = -(int16_t)half_width;
+    *out_x2 = half_width + 1;
+    return self->color_index;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
@@ -34,6 +34,8 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 
     int16_t *points_list = gc_realloc(self->points_list, 2 * len * sizeof(uint16_t), true);
     VECTORIO_POLYGON_DEBUG("realloc(%p, %d) -> %p", self->points_list, 2 * len * sizeof(uint16_t), points_list);
+    self->span_crossings = gc_realloc(self->span_crossings, len * sizeof(int32_t), true);
+    self->span_row_valid = false;
 
     // In case the validation calls below fail, set these values temporarily
     self->points_list = NULL;
@@ -65,6 +67,9 @@ void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t po
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
     self->len = 0;
+    self->span_crossings = NULL;
+    self->span_crossing_count = 0;
+    self->span_row_valid = false;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
@@ -185,6 +190,87 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Smallest integer not less than numerator / denominator, for a positive denominator.
+__attribute__((always_inline)) static inline int32_t ceil_div(int32_t numerator, int32_t denominator) {
+    if (numerator >= 0) {
+        return (numerator + denominator - 1) / denominator;
+    }
+    return -((-numerator) / denominator);
+}
+
+// Builds the sorted edge table for one row. Each edge crossing the row contributes its winding
+// to every pixel strictly left of its crossing x, using the same half-open rule and line_side
+// sign test as get_pixel, so a pixel's winding number is the sum over crossings right of it.
+static void _compute_row_crossings(vectorio_polygon_t *self, int16_t y) {
+    uint16_t count = 0;
+    int16_t x1 = self->points_list[0];
+    int16_t y1 = self->points_list[1];
+    for (uint16_t i = 2; i <= self->len + 1; i += 2) {
+        int16_t x2 = self->points_list[i % self->len];
+        int16_t y2 = self->points_list[(i + 1) % self->len];
+        bool upward = y1 <= y && y2 > y;
+        bool downward = y1 > y && y2 <= y;
+        if (upward || downward) {
+            // The edge covers pixels with px < x1 + (y - y1) * dx / dy.
+            int32_t numerator = (int32_t)(y - y1) * (x2 - x1);
+            int32_t denominator = y2 - y1;
+            if (denominator < 0) {
+                numerator = -numerator;
+                denominator = -denominator;
+            }
+            int32_t crossing = x1 + ceil_div(numerator, denominator);
+            // Packed so that sorting orders by x. Multiplied rather than shifted, as
+            // crossing is negative left of the origin.
+            int32_t entry = crossing * 2 + (upward ? 1 : 0);
+            // Insertion sort; rows rarely cross more than a handful of edges.
+            uint16_t j = count;
+            while (j > 0 && self->span_crossings[j - 1] > entry) {
+                self->span_crossings[j] = self->span_crossings[j - 1];
+                --j;
+            }
+            self->span_crossings[j] = entry;
+            ++count;
+        }
+        x1 = x2;
+        y1 = y2;
+    }
+    self->span_crossing_count = count;
+    self->span_row = y;
+    self->span_row_valid = true;
+}
+
+uint32_t common_hal_vectorio_polygon_get_span(void *obj, int16_t y, int16_t x, int16_t *out_x1, int16_t *out_x2) {
+    vectorio_polygon_t *self = obj;
+
+    if (self->len == 0) {
+        return 0;
+    }
+    if (!self->span_row_valid || self->span_row != y) {
+        _compute_row_crossings(self, y);
+    }
+
+    // Sweep left to right. Pixels in [crossing[k - 1], crossing[k]) have winding number
+    // -(sum of windings of crossings 0..k-1), so runs open and close where that prefix
+    // sum leaves and returns to zero.
+    int16_t winding_number = 0;
+    int32_t run_start = 0;
+    for (uint16_t k = 0; k < self->span_crossing_count; ++k) {
+        int32_t entry = self->span_crossings[k];
+        bool upward = entry % 2 != 0;
+        int32_t crossing = (entry - upward) / 2;
+        int16_t previous = winding_number;
+        winding_number += upward ? 1 : -1;
+        if (previous == 0 && winding_number != 0) {
+            run_start = crossing;
+        } else if (previous != 0 && winding_number == 0 && crossing > run_start && crossing > x) {
+            *out_x1 = run_start;
+            *out_x2 = crossing;
+            return self->color_index;
+        }
+    }
+    return 0;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
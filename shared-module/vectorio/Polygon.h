@@ -17,6 +17,12 @@ typedef struct {
     int16_t *points_list;
     uint16_t len;
     uint16_t color_index;
+    // Sorted edge crossings of the most recently rasterized row, encoded as
+    // (x << 1) | upward. Sized for one entry per edge.
+    int32_t *span_crossings;
+    uint16_t span_crossing_count;
+    int16_t span_row;
+    bool span_row_valid;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
 } vectorio_polygon_t;
@@ -33,6 +33,16 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+uint32_t common_hal_vectorio_rectangle_get_span(void *obj, int16_t y, int16_t x, int16_t *out_x1, int16_t *out_x2) {
+    vectorio_rectangle_t *self = obj;
+    if (y < 0 || y >= self->height || x >= self->width || self->width == 0) {
+        return 0;
+    }
+    *out_x1 = 0;
+    *out_x2 = self->width;
+    return self->color_index;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "stdlib.h"
+#include <string.h>
 
 #include "shared-module/vectorio/__init__.h"
 #include "shared-bindings/vectorio/VectorShape.h"
@@ -320,59 +321,128 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
-bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
-    // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
-    //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
-    //   To make it relative to the VectorShape position, we must shift it.
-    // Pixels are drawn on the screen_area (shifted) coordinate space, while pixels are _determined_ from
-    //   the shape_area (unshifted) space.
-    #ifdef VECTORIO_PERF
-    uint64_t start = common_hal_time_monotonic_ns();
-    uint64_t pixel_time = 0;
-    #endif
+// Writes one shaded pixel at pixel_index of the area buffer.
+static void _write_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint32_t pixel_index, uint16_t linestride_px, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", pixel);
+        *(((uint16_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", pixel);
+        *(((uint32_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", pixel);
+        *(((uint8_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
 
-    if (self->hidden) {
-        return false;
+// Writes count copies of pixel starting at pixel_index, which must all lie in one buffer row.
+static void _write_pixels(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint32_t pixel_index, uint16_t count, uint16_t linestride_px, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        uint16_t *p = ((uint16_t *)buffer) + pixel_index;
+        if (count > 0 && ((uintptr_t)p & 2) != 0) {
+            *p++ = pixel;
+            count--;
+        }
+        uint32_t pair = (pixel & 0xffff) | (pixel << 16);
+        uint32_t *words = (uint32_t *)p;
+        for (uint16_t i = 0; i < count / 2; i++) {
+            words[i] = pair;
+        }
+        if (count & 1) {
+            p[count - 1] = pixel;
+        }
+    } else if (colorspace->depth == 32) {
+        uint32_t *p = buffer + pixel_index;
+        for (uint16_t i = 0; i < count; i++) {
+            p[i] = pixel;
+        }
+    } else if (colorspace->depth == 8) {
+        memset(((uint8_t *)buffer) + pixel_index, pixel, count);
+    } else {
+        for (uint16_t i = 0; i < count; i++) {
+            _write_pixel(colorspace, buffer, pixel_index + i, linestride_px, pixel);
+        }
     }
+}
 
-    VECTORIO_SHAPE_DEBUG("%p fill_area: fill: {(%5d,%5d), (%5d,%5d)}",
-        self,
-        area->x1, area->y1, area->x2, area->y2
-        );
-    displayio_area_t overlap;
-    if (!displayio_area_compute_overlap(area, &self->current_area, &overlap)) {
-        VECTORIO_SHAPE_DEBUG(" no overlap\n");
-        return false;
+// Fills the unmasked pixels of a run of count pixels starting at pixel_index and marks them in the mask.
+// Works a mask word at a time so runs that no other layer has touched are written with word stores.
+static void _fill_run(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint32_t *mask, uint32_t pixel_index, uint16_t count, uint16_t linestride_px, uint32_t pixel) {
+    uint32_t end = pixel_index + count;
+    while (pixel_index < end) {
+        uint32_t *mask_doubleword = &mask[pixel_index / 32];
+        uint8_t first_bit = pixel_index % 32;
+        uint8_t chunk = MIN(32u - first_bit, end - pixel_index);
+        uint32_t chunk_bits = (chunk == 32 ? 0xffffffff : ((1u << chunk) - 1)) << first_bit;
+        uint32_t unmasked = ~*mask_doubleword & chunk_bits;
+        if (unmasked == chunk_bits) {
+            _write_pixels(colorspace, buffer, pixel_index, chunk, linestride_px, pixel);
+        } else {
+            while (unmasked != 0) {
+                uint8_t bit = __builtin_ctz(unmasked);
+                unmasked &= unmasked - 1;
+                _write_pixel(colorspace, buffer, pixel_index - first_bit + bit, linestride_px, pixel);
+            }
+        }
+        *mask_doubleword |= chunk_bits;
+        pixel_index += chunk;
     }
-    VECTORIO_SHAPE_DEBUG(", overlap: {(%3d,%3d), (%3d,%3d)}", overlap.x1, overlap.y1, overlap.x2, overlap.y2);
+}
 
-    bool full_coverage = displayio_area_equal(area, &overlap);
+static bool _shader_dithers(vectorio_vector_shape_t *self) {
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        return ((displayio_palette_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        return ((displayio_colorconverter_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither;
+    }
+    return false;
+}
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
-    VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
-        self->x, self->y,
-        self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
-        self->absolute_transform->width, self->absolute_transform->height, self->absolute_transform->mirror_x, self->absolute_transform->mirror_y, self->absolute_transform->transpose_xy
-        );
+static void _shade(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->pixel = 0;
+    output_pixel->opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+}
+
+// Generic path: asks the shape about every pixel of the overlap. Used when the transform
+// transposes x and y, because screen rows then map to shape columns.
+static bool _fill_area_per_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, const displayio_area_t *overlap, uint32_t *mask, uint32_t *buffer) {
+    bool full_coverage = displayio_area_equal(area, overlap);
 
     uint16_t linestride_px = displayio_area_width(area);
-    uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
-    uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
-    VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+    uint16_t line_dirty_offset_px = (overlap->y1 - area->y1) * linestride_px;
+    uint16_t column_dirty_offset_px = overlap->x1 - area->x1;
 
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
-    displayio_area_t shape_area;
-    self->ishape.get_area(self->ishape.shape, &shape_area);
-
     uint16_t mask_start_px = line_dirty_offset_px;
-    for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
+    for (input_pixel.y = overlap->y1; input_pixel.y < overlap->y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
-        for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
+        for (input_pixel.x = overlap->x1; input_pixel.x < overlap->x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
-            uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
+            uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap->x1);
             uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
             uint8_t mask_bit = pixel_index % 32;
             VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
@@ -380,7 +450,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
                 continue;
             }
-            output_pixel.pixel = 0;
 
             // Cast input screen coordinates to shape coordinates to pick the pixel to draw
             int16_t pixel_to_get_x;
@@ -388,14 +457,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
 
             VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t pre_pixel = common_hal_time_monotonic_ns();
-            #endif
             input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t post_pixel = common_hal_time_monotonic_ns();
-            pixel_time += post_pixel - pre_pixel;
-            #endif
             VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
 
             // vectorio shapes use 0 to mean "area is not covered."
@@ -406,15 +468,9 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             } else {
                 // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
                 input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                }
+                input_pixel.tile_x = input_pixel.x;
+                input_pixel.tile_y = input_pixel.y;
+                _shade(self, colorspace, &input_pixel, &output_pixel);
 
                 // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
                 if (!output_pixel.opaque) {
@@ -423,47 +479,156 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 }
 
                 *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+                _write_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
+            }
+        }
+        mask_start_px += linestride_px - column_dirty_offset_px;
+    }
+    return full_coverage;
+}
+
+// Span path: each screen row is one shape row, so ask the shape for its covered runs and
+// fill them whole. Every pixel of a shape has the same value, so unless the shader dithers
+// it is shaded once per run rather than once per pixel.
+static bool _fill_area_spans(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, const displayio_area_t *overlap, uint32_t *mask, uint32_t *buffer) {
+    bool full_coverage = displayio_area_equal(area, overlap);
+
+    uint16_t linestride_px = displayio_area_width(area);
+    uint16_t overlap_width = displayio_area_width(overlap);
+    bool mirror_x = self->absolute_transform->dx < 1;
+    bool mirror_y = self->absolute_transform->dy < 1;
+    int16_t origin_x = self->absolute_transform->x + self->absolute_transform->dx * self->x;
+    int16_t origin_y = self->absolute_transform->y + self->absolute_transform->dy * self->y;
+    // The shape columns [shape_x1, shape_x2) that land inside the overlap.
+    int16_t shape_x1 = mirror_x ? origin_x - (overlap->x2 - 1) : overlap->x1 - origin_x;
+    int16_t shape_x2 = shape_x1 + overlap_width;
+    bool dither = _shader_dithers(self);
+
+    displayio_input_pixel_t input_pixel = {0};
+    displayio_output_pixel_t output_pixel = {0};
+    uint32_t shaded_value = 0;
+
+    for (int16_t y = overlap->y1; y < overlap->y2; ++y) {
+        int16_t shape_y = mirror_y ? origin_y - y : y - origin_y;
+        uint32_t row_start = (y - area->y1) * linestride_px + (overlap->x1 - area->x1);
+        int16_t x = shape_x1;
+        while (x < shape_x2) {
+            int16_t run_x1;
+            int16_t run_x2;
+            uint32_t value = self->ishape.get_span(self->ishape.shape, shape_y, x, &run_x1, &run_x2);
+            if (value == 0 || run_x1 >= shape_x2) {
+                break;
+            }
+            run_x1 = MAX(run_x1, x);
+            run_x2 = MIN(run_x2, shape_x2);
+            if (run_x1 > x) {
+                full_coverage = false;
+            }
+            uint16_t count = run_x2 - run_x1;
+            uint32_t run_start = row_start + (mirror_x ? shape_x2 - run_x2 : run_x1 - shape_x1);
+            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p row %3d span [%3d, %3d) -> index %5u", self, y, run_x1, run_x2, run_start);
+
+            input_pixel.pixel = value - 1;
+            if (dither) {
+                for (uint16_t i = 0; i < count; i++) {
+                    uint32_t pixel_index = run_start + i;
+                    uint32_t *mask_doubleword = &mask[pixel_index / 32];
+                    uint32_t mask_bit = 1u << (pixel_index % 32);
+                    if ((*mask_doubleword & mask_bit) != 0) {
+                        continue;
                     }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+                    input_pixel.x = overlap->x1 + (pixel_index - row_start);
+                    input_pixel.y = y;
+                    input_pixel.tile_x = input_pixel.x;
+                    input_pixel.tile_y = input_pixel.y;
+                    _shade(self, colorspace, &input_pixel, &output_pixel);
+                    if (!output_pixel.opaque) {
+                        full_coverage = false;
                     }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
+                    *mask_doubleword |= mask_bit;
+                    _write_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
+                }
+            } else {
+                if (shaded_value != value) {
+                    _shade(self, colorspace, &input_pixel, &output_pixel);
+                    shaded_value = value;
                 }
+                if (!output_pixel.opaque) {
+                    full_coverage = false;
+                }
+                _fill_run(colorspace, buffer, mask, run_start, count, linestride_px, output_pixel.pixel);
             }
+            x = run_x2;
+        }
+        if (x < shape_x2) {
+            VECTORIO_SHAPE_PIXEL_DEBUG(" (row %d not fully covered)", y);
+            full_coverage = false;
         }
-        mask_start_px += linestride_px - column_dirty_offset_px;
     }
+    return full_coverage;
+}
+
+#ifdef VECTORIO_PERF
+// Running totals across all shapes so a refresh loop reports a stable fill rate.
+static uint64_t vectorio_perf_total_ns;
+static uint64_t vectorio_perf_total_pixels;
+#endif
+
+bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
+    // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
+    //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
+    //   To make it relative to the VectorShape position, we must shift it.
+    // Pixels are drawn on the screen_area (shifted) coordinate space, while pixels are _determined_ from
+    //   the shape_area (unshifted) space.
+    #ifdef VECTORIO_PERF
+    uint64_t start = common_hal_time_monotonic_ns();
+    #endif
+
+    if (self->hidden) {
+        return false;
+    }
+
+    VECTORIO_SHAPE_DEBUG("%p fill_area: fill: {(%5d,%5d), (%5d,%5d)}",
+        self,
+        area->x1, area->y1, area->x2, area->y2
+        );
+    displayio_area_t overlap;
+    if (!displayio_area_compute_overlap(area, &self->current_area, &overlap)) {
+        VECTORIO_SHAPE_DEBUG(" no overlap\n");
+        return false;
+    }
+    VECTORIO_SHAPE_DEBUG(", overlap: {(%3d,%3d), (%3d,%3d)}", overlap.x1, overlap.y1, overlap.x2, overlap.y2);
+    VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
+        self->x, self->y,
+        self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
+        self->absolute_transform->width, self->absolute_transform->height, self->absolute_transform->mirror_x, self->absolute_transform->mirror_y, self->absolute_transform->transpose_xy
+        );
+    VECTORIO_SHAPE_DEBUG(", linestride:%3d depth:%2d shape:%s",
+        displayio_area_width(area), colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
+
+    bool full_coverage;
+    if (self->absolute_transform->transpose_xy) {
+        full_coverage = _fill_area_per_pixel(self, colorspace, area, &overlap, mask, buffer);
+    } else {
+        full_coverage = _fill_area_spans(self, colorspace, area, &overlap, mask, buffer);
+    }
+
     #ifdef VECTORIO_PERF
-    uint64_t end = common_hal_time_monotonic_ns();
-    uint32_t pixels = (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1);
-    VECTORIO_PERF("draw %16s -> shape:{%4dpx, %4.1fms,%9.1fpps fill}  shape_pixels:{%6.1fus total, %4.1fus/px}\n",
+    uint64_t elapsed = MAX(1, common_hal_time_monotonic_ns() - start);
+    uint32_t pixels = displayio_area_size(&overlap);
+    vectorio_perf_total_ns += elapsed;
+    vectorio_perf_total_pixels += pixels;
+    VECTORIO_PERF("draw %16s %s -> shape:{%6dpx, %6.3fms, %10.1fpx/s} total:{%8dpx, %10.1fpx/s}\n",
         mp_obj_get_type_str(self->ishape.shape),
-        (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1),
-        (double)((end - start) / 1000000.0),
-        (double)(MAX(1, pixels * (1000000000.0 / (end - start)))),
-        (double)(pixel_time / 1000.0),
-        (double)(pixel_time / 1000.0 / pixels)
+        self->absolute_transform->transpose_xy ? "pixels" : "spans ",
+        pixels,
+        (double)(elapsed / 1000000.0),
+        (double)(pixels * (1000000000.0 / elapsed)),
+        (uint32_t)vectorio_perf_total_pixels,
+        (double)(vectorio_perf_total_pixels * (1000000000.0 / vectorio_perf_total_ns))
         );
     #endif
-    VECTORIO_SHAPE_DEBUG(" -> pixels:%4d\n", (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1));
+    VECTORIO_SHAPE_DEBUG(" -> pixels:%4d\n", displayio_area_size(&overlap));
     return full_coverage;
 }
 
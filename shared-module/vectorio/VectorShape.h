@@ -16,6 +16,10 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Finds the first run [out_x1, out_x2) of covered pixels in shape row y that ends after x.
+// Returns the run's pixel value, or 0 when there are no more covered pixels in the row.
+// The result must agree with get_pixel for every pixel of the row.
+typedef uint32_t get_span_function(mp_obj_t shape, int16_t y, int16_t x, int16_t *out_x1, int16_t *out_x2);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -27,6 +31,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_span_function *get_span;
 } vectorio_ishape_t;
 
 typedef struct {
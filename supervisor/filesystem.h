@@ -36,6 +36,13 @@ fs_user_mount_t *filesystem_circuitpy(void);
 fs_user_mount_t *filesystem_for_path(const char *path_in, const char **path_under_mount);
 bool filesystem_native_fatfs(fs_user_mount_t *fs_mount);
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+#include "lib/littlefs/lfs2.h"
+// The littlefs CIRCUITPY if the path is on it, with the path to use there, or
+// NULL. Workflows use it directly, as they use FatFs for a FAT filesystem.
+lfs2_t *filesystem_lfs_for_path(const char *path_in, const char **path_under_mount);
+#endif
+
 // We have two levels of locking. filesystem_* calls grab a shared blockdev lock to allow
 // CircuitPython's fatfs code to edit the blocks. blockdev_* calls grab a lock to mutate blocks
 // directly, excluding any filesystem_* locks.
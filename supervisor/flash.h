@@ -26,6 +26,10 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num,
 
 struct _fs_user_mount_t;
 void supervisor_flash_init_vfs(struct _fs_user_mount_t *vfs);
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+struct _mp_vfs_blockdev_t;
+void supervisor_flash_init_blockdev(struct _mp_vfs_blockdev_t *blockdev);
+#endif
 void supervisor_flash_flush(void);
 void supervisor_flash_release_cache(void);
 
@@ -120,9 +120,135 @@ static uint64_t truncate_time(uint64_t input_time, DWORD *fattime) {
     return truncated_time;
 }
 
+// Used by write and write data to know when the write is complete.
+static size_t total_write_length;
+static uint64_t _truncated_time;
+
 // Used by read and write.
 static FIL active_file;
 static fs_user_mount_t *active_mount;
+static bool active_file_writing;
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+// Set instead of active_mount when the active file is on a littlefs CIRCUITPY.
+static lfs2_t *active_lfs;
+static lfs2_file_t active_lfs_file;
+static supervisor_workflow_lfs_file_config_t active_lfs_config;
+#endif
+
+// Opens the active file for reading, or for writing with the given
+// modification time. Returns the status to reply with.
+static uint8_t _open_active_file(const char *full_path, bool write, uint64_t modification_time) {
+    const char *mount_path;
+    active_file_writing = write;
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    active_lfs = filesystem_lfs_for_path(full_path, &mount_path);
+    if (active_lfs != NULL) {
+        _truncated_time = modification_time;
+        supervisor_workflow_lfs_file_config(&active_lfs_config, write ? modification_time : 0);
+        int flags = write ? LFS2_O_WRONLY | LFS2_O_CREAT : LFS2_O_RDONLY;
+        if (lfs2_file_opencfg(active_lfs, &active_lfs_file, mount_path, flags, &active_lfs_config.cfg) != LFS2_ERR_OK) {
+            active_lfs = NULL;
+            return STATUS_ERROR;
+        }
+        return STATUS_OK;
+    }
+    #endif
+    active_mount = filesystem_for_path(full_path, &mount_path);
+    if (active_mount == NULL || !filesystem_native_fatfs(active_mount)) {
+        return STATUS_ERROR;
+    }
+    FATFS *fs = &active_mount->fatfs;
+    if (!write) {
+        return f_open(fs, &active_file, mount_path, FA_READ) == FR_OK ? STATUS_OK : STATUS_ERROR;
+    }
+    if (!filesystem_lock(active_mount)) {
+        return STATUS_ERROR_READONLY;
+    }
+    DWORD fattime;
+    _truncated_time = truncate_time(modification_time, &fattime);
+    override_fattime(fattime);
+    if (f_open(fs, &active_file, mount_path, FA_WRITE | FA_OPEN_ALWAYS) != FR_OK) {
+        filesystem_unlock(active_mount);
+        override_fattime(0);
+        return STATUS_ERROR;
+    }
+    return STATUS_OK;
+}
+
+static uint32_t _active_file_size(void) {
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    if (active_lfs != NULL) {
+        lfs2_soff_t size = lfs2_file_size(active_lfs, &active_lfs_file);
+        return size < 0 ? 0 : size;
+    }
+    #endif
+    return f_size(&active_file);
+}
+
+static void _active_file_seek(uint32_t offset) {
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    if (active_lfs != NULL) {
+        lfs2_file_seek(active_lfs, &active_lfs_file, offset, LFS2_SEEK_SET);
+        return;
+    }
+    #endif
+    f_lseek(&active_file, offset);
+}
+
+// Returns the number of bytes read, which is 0 on an error.
+static size_t _active_file_read(void *buf, size_t len) {
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    if (active_lfs != NULL) {
+        lfs2_ssize_t quantity_read = lfs2_file_read(active_lfs, &active_lfs_file, buf, len);
+        return quantity_read < 0 ? 0 : quantity_read;
+    }
+    #endif
+    UINT quantity_read;
+    if (f_read(&active_file, buf, len, &quantity_read) != FR_OK) {
+        return 0;
+    }
+    return quantity_read;
+}
+
+// Returns the number of bytes written, which is 0 on an error.
+static size_t _active_file_write(const void *buf, size_t len) {
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    if (active_lfs != NULL) {
+        lfs2_ssize_t written = lfs2_file_write(active_lfs, &active_lfs_file, buf, len);
+        return written < 0 ? 0 : written;
+    }
+    #endif
+    UINT actual;
+    if (f_write(&active_file, buf, len, &actual) != FR_OK) {
+        return 0;
+    }
+    return actual;
+}
+
+// Closes the active file. A written file is truncated at the current position
+// first, and its filesystem unlocked.
+static void _close_active_file(void) {
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    if (active_lfs != NULL) {
+        if (active_file_writing) {
+            lfs2_file_truncate(active_lfs, &active_lfs_file, lfs2_file_tell(active_lfs, &active_lfs_file));
+        }
+        // This also writes the modification time.
+        lfs2_file_close(active_lfs, &active_lfs_file);
+        active_lfs = NULL;
+        return;
+    }
+    #endif
+    if (active_file_writing) {
+        f_truncate(&active_file);
+    }
+    f_close(&active_file);
+    if (active_file_writing) {
+        override_fattime(0);
+        filesystem_unlock(active_mount);
+    }
+}
+
 static uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
     struct read_command *command = (struct read_command *)raw_buf;
     size_t header_size = sizeof(struct read_command);
@@ -145,22 +271,12 @@ static uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
     char *full_path = (char *)((uint8_t *)command) + header_size;
     full_path[command->path_length] = '\0';
 
-    const char *mount_path;
-    active_mount = filesystem_for_path(full_path, &mount_path);
-    if (active_mount == NULL || !filesystem_native_fatfs(active_mount)) {
-        response.status = STATUS_ERROR;
-        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
-        return ANY_COMMAND;
-    }
-
-    FATFS *fs = &active_mount->fatfs;
-    FRESULT result = f_open(fs, &active_file, mount_path, FA_READ);
-    if (result != FR_OK) {
-        response.status = STATUS_ERROR;
+    response.status = _open_active_file(full_path, false, 0);
+    if (response.status != STATUS_OK) {
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
         return ANY_COMMAND;
     }
-    uint32_t total_length = f_size(&active_file);
+    uint32_t total_length = _active_file_size();
     // Write out the response header.
     uint32_t offset = command->chunk_offset;
     uint32_t chunk_size = command->chunk_size;
@@ -169,20 +285,22 @@ static uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
     response.total_length = total_length;
     response.data_size = chunk_size;
     common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
-    f_lseek(&active_file, offset);
+    _active_file_seek(offset);
     // Write out the chunk contents. We can do this in small pieces because PacketBuffer
     // will assemble them into larger packets of its own.
     size_t chunk_end = offset + chunk_size;
     while (offset < chunk_end) {
-        size_t quantity_read;
         size_t read_amount = MIN(response_size, chunk_end - offset);
-        f_read(&active_file, data_buffer, read_amount, &quantity_read);
+        size_t quantity_read = _active_file_read(data_buffer, read_amount);
+        if (quantity_read == 0) {
+            break;
+        }
         offset += quantity_read;
         // TODO: Do something if the read fails
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, data_buffer, quantity_read, NULL, 0);
     }
     if (offset >= total_length) {
-        f_close(&active_file);
+        _close_active_file();
         return ANY_COMMAND;
     }
     return READ_PACING;
@@ -195,23 +313,22 @@ static uint8_t _process_read_pacing(const uint8_t *raw_buf, size_t command_len)
     response.status = STATUS_OK;
     size_t response_size = sizeof(struct read_data);
 
-    uint32_t total_length = f_size(&active_file);
+    uint32_t total_length = _active_file_size();
     // Write out the response header.
     uint32_t chunk_size = MIN(command->chunk_size, total_length - command->chunk_offset);
     response.chunk_offset = command->chunk_offset;
     response.total_length = total_length;
     response.data_size = chunk_size;
     common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
-    f_lseek(&active_file, command->chunk_offset);
+    _active_file_seek(command->chunk_offset);
     // Write out the chunk contents. We can do this in small pieces because PacketBuffer
     // will assemble them into larger packets of its own.
     size_t chunk_offset = 0;
     uint8_t data[20];
     while (chunk_offset < chunk_size) {
-        size_t quantity_read;
         size_t read_size = MIN(chunk_size - chunk_offset, sizeof(data));
-        FRESULT result = f_read(&active_file, &data, read_size, &quantity_read);
-        if (quantity_read == 0 || result != FR_OK) {
+        size_t quantity_read = _active_file_read(&data, read_size);
+        if (quantity_read == 0) {
             // TODO: If we can't read everything, then the file must have been shortened. Maybe we
             // should return 0s to pad it out.
             break;
@@ -220,16 +337,12 @@ static uint8_t _process_read_pacing(const uint8_t *raw_buf, size_t command_len)
         chunk_offset += quantity_read;
     }
     if ((chunk_offset + chunk_size) >= total_length) {
-        f_close(&active_file);
+        _close_active_file();
         return ANY_COMMAND;
     }
     return READ_PACING;
 }
 
-// Used by write and write data to know when the write is complete.
-static size_t total_write_length;
-static uint64_t _truncated_time;
-
 static uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     struct write_command *command = (struct write_command *)raw_buf;
     size_t header_size = sizeof(struct write_command);
@@ -251,31 +364,11 @@ static uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     char *full_path = (char *)command->path;
     full_path[command->path_length] = '\0';
 
-    const char *mount_path;
-    active_mount = filesystem_for_path(full_path, &mount_path);
-    if (active_mount == NULL || !filesystem_native_fatfs(active_mount)) {
-        response.status = STATUS_ERROR;
+    response.status = _open_active_file(full_path, true, command->modification_time);
+    if (response.status != STATUS_OK) {
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
         return ANY_COMMAND;
     }
-    if (!filesystem_lock(active_mount)) {
-        response.status = STATUS_ERROR_READONLY;
-        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
-        return ANY_COMMAND;
-    }
-
-    FATFS *fs = &active_mount->fatfs;
-    DWORD fattime;
-    _truncated_time = truncate_time(command->modification_time, &fattime);
-    override_fattime(fattime);
-    FRESULT result = f_open(fs, &active_file, mount_path, FA_WRITE | FA_OPEN_ALWAYS);
-    if (result != FR_OK) {
-        response.status = STATUS_ERROR;
-        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
-        filesystem_unlock(active_mount);
-        override_fattime(0);
-        return ANY_COMMAND;
-    }
     // Write out the pacing response.
 
     // Align the next chunk to a sector boundary.
@@ -283,11 +376,8 @@ static uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     size_t chunk_size = MIN(total_write_length - offset, 512 - (offset % 512));
     // Special case when truncating the file. (Deleting stuff off the end.)
     if (chunk_size == 0) {
-        f_lseek(&active_file, offset);
-        f_truncate(&active_file);
-        f_close(&active_file);
-        override_fattime(0);
-        filesystem_unlock(active_mount);
+        _active_file_seek(offset);
+        _close_active_file();
     }
     response.offset = offset;
     response.free_space = chunk_size;
@@ -312,8 +402,7 @@ static uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
-        filesystem_unlock(active_mount);
-        override_fattime(0);
+        _close_active_file();
         return ANY_COMMAND;
     }
     // We need to receive another packet to have the full path.
@@ -321,15 +410,13 @@ static uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
         return THIS_COMMAND;
     }
     uint32_t offset = command->offset;
-    f_lseek(&active_file, offset);
-    UINT actual;
-    f_write(&active_file, command->data, command->data_size, &actual);
+    _active_file_seek(offset);
+    size_t actual = _active_file_write(command->data, command->data_size);
     if (actual < command->data_size) { // -1 for the null we'll write
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
-        filesystem_unlock(active_mount);
-        override_fattime(0);
+        _close_active_file();
         return ANY_COMMAND;
     }
     offset += command->data_size;
@@ -340,10 +427,7 @@ static uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
     response.truncated_time = _truncated_time;
     common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
     if (total_write_length == offset) {
-        f_truncate(&active_file);
-        f_close(&active_file);
-        override_fattime(0);
-        filesystem_unlock(active_mount);
+        _close_active_file();
         // Don't reload until everything is written out of the packet buffer.
         common_hal_bleio_packet_buffer_flush(&_transfer_packet_buffer);
         return ANY_COMMAND;
@@ -442,6 +526,90 @@ static void send_listdir_entry_header(const struct listdir_entry *entry, mp_int_
     common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, ((const uint8_t *)entry) + 16, response_size - 16, NULL, 0);
 }
 
+static void send_listdir_entry(struct listdir_entry *entry, const char *name, mp_int_t max_packet_size) {
+    size_t name_length = strlen(name);
+    entry->path_length = name_length;
+    send_listdir_entry_header(entry, max_packet_size);
+    size_t fn_offset = 0;
+    while (fn_offset < name_length) {
+        size_t fn_size = MIN(name_length - fn_offset, 4);
+        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, ((const uint8_t *)name) + fn_offset, fn_size, NULL, 0);
+        fn_offset += fn_size;
+    }
+}
+
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+static bool _lfs_dot_entry(const struct lfs2_info *info) {
+    return strcmp(info->name, ".") == 0 || strcmp(info->name, "..") == 0;
+}
+
+static uint8_t _process_lfs_listdir(lfs2_t *lfs, const char *path, struct listdir_entry *entry, mp_int_t max_packet_size) {
+    // The entries are written over the path so keep a copy of it, without a
+    // trailing / so that entry names can be appended.
+    size_t path_length = strlen(path);
+    if (path[path_length - 1] == '/') {
+        path_length--;
+    }
+    char dir_path[path_length + 1];
+    memcpy(dir_path, path, path_length);
+    dir_path[path_length] = '\0';
+
+    lfs2_dir_t dir;
+    int res = lfs2_dir_open(lfs, &dir, path);
+
+    entry->command = LISTDIR_ENTRY;
+    entry->status = STATUS_OK;
+    entry->path_length = 0;
+    entry->entry_number = 0;
+    entry->entry_count = 0;
+    entry->flags = 0;
+
+    if (res != LFS2_ERR_OK) {
+        entry->status = STATUS_ERROR_NO_FILE;
+        send_listdir_entry_header(entry, max_packet_size);
+        return ANY_COMMAND;
+    }
+    struct lfs2_info info;
+    size_t total_entries = 0;
+    while (lfs2_dir_read(lfs, &dir, &info) > 0) {
+        if (!_lfs_dot_entry(&info)) {
+            total_entries += 1;
+        }
+    }
+    lfs2_dir_rewind(lfs, &dir);
+    entry->entry_count = total_entries;
+    size_t i = 0;
+    while (i < total_entries && lfs2_dir_read(lfs, &dir, &info) > 0) {
+        if (_lfs_dot_entry(&info)) {
+            continue;
+        }
+        entry->entry_number = i++;
+        // The modification time is kept on the entry so look it up by its full path.
+        size_t name_length = strlen(info.name);
+        char full_path[path_length + 1 + name_length + 1];
+        memcpy(full_path, dir_path, path_length);
+        full_path[path_length] = '/';
+        memcpy(full_path + path_length + 1, info.name, name_length + 1);
+        entry->truncated_time = supervisor_workflow_lfs_get_mtime(lfs, full_path);
+        if (info.type == LFS2_TYPE_DIR) {
+            entry->flags = 1; // Directory
+            entry->file_size = 0;
+        } else {
+            entry->flags = 0;
+            entry->file_size = info.size;
+        }
+        send_listdir_entry(entry, info.name, max_packet_size);
+    }
+    lfs2_dir_close(lfs, &dir);
+    entry->path_length = 0;
+    entry->entry_number = entry->entry_count;
+    entry->flags = 0;
+    entry->file_size = 0;
+    send_listdir_entry_header(entry, max_packet_size);
+    return ANY_COMMAND;
+}
+#endif
+
 static uint8_t _process_listdir(uint8_t *raw_buf, size_t command_len) {
     const struct listdir_command *command = (struct listdir_command *)raw_buf;
     struct listdir_entry *entry = (struct listdir_entry *)raw_buf;
@@ -469,6 +637,12 @@ static uint8_t _process_listdir(uint8_t *raw_buf, size_t command_len) {
     _terminate_path(full_path, command->path_length);
 
     const char *mount_path;
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    lfs2_t *lfs = filesystem_lfs_for_path(full_path, &mount_path);
+    if (lfs != NULL) {
+        return _process_lfs_listdir(lfs, mount_path, entry, max_packet_size);
+    }
+    #endif
     active_mount = filesystem_for_path(full_path, &mount_path);
     if (active_mount == NULL || !filesystem_native_fatfs(active_mount)) {
         entry->command = LISTDIR_ENTRY;
@@ -522,15 +696,7 @@ static uint8_t _process_listdir(uint8_t *raw_buf, size_t command_len) {
             entry->file_size = file_info.fsize;
         }
 
-        size_t name_length = strlen(file_info.fname);
-        entry->path_length = name_length;
-        send_listdir_entry_header(entry, max_packet_size);
-        size_t fn_offset = 0;
-        while (fn_offset < name_length) {
-            size_t fn_size = MIN(name_length - fn_offset, 4);
-            common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, ((uint8_t *)file_info.fname) + fn_offset, fn_size, NULL, 0);
-            fn_offset += fn_size;
-        }
+        send_listdir_entry(entry, file_info.fname, max_packet_size);
     }
     f_closedir(&dir);
     entry->path_length = 0;
@@ -667,6 +833,12 @@ void supervisor_bluetooth_file_transfer_background(void) {
 void supervisor_bluetooth_file_transfer_disconnected(void) {
     next_command = ANY_COMMAND;
     current_offset = 0;
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    if (active_lfs != NULL) {
+        lfs2_file_close(active_lfs, &active_lfs_file);
+        active_lfs = NULL;
+    }
+    #endif
     f_close(&active_file);
     autoreload_resume(AUTORELOAD_SUSPEND_BLE);
 }
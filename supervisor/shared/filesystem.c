@@ -7,6 +7,7 @@
 #include "supervisor/filesystem.h"
 
 #include "extmod/vfs_fat.h"
+#include "extmod/vfs_lfs.h"
 #include "lib/oofatfs/ff.h"
 #include "lib/oofatfs/diskio.h"
 
@@ -25,6 +26,12 @@ void filesystem_background(void) {
     if (filesystem_flush_requested) {
         filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
         // Flush but keep caches
+        #if MICROPY_FATFS_CACHE_SECTORS
+        fs_user_mount_t *circuitpy = filesystem_circuitpy();
+        if (circuitpy != NULL) {
+            fatfs_cache_write_back(circuitpy);
+        }
+        #endif
         supervisor_flash_flush();
         filesystem_flush_requested = false;
     }
@@ -57,6 +64,7 @@ static void make_empty_file(FATFS *fatfs, const char *path) {
         make_file_with_contents(fatfs, filename, buffer, sizeof(buffer) - 1); \
 } while (0)
 
+__attribute__((unused)) // unused when CIRCUITPY is littlefs
 static void make_file_with_contents(FATFS *fatfs, const char *filename, const byte *content, UINT size) {
     FIL fs;
     // Create or modify existing code.py file
@@ -69,17 +77,67 @@ static void make_file_with_contents(FATFS *fatfs, const char *filename, const by
     make_empty_file(fatfs, filename)
 #endif
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+static void make_lfs_file(lfs2_t *lfs, const char *path, const char *contents) {
+    uint8_t cache[CIRCUITPY_LITTLEFS_CACHE_SIZE];
+    struct lfs2_file_config cfg = { .buffer = cache };
+    lfs2_file_t file;
+    if (lfs2_file_opencfg(lfs, &file, path, LFS2_O_WRONLY | LFS2_O_CREAT | LFS2_O_TRUNC, &cfg) == 0) {
+        lfs2_file_write(lfs, &file, contents, strlen(contents));
+        lfs2_file_close(lfs, &file);
+    }
+}
+
+static bool init_littlefs(bool create_allowed, bool force_create) {
+    mp_vfs_blockdev_t blockdev = { .flags = 0 };
+    supervisor_flash_init_blockdev(&blockdev);
+
+    int res = mp_vfs_lfs2_mount_native(&blockdev, force_create);
+    if (res == LFS2_ERR_CORRUPT && create_allowed) {
+        // No littlefs superblock, so this is a new or FAT formatted flash.
+        force_create = true;
+        res = mp_vfs_lfs2_mount_native(&blockdev, true);
+    }
+    if (res != 0) {
+        return false;
+    }
+    if (force_create) {
+        // USB can't see a littlefs CIRCUITPY, so there are no files to keep
+        // hosts out. Just make the usual starting point.
+        lfs2_t *lfs = mp_vfs_lfs2_native_lfs();
+        #if CIRCUITPY_SDCARDIO || CIRCUITPY_SDIOIO
+        lfs2_mkdir(lfs, "/sd");
+        #endif
+        #if CIRCUITPY_OS_GETENV
+        make_lfs_file(lfs, "/settings.toml", "");
+        #endif
+        make_lfs_file(lfs, "/code.py", "print(\"Hello World!\")\n");
+        if (lfs2_mkdir(lfs, "/lib") != 0) {
+            return false;
+        }
+        supervisor_flash_flush();
+    }
+    return true;
+}
+#endif
+
 // we don't make this function static because it needs a lot of stack and we
 // want it to be executed without using stack within main() function
 bool filesystem_init(bool create_allowed, bool force_create) {
+    mp_vfs_mount_t *vfs = &_mp_vfs;
+    vfs->len = 0;
+
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    if (!init_littlefs(create_allowed, force_create)) {
+        return false;
+    }
+    vfs->obj = mp_vfs_lfs2_native_vfs();
+    #else
     // init the vfs object
     fs_user_mount_t *vfs_fat = &_internal_vfs;
     vfs_fat->blockdev.flags = 0;
     supervisor_flash_init_vfs(vfs_fat);
 
-    mp_vfs_mount_t *vfs = &_mp_vfs;
-    vfs->len = 0;
-
     // try to mount the flash
     FRESULT res = f_mount(&vfs_fat->fatfs);
     if ((res == FR_NO_FILESYSTEM && create_allowed) || force_create) {
@@ -147,10 +205,11 @@ bool filesystem_init(bool create_allowed, bool force_create) {
     } else if (res != FR_OK) {
         return false;
     }
+    vfs->obj = MP_OBJ_FROM_PTR(vfs_fat);
+    #endif
 
     vfs->str = "/";
     vfs->len = 1;
-    vfs->obj = MP_OBJ_FROM_PTR(vfs_fat);
     vfs->next = NULL;
 
     MP_STATE_VM(vfs_mount_table) = vfs;
@@ -169,6 +228,9 @@ bool filesystem_init(bool create_allowed, bool force_create) {
 void PLACE_IN_ITCM(filesystem_flush)(void) {
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    #if MICROPY_FATFS_CACHE_SECTORS
+    fatfs_cache_flush_all();
+    #endif
     supervisor_flash_flush();
     // Don't keep caches because this is called when starting or stopping the VM.
     supervisor_flash_release_cache();
@@ -215,7 +277,8 @@ bool filesystem_present(void) {
 }
 
 fs_user_mount_t *filesystem_circuitpy(void) {
-    if (!filesystem_present()) {
+    // A littlefs CIRCUITPY can only be used through the VFS.
+    if (!filesystem_present() || CIRCUITPY_FILESYSTEM_LITTLEFS) {
         return NULL;
     }
     return &_internal_vfs;
@@ -243,6 +306,21 @@ fs_user_mount_t *filesystem_for_path(const char *path_in, const char **path_unde
     return fs_mount;
 }
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+lfs2_t *filesystem_lfs_for_path(const char *path_in, const char **path_under_mount) {
+    if (!filesystem_present()) {
+        return NULL;
+    }
+    mp_vfs_mount_t *vfs = mp_vfs_lookup_path(path_in, path_under_mount);
+    if (vfs == MP_VFS_ROOT) {
+        *path_under_mount = "/";
+    } else if (vfs == MP_VFS_NONE || vfs->obj != mp_vfs_lfs2_native_vfs()) {
+        return NULL;
+    }
+    return mp_vfs_lfs2_native_lfs();
+}
+#endif
+
 bool filesystem_native_fatfs(fs_user_mount_t *fs_mount) {
     return fs_mount->base.type == &mp_fat_vfs_type && (fs_mount->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) != 0;
 }
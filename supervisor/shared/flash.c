@@ -196,6 +196,38 @@ MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &supervisor_flash_obj_locals_dict
     );
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+// littlefs gets the whole flash, without the fake MBR that FAT is given.
+static mp_uint_t flash_raw_read_blocks(mp_obj_t self, uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    return supervisor_flash_read_blocks(dest, block_num, num_blocks);
+}
+
+static mp_uint_t flash_raw_write_blocks(mp_obj_t self, const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    return flash_write_blocks(self, src, block_num + PART1_START_BLOCK, num_blocks);
+}
+
+static bool flash_raw_ioctl(mp_obj_t self, size_t cmd, size_t arg, mp_int_t *out_value) {
+    if (cmd == MP_BLOCKDEV_IOCTL_BLOCK_COUNT) {
+        *out_value = supervisor_flash_get_block_count();
+        return true;
+    }
+    return flash_ioctl(self, cmd, arg, out_value);
+}
+
+void supervisor_flash_init_blockdev(mp_vfs_blockdev_t *blockdev) {
+    blockdev->flags |= MP_BLOCKDEV_FLAG_NATIVE | MP_BLOCKDEV_FLAG_HAVE_IOCTL;
+    blockdev->readblocks[0] = mp_const_none;
+    blockdev->readblocks[1] = (mp_obj_t)&supervisor_flash_obj;
+    blockdev->readblocks[2] = (mp_obj_t)flash_raw_read_blocks; // native version
+    blockdev->writeblocks[0] = mp_const_none;
+    blockdev->writeblocks[1] = (mp_obj_t)&supervisor_flash_obj;
+    blockdev->writeblocks[2] = (mp_obj_t)flash_raw_write_blocks; // native version
+    blockdev->u.ioctl[0] = mp_const_none;
+    blockdev->u.ioctl[1] = (mp_obj_t)&supervisor_flash_obj;
+    blockdev->u.ioctl[2] = (mp_obj_t)flash_raw_ioctl; // native version
+}
+#endif
+
 void supervisor_flash_init_vfs(fs_user_mount_t *vfs) {
     vfs->base.type = &mp_fat_vfs_type;
     vfs->blockdev.flags |= MP_BLOCKDEV_FLAG_NATIVE | MP_BLOCKDEV_FLAG_HAVE_IOCTL;
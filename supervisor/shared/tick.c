@@ -27,6 +27,14 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILER
+#include "shared-module/profiler/__init__.h"
+#endif
+
+#if CIRCUITPY_SDCARDIO
+#include "shared-module/sdcardio/__init__.h"
+#endif
+
 #include "shared-bindings/microcontroller/__init__.h"
 
 #if CIRCUITPY_WATCHDOG
@@ -82,6 +90,14 @@ void supervisor_tick(void) {
     keypad_tick();
     #endif
 
+    #if CIRCUITPY_PROFILER
+    profiler_tick();
+    #endif
+
+    #if CIRCUITPY_SDCARDIO
+    sdcardio_tick();
+    #endif
+
     background_callback_add(&tick_callback, supervisor_background_tick, NULL);
 }
 
@@ -23,6 +23,22 @@
 static bool ejected[1] = {true};
 static bool locked[1] = {false};
 
+#if CIRCUITPY_USB_MSC_CACHE_BLOCKS
+// A run of consecutive blocks of the root filesystem. It holds either data read
+// ahead of a sequential read, or the pieces of a write waiting to be written
+// together once the host finishes the WRITE10 command.
+static fs_user_mount_t *cache_vfs;
+static uint32_t cache_lba;
+static uint32_t cache_count;
+static bool cache_dirty;
+// fatfs_sector_write_count when clean data was read, so that writes made by
+// CircuitPython since then can be noticed.
+static uint32_t cache_write_count;
+static uint32_t cache[CIRCUITPY_USB_MSC_CACHE_BLOCKS * MSC_FLASH_BLOCK_SIZE / sizeof(uint32_t)];
+// Where the next read starts if the host is reading sequentially.
+static uint32_t next_read_lba;
+#endif
+
 // The root FS is always at the end of the list.
 static fs_user_mount_t *get_vfs(int lun) {
     // TODO(tannewt): Return the mount which matches the lun where 0 is the end
@@ -40,6 +56,32 @@ static fs_user_mount_t *get_vfs(int lun) {
     return current_mount->obj;
 }
 
+#if CIRCUITPY_USB_MSC_CACHE_BLOCKS
+static bool msc_cache_flush(void) {
+    if (!cache_dirty) {
+        return true;
+    }
+    cache_dirty = false;
+    DRESULT res = disk_write(cache_vfs, (uint8_t *)cache, cache_lba, cache_count);
+    cache_vfs = NULL;
+    return res == RES_OK;
+}
+#endif
+
+// Write back anything the host has written that hasn't reached the device yet.
+static bool msc_flush(fs_user_mount_t *vfs) {
+    bool ok = true;
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS
+    ok = msc_cache_flush();
+    cache_vfs = NULL;
+    #endif
+    #if MICROPY_FATFS_CACHE_SECTORS
+    ok &= fatfs_cache_flush(vfs) == 0;
+    #endif
+    (void)vfs;
+    return ok;
+}
+
 static void _usb_msc_uneject(void) {
     for (uint8_t i = 0; i < sizeof(ejected); i++) {
         ejected[i] = false;
@@ -57,6 +99,7 @@ void usb_msc_umount(void) {
         if (vfs == NULL) {
             continue;
         }
+        msc_flush(vfs);
         blockdev_unlock(vfs);
         locked[i] = false;
     }
@@ -146,7 +189,39 @@ int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buff
         return -1;
     }
 
-    disk_read(vfs, buffer, lba, block_count);
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS
+    if (cache_dirty) {
+        msc_cache_flush();
+    }
+    bool sequential = lba == next_read_lba;
+    next_read_lba = lba + block_count;
+    if (cache_write_count != fatfs_sector_write_count) {
+        cache_vfs = NULL;
+    }
+    bool hit = cache_vfs == vfs && lba >= cache_lba && lba + block_count <= cache_lba + cache_count;
+    if (!hit && sequential && block_count < CIRCUITPY_USB_MSC_CACHE_BLOCKS) {
+        // The host is working through a file or directory, so fetch the blocks
+        // it is likely to ask for next in the same read.
+        uint32_t count = MIN(CIRCUITPY_USB_MSC_CACHE_BLOCKS, disk_block_count - lba);
+        cache_vfs = NULL;
+        if (disk_read(vfs, (uint8_t *)cache, lba, count) == RES_OK) {
+            cache_vfs = vfs;
+            cache_lba = lba;
+            cache_count = count;
+            cache_write_count = fatfs_sector_write_count;
+            hit = true;
+        }
+    }
+    if (hit) {
+        memcpy(buffer, (uint8_t *)cache + (lba - cache_lba) * MSC_FLASH_BLOCK_SIZE,
+            block_count * MSC_FLASH_BLOCK_SIZE);
+        return block_count * MSC_FLASH_BLOCK_SIZE;
+    }
+    #endif
+
+    if (disk_read(vfs, buffer, lba, block_count) != RES_OK) {
+        return -1;
+    }
 
     return block_count * MSC_FLASH_BLOCK_SIZE;
 }
@@ -161,7 +236,31 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t *vfs = get_vfs(lun);
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS
+    if (!cache_dirty) {
+        // Drop any data read ahead; the cache collects this write instead.
+        cache_vfs = NULL;
+    } else if (cache_vfs != vfs || lba != cache_lba + cache_count ||
+               cache_count + block_count > CIRCUITPY_USB_MSC_CACHE_BLOCKS) {
+        if (!msc_cache_flush()) {
+            return -1;
+        }
+    }
+    if (cache_dirty) {
+        memcpy((uint8_t *)cache + cache_count * MSC_FLASH_BLOCK_SIZE, buffer, bufsize);
+        cache_count += block_count;
+    } else if (block_count < CIRCUITPY_USB_MSC_CACHE_BLOCKS) {
+        memcpy(cache, buffer, bufsize);
+        cache_vfs = vfs;
+        cache_lba = lba;
+        cache_count = block_count;
+        cache_dirty = true;
+    } else if (disk_write(vfs, buffer, lba, block_count) != RES_OK) {
+        return -1;
+    }
+    #else
     disk_write(vfs, buffer, lba, block_count);
+    #endif
     // Since by getting here we assume the mount is read-only to
     // MicroPython let's update the cached FatFs sector if it's the one
     // we just wrote.
@@ -184,7 +283,12 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
 // Callback invoked when WRITE10 command is completed (status received and accepted by host).
 // used to flush any pending cache.
 void tud_msc_write10_complete_cb(uint8_t lun) {
-    (void)lun;
+    fs_user_mount_t *vfs = get_vfs(lun);
+    if (vfs != NULL) {
+        // Only hand the blocks to the device. Erasing and programming flash is
+        // still left to the periodic filesystem flush or the host's SYNC.
+        msc_flush(vfs);
+    }
 
     // This write is complete; initiate an autoreload.
     autoreload_resume(AUTORELOAD_SUSPEND_USB);
@@ -235,7 +339,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     if (load_eject) {
         if (!start) {
             // Eject but first flush.
-            if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
+            if (!msc_flush(current_mount) || disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
                 return false;
             } else {
                 blockdev_unlock(current_mount);
@@ -249,7 +353,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     } else {
         if (!start) {
             // Stop the unit but don't eject.
-            if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
+            if (!msc_flush(current_mount) || disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
                 return false;
             }
         }
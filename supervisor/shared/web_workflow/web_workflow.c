@@ -12,6 +12,9 @@
 
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+#include "extmod/vfs_lfs.h"
+#endif
 #include "genhdr/mpversion.h"
 #include "py/mperrno.h"
 #include "py/mpstate.h"
@@ -50,6 +53,10 @@
 #include "shared-module/os/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILER
+#include "shared-bindings/profiler/SamplingProfiler.h"
+#endif
+
 enum request_state {
     STATE_METHOD,
     STATE_PATH,
@@ -652,6 +659,54 @@ static void _reply_redirect(socketpool_socket_obj_t *socket, _request *request,
 }
 #endif
 
+static void _send_directory_json_header(socketpool_socket_obj_t *socket, _request *request, uint32_t free_blocks, uint32_t total_blocks, uint32_t block_size, bool writable) {
+    socketpool_socket_send(socket, (const uint8_t *)OK_JSON, strlen(OK_JSON));
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+    mp_print_t _socket_print = {socket, _print_chunk};
+
+    // Send mount info.
+    mp_printf(&_socket_print,
+        "{\"free\": %u, "
+        "\"total\": %u, "
+        "\"block_size\": %u, "
+        "\"writable\": %s, ", free_blocks, total_blocks, block_size, writable ? "true" : "false");
+
+    // Send file list
+    _send_chunk(socket, "\"files\": [");
+}
+
+static void _send_directory_json_entry(socketpool_socket_obj_t *socket, bool first, const char *name, bool directory, uint32_t modified_s, size_t file_size) {
+    mp_print_t _socket_print = {socket, _print_chunk};
+    if (!first) {
+        _send_chunk(socket, ",");
+    }
+    _send_chunks(socket,
+        "{\"name\": \"", name, "\",",
+        "\"directory\": ", NULL);
+    if (directory) {
+        _send_chunk(socket, "true");
+    } else {
+        _send_chunk(socket, "false");
+    }
+    // We use nanoseconds past Jan 1, 1970 for consistency with BLE API and
+    // LittleFS.
+    _send_chunk(socket, ", ");
+
+    // Manually append zeros to make the time nanoseconds. Support for printing 64 bit numbers
+    // varies across chipsets.
+    mp_printf(&_socket_print, "\"modified_ns\": %lu000000000, ", modified_s);
+    if (directory) {
+        file_size = 0;
+    }
+    mp_printf(&_socket_print, "\"file_size\": %d }", file_size);
+}
+
+static void _send_directory_json_end(socketpool_socket_obj_t *socket) {
+    _send_chunk(socket, "]}");
+    _send_chunk(socket, "");
+}
+
 static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *request, fs_user_mount_t *fs_mount, FF_DIR *dir, const char *request_path, const char *path) {
     FILINFO file_info;
     char *fn = file_info.fname;
@@ -661,12 +716,6 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
         return;
     }
 
-    socketpool_socket_send(socket, (const uint8_t *)OK_JSON, strlen(OK_JSON));
-    _cors_header(socket, request);
-    _send_str(socket, "\r\n");
-    mp_print_t _socket_print = {socket, _print_chunk};
-
-    // Send mount info.
     DWORD free_clusters = 0;
     FATFS *fatfs = &fs_mount->fatfs;
     f_getfree(fatfs, &free_clusters);
@@ -679,65 +728,101 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
     uint32_t cluster_size = fatfs->csize * ssize;
     uint32_t total_clusters = fatfs->n_fatent - 2;
 
-    const char *writable = "false";
+    bool writable = false;
     // Test to see if we can grab the write lock. USB will grab the underlying
     // blockdev lock once it says it is writable. Unlock immediately since we
     // aren't actually writing.
     if (filesystem_lock(fs_mount)) {
         filesystem_unlock(fs_mount);
-        writable = "true";
+        writable = true;
     }
-    mp_printf(&_socket_print,
-        "{\"free\": %u, "
-        "\"total\": %u, "
-        "\"block_size\": %u, "
-        "\"writable\": %s, ", free_clusters, total_clusters, cluster_size, writable);
+    _send_directory_json_header(socket, request, free_clusters, total_clusters, cluster_size, writable);
 
-    // Send file list
-    _send_chunk(socket, "\"files\": [");
     bool first = true;
-
     while (res == FR_OK && fn[0] != 0) {
-        if (!first) {
-            _send_chunk(socket, ",");
-        }
-        _send_chunks(socket,
-            "{\"name\": \"", file_info.fname, "\",",
-            "\"directory\": ", NULL);
-        if ((file_info.fattrib & AM_DIR) != 0) {
-            _send_chunk(socket, "true");
-        } else {
-            _send_chunk(socket, "false");
-        }
-        // We use nanoseconds past Jan 1, 1970 for consistency with BLE API and
-        // LittleFS.
-        _send_chunk(socket, ", ");
-
         uint32_t truncated_time = timeutils_mktime(1980 + (file_info.fdate >> 9),
             (file_info.fdate >> 5) & 0xf,
             file_info.fdate & 0x1f,
             file_info.ftime >> 11,
             (file_info.ftime >> 5) & 0x3f,
             (file_info.ftime & 0x1f) * 2);
-
-        // Manually append zeros to make the time nanoseconds. Support for printing 64 bit numbers
-        // varies across chipsets.
-        mp_printf(&_socket_print, "\"modified_ns\": %lu000000000, ", truncated_time);
-        size_t file_size = 0;
-        if ((file_info.fattrib & AM_DIR) == 0) {
-            file_size = file_info.fsize;
-        }
-        mp_printf(&_socket_print, "\"file_size\": %d }", file_size);
+        _send_directory_json_entry(socket, first, file_info.fname, (file_info.fattrib & AM_DIR) != 0, truncated_time, file_info.fsize);
 
         first = false;
         res = f_readdir(dir, &file_info);
     }
-    _send_chunk(socket, "]}");
-    _send_chunk(socket, "");
+    _send_directory_json_end(socket);
+}
+
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+static uint32_t _lfs_free_blocks(lfs2_t *lfs) {
+    lfs2_ssize_t used = lfs2_fs_size(lfs);
+    if (used < 0) {
+        return 0;
+    }
+    return lfs->cfg->block_count - used;
+}
+
+static void _reply_lfs_directory_json(socketpool_socket_obj_t *socket, _request *request, lfs2_t *lfs, lfs2_dir_t *dir, const char *path) {
+    struct lfs2_info info;
+    int res = lfs2_dir_read(lfs, dir, &info);
+    if (res < 0) {
+        _reply_missing(socket, request);
+        return;
+    }
+
+    // There is no USB mass storage for littlefs so it is always writable here.
+    _send_directory_json_header(socket, request, _lfs_free_blocks(lfs), lfs->cfg->block_count, lfs->cfg->block_size, true);
+
+    size_t pathlen = strlen(path);
+    if (path[pathlen - 1] == '/') {
+        pathlen--;
+    }
+    bool first = true;
+    while (res > 0) {
+        if (strcmp(info.name, ".") != 0 && strcmp(info.name, "..") != 0) {
+            // The modification time is kept on the entry so look it up by its full path.
+            size_t namelen = strlen(info.name);
+            char full_path[pathlen + 1 + namelen + 1];
+            memcpy(full_path, path, pathlen);
+            full_path[pathlen] = '/';
+            memcpy(full_path + pathlen + 1, info.name, namelen + 1);
+            uint64_t modified_ns = supervisor_workflow_lfs_get_mtime(lfs, full_path);
+            _send_directory_json_entry(socket, first, info.name, info.type == LFS2_TYPE_DIR, modified_ns / 1000000000, info.size);
+            first = false;
+        }
+        res = lfs2_dir_read(lfs, dir, &info);
+    }
+    _send_directory_json_end(socket);
 }
+#endif
+
+// Reads up to len bytes of the file into buf and returns how many were read.
+typedef size_t (*_file_read_t)(void *file, uint8_t *buf, size_t len);
 
-static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
-    uint32_t total_length = f_size(active_file);
+static size_t _fat_read(void *file, uint8_t *buf, size_t len) {
+    UINT quantity_read = 0;
+    f_read(file, buf, len, &quantity_read);
+    return quantity_read;
+}
+
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+typedef struct {
+    lfs2_t *lfs;
+    lfs2_file_t file;
+} _lfs_open_file;
+
+static size_t _lfs_read(void *file, uint8_t *buf, size_t len) {
+    _lfs_open_file *open_file = file;
+    lfs2_ssize_t quantity_read = lfs2_file_read(open_file->lfs, &open_file->file, buf, len);
+    if (quantity_read < 0) {
+        return 0;
+    }
+    return quantity_read;
+}
+#endif
+
+static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, uint32_t total_length, _file_read_t read, void *file) {
 
     _send_str(socket, "HTTP/1.1 200 OK\r\n");
     mp_print_t _socket_print = {socket, _print_raw};
@@ -761,8 +846,10 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
     int nodelay_ok = -1;
     while (total_read < total_length) {
         uint8_t data_buffer[64];
-        size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
+        size_t quantity_read = read(file, data_buffer, 64);
+        if (quantity_read == 0) {
+            break;
+        }
         total_read += quantity_read;
         // When getting near the end of the file, disable Nagle's combining algorithm so that
         // data is sent immediately.
@@ -884,15 +971,32 @@ static void _reply_with_diskinfo_json(socketpool_socket_obj_t *socket, _request
     mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table);
     size_t i = 0;
     while (vfs != NULL) {
-        if (i > 0) {
-            _send_chunk(socket, ",");
+        #if CIRCUITPY_FILESYSTEM_LITTLEFS
+        if (vfs->obj == mp_vfs_lfs2_native_vfs()) {
+            if (i > 0) {
+                _send_chunk(socket, ",");
+            }
+            lfs2_t *lfs = mp_vfs_lfs2_native_lfs();
+            mp_printf(&_socket_print,
+                "{\"root\": \"%s\", "
+                "\"free\": %u, "
+                "\"total\": %u, "
+                "\"block_size\": %u, "
+                "\"writable\": true}", vfs->str, _lfs_free_blocks(lfs), lfs->cfg->block_count, lfs->cfg->block_size);
+            i++;
+            vfs = vfs->next;
+            continue;
         }
+        #endif
         fs_user_mount_t *fs = MP_OBJ_TO_PTR(vfs->obj);
         // Skip non-fat and non-native block file systems.
         if (fs->base.type != &mp_fat_vfs_type || (fs->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) == 0) {
             vfs = vfs->next;
             continue;
         }
+        if (i > 0) {
+            _send_chunk(socket, ",");
+        }
         DWORD free_clusters = 0;
         FATFS *fatfs = &fs->fatfs;
         f_getfree(fatfs, &free_clusters);
@@ -925,6 +1029,27 @@ static void _reply_with_diskinfo_json(socketpool_socket_obj_t *socket, _request
     _send_chunk(socket, "");
 }
 
+#if CIRCUITPY_PROFILER
+// Folded stacks from the most recently started profiler.SamplingProfiler,
+// empty if there isn't one.
+static void _reply_with_profile(socketpool_socket_obj_t *socket, _request *request) {
+    _send_strs(socket,
+        "HTTP/1.1 200 OK\r\n",
+        "Transfer-Encoding: chunked\r\n",
+        "Content-Type: text/plain\r\n", NULL);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+    mp_print_t _socket_print = {socket, _print_chunk};
+
+    profiler_samplingprofiler_obj_t *profiler = MP_OBJ_TO_PTR(MP_STATE_VM(sampling_profiler));
+    if (profiler != NULL) {
+        profiler_samplingprofiler_print_folded(profiler, &_socket_print);
+    }
+    // Empty chunk signals the end of the response.
+    _send_chunk(socket, "");
+}
+#endif
+
 
 // FATFS has a two second timestamp resolution but the BLE API allows for nanosecond resolution.
 // This function truncates the time the time to a resolution storable by FATFS and fills in the
@@ -1061,6 +1186,89 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     }
 }
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+static void _write_lfs_file_and_reply(socketpool_socket_obj_t *socket, _request *request, lfs2_t *lfs, const char *path) {
+    supervisor_workflow_lfs_file_config_t config;
+    supervisor_workflow_lfs_file_config(&config, request->timestamp_ms * 1000000);
+    lfs2_file_t active_file;
+    int res = lfs2_file_opencfg(lfs, &active_file, path, LFS2_O_WRONLY, &config.cfg);
+    bool new_file = false;
+    size_t old_length = 0;
+    if (res == LFS2_ERR_NOENT) {
+        new_file = true;
+        res = lfs2_file_opencfg(lfs, &active_file, path, LFS2_O_WRONLY | LFS2_O_CREAT, &config.cfg);
+    } else if (res == LFS2_ERR_OK) {
+        old_length = lfs2_file_size(lfs, &active_file);
+    }
+
+    if (res == LFS2_ERR_NOENT) {
+        _discard_incoming(socket, request->content_length);
+        _reply_missing(socket, request);
+        return;
+    }
+    if (res != LFS2_ERR_OK) {
+        _discard_incoming(socket, request->content_length);
+        _reply_server_error(socket, request);
+        return;
+    }
+
+    // littlefs can't preallocate, so compare with the free space instead. The
+    // old contents are freed as the new ones are written.
+    uint64_t available = (uint64_t)_lfs_free_blocks(lfs) * lfs->cfg->block_size + old_length;
+    if (request->content_length > available) {
+        lfs2_file_close(lfs, &active_file);
+        if (new_file) {
+            lfs2_remove(lfs, path);
+        }
+        // Too large.
+        if (request->expect) {
+            _reply_expectation_failed(socket, request);
+        } else {
+            _discard_incoming(socket, request->content_length);
+            _reply_payload_too_large(socket, request);
+        }
+        return;
+    } else if (request->expect) {
+        _reply_continue(socket, request);
+    }
+    lfs2_file_truncate(lfs, &active_file, 0);
+
+    size_t total_read = 0;
+    bool error = false;
+    while (total_read < request->content_length && !error) {
+        uint8_t bytes[64];
+        size_t read_len = MIN(sizeof(bytes), request->content_length - total_read);
+        int len = socketpool_socket_recv_into(socket, bytes, read_len);
+        if (len < 0) {
+            if (len == -MP_EAGAIN) {
+                continue;
+            }
+            error = true;
+            break;
+        }
+        total_read += len;
+        if (lfs2_file_write(lfs, &active_file, bytes, len) != len) {
+            error = true;
+            break;
+        }
+    }
+
+    // This also writes the modification time.
+    if (lfs2_file_close(lfs, &active_file) != LFS2_ERR_OK) {
+        error = true;
+    }
+
+    if (error) {
+        _discard_incoming(socket, request->content_length - total_read);
+        _reply_server_error(socket, request);
+    } else if (new_file) {
+        _reply_created(socket, request);
+    } else {
+        _reply_no_content(socket, request);
+    }
+}
+#endif
+
 #define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type;
 
 STATIC_FILE(code_html);
@@ -1146,6 +1354,47 @@ static void _decode_percents(char *str) {
     }
 }
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+static bool _reply_lfs(socketpool_socket_obj_t *socket, _request *request, lfs2_t *lfs, char *path, const char *lfs_path, bool directory) {
+    size_t pathlen = strlen(path);
+    if (directory) {
+        if (strcasecmp(request->method, "GET") == 0) {
+            lfs2_dir_t dir;
+            int res = lfs2_dir_open(lfs, &dir, lfs_path);
+            if (res != LFS2_ERR_OK) {
+                _reply_missing(socket, request);
+                return false;
+            }
+            if (request->json) {
+                _reply_lfs_directory_json(socket, request, lfs, &dir, lfs_path);
+            } else if (pathlen == 1) {
+                _REPLY_STATIC(socket, request, directory_html);
+            } else {
+                _reply_missing(socket, request);
+            }
+            lfs2_dir_close(lfs, &dir);
+        }
+    } else { // Dealing with a file.
+        if (strcasecmp(request->method, "GET") == 0) {
+            supervisor_workflow_lfs_file_config_t config;
+            supervisor_workflow_lfs_file_config(&config, 0);
+            _lfs_open_file open_file = { .lfs = lfs };
+            if (lfs2_file_opencfg(lfs, &open_file.file, lfs_path, LFS2_O_RDONLY, &config.cfg) != LFS2_ERR_OK) {
+                _reply_missing(socket, request);
+            } else {
+                uint32_t total_length = lfs2_file_size(lfs, &open_file.file);
+                _reply_with_file(socket, request, path, total_length, _lfs_read, &open_file);
+                lfs2_file_close(lfs, &open_file.file);
+            }
+        } else if (strcasecmp(request->method, "PUT") == 0) {
+            _write_lfs_file_and_reply(socket, request, lfs, lfs_path);
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
 static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
     if (request->redirect) {
         #if CIRCUITPY_MDNS
@@ -1249,6 +1498,13 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
 
             // These responses don't use helpers because they stream data in and
             // out. So, share the mount lookup code.
+            #if CIRCUITPY_FILESYSTEM_LITTLEFS
+            const char *lfs_path;
+            lfs2_t *lfs = filesystem_lfs_for_path(path, &lfs_path);
+            if (lfs != NULL) {
+                return _reply_lfs(socket, request, lfs, path, lfs_path, directory);
+            }
+            #endif
             const char *path_out = NULL;
             mp_vfs_mount_t *vfs = mp_vfs_lookup_path(path, &path_out);
             if (vfs == MP_VFS_NONE) {
@@ -1258,6 +1514,11 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
             fs_user_mount_t *fs_mount;
             if (vfs == MP_VFS_ROOT) {
                 fs_mount = filesystem_circuitpy();
+                // CIRCUITPY may not be FAT.
+                if (fs_mount == NULL) {
+                    _reply_missing(socket, request);
+                    return false;
+                }
             } else {
                 fs_mount = MP_OBJ_TO_PTR(vfs->obj);
                 // Skip non-fat and non-native block file systems.
@@ -1306,7 +1567,7 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                     if (result != FR_OK) {
                         _reply_missing(socket, request);
                     } else {
-                        _reply_with_file(socket, request, path, &active_file);
+                        _reply_with_file(socket, request, path, f_size(&active_file), _fat_read, &active_file);
                     }
 
                     f_close(&active_file);
@@ -1341,6 +1602,18 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
             _reply_with_version_json(socket, request);
         } else if (strcmp(path, "/diskinfo.json") == 0) {
             _reply_with_diskinfo_json(socket, request);
+        #if CIRCUITPY_PROFILER
+        } else if (strcmp(path, "/profile.txt") == 0) {
+            if (!request->authenticated) {
+                if (_api_password[0] != '\0') {
+                    _reply_unauthorized(socket, request);
+                } else {
+                    _reply_forbidden(socket, request);
+                }
+            } else {
+                _reply_with_profile(socket, request);
+            }
+        #endif
         } else if (strcmp(path, "/serial/") == 0) {
             if (!request->authenticated) {
                 if (_api_password[0] != '\0') {
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdbool.h>
+#include <string.h>
 #include "py/mpconfig.h"
 #include "py/mpstate.h"
 #include "py/stackctrl.h"
@@ -15,6 +16,10 @@
 #include "supervisor/shared/serial.h"
 #include "supervisor/shared/workflow.h"
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+#include "extmod/vfs_lfs.h"
+#endif
+
 #if CIRCUITPY_BLEIO
 #include "shared-bindings/_bleio/__init__.h"
 #include "supervisor/shared/bluetooth/bluetooth.h"
@@ -116,9 +121,74 @@ void supervisor_workflow_start(void) {
     #endif
 }
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+FRESULT supervisor_workflow_lfs_result(int err) {
+    switch (err) {
+        case LFS2_ERR_OK:
+            return FR_OK;
+        case LFS2_ERR_NOENT:
+            return FR_NO_FILE;
+        case LFS2_ERR_NOTDIR:
+            return FR_NO_PATH;
+        case LFS2_ERR_EXIST:
+            return FR_EXIST;
+        case LFS2_ERR_ISDIR:
+        case LFS2_ERR_NOTEMPTY:
+        case LFS2_ERR_NOSPC:
+            return FR_DENIED;
+        case LFS2_ERR_NAMETOOLONG:
+            return FR_INVALID_NAME;
+        default:
+            return FR_DISK_ERR;
+    }
+}
+
+uint64_t supervisor_workflow_lfs_get_mtime(lfs2_t *lfs, const char *path) {
+    uint8_t buf[8];
+    uint64_t ns = 0;
+    if (lfs2_getattr(lfs, path, MP_VFS_LFS2_ATTR_MTIME, buf, sizeof(buf)) == sizeof(buf)) {
+        for (size_t i = sizeof(buf); i > 0; i--) {
+            ns = (ns << 8) | buf[i - 1];
+        }
+    }
+    return ns;
+}
+
+void supervisor_workflow_lfs_file_config(supervisor_workflow_lfs_file_config_t *config, uint64_t mtime_ns) {
+    memset(&config->cfg, 0, sizeof(config->cfg));
+    config->cfg.buffer = config->cache;
+    if (mtime_ns == 0) {
+        return;
+    }
+    for (size_t i = 0; i < sizeof(config->mtime); i++) {
+        config->mtime[i] = mtime_ns;
+        mtime_ns >>= 8;
+    }
+    config->attr.type = MP_VFS_LFS2_ATTR_MTIME;
+    config->attr.buffer = config->mtime;
+    config->attr.size = sizeof(config->mtime);
+    config->cfg.attrs = &config->attr;
+    config->cfg.attr_count = 1;
+}
+#endif
+
 FRESULT supervisor_workflow_move(const char *old_path, const char *new_path) {
     const char *old_mount_path;
     const char *new_mount_path;
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    lfs2_t *lfs = filesystem_lfs_for_path(old_path, &old_mount_path);
+    if (lfs != NULL) {
+        if (filesystem_lfs_for_path(new_path, &new_mount_path) != lfs) {
+            return FR_NO_PATH;
+        }
+        // littlefs would replace an existing file, where FatFs refuses.
+        struct lfs2_info info;
+        if (lfs2_stat(lfs, new_mount_path, &info) == LFS2_ERR_OK) {
+            return FR_EXIST;
+        }
+        return supervisor_workflow_lfs_result(lfs2_rename(lfs, old_mount_path, new_mount_path));
+    }
+    #endif
     fs_user_mount_t *active_mount = filesystem_for_path(old_path, &old_mount_path);
     fs_user_mount_t *new_mount = filesystem_for_path(new_path, &new_mount_path);
     if (active_mount == NULL || new_mount == NULL || active_mount != new_mount || !filesystem_native_fatfs(active_mount)) {
@@ -136,6 +206,16 @@ FRESULT supervisor_workflow_move(const char *old_path, const char *new_path) {
 
 FRESULT supervisor_workflow_mkdir(DWORD fattime, const char *full_path) {
     const char *mount_path;
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    lfs2_t *lfs = filesystem_lfs_for_path(full_path, &mount_path);
+    if (lfs != NULL) {
+        struct lfs2_info info;
+        if (lfs2_stat(lfs, mount_path, &info) == LFS2_ERR_OK) {
+            return FR_EXIST;
+        }
+        return supervisor_workflow_lfs_result(lfs2_mkdir(lfs, mount_path));
+    }
+    #endif
     fs_user_mount_t *active_mount = filesystem_for_path(full_path, &mount_path);
     if (active_mount == NULL || !filesystem_native_fatfs(active_mount)) {
         return FR_NO_PATH;
@@ -230,8 +310,64 @@ static FRESULT supervisor_workflow_delete_directory_contents(FATFS *fs, const TC
     return res;
 }
 
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+static int supervisor_workflow_lfs_delete_directory_contents(lfs2_t *lfs, const char *path) {
+    // Check the stack since we're putting paths on it.
+    if (mp_stack_usage() >= MP_STATE_THREAD(stack_limit)) {
+        return LFS2_ERR_IO;
+    }
+    int res = LFS2_ERR_OK;
+    while (res == LFS2_ERR_OK) {
+        lfs2_dir_t dir;
+        struct lfs2_info info;
+        res = lfs2_dir_open(lfs, &dir, path);
+        if (res != LFS2_ERR_OK) {
+            break;
+        }
+        // Find the first entry other than . and .., reopening the directory
+        // every time since deleting entries changes it.
+        int found;
+        do {
+            found = lfs2_dir_read(lfs, &dir, &info);
+        } while (found > 0 && (strcmp(info.name, ".") == 0 || strcmp(info.name, "..") == 0));
+        lfs2_dir_close(lfs, &dir);
+        if (found <= 0) {
+            res = found;
+            break;
+        }
+        size_t pathlen = strlen(path);
+        size_t fnlen = strlen(info.name);
+        char full_path[pathlen + 1 + fnlen + 1];
+        memcpy(full_path, path, pathlen);
+        full_path[pathlen] = '/';
+        memcpy(full_path + pathlen + 1, info.name, fnlen + 1);
+        if (info.type == LFS2_TYPE_DIR) {
+            res = supervisor_workflow_lfs_delete_directory_contents(lfs, full_path);
+        }
+        if (res == LFS2_ERR_OK) {
+            res = lfs2_remove(lfs, full_path);
+        }
+    }
+    return res;
+}
+#endif
+
 FRESULT supervisor_workflow_delete_recursive(const char *full_path) {
     const char *mount_path;
+    #if CIRCUITPY_FILESYSTEM_LITTLEFS
+    lfs2_t *lfs = filesystem_lfs_for_path(full_path, &mount_path);
+    if (lfs != NULL) {
+        struct lfs2_info info;
+        int res = lfs2_stat(lfs, mount_path, &info);
+        if (res == LFS2_ERR_OK && info.type == LFS2_TYPE_DIR) {
+            res = supervisor_workflow_lfs_delete_directory_contents(lfs, mount_path);
+        }
+        if (res == LFS2_ERR_OK) {
+            res = lfs2_remove(lfs, mount_path);
+        }
+        return supervisor_workflow_lfs_result(res);
+    }
+    #endif
     fs_user_mount_t *active_mount = filesystem_for_path(full_path, &mount_path);
     if (active_mount == NULL || !filesystem_native_fatfs(active_mount)) {
         return FR_NO_PATH;
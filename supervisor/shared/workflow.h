@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "py/mpconfig.h"
 #include "lib/oofatfs/ff.h"
 
 extern bool supervisor_workflow_connecting(void);
@@ -15,3 +16,23 @@ FRESULT supervisor_workflow_move(const char *old_path, const char *new_path);
 FRESULT supervisor_workflow_mkdir(DWORD fattime, const char *full_path);
 FRESULT supervisor_workflow_mkdir_parents(DWORD fattime, char *path);
 FRESULT supervisor_workflow_delete_recursive(const char *full_path);
+
+#if CIRCUITPY_FILESYSTEM_LITTLEFS
+#include "lib/littlefs/lfs2.h"
+// The nearest FatFs result for a littlefs error, so that workflows report both
+// filesystems the same way.
+FRESULT supervisor_workflow_lfs_result(int err);
+// The modification time that VfsLfs2 reports for the file, or 0 if it has none.
+uint64_t supervisor_workflow_lfs_get_mtime(lfs2_t *lfs, const char *path);
+
+// Configuration for a file that a workflow opens. A file opened for writing
+// with it gets the given modification time when it is closed, as VfsLfs2 does.
+typedef struct {
+    struct lfs2_file_config cfg;
+    struct lfs2_attr attr;
+    uint8_t mtime[8];
+    uint8_t cache[CIRCUITPY_LITTLEFS_CACHE_SIZE];
+} supervisor_workflow_lfs_file_config_t;
+// A modification time of 0 leaves the file's alone.
+void supervisor_workflow_lfs_file_config(supervisor_workflow_lfs_file_config_t *config, uint64_t mtime_ns);
+#endif
@@ -20,3 +20,11 @@ print(hex(pow(2, x-1, x))) # Should be 1, since x is prime
 print(hex(pow(y, x-1, x))) # Should be 1, since x is prime
 print(hex(pow(y, y-1, x))) # Should be a 'big value'
 print(hex(pow(y, y-1, y))) # Should be a 'big value'
+
+# moduli with odd, even and negative values and exponents of different widths
+m = (1 << 1024) - 105
+e = (1 << 700) + 12345
+for mod in (m, m + 1, -m, x, -x, 3, 2, (1 << 64) + 1, (1 << 64) + 13):
+    for base in (2, -3, y, -y, mod - 1, mod * 5 + 7):
+        for exp in (1, 2, 3, 0x1F, 0x7FFFFFFF, e, y):
+            print(hex(pow(base, exp, mod)))
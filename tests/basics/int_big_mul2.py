@@ -0,0 +1,30 @@
+# test multiplication of big ints large enough to use subquadratic algorithms
+
+# numbers with a mix of digit patterns, built deterministically
+def make(bits, seed):
+    n = 0
+    while n.bit_length() < bits:
+        seed = (seed * 1103515245 + 12345) & 0xFFFFFFFF
+        n = (n << 32) | seed
+    return n >> (n.bit_length() - bits)
+
+
+for abits in (1000, 1024, 2048, 3001, 8192):
+    for bbits in (31, 600, 1024, 2049, 5000, 8192):
+        a = make(abits, abits)
+        b = make(bbits, bbits + 1)
+        p = a * b
+        print(abits, bbits, p.bit_length(), p % 1000000007, p >> (p.bit_length() - 64))
+        print(p == b * a, p // a == b, p % a, (-a) * b == -p, (-a) * (-b) == p)
+
+# squares, including all-ones digits which maximise carries
+for bits in (1024, 2048, 4096, 10000):
+    a = (1 << bits) - 1
+    print(bits, a * a == (1 << (2 * bits)) - (1 << (bits + 1)) + 1)
+    a = make(bits, 7)
+    print(bits, (a * a) % 998244353)
+
+# operands with long runs of zero digits
+a = (1 << 5000) + 1
+b = (1 << 3000) + (1 << 1500) + 1
+print(a * b == (1 << 8000) + (1 << 6500) + (1 << 5000) + (1 << 3000) + (1 << 1500) + 1)
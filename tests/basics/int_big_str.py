@@ -0,0 +1,32 @@
+# test converting big ints to and from strings in various bases
+
+def make(bits, seed):
+    n = 0
+    while n.bit_length() < bits:
+        seed = (seed * 1103515245 + 12345) & 0xFFFFFFFF
+        n = (n << 32) | seed
+    return n >> (n.bit_length() - bits)
+
+
+for bits in (65, 96, 127, 128, 129, 1000, 4096, 12000):
+    for n in (make(bits, bits), 1 << (bits - 1), (1 << bits) - 1):
+        for v in (n, -n):
+            s = str(v)
+            print(len(s), s[:20], s[-20:], int(s) == v)
+            for f in (bin, oct, hex):
+                s = f(v)
+                print(len(s), s[:20], s[-20:], int(s, 0) == v)
+            print(int(s[s.index("x") + 1 :], 16) == abs(v))
+
+# powers of ten have long runs of zeros in every chunk
+for e in (18, 19, 20, 38, 100, 999):
+    s = str(10**e)
+    print(len(s), s.count("0"), str(10**e - 1).count("9"))
+
+# other bases
+for base in (3, 7, 10, 11, 32, 36):
+    print(int("1" * 100, base) % 1000003, int("z" * 40, 36) % base)
+
+# thousands separators
+for n in (123456789012345678901234567890, 1234567890123456789012345678901, 10**30, 10**29):
+    print("{:,}".format(n), "{:,}".format(-n))
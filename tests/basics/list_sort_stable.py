@@ -0,0 +1,73 @@
+# test that list.sort and sorted are stable, and call key once per element
+
+# pairs that compare equal on their first element keep their order
+l = [(i * 7 % 5, i) for i in range(40)]
+print(sorted(l, key=lambda p: p[0]))
+print(sorted(l, key=lambda p: p[0], reverse=True))
+
+
+class C:
+    def __init__(self, k, tag):
+        self.k = k
+        self.tag = tag
+
+    def __lt__(self, other):
+        return self.k < other.k
+
+    def __repr__(self):
+        return "%d%s" % (self.k, self.tag)
+
+
+l = [C(i % 3, chr(97 + i)) for i in range(12)]
+l.sort()
+print(l)
+l.sort(reverse=True)
+print(l)
+
+# runs that are already sorted, reverse sorted or mixed
+for l in (
+    list(range(100)),
+    list(range(100, 0, -1)),
+    list(range(50)) + list(range(50)),
+    [i % 10 for i in range(200)],
+    [(i * 31) % 97 for i in range(500)] + list(range(300)),
+):
+    print(sorted(l) == sorted(l, reverse=True)[::-1], sorted(l)[:5], sorted(l)[-5:])
+
+# key is computed once per element
+calls = 0
+
+
+def key(x):
+    global calls
+    calls += 1
+    return -x
+
+
+l = [(i * 13) % 101 for i in range(300)]
+l.sort(key=key)
+print(calls, l[:5])
+
+# if a comparison raises, the list still holds every element
+n = 0
+
+
+class Bad:
+    def __init__(self, v):
+        self.v = v
+
+    def __lt__(self, other):
+        global n
+        n += 1
+        if n == 700:
+            raise ValueError
+        return self.v < other.v
+
+
+l = [Bad((i * 29) % 83) for i in range(300)]
+before = sorted(id(x) for x in l)
+try:
+    l.sort()
+except ValueError:
+    print("ValueError")
+print(len(l), sorted(id(x) for x in l) == before)
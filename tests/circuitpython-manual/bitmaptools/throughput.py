@@ -0,0 +1,61 @@
+# Measures bitmaptools.rotozoom, blit and blit2x throughput in pixels per second.
+#
+# Runs on any build with bitmaptools and displayio, including the unix port.
+import time
+import bitmaptools
+import displayio
+
+try:
+    now_ns = time.monotonic_ns
+except AttributeError:
+    now_ns = time.time_ns
+
+ITERATIONS = 20
+W, H = 160, 120
+
+
+def filled(bits):
+    b = displayio.Bitmap(W, H, 1 << bits)
+    for y in range(H):
+        for x in range(W):
+            b[x, y] = (x ^ y) & ((1 << bits) - 1)
+    return b
+
+
+def report(name, pixels, elapsed):
+    print("{:28s} {:12.0f} px/s".format(name, pixels * 1e9 / elapsed))
+
+
+def run(name, pixels, fn):
+    start = now_ns()
+    for _ in range(ITERATIONS):
+        fn()
+    report(name, ITERATIONS * pixels, now_ns() - start)
+
+
+for dest_bits, source_bits in ((16, 16), (8, 8), (16, 8), (1, 1), (8, 4)):
+    source = filled(source_bits)
+    dest = displayio.Bitmap(W, H, 1 << dest_bits)
+    tag = "{}->{}".format(source_bits, dest_bits)
+    run("blit " + tag, W * H, lambda: bitmaptools.blit(dest, source, 0, 0))
+    run(
+        "blit skip " + tag,
+        W * H,
+        lambda: bitmaptools.blit(dest, source, 0, 0, skip_source_index=1),
+    )
+    run(
+        "rotozoom 30deg " + tag,
+        W * H,
+        lambda: bitmaptools.rotozoom(dest, source, angle=0.5236, scale=1.25),
+    )
+
+source = filled(16)
+small = displayio.Bitmap(W // 2, H // 2, 65536)
+bitmaptools.blit(small, source, 0, 0, x2=W // 2, y2=H // 2)
+dest = displayio.Bitmap(W, H, 65536)
+run("blit2x nearest 16", W * H, lambda: bitmaptools.blit2x(dest, small, 0, 0))
+run(
+    "blit2x bilinear RGB565",
+    W * H,
+    lambda: bitmaptools.blit2x(dest, small, 0, 0, colorspace=displayio.Colorspace.RGB565),
+)
@@ -0,0 +1,66 @@
+# Measures refresh time for OnDiskBitmap backgrounds, with and without the
+# row cache.
+#
+# Run on a board with a built-in display and a writable filesystem, such as
+# a mounted SD card; set FILENAME accordingly. Two BMPs are written: a
+# full-screen 24-bit image, which the cache reads a band of rows at a time,
+# and a small 4-bit image that fits in the cache and is read only once.
+import struct
+import time
+import board
+import displayio
+
+FILENAME = "/sd/ondiskbitmap_refresh.bmp"
+REFRESHES = 10
+
+
+def write_bmp(filename, width, height, bits):
+    stride = (width * bits + 31) // 32 * 4
+    colors = 1 << bits if bits <= 8 else 0
+    offset = 14 + 40 + 4 * colors
+    with open(filename, "wb") as f:
+        f.write(b"BM" + struct.pack("<IHHI", offset + stride * height, 0, 0, offset))
+        f.write(struct.pack("<IiiHHIIiiII", 40, width, height, 1, bits, 0, 0, 0, 0, colors, 0))
+        for i in range(colors):
+            f.write(struct.pack("<I", i * 0x111111 & 0xFFFFFF))
+        row = bytearray(stride)
+        for y in range(height):
+            if bits == 24:
+                for x in range(width):
+                    row[3 * x : 3 * x + 3] = bytes((x & 0xFF, y & 0xFF, (x ^ y) & 0xFF))
+            else:
+                for i in range(width * bits // 8):
+                    row[i] = (i + y) * 0x11 & 0xFF
+            f.write(row)
+
+
+display = board.DISPLAY
+display.auto_refresh = False
+
+for name, width, height, bits in (
+    ("full screen 24bpp", display.width, display.height, 24),
+    ("64x64 4bpp", 64, 64, 4),
+):
+    write_bmp(FILENAME, width, height, bits)
+    for cache in (False, True):
+        odb = displayio.OnDiskBitmap(FILENAME, cache=cache)
+        grid = displayio.TileGrid(odb, pixel_shader=odb.pixel_shader)
+        group = displayio.Group()
+        group.append(grid)
+        display.root_group = group
+        display.refresh()
+
+        start = time.monotonic_ns()
+        for i in range(REFRESHES):
+            # Moving the grid back and forth forces a full redraw of it.
+            grid.x = i & 1
+            display.refresh()
+        elapsed = time.monotonic_ns() - start
+        print(
+            "{:20s} cache={:5s} {:8.1f} ms/refresh".format(
+                name, str(cache), elapsed / REFRESHES / 1e6
+            )
+        )
+
+display.root_group = None
+display.auto_refresh = True
@@ -0,0 +1,50 @@
+# Measures jpegio decode time for full, scaled and cropped decodes.
+#
+# Runs on any build with jpegio, including the unix port. The default image is
+# the sample that ships with tjpgd; pass another baseline JPEG path as the
+# first argument to time it instead, e.g. a camera thumbnail or a map tile.
+import sys
+import time
+import displayio
+import jpegio
+
+try:
+    now_ns = time.monotonic_ns
+except AttributeError:
+    now_ns = time.time_ns
+
+ITERATIONS = 10
+
+if len(sys.argv) > 1:
+    filename = sys.argv[1]
+else:
+    here = __file__.rsplit("/", 1)[0] if "/" in __file__ else "."
+    filename = here + "/../../../lib/tjpgd/doc/en/jpeg.jpeg"
+
+with open(filename, "rb") as f:
+    content = f.read()
+
+decoder = jpegio.JpegDecoder()
+width, height = decoder.open(content)
+print("{}: {}x{}".format(filename, width, height))
+
+bitmap = displayio.Bitmap(width, height, 65535)
+
+
+def run(name, **kwargs):
+    start = now_ns()
+    for _ in range(ITERATIONS):
+        decoder.open(content)
+        decoder.decode(bitmap, **kwargs)
+    elapsed = (now_ns() - start) / ITERATIONS
+    print("{:24s} {:8.2f} ms".format(name, elapsed / 1e6))
+
+
+for scale in range(4):
+    run("full 1/{}".format(1 << scale), scale=scale)
+
+run("crop center quarter", x1=width // 4, y1=height // 4, x2=3 * width // 4, y2=3 * height // 4)
+run("crop top 16 rows", y2=16)
+run("crop bottom 16 rows", y1=height - 16)
+run("crop 1/2 center quarter", scale=1, x1=width // 8, y1=height // 8, x2=width // 4, y2=height // 4)
+run("color key", skip_source_index=0)
@@ -0,0 +1,63 @@
+# Measures the time startup code spends reading settings with os.getenv.
+#
+# Runs on the unix coverage build, where it builds a settings.toml with many
+# keys and comments on a RAM-backed FAT filesystem and then looks up a
+# typical set of startup settings, the way code.py and the supervisor do.
+import os
+import time
+
+KEYS = 60
+LOOKUPS = 25
+ROUNDS = 20
+
+os.umount("/")
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=None):
+        if off is None:
+            off = 0
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+bdev = RAMBlockDevice(256)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+
+with open("/settings.toml", "w") as f:
+    for i in range(KEYS):
+        f.write("# Setting number {}, described at some length in a comment\n".format(i))
+        f.write('APP_SETTING_{} = "value for setting {}"\n'.format(i, i))
+    f.write("CIRCUITPY_WEB_API_PORT = 8080\n")
+
+names = ["APP_SETTING_{}".format(i * KEYS // LOOKUPS) for i in range(LOOKUPS)]
+names += ["CIRCUITPY_WEB_API_PORT", "CIRCUITPY_NOT_SET"]
+
+start = time.time_ns()
+for _ in range(ROUNDS):
+    for name in names:
+        os.getenv(name)
+elapsed = time.time_ns() - start
+print(
+    "{} lookups in a {} byte settings.toml: {:.1f} us/lookup".format(
+        len(names), os.stat("/settings.toml")[6], elapsed / ROUNDS / len(names) / 1e3
+    )
+)
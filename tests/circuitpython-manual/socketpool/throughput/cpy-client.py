@@ -0,0 +1,75 @@
+import os
+import socketpool
+import time
+import wifi
+
+TIMEOUT = None
+HOST = "192.168.10.179"
+PORT = 5000
+FILENAME = "/sd/payload.bin"
+BLOCK = 2048
+COUNT = 64
+
+# Connect to wifi
+print("Connecting to wifi")
+wifi.radio.connect("mySSID", "myPASS")
+pool = socketpool.SocketPool(wifi.radio)
+
+header = bytearray(8)
+block = bytearray(BLOCK)
+trailer = bytearray(8)
+
+
+def with_send(s):
+    with open(FILENAME, "rb") as f:
+        while True:
+            data = f.read(BLOCK)
+            if not data:
+                break
+            s.sendall(data)
+
+
+def with_readinto(s):
+    with open(FILENAME, "rb") as f:
+        while True:
+            n = f.readinto(block)
+            if not n:
+                break
+            s.sendall(memoryview(block)[:n])
+
+
+def with_sendfile(s):
+    with open(FILENAME, "rb") as f:
+        s.sendfile(f)
+
+
+def with_sendmsg(s):
+    for _ in range(COUNT):
+        parts = [header, block, trailer]
+        while parts:
+            sent = s.sendmsg(parts)
+            while parts and sent >= len(parts[0]):
+                sent -= len(parts[0])
+                parts.pop(0)
+            if parts:
+                parts[0] = memoryview(parts[0])[sent:]
+
+
+with open(FILENAME, "wb") as f:
+    for _ in range(COUNT):
+        f.write(block)
+size = os.stat(FILENAME)[6]
+
+for name, fn, nbytes in (
+    ("read+sendall", with_send, size),
+    ("readinto+sendall", with_readinto, size),
+    ("sendfile", with_sendfile, size),
+    ("sendmsg", with_sendmsg, COUNT * (len(header) + BLOCK + len(trailer))),
+):
+    with pool.socket(pool.AF_INET, pool.SOCK_STREAM) as s:
+        s.settimeout(TIMEOUT)
+        s.connect((HOST, PORT))
+        start = time.monotonic_ns()
+        fn(s)
+        elapsed = (time.monotonic_ns() - start) / 1e9
+    print(f"{name}: {nbytes} bytes in {elapsed:.3f}s, {nbytes / elapsed / 1024:.1f} KiB/s")
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+import socket
+
+HOST = "192.168.10.179"
+PORT = 5000
+
+print("Create Socket")
+with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as s:
+    s.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    s.bind((HOST, PORT))
+    s.listen()
+    print("Accepting connections")
+    buf = bytearray(65536)
+    while True:
+        conn, addr = s.accept()
+        total = 0
+        with conn:
+            while True:
+                n = conn.recv_into(buf)
+                if not n:
+                    break
+                total += n
+        print("Received", total, "bytes from", addr)
@@ -0,0 +1,65 @@
+# Measures how fast a terminalio.Terminal can stream and redraw text.
+#
+# Run on a board with a built-in display. "scroll" writes new lines so every
+# refresh redraws the whole grid; "dashboard" rewrites the same screen with a
+# single changing field per line, which only dirties the cells that change.
+import time
+import board
+import displayio
+import terminalio
+
+LINES = 200
+
+display = board.DISPLAY
+display.auto_refresh = False
+
+font = terminalio.FONT
+glyph_width, glyph_height = font.get_bounding_box()
+columns = display.width // glyph_width
+rows = display.height // glyph_height
+
+palette = displayio.Palette(2)
+palette[0] = 0x000000
+palette[1] = 0x34BB90
+
+grid = displayio.TileGrid(
+    font.bitmap,
+    pixel_shader=palette,
+    width=columns,
+    height=rows,
+    tile_width=glyph_width,
+    tile_height=glyph_height,
+)
+terminal = terminalio.Terminal(grid, font)
+
+group = displayio.Group()
+group.append(grid)
+display.root_group = group
+display.refresh()
+
+
+def report(name, start, lines):
+    elapsed = time.monotonic_ns() - start
+    print(
+        "{:10s} {:8.2f} ms/line {:8.1f} lines/s".format(
+            name, elapsed / lines / 1e6, lines * 1e9 / elapsed
+        )
+    )
+
+
+line = ("0123456789abcdefghijklmnopqrstuvwxyz" * 4)[: columns - 8]
+start = time.monotonic_ns()
+for i in range(LINES):
+    terminal.write("\r\n{:6d} {}".format(i, line))
+    display.refresh()
+report("scroll", start, LINES)
+
+terminal.write("\x1b[2J")
+start = time.monotonic_ns()
+for i in range(LINES):
+    terminal.write("\x1b[{};1H{:6d} {}".format(i % rows + 1, i, line))
+    display.refresh()
+report("dashboard", start, LINES)
+
+display.root_group = None
+display.auto_refresh = True
@@ -0,0 +1,131 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+// Counts the disk_read and disk_write calls that USB mass storage makes for a
+// few typical host workloads. supervisor/shared/usb/usb_msc_flash.c is built
+// on the host against a RAM disk, and its callbacks are called the way TinyUSB
+// calls them, in pieces of CFG_TUD_MSC_BUFSIZE bytes.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "msc_stubs.h"
+
+#define BLOCK_SIZE (512)
+#define DISK_BLOCKS (8192)
+#define CFG_TUD_MSC_BUFSIZE (1024)
+
+static uint8_t disk[DISK_BLOCKS * BLOCK_SIZE];
+static fs_user_mount_t root = { .fatfs = { .ssize = BLOCK_SIZE } };
+static mp_vfs_mount_t root_mount = { .obj = &root };
+mp_vfs_mount_t *bench_vfs_mount_table = &root_mount;
+uint32_t fatfs_sector_write_count;
+
+static unsigned reads;
+static unsigned writes;
+
+DRESULT disk_read(fs_user_mount_t *vfs, uint8_t *buff, uint32_t sector, unsigned count) {
+    reads++;
+    memcpy(buff, disk + sector * BLOCK_SIZE, count * BLOCK_SIZE);
+    return RES_OK;
+}
+
+DRESULT disk_write(fs_user_mount_t *vfs, const uint8_t *buff, uint32_t sector, unsigned count) {
+    writes++;
+    memcpy(disk + sector * BLOCK_SIZE, buff, count * BLOCK_SIZE);
+    return RES_OK;
+}
+
+DRESULT disk_ioctl(fs_user_mount_t *vfs, uint8_t cmd, void *buff) {
+    if (cmd == GET_SECTOR_COUNT) {
+        *(uint32_t *)buff = DISK_BLOCKS;
+    } else if (cmd == GET_SECTOR_SIZE) {
+        *(uint16_t *)buff = BLOCK_SIZE;
+    }
+    return RES_OK;
+}
+
+bool blockdev_lock(fs_user_mount_t *vfs) {
+    return true;
+}
+
+void blockdev_unlock(fs_user_mount_t *vfs) {
+}
+
+bool filesystem_is_writable_by_usb(fs_user_mount_t *vfs) {
+    return true;
+}
+
+void autoreload_suspend(uint32_t lock_mask) {
+}
+
+void autoreload_resume(uint32_t lock_mask) {
+}
+
+void autoreload_trigger(void) {
+}
+
+bool tud_msc_set_sense(uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier) {
+    return true;
+}
+
+// One READ10 or WRITE10 command, split up the way TinyUSB does.
+static void read10(uint32_t lba, uint32_t count, uint8_t *buf) {
+    for (uint32_t done = 0; done < count * BLOCK_SIZE; done += CFG_TUD_MSC_BUFSIZE) {
+        uint32_t len = MIN(CFG_TUD_MSC_BUFSIZE, count * BLOCK_SIZE - done);
+        if (tud_msc_read10_cb(0, lba + done / BLOCK_SIZE, 0, buf + done, len) != (int32_t)len) {
+            abort();
+        }
+    }
+}
+
+static void write10(uint32_t lba, uint32_t count, uint8_t *buf) {
+    for (uint32_t done = 0; done < count * BLOCK_SIZE; done += CFG_TUD_MSC_BUFSIZE) {
+        uint32_t len = MIN(CFG_TUD_MSC_BUFSIZE, count * BLOCK_SIZE - done);
+        if (tud_msc_write10_cb(0, lba + done / BLOCK_SIZE, 0, buf + done, len) != (int32_t)len) {
+            abort();
+        }
+    }
+    tud_msc_write10_complete_cb(0);
+}
+
+#define FILE_LBA (1024)
+#define FILE_BLOCKS (4096)
+#define COMMAND_BLOCKS (128)
+#define DIR_LBA (100)
+#define DIR_BLOCKS (8)
+
+int main(void) {
+    static uint8_t file[FILE_BLOCKS * BLOCK_SIZE];
+    static uint8_t buf[COMMAND_BLOCKS * BLOCK_SIZE];
+    for (size_t i = 0; i < sizeof(file); i++) {
+        file[i] = rand();
+    }
+
+    for (uint32_t i = 0; i < FILE_BLOCKS; i += COMMAND_BLOCKS) {
+        write10(FILE_LBA + i, COMMAND_BLOCKS, file + i * BLOCK_SIZE);
+    }
+    printf("copy 2MB in 64kB commands: %u disk_write calls\n", writes);
+    bool ok = memcmp(disk + FILE_LBA * BLOCK_SIZE, file, sizeof(file)) == 0;
+
+    for (uint32_t i = 0; i < FILE_BLOCKS; i += COMMAND_BLOCKS) {
+        read10(FILE_LBA + i, COMMAND_BLOCKS, buf);
+        ok &= memcmp(buf, file + i * BLOCK_SIZE, sizeof(buf)) == 0;
+    }
+    printf("read it back: %u disk_read calls\n", reads);
+
+    // A host lists a directory one sector at a time.
+    reads = 0;
+    for (int i = 0; i < 100; i++) {
+        for (uint32_t j = 0; j < DIR_BLOCKS; j++) {
+            read10(DIR_LBA + j, 1, buf);
+        }
+    }
+    printf("list an 8-sector dir x100: %u disk_read calls\n", reads);
+
+    printf("data %s\n", ok ? "ok" : "corrupt");
+    return ok ? 0 : 1;
+}
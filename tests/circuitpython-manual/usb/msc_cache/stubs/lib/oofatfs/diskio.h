@@ -0,0 +1,2 @@
+// Stands in for the real header when building the harness on the host.
+#include "msc_stubs.h"
@@ -0,0 +1,80 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+// Just enough of TinyUSB, FatFs and the VM for usb_msc_flash.c to build on the
+// host against the RAM disk in msc_cache_bench.c.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MIN(x, y) ((x) < (y) ? (x) : (y))
+
+#define MICROPY_FATFS_CACHE_SECTORS (0)
+#define FF_MIN_SS (512)
+#define FF_MAX_SS (512)
+#define FILESYSTEM_BLOCK_SIZE (512)
+#define MP_OBJ_NULL (NULL)
+
+typedef enum {
+    RES_OK = 0,
+    RES_ERROR,
+} DRESULT;
+
+#define CTRL_SYNC (0)
+#define GET_SECTOR_COUNT (1)
+#define GET_SECTOR_SIZE (2)
+
+typedef struct {
+    uint16_t ssize;
+    uint32_t winsect;
+    uint8_t win[FF_MAX_SS];
+} FATFS;
+
+typedef struct {
+    struct {
+        void *writeblocks[1];
+    } blockdev;
+    FATFS fatfs;
+} fs_user_mount_t;
+
+typedef struct _mp_vfs_mount_t {
+    void *obj;
+    struct _mp_vfs_mount_t *next;
+} mp_vfs_mount_t;
+
+extern mp_vfs_mount_t *bench_vfs_mount_table;
+#define MP_STATE_VM(x) (bench_##x)
+
+extern uint32_t fatfs_sector_write_count;
+
+DRESULT disk_read(fs_user_mount_t *vfs, uint8_t *buff, uint32_t sector, unsigned count);
+DRESULT disk_write(fs_user_mount_t *vfs, const uint8_t *buff, uint32_t sector, unsigned count);
+DRESULT disk_ioctl(fs_user_mount_t *vfs, uint8_t cmd, void *buff);
+
+bool blockdev_lock(fs_user_mount_t *vfs);
+void blockdev_unlock(fs_user_mount_t *vfs);
+bool filesystem_is_writable_by_usb(fs_user_mount_t *vfs);
+
+#define AUTORELOAD_SUSPEND_USB (1)
+void autoreload_suspend(uint32_t lock_mask);
+void autoreload_resume(uint32_t lock_mask);
+void autoreload_trigger(void);
+
+#define SCSI_CMD_PREVENT_ALLOW_MEDIUM_REMOVAL (0x1e)
+#define SCSI_SENSE_NOT_READY (0x02)
+#define SCSI_SENSE_ILLEGAL_REQUEST (0x05)
+#define CFG_TUD_MSC_VENDOR "Bench"
+#define CFG_TUD_MSC_PRODUCT "RAM disk"
+#define CFG_TUD_MSC_PRODUCT_REV "1.0"
+bool tud_msc_set_sense(uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier);
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buffer, uint32_t bufsize);
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *buffer, uint32_t bufsize);
+void tud_msc_write10_complete_cb(uint8_t lun);
@@ -0,0 +1,160 @@
+import aesio
+from binascii import hexlify, unhexlify
+
+# Test cases 2, 4, 6 and 16 from "The Galois/Counter Mode of Operation (GCM)",
+# McGrew and Viega, appendix B.
+
+key = unhexlify("00000000000000000000000000000000")
+iv = unhexlify("000000000000000000000000")
+
+print("case 2")
+data = bytearray(16)
+cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+cipher.encrypt_into(data, data)
+print(str(hexlify(data), ""))
+print(str(hexlify(cipher.digest()), ""))
+print()
+
+key = unhexlify("feffe9928665731c6d6a8f9467308308")
+iv = unhexlify("cafebabefacedbaddecaf888")
+plaintext = unhexlify(
+    "d9313225f88406e5a55909c5aff5269a"
+    "86a7a9531534f7da2e4c303d8a318a72"
+    "1c3c0c95956809532fcf0e2449a6b525"
+    "b16aedf5aa0de657ba637b39"
+)
+aad = unhexlify("feedfacedeadbeeffeedfacedeadbeefabaddad2")
+
+print("case 4")
+cyphertext = bytearray(len(plaintext))
+cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+cipher.update(aad)
+cipher.encrypt_into(plaintext, cyphertext)
+for i in range(0, len(cyphertext), 16):
+    print(str(hexlify(cyphertext[i : i + 16]), ""))
+tag = cipher.digest()
+print(str(hexlify(tag), ""))
+print()
+
+print("case 4, in place and in pieces")
+data = bytearray(plaintext)
+cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+cipher.update(aad[:7])
+cipher.update(aad[7:])
+view = memoryview(data)
+for start, end in ((0, 5), (5, 21), (21, 32), (32, len(data))):
+    cipher.encrypt_into(view[start:end], view[start:end])
+print(data == cyphertext, cipher.digest() == tag)
+
+cipher.rekey(key, IV=iv)
+cipher.update(aad)
+cipher.decrypt_into(data, data)
+print(data == plaintext)
+cipher.verify(tag)
+cipher.verify(tag[:12])
+print("verified")
+print()
+
+print("case 4, tampered")
+data = bytearray(cyphertext)
+data[0] ^= 1
+cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+cipher.update(aad)
+cipher.decrypt_into(data, data)
+try:
+    cipher.verify(tag)
+except ValueError as e:
+    print("ValueError", e)
+print()
+
+print("case 6")
+# A 60-byte nonce is hashed to make the counter block.
+iv6 = unhexlify(
+    "9313225df88406e555909c5aff5269aa"
+    "6a7a9538534f7da1e4c303d2a318a728"
+    "c3c0c95156809539fcf0e2429a6b5254"
+    "16aedbf5a0de6a57a637b39b"
+)
+cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv6)
+cipher.update(aad)
+cipher.encrypt_into(plaintext, cyphertext)
+for i in range(0, len(cyphertext), 16):
+    print(str(hexlify(cyphertext[i : i + 16]), ""))
+print(str(hexlify(cipher.digest()), ""))
+print()
+
+print("case 16")
+key = unhexlify("feffe9928665731c6d6a8f9467308308" "feffe9928665731c6d6a8f9467308308")
+cyphertext = bytearray(len(plaintext))
+cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+cipher.update(aad)
+cipher.encrypt_into(plaintext, cyphertext)
+for i in range(0, len(cyphertext), 16):
+    print(str(hexlify(cyphertext[i : i + 16]), ""))
+print(str(hexlify(cipher.digest()), ""))
+print()
+
+print("errors")
+try:
+    aesio.AES(key, aesio.MODE_GCM)
+except ValueError as e:
+    print("ValueError", e)
+cipher = aesio.AES(key, aesio.MODE_GCM, IV=iv)
+cipher.encrypt_into(bytearray(4), bytearray(4))
+try:
+    cipher.update(aad)
+except ValueError as e:
+    print("ValueError", e)
+try:
+    cipher.verify(b"abc")
+except ValueError as e:
+    print("ValueError", e)
+cipher = aesio.AES(key, aesio.MODE_CTR, IV=bytes(16))
+try:
+    cipher.digest()
+except ValueError as e:
+    print("ValueError", e)
+print()
+
+print("mode changes")
+# GCM needs a nonce, so it can only be switched to or from by rekey().
+try:
+    cipher.mode = aesio.MODE_GCM
+except ValueError as e:
+    print("ValueError", e)
+cipher.mode = aesio.MODE_CBC
+print(cipher.mode == aesio.MODE_CBC)
+cipher.rekey(key, IV=iv, mode=aesio.MODE_GCM)
+cipher.update(aad)
+data = bytearray(len(plaintext))
+cipher.encrypt_into(plaintext, data)
+print(cipher.mode == aesio.MODE_GCM, data == cyphertext)
+try:
+    cipher.mode = aesio.MODE_CTR
+except ValueError as e:
+    print("ValueError", e)
+try:
+    cipher.rekey(key, mode=aesio.MODE_CTR)
+    cipher.rekey(key, mode=aesio.MODE_GCM)
+except ValueError as e:
+    print("ValueError", e)
+print(cipher.mode == aesio.MODE_CTR)
+print()
+
+print("CTR in pieces")
+# CTR128-AES128 vector from NIST Special Publication 800-38A, split at odd places
+key = unhexlify("2b7e151628aed2a6abf7158809cf4f3c")
+counter = unhexlify("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff")
+plaintext = unhexlify(
+    "6bc1bee22e409f96e93d7e117393172a"
+    "ae2d8a571e03ac9c9eb76fac45af8e51"
+    "30c81c46a35ce411e5fbc1191a0a52ef"
+    "f69f2445df4f9b17ad2b417be66c3710"
+)
+data = bytearray(plaintext)
+view = memoryview(data)
+cipher = aesio.AES(key, aesio.MODE_CTR, IV=counter)
+for start, end in ((0, 3), (3, 20), (20, 21), (21, 64)):
+    cipher.encrypt_into(view[start:end], view[start:end])
+for i in range(0, len(data), 16):
+    print(str(hexlify(data[i : i + 16]), ""))
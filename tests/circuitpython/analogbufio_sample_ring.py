@@ -0,0 +1,78 @@
+# Test the ring of blocks that analogbufio.BufferedIn.start() captures into,
+# using the coverage build's SampleRing in place of the DMA interrupt.
+import array
+
+try:
+    SampleRing
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+# Blocks are filled in order and read back without gaps.
+buf = array.array("H", [0] * 8)
+ring = SampleRing(buf, blocks=4)
+print([ring.issue() for _ in range(2)])
+ring.complete(0, [1, 2])
+print(ring.in_waiting)
+ring.complete(1, [3, 4])
+out = array.array("H", [0] * 3)
+print(ring.readinto(out), list(out), ring.in_waiting)
+
+# A read can span blocks and continue partway through one.
+print(ring.issue(), ring.issue(), ring.issue())
+ring.complete(2, [5, 6])
+ring.complete(3, [7, 8])
+print(ring.readinto(out), list(out), ring.in_waiting)
+
+# Once the reader falls behind, samples go to scratch and are counted.
+ring.complete(0, [9, 10])
+print(ring.issue(), ring.issue(), ring.issue())
+ring.complete(1, [11, 12])
+ring.complete(2, [13, 14])
+ring.complete(-1, [0])
+print(ring.overflow_count)
+out = array.array("H", [0] * 8)
+print(ring.readinto(out), list(out))
+print(ring.issue())
+
+# Decimation averages across block boundaries.
+buf = bytearray(6)
+ring = SampleRing(buf, blocks=3, decimation=4)
+for i, samples in enumerate(([10, 20], [30, 40], [50, 60])):
+    ring.issue()
+    ring.complete(i, samples)
+print(ring.in_waiting)
+out = bytearray(2)
+print(ring.readinto(out), list(out), ring.in_waiting)
+ring.issue()
+ring.complete(0, [70, 80])
+print(ring.readinto(out), list(out))
+
+# With two blocks always issued, as RP2040's two DMA channels keep them, every
+# block is captured as long as the reader keeps up.
+buf = bytearray(6)
+ring = SampleRing(buf, blocks=3, in_flight=2)
+issued = [ring.issue(), ring.issue()]
+out = bytearray(2)
+got = []
+for i in range(6):
+    block = issued.pop(0)
+    ring.complete(block, [i, i])
+    issued.append(ring.issue())
+    ring.readinto(out)
+    got.extend(out)
+print(issued, got, ring.overflow_count)
+
+# Bad arguments.
+for args, kwargs in (
+    ((array.array("h", [0] * 4),), {}),
+    ((bytearray(4),), {"blocks": 1}),
+    ((bytearray(4),), {"blocks": 2, "in_flight": 2}),
+    ((bytearray(4),), {"blocks": 8}),
+    ((array.array("H", [0] * 3),), {"blocks": 2}),
+    ((bytearray(4),), {"decimation": 0}),
+):
+    try:
+        SampleRing(*args, **kwargs)
+    except ValueError as e:
+        print("ValueError:", e)
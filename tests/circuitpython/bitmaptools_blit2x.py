@@ -0,0 +1,50 @@
+import displayio
+import bitmaptools
+
+
+def dump(bmp):
+    for y in range(bmp.height):
+        print(" ".join("{:x}".format(bmp[x, y]) for x in range(bmp.width)))
+
+
+source = displayio.Bitmap(3, 2, 4)
+for i in range(6):
+    source[i] = i % 4
+
+# Nearest neighbor, clipped at the right and bottom edges
+dest = displayio.Bitmap(7, 5, 4)
+bitmaptools.blit2x(dest, source, 2, 2)
+dump(dest)
+
+# Skip index, into a deeper bitmap, from a sub-region
+dest = displayio.Bitmap(6, 4, 256)
+dest.fill(9)
+bitmaptools.blit2x(dest, source, 0, 0, x1=1, x2=3, skip_source_index=0)
+dump(dest)
+
+# RGB565 fast path
+source16 = displayio.Bitmap(2, 2, 65536)
+source16[0, 0] = 0xF800
+source16[1, 0] = 0x07E0
+source16[0, 1] = 0x001F
+source16[1, 1] = 0xFFFF
+dest = displayio.Bitmap(4, 4, 65536)
+bitmaptools.blit2x(dest, source16, 0, 0)
+dump(dest)
+
+# Bilinear
+bitmaptools.blit2x(dest, source16, 0, 0, colorspace=displayio.Colorspace.RGB565)
+dump(dest)
+
+gray = displayio.Bitmap(3, 1, 256)
+gray[0] = 0
+gray[1] = 100
+gray[2] = 255
+dest = displayio.Bitmap(6, 2, 256)
+bitmaptools.blit2x(dest, gray, 0, 0, colorspace=displayio.Colorspace.L8)
+dump(dest)
+
+try:
+    bitmaptools.blit2x(dest, source16, 0, 0, colorspace=displayio.Colorspace.L8)
+except ValueError as e:
+    print(e)
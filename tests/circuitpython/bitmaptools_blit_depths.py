@@ -0,0 +1,39 @@
+import displayio
+import bitmaptools
+
+
+def make_source(w, h, bits):
+    bmp = displayio.Bitmap(w, h, 1 << bits)
+    mask = (1 << bits) - 1
+    for y in range(h):
+        for x in range(w):
+            bmp[x, y] = (x * 5 + y * 3 + 1) & mask
+    return bmp
+
+
+def dump(bmp):
+    for y in range(bmp.height):
+        print(" ".join("{:x}".format(bmp[x, y]) for x in range(bmp.width)))
+
+
+for source_bits, dest_bits in ((1, 1), (1, 2), (2, 2), (4, 4), (4, 8), (8, 8), (8, 16), (16, 16)):
+    print(source_bits, dest_bits)
+    source = make_source(7, 5, source_bits)
+    dest = displayio.Bitmap(11, 6, 1 << dest_bits)
+    # Whole source, partly off the right and bottom edges
+    bitmaptools.blit(dest, source, 6, 2)
+    # Sub-region at an unaligned offset
+    bitmaptools.blit(dest, source, 1, 0, x1=1, y1=1, x2=6, y2=4)
+    dump(dest)
+    # Skip indexes on both sides
+    dest.fill(1)
+    bitmaptools.blit(dest, source, 2, 1, skip_source_index=2, skip_dest_index=0)
+    dump(dest)
+
+# Overlapping copies within one bitmap, in every direction
+for dx, dy in ((2, 1), (-2, 1), (2, -1), (-2, -1), (3, 0), (0, 2)):
+    for bits in (2, 8, 16):
+        bmp = make_source(9, 7, bits)
+        bitmaptools.blit(bmp, bmp, 2 + dx, 2 + dy, x1=2, y1=2, x2=7, y2=5)
+        print(dx, dy, bits)
+        dump(bmp)
@@ -0,0 +1,44 @@
+import displayio
+import bitmaptools
+
+
+def make_source(w, h, bits):
+    bmp = displayio.Bitmap(w, h, 1 << bits)
+    mask = (1 << bits) - 1
+    for y in range(h):
+        for x in range(w):
+            bmp[x, y] = (x * 7 + y * 3) & mask
+    return bmp
+
+
+def dump(bmp):
+    for y in range(bmp.height):
+        print(" ".join("{:x}".format(bmp[x, y]) for x in range(bmp.width)))
+
+
+for source_bits, dest_bits in ((1, 1), (2, 4), (4, 4), (8, 8), (8, 16), (16, 16)):
+    source = make_source(6, 5, source_bits)
+    for angle, scale in ((0.0, 1.0), (0.0, 2.0), (0.0, 0.5)):
+        dest = displayio.Bitmap(12, 10, 1 << dest_bits)
+        bitmaptools.rotozoom(dest, source, ox=5, oy=4, angle=angle, scale=scale)
+        print(source_bits, dest_bits, angle, scale)
+        dump(dest)
+
+# Skip index, clipping on both bitmaps
+source = make_source(8, 8, 4)
+dest = displayio.Bitmap(10, 10, 16)
+dest.fill(15)
+bitmaptools.rotozoom(
+    dest,
+    source,
+    ox=3,
+    oy=3,
+    px=4,
+    py=4,
+    dest_clip0=(1, 1),
+    dest_clip1=(9, 8),
+    source_clip0=(2, 1),
+    source_clip1=(7, 6),
+    skip_index=0,
+)
+dump(dest)
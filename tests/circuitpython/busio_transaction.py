@@ -0,0 +1,171 @@
+# Test busio.Transaction replaying steps on buses written in Python.
+try:
+    from busio import Transaction
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+class FakeI2C:
+    def __init__(self):
+        self.regs = bytearray(range(16))
+        self.locked = False
+        self.busy = 0
+
+    def try_lock(self):
+        if self.busy:
+            self.busy -= 1
+            return False
+        print("lock")
+        self.locked = True
+        return True
+
+    def unlock(self):
+        print("unlock")
+        self.locked = False
+
+    def writeto(self, address, buffer):
+        assert self.locked
+        print("writeto", hex(address), bytes(buffer))
+        if len(buffer) > 1:
+            self.regs[buffer[0]] = buffer[1]
+
+    def readfrom_into(self, address, buffer):
+        print("readfrom_into", hex(address), len(buffer))
+        for i in range(len(buffer)):
+            buffer[i] = 0xAA
+
+    def writeto_then_readfrom(self, address, out_buffer, in_buffer):
+        print("writeto_then_readfrom", hex(address), bytes(out_buffer), len(in_buffer))
+        if out_buffer[0] == 0xFF:
+            raise OSError(19)
+        reg = out_buffer[0]
+        in_buffer[:] = self.regs[reg : reg + len(in_buffer)]
+
+
+class FakeSPI:
+    def try_lock(self):
+        print("lock")
+        return True
+
+    def unlock(self):
+        print("unlock")
+
+    def configure(self, *, baudrate, polarity, phase, bits):
+        print("configure", baudrate, polarity, phase, bits)
+
+    def write(self, buffer):
+        print("write", bytes(buffer))
+
+    def readinto(self, buffer, *, write_value=0):
+        print("readinto", len(buffer), write_value)
+        for i in range(len(buffer)):
+            buffer[i] = i + 1
+
+
+class FakePin:
+    def __init__(self):
+        self._value = True
+
+    @property
+    def value(self):
+        return self._value
+
+    @value.setter
+    def value(self, value):
+        print("cs", value)
+        self._value = value
+
+
+# I2C: record the steps once and run them twice.
+bus = FakeI2C()
+accel = bytearray(2)
+gyro = bytearray(3)
+t = Transaction(bus, 0x6A)
+print(len(t), bool(t))
+t.write(b"\x05\x63")
+t.delay_us(10)
+t.write_then_readinto(b"\x04", accel)
+t.write_then_readinto(memoryview(b"\x00\x08")[1:], gyro)
+t.readinto(bytearray(1))
+print(len(t), bool(t))
+t.run()
+print(accel, gyro)
+bus.regs[4] = 0x44
+t.run()
+print(accel)
+
+# A bus in use by someone else is waited for.
+bus.busy = 2
+t.run()
+
+# An error stops the run and unlocks the bus.
+t.clear()
+print(len(t))
+t.write_then_readinto(b"\xff", accel)
+t.write(b"\x00")
+try:
+    t.run()
+except OSError as e:
+    print("OSError", e.errno)
+print(bus.locked)
+
+# SPI: chip select is asserted around each step.
+data = bytearray(2)
+t = Transaction(FakeSPI(), chip_select=FakePin(), baudrate=1000000, phase=1)
+t.write(b"\x8f")
+t.readinto(data, write_value=0xFF)
+t.write_then_readinto(b"\x0f", data)
+t.run()
+print(data)
+
+# A chip select that fails while releasing after an error still leaves the
+# bus unlocked, and the first error is the one raised.
+class FailingSPI(FakeSPI):
+    def write(self, buffer):
+        raise OSError(5)
+
+
+class FailingPin:
+    @property
+    def value(self):
+        return False
+
+    @value.setter
+    def value(self, value):
+        print("cs", value)
+        if value:
+            raise RuntimeError("cs")
+
+
+t = Transaction(FailingSPI(), chip_select=FailingPin())
+t.write(b"\x01")
+try:
+    t.run()
+except OSError as e:
+    print("OSError", e.errno)
+
+# Invalid arguments.
+for args, kwargs in (
+    ((bus, 0x80), {}),
+    ((bus,), {"polarity": 2}),
+):
+    try:
+        Transaction(*args, **kwargs)
+    except ValueError as e:
+        print("ValueError")
+t = Transaction(bus, 0x10)
+for step in (lambda: t.write(1), lambda: t.readinto(b"")):
+    try:
+        step()
+    except TypeError:
+        print("TypeError")
+try:
+    t.delay_us(-1)
+except ValueError:
+    print("ValueError")
+try:
+    t.readinto(bytearray(1), write_value=256)
+except ValueError:
+    print("ValueError")
+print(len(t))
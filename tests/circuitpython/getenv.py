@@ -90,3 +90,20 @@ run_test(f"noeol", b"noeol=3")
 
 for content in content_bad:
     run_test("key", content)
+
+# Many keys, more than are indexed, looked up repeatedly without rewriting
+content_many = b"".join(b"many%d = %d\n" % (i, i * i) for i in range(40)) + b"dup = 1\ndup = 2\n"
+with open("/settings.toml", "wb") as f:
+    f.write(content_many)
+for key in ("many0", "many31", "many32", "many39", "dup", "many40", "many3", "dup"):
+    print(key, os.getenv(key))
+
+# Rewriting the file with the same size is noticed
+for value in (b"1", b"2"):
+    with open("/settings.toml", "wb") as f:
+        f.write(b"same = " + value + b"\n")
+    print("same", os.getenv("same"))
+
+run_test("a b", b'a b = "spaced"\n')
+run_test("#c", b'#c = "commented"\n')
+run_test("d", b'd="x"\n[t]\nd="y"\n')
@@ -130,3 +130,10 @@ test(content, scale=3, x=12, y=16, x1=8, y1=12, x2=16, y2=16)
 
 print("color key")
 test(content, scale=0, skip_source_index=0x4529, fill=0)
+
+print("region of interest")
+test(content, scale=0, x1=100, y1=90, x2=180, y2=150)
+test(content, scale=0, x=200, y=220, x1=17, y1=33)
+test(content, scale=1, x=5, y=7, x1=33, y1=17, x2=90, y2=61)
+test(content, scale=2, x1=31, y1=1, x2=33, y2=2)
+test(content, scale=0, x1=100, y1=90, x2=180, y2=150, skip_source_index=0x4529)
@@ -0,0 +1,75 @@
+# Test memorymonitor.AllocationProfiler
+try:
+    import memorymonitor
+
+    memorymonitor.AllocationProfiler
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+import io
+
+
+def make_lists():
+    return [[0] * 20 for _ in range(5)]
+
+
+def make_big():
+    return bytearray(2000)
+
+
+def frames(profiler):
+    # Merge entries with the same lines and drop sizes, which vary by port.
+    result = {}
+    for count, size, stack in profiler.sites():
+        key = tuple((func, line) for _, func, line in stack)
+        result[key] = result.get(key, 0) + count
+    return result
+
+
+# Sample every allocation.
+profiler = memorymonitor.AllocationProfiler()
+with profiler:
+    make_lists()
+for stack, count in sorted(frames(profiler).items()):
+    print(stack[-2:], count >= 1)
+print(profiler.dropped)
+
+# Only sample big allocations.
+profiler = memorymonitor.AllocationProfiler(every=0, min_size=1000, depth=1)
+with profiler:
+    make_lists()
+    make_big()
+sites = profiler.sites()
+print(len(sites), sites[0][0], sites[0][1] >= 2000, [frame[1:] for frame in sites[0][2]])
+
+# A full table counts the samples that didn't fit.
+profiler = memorymonitor.AllocationProfiler(max_sites=1)
+with profiler:
+    make_lists()
+    make_big()
+print(len(profiler.sites()), profiler.dropped > 0)
+profiler.clear()
+print(profiler.sites(), profiler.dropped)
+
+# Folded stacks output.
+profiler = memorymonitor.AllocationProfiler(every=0, min_size=1000, depth=2)
+with profiler:
+    make_big()
+out = io.StringIO()
+profiler.dump(out, count=True)
+for line in out.getvalue().splitlines():
+    stack, weight = line.rsplit(" ", 1)
+    print([frame.split(":", 1)[1] for frame in stack.split(";")], weight)
+
+# Only one profiler can run at a time.
+with profiler:
+    try:
+        memorymonitor.AllocationProfiler().__enter__()
+    except RuntimeError:
+        print("RuntimeError")
+
+try:
+    memorymonitor.AllocationProfiler(depth=9)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,46 @@
+# Test memorymonitor.heap_usage
+try:
+    import memorymonitor
+
+    memorymonitor.heap_usage
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+import gc
+
+
+def usage():
+    gc.collect()
+    return memorymonitor.heap_usage()
+
+
+before = usage()
+print(sorted(before.keys()))
+print(all(isinstance(v, int) and v >= 0 for v in before.values()))
+
+# Compiling code allocates bytecode and its constant tables.
+exec("def f(x):\n    return (x, 'heap_usage_test_string')\n")
+after = usage()
+print(after["bytecode"] > before["bytecode"])
+print(after["constants"] > before["constants"])
+print(after["qstr"] >= before["qstr"])
+
+# Big buffers owned by native modules are attributed to them.
+try:
+    import displayio
+
+    before = usage()
+    bitmap = displayio.Bitmap(64, 64, 256)
+    print(usage()["display"] - before["display"] >= 64 * 64)
+except ImportError:
+    print(True)
+
+try:
+    import synthio
+
+    before = usage()
+    synth = synthio.Synthesizer(sample_rate=8000)
+    print(usage()["audio"] > before["audio"])
+except ImportError:
+    print(True)
@@ -0,0 +1,64 @@
+# Test profiler.SamplingProfiler
+try:
+    import profiler
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+import io
+import time
+
+
+def spin():
+    x = 0
+    for i in range(1000):
+        x += i * i
+    return x
+
+
+def run(p, n):
+    # Samples are taken on a CPU time timer, so run until there are enough.
+    start = time.ticks_ms()
+    with p:
+        while p.samples < n and time.ticks_diff(time.ticks_ms(), start) < 10000:
+            spin()
+    return p.samples >= n
+
+
+p = profiler.SamplingProfiler(interval=0.001, max_samples=1000, depth=2)
+print(run(p, 20))
+stacks = p.stacks()
+print(sum(count for count, stack in stacks) == p.samples)
+count, stack = max(stacks)
+print([frame[1] for frame in stack])
+
+# Once the ring is full, the oldest samples are replaced.
+p = profiler.SamplingProfiler(interval=0.001, max_samples=8, depth=1)
+print(run(p, 20))
+print(sum(count for count, stack in p.stacks()))
+p.clear()
+print(p.samples, p.stacks())
+
+# Folded stacks output.
+p = profiler.SamplingProfiler(interval=0.001, depth=1)
+run(p, 5)
+out = io.StringIO()
+p.dump(out)
+total = 0
+for line in out.getvalue().splitlines():
+    stack, count = line.rsplit(" ", 1)
+    total += int(count)
+print(total == p.samples)
+
+# Only one profiler can run at a time.
+with p:
+    try:
+        profiler.SamplingProfiler().__enter__()
+    except RuntimeError:
+        print("RuntimeError")
+
+for kwargs in ({"depth": 9}, {"interval": 0}, {"interval": 2}, {"max_samples": 0}):
+    try:
+        profiler.SamplingProfiler(**kwargs)
+    except ValueError:
+        print("ValueError")
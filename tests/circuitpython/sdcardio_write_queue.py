@@ -0,0 +1,195 @@
+# Test sdcardio's queued writes and CMD25 stream against a simulated SD card
+# in SPI mode, using the coverage build's SDCardProtocol in place of the bus.
+import errno
+
+try:
+    SDCardProtocol
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+
+class Card:
+    def __init__(self):
+        self.blocks = {}
+        self.log = []
+        self.out = []
+        self.busy = 0
+        # Polls that the card stays busy for after each block.
+        self.busy_after_block = 1
+        self.stuck = False
+        self.fail = set()
+        self.cmd = None
+        self.data = None
+        self.writing = None
+
+    def exchange(self, tx):
+        return bytes(self.byte(b) for b in tx)
+
+    def byte(self, b):
+        if self.out:
+            r = self.out.pop(0)
+        elif self.stuck or self.busy:
+            self.busy = max(self.busy - 1, 0)
+            r = 0
+        else:
+            r = 0xFF
+        if self.data is not None:
+            self.data.append(b)
+            if len(self.data) == 514:
+                self.end_block()
+        elif self.cmd is not None:
+            self.cmd.append(b)
+            if len(self.cmd) == 6:
+                self.command(self.cmd[0] & 0x3F, int.from_bytes(self.cmd[1:5], "big"))
+                self.cmd = None
+        elif self.writing is not None and b == 0xFC:
+            self.data = bytearray()
+        elif self.writing is not None and b == 0xFD:
+            self.log.append("stop")
+            self.writing = None
+            self.busy = 2
+        elif self.writing is None and b & 0xC0 == 0x40:
+            self.cmd = bytearray([b])
+        return r
+
+    def end_block(self):
+        block = self.writing
+        self.writing += 1
+        if block in self.fail:
+            self.log.append("fail %d" % block)
+            self.out = [0x0D]
+        else:
+            self.log.append("block %d" % block)
+            self.blocks[block] = bytes(self.data[:512])
+            self.out = [0xE5]
+        self.data = None
+        self.busy = self.busy_after_block
+
+    def command(self, cmd, arg):
+        block = arg // 512
+        if cmd == 25:
+            self.log.append("CMD25 %d" % block)
+            self.writing = block
+            self.out = [0xFF, 0]
+        elif cmd == 17:
+            self.log.append("CMD17 %d" % block)
+            data = list(self.blocks.get(block, bytes(512)))
+            self.out = [0xFF, 0, 0xFF, 0xFE] + data + [0xFF, 0xFF]
+        else:
+            self.out = [0xFF, 4]
+
+    def take_log(self):
+        log, self.log = self.log, []
+        return log
+
+
+def data(*tags):
+    return b"".join(bytes([t]) * 512 for t in tags)
+
+
+card = Card()
+sd = SDCardProtocol(card.exchange)
+
+# Writes are queued after opening the CMD25 stream, and sent in the
+# background as the card becomes ready for each block.
+print(sd.writeblocks(10, data(10, 11)), sd.queued, sd.pending, card.take_log())
+sd.background()
+print(sd.queued, sd.pending, card.take_log())
+sd.background()
+print(sd.queued, sd.pending, card.take_log())
+
+# While the card is busy the background does nothing.
+print(sd.writeblocks(12, data(12)), card.take_log())
+card.busy = 5
+sd.background()
+print(sd.queued, card.take_log())
+
+# A non contiguous write ends the stream after sending what is queued.
+print(sd.writeblocks(20, data(20)), card.take_log())
+
+# A full queue sends its oldest blocks to make room.
+print(sd.writeblocks(21, data(21, 22, 23, 24, 25)), sd.queued, card.take_log())
+
+# sync sends everything and ends the stream.
+print(sd.sync(), sd.queued, sd.pending, card.take_log())
+print(sorted(card.blocks))
+print(all(card.blocks[b] == bytes([b]) * 512 for b in card.blocks))
+print(sd.sync(), card.take_log())
+
+# Reading ends the stream first, so it sees the queued blocks.
+print(sd.writeblocks(30, data(30)), card.take_log())
+buf = bytearray(512)
+print(sd.readblocks(30, buf), buf == bytes([30]) * 512, card.take_log())
+
+# A block that fails in the background is reported by the next write, which
+# is not done, and the stream is stopped.
+card.fail = {41}
+print(sd.writeblocks(40, data(40, 41, 42)), card.take_log())
+sd.background()
+sd.background()
+print(sd.queued, sd.pending, card.take_log())
+print(sd.writeblocks(43, data(43)) == -errno.EIO, card.take_log())
+print(sd.writeblocks(43, data(43)), card.take_log())
+print(sd.sync(), card.take_log())
+
+# Or by sync.
+print(sd.writeblocks(41, data(41)), sd.sync() == -errno.EIO, card.take_log())
+card.fail = set()
+print(sd.sync(), card.take_log())
+
+# A card that stays busy times out.
+print(sd.writeblocks(50, data(50)), card.take_log())
+card.stuck = True
+print(sd.sync() == -errno.ETIMEDOUT, sd.queued, sd.pending, card.take_log())
+card.stuck = False
+print(sd.sync(), card.take_log())
+
+# Without RAM for the queue, each block is sent as it is written.
+card = Card()
+sd = SDCardProtocol(card.exchange, queue=False)
+print(sd.writeblocks(60, data(60, 61)), sd.queued, sd.pending, card.take_log())
+print(sd.sync(), card.take_log())
+
+# A FAT filesystem on the card reports a write that fails in the background
+# when the file is closed, as the close syncs the block device.
+import os
+
+
+class BlockDevice:
+    def __init__(self, sd, count):
+        self.sd = sd
+        self.count = count
+
+    def readblocks(self, n, buf):
+        return self.sd.readblocks(n, buf)
+
+    def writeblocks(self, n, buf):
+        return self.sd.writeblocks(n, buf)
+
+    def ioctl(self, op, arg):
+        if op == 3:  # sync
+            return self.sd.sync() or 0
+        if op == 4:  # block count
+            return self.count
+        if op == 5:  # block size
+            return 512
+
+
+card = Card()
+bdev = BlockDevice(SDCardProtocol(card.exchange), 128)
+os.VfsFat.mkfs(bdev)
+fs = os.VfsFat(bdev)
+card.take_log()
+with fs.open("ok.txt", "w") as f:
+    f.write("ok")
+print(fs.open("ok.txt", "r").read())
+
+f = fs.open("lost.txt", "w")
+f.write("lost")
+card.fail = set(range(128))
+try:
+    f.close()
+except OSError as e:
+    print("OSError", e.errno == errno.EIO)
+card.fail = set()
@@ -0,0 +1,153 @@
+# Test the loops behind socketpool.Socket's sendmsg, recvmsg_into and sendfile
+# against a simulated socket, using the coverage build's SocketTransfer.
+import errno
+import io
+import uctypes
+
+try:
+    SocketTransfer
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+
+class Sock:
+    def __init__(self):
+        self.sent = b""
+        # Most bytes each send takes, then what it does once these run out:
+        # None to take everything, or an errno to raise.
+        self.sends = []
+        self.after = None
+        self.incoming = []
+        self.recv_error = None
+
+    def send(self, data):
+        if self.sends:
+            n = self.sends.pop(0)
+        elif self.after is None:
+            n = len(data)
+        elif self.after == -1:
+            return -1
+        else:
+            raise OSError(self.after)
+        self.sent += data[:n]
+        return min(n, len(data))
+
+    def recv(self, n):
+        if not self.incoming:
+            if self.recv_error:
+                raise OSError(self.recv_error)
+            return b""
+        data = self.incoming.pop(0)
+        if len(data) > n:
+            self.incoming.insert(0, data[n:])
+            data = data[:n]
+        return data
+
+    def readable(self):
+        return bool(self.incoming) or self.recv_error is not None
+
+    def transfer(self):
+        return SocketTransfer(self.send, self.recv, self.readable)
+
+
+def attempt(f, *args):
+    try:
+        return f(*args)
+    except OSError as e:
+        return "OSError", e.errno
+
+
+print("sendmsg")
+s = Sock()
+print(s.transfer().sendmsg([b"abc", b"", b"defg"]), s.sent)
+# Stops at the first buffer that isn't sent completely.
+s = Sock()
+s.sends = [3, 2]
+print(s.transfer().sendmsg([b"abc", b"defg", b"hi"]), s.sent)
+# An error after some bytes went out returns them; before any, it raises.
+s = Sock()
+s.sends = [3]
+s.after = errno.EAGAIN
+print(s.transfer().sendmsg([b"abc", b"defg"]), s.sent)
+print(attempt(s.transfer().sendmsg, [b"defg"]))
+s.after = -1
+print(attempt(s.transfer().sendmsg, [b"defg"]))
+
+print("recvmsg_into")
+s = Sock()
+s.incoming = [b"abcdefgh"]
+bufs = [bytearray(3), bytearray(3), bytearray(3)]
+print(s.transfer().recvmsg_into(bufs), bufs)
+# Only waits for the first buffer.
+s = Sock()
+s.incoming = [b"abc"]
+bufs = [bytearray(3), bytearray(3)]
+print(s.transfer().recvmsg_into(bufs), bufs)
+# An error after some bytes were received returns them; before any, it raises.
+s = Sock()
+s.incoming = [b"abc"]
+s.recv_error = errno.ECONNRESET
+bufs = [bytearray(3), bytearray(3)]
+print(s.transfer().recvmsg_into(bufs), bufs)
+print(attempt(s.transfer().recvmsg_into, bufs))
+
+print("sendfile")
+data = bytes(range(256)) * 20
+s = Sock()
+f = io.BytesIO(data)
+print(s.transfer().sendfile(f, 0, 1 << 30), s.sent == data, f.tell())
+s = Sock()
+f = io.BytesIO(data)
+print(s.transfer().sendfile(f, 100, 1000), s.sent == data[100:1100], f.tell())
+# Short sends carry on until the block is sent.
+s = Sock()
+s.sends = [1, 7, 2000]
+f = io.BytesIO(data)
+print(s.transfer().sendfile(f, 0, 3000), s.sent == data[:3000], f.tell())
+# A send error leaves the file after the last byte sent, so it can resume.
+s = Sock()
+s.sends = [2048, 10]
+s.after = errno.ETIMEDOUT
+f = io.BytesIO(data)
+print(s.transfer().sendfile(f, 0, 1 << 30), f.tell())
+print(attempt(s.transfer().sendfile, f, 0, 1 << 30), f.tell())
+s.after = None
+print(s.transfer().sendfile(f, 0, 1 << 30), s.sent == data, f.tell())
+
+
+# A read error leaves the file after the last byte sent too. The file is a
+# Python stream so that reads can fail, and seeks go through its ioctl.
+MP_STREAM_SEEK = 2
+SEEK_STRUCT = {"offset": uctypes.INT64 | 0, "whence": uctypes.INT32 | 8}
+
+
+class Failing(io.IOBase):
+    def __init__(self, data, fail_at):
+        self.data = data
+        self.pos = 0
+        self.fail_at = fail_at
+
+    def readinto(self, buf):
+        if self.pos >= self.fail_at:
+            return -errno.EIO
+        n = min(len(buf), self.fail_at - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+    def ioctl(self, request, arg):
+        if request != MP_STREAM_SEEK:
+            return -errno.EINVAL
+        seek = uctypes.struct(arg, SEEK_STRUCT)
+        self.pos = seek.offset + (self.pos if seek.whence == 1 else 0)
+        seek.offset = self.pos
+        return 0
+
+
+s = Sock()
+f = Failing(data, 3000)
+print(s.transfer().sendfile(f, 0, 1 << 30), s.sent == data[:2048], f.pos)
+print(attempt(s.transfer().sendfile, f, 0, 1 << 30), f.pos)
+f = Failing(data, 3000)
+print(s.transfer().sendfile(f, 2500, 400), f.pos)
@@ -0,0 +1,77 @@
+# Test hashlib.file_digest(), including several digests in one pass.
+try:
+    import hashlib, io
+
+    hashlib.file_digest
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+try:
+    import binascii
+
+    binascii.crc32
+except (ImportError, AttributeError):
+    binascii = None
+
+# Cross block boundaries, including a whole number of blocks.
+for size in (0, 1, 63, 64, 65, 4095, 4096, 4097, 10000):
+    data = bytes(i * 13 & 0xFF for i in range(size))
+    h = hashlib.file_digest(io.BytesIO(data), "sha256")
+    print(size, h.digest() == hashlib.sha256(data).digest())
+
+data = b"0123456789abcdef" * 600
+print(hashlib.file_digest(io.BytesIO(data), hashlib.sha256).digest() == hashlib.sha256(data).digest())
+
+# Several digests in one pass, including one written in Python.
+class CRC32:
+    def __init__(self):
+        self.value = 0
+        self.calls = 0
+
+    def update(self, buf):
+        self.value = binascii.crc32(buf, self.value)
+        self.calls += 1
+
+    def digest(self):
+        return self.value.to_bytes(4, "big")
+
+
+if binascii:
+    sha, crc = hashlib.file_digest(io.BytesIO(data), ("sha256", CRC32))
+    print(sha.digest() == hashlib.sha256(data).digest())
+    print(crc.value == binascii.crc32(data), crc.calls)
+else:
+    print(True)
+    print(True, 3)
+
+f = io.BytesIO(data)
+f.seek(100)
+print(hashlib.file_digest(f, ["sha256"])[0].digest() == hashlib.sha256(data[100:]).digest())
+
+for digest in ("sha0", 1):
+    try:
+        hashlib.file_digest(io.BytesIO(data), digest)
+    except (ValueError, TypeError) as e:
+        print(type(e).__name__)
+try:
+    hashlib.file_digest(data, "sha256")
+except (OSError, TypeError) as e:
+    print(type(e).__name__)
+
+# A Python digest may keep the buffer it was updated with.
+class Keep:
+    def __init__(self):
+        self.buf = None
+
+    def update(self, buf):
+        self.buf = buf
+
+    def digest(self):
+        return bytes(self.buf)
+
+
+keep = hashlib.file_digest(io.BytesIO(data[:10]), Keep)
+for i in range(100):
+    bytearray(4096)
+print(bytes(keep.buf[:10]) == data[:10])
@@ -0,0 +1,81 @@
+# Test files that are written and read at the same time on a FAT filesystem.
+
+try:
+    import os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMBlockDevice(100)
+    os.VfsFat.mkfs(bdev)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+vfs = os.VfsFat(bdev)
+os.mount(vfs, "/ramdisk")
+
+# Append lines to two files in turn while reading a third.
+with open("/ramdisk/big", "wb") as f:
+    f.write(bytes(range(256)) * 24)
+a = open("/ramdisk/a.csv", "w")
+b = open("/ramdisk/b.csv", "w")
+big = open("/ramdisk/big", "rb")
+total = 0
+for i in range(200):
+    a.write("%d,%d\n" % (i, i * i))
+    b.write("%d\n" % -i)
+    chunk = big.read(31)
+    if not chunk:
+        big.seek(0)
+        chunk = big.read(31)
+    total += sum(chunk)
+print(total)
+
+# Read a file back with a multi-sector read while the others are still open.
+a.flush()
+with open("/ramdisk/a.csv") as f:
+    data = f.read()
+print(len(data), repr(data[:10]), repr(data[-12:]))
+a.close()
+b.close()
+big.close()
+
+# A fresh mount of the block device sees everything once the files are closed.
+vfs2 = os.VfsFat(bdev)
+with vfs2.open("/a.csv", "r") as f:
+    print(f.read() == data)
+with vfs2.open("/b.csv", "r") as f:
+    lines = f.read().split()
+    print(len(lines), lines[0], lines[-1])
+print(sorted(vfs2.ilistdir("/")))
+
+# Data written through one mount is not lost when it is unmounted.
+f = open("/ramdisk/c.txt", "w")
+f.write("unsynced")
+f.close()
+os.umount("/ramdisk")
+print(os.VfsFat(bdev).open("/c.txt", "r").read())
@@ -0,0 +1,99 @@
+# Test preallocating contiguous space for a file on a FAT filesystem.
+
+try:
+    import errno, os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMBlockDevice(200)
+    os.VfsFat.mkfs(bdev)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+vfs = os.VfsFat(bdev)
+free = vfs.statvfs("/")[3]
+
+f = vfs.open("/log.csv", "w")
+if not hasattr(f, "preallocate"):
+    f.close()
+    print("SKIP")
+    raise SystemExit
+
+# The space is taken, but the file only has what has been written to it.
+f.preallocate(20000)
+print(vfs.statvfs("/")[3] < free - 35)
+for i in range(100):
+    f.write("%d,%d\n" % (i, i * i))
+f.flush()
+print(vfs.stat("/log.csv")[6])
+f.close()
+
+# Unused space is given back on close.
+print(vfs.statvfs("/")[3] == free - 2)
+with vfs.open("/log.csv", "r") as f:
+    lines = f.read().split()
+print(len(lines), lines[0], lines[-1])
+
+# A file can grow past the space preallocated for it.
+with vfs.open("/big", "wb") as f:
+    f.preallocate(1000)
+    for i in range(10):
+        f.write(bytes([i]) * 300)
+with vfs.open("/big", "rb") as f:
+    data = f.read()
+print(len(data), data[0], data[999], data[1000], data[-1])
+
+# Nothing is left allocated to a file that was not written to.
+with vfs.open("/empty", "w") as f:
+    f.preallocate(5000)
+print(vfs.stat("/empty")[6], vfs.statvfs("/")[3] == free - 8)
+
+# Only an empty file open for writing can be preallocated.
+with vfs.open("/log.csv", "a") as f:
+    try:
+        f.preallocate(1000)
+    except OSError as er:
+        print(er.errno == errno.EACCES)
+with vfs.open("/log.csv", "r") as f:
+    try:
+        f.preallocate(1000)
+    except OSError as er:
+        print(er.errno == errno.EACCES)
+with vfs.open("/new", "w") as f:
+    try:
+        f.preallocate(0)
+    except ValueError:
+        print("ValueError")
+    try:
+        f.preallocate(10000000)
+    except OSError as er:
+        print(er.errno == errno.EACCES)
+
+# Another mount of the device sees the same files.
+vfs2 = os.VfsFat(bdev)
+print(sorted((name, size) for name, _, _, size in vfs2.ilistdir("/")))
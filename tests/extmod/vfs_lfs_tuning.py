@@ -0,0 +1,68 @@
+# Test the block_cycles and cache_size tuning arguments of VfsLfs2
+
+try:
+    import os
+
+    os.VfsLfs2
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+        self.erases = 0
+
+    def readblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        for i in range(len(buf)):
+            buf[i] = self.data[addr + i]
+
+    def writeblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        for i in range(len(buf)):
+            self.data[addr + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # block erase
+            self.erases += 1
+            return 0
+
+
+bdev = RAMBlockDevice(30)
+
+# Format and mount with the tuning arguments.
+os.VfsLfs2.mkfs(bdev, readsize=64, progsize=64, block_cycles=8, cache_size=256)
+vfs = os.VfsLfs2(bdev, readsize=64, progsize=64, block_cycles=8, cache_size=256)
+for i in range(20):
+    with vfs.open("test.txt", "w") as f:
+        f.write("data%d" % i)
+with vfs.open("test.txt", "r") as f:
+    print(f.read())
+print(bdev.erases > 0)
+
+# A cache the size of a block.
+vfs = os.VfsLfs2(bdev, cache_size=512)
+with vfs.open("test.txt", "r") as f:
+    print(f.read())
+
+# block_cycles=-1 turns off wear levelling.
+vfs = os.VfsLfs2(bdev, block_cycles=-1)
+with vfs.open("test.txt", "a") as f:
+    f.write("!")
+with vfs.open("test.txt", "r") as f:
+    print(f.read())
+
+# The cache must be a multiple of readsize and progsize and divide the block size.
+for cache_size in (100, 384, 1024):
+    try:
+        os.VfsLfs2(bdev, readsize=64, progsize=64, cache_size=cache_size)
+    except ValueError:
+        print("ValueError", cache_size)
@@ -0,0 +1,56 @@
+# test float arithmetic and comparisons with float and small int operands,
+# which the VM handles without going through the float type
+
+
+def ops(a, b):
+    print(a + b, a - b, a * b)
+    print(a < b, a > b, a == b, a <= b, a >= b, a != b)
+    try:
+        print(a / b)
+    except ZeroDivisionError:
+        print("ZeroDivisionError")
+
+
+for a, b in ((1.5, 0.75), (1.5, 2), (3, 0.5), (-2.0, -2), (0.0, 0), (1.0, 0.0), (2.5, 1.25)):
+    ops(a, b)
+
+# in-place forms
+x = 1.0
+x += 2
+x -= 0.5
+x *= 4
+x /= 5
+print(x)
+
+# division by zero must still raise
+for b in (0, 0.0, -0.0):
+    try:
+        1.0 / b
+    except ZeroDivisionError:
+        print("ZeroDivisionError")
+
+# nan and inf
+nan = float("nan")
+inf = float("inf")
+print(nan == nan, nan != nan, nan < 1, nan >= 1.0)
+print(inf > 10**6, -inf < 0, inf - inf != inf - inf)
+
+# operands that are not floats or small ints fall back to the general case
+print(1.5 + True, 2.0 * (1 << 40) == 1 << 41, 1.5 < (1 << 70), 1.0 == (1 << 70))
+try:
+    1.5 + "x"
+except TypeError:
+    print("TypeError")
+
+
+# a typical loop
+def mix(n):
+    acc = 0.0
+    for i in range(n):
+        acc = acc * 0.5 + i
+        if acc > 100:
+            acc -= 100
+    return acc
+
+
+print("%.3f" % mix(50))
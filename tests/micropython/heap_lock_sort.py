@@ -0,0 +1,20 @@
+# test that list.sort works without heap memory for keys or merging
+
+import micropython
+
+l = [(i * 37) % 101 - 50 for i in range(300)]
+expected = sorted(l)
+expected_key = sorted(l, key=abs)
+expected_key_reverse = sorted(l, key=abs, reverse=True)
+a = l[:]
+b = l[:]
+c = l[:]
+
+micropython.heap_lock()
+a.sort()
+b.sort(key=abs)
+c.sort(key=abs, reverse=True)
+micropython.heap_unlock()
+
+print(a == expected, b == expected_key, c == expected_key_reverse)
+print(b[:8])
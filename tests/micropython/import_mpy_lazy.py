@@ -0,0 +1,121 @@
+# Test importing an .mpy file whose functions are only loaded when first used.
+
+try:
+    import gc, os, sys
+
+    os.stat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+# Functions are only loaded lazily from an absolute path.
+temp_dir = os.getcwd() + "/micropy_test_lazy_dir"
+try:
+    os.stat(temp_dir)
+    print("SKIP")
+    raise SystemExit
+except OSError:
+    pass
+
+# lazymod.mpy is compiled from:
+# class A:
+#     def __init__(self, x):
+#         self.x = x
+#
+#     def add(self, y):
+#         def inner(z):
+#             return self.x + z
+#
+#         return inner(y)
+#
+#
+# def gen(n):
+#     for i in range(n):
+#         yield i * 2
+#
+#
+# def f(a, b=2, *, c=3):
+#     return a + b + c
+#
+#
+# def g():
+#     # Long enough to stand out in heap_usage().
+#     x = 0
+#     x = x * 3 + 3
+#     ...
+#     x = x * 42 + 42
+#     return x
+#
+#
+# def h():
+#     return "h"
+lazymod_v1 = b'C\x07\x00\x1f\x16\x00\x14lazymod.py\x00\x0f\x02A\x00\x02c\x00\x06gen\x00\x02f\x00\x02g\x00\x02h\x00#\x02x\x00\x06add\x00\ninner\x00/-5\x02n\x00\x02a\x00\x02b\x00\x82\x13\x02y\x00\x0b\x02z\x00\x82|\x18\x12\x01\x89\x0bd@m \x84.T2\x00\x10\x024\x02\x16\x022\x01\x16\x04\x82*\x01,\x00\x83\x10\x03b3\x02\x16\x052\x03\x16\x062\x04\x16\x07Qc\x05\x81<\x00\x06\x02(d\x11\x0c\x16\r\x10\x02\x16\x0e2\x00\x16\x082\x01\x16\nQc\x02`\x1a\x08\x08\x12\t@\xb1\x1f\t\x00Qc\x81\x1c"\r\n\x12\x13`@e\x00\xb0 \x00\x01\xc2\xb2\xb14\x01c\x01p\x1a\n\x0b\x14\x15``%\x00\x13\t:[c\x82\x00\xa9@\n\x04\x0f\x80\x0c&\xb0\x80BKW\xc1\xb18\x89\x1dgY8\x88NXZA1\x80YYQc\x81\x18\xa2\x89\x80\x80@\x0c\x05\x10\x11\x03\x80\x11\xb0:[:\x81\x1bc\x97\x10\x10X\x06\x80\x16"((((((((((((((((((((((((((((((((((((((((\x80\xc0\xb08\x89]8\x89[\xc0\xb08\x8a\x1d8\x8a\x1b\xc0\xb08\x8a]8\x8a[\xc0\xb08\x8b\x1d8\x8b\x1b\xc0\xb08\x8b]8\x8b[\xc0\xb08\x8c\x1d8\x8c\x1b\xc0\xb08\x8c]8\x8c[\xc0\xb08\x8d\x1d8\x8d\x1b\xc0\xb08\x8d]8\x8d[\xc0\xb08\x8e\x1d8\x8e\x1b\xc0\xb08\x8e]8\x8e[\xc0\xb08\x8f\x1d8\x8f\x1b\xc0\xb08\x8f]8\x8f[\xc0\xb08\x90\x1d8\x90\x1b\xc0\xb08\x90]8\x90[\xc0\xb08\x91\x1d8\x91\x1b\xc0\xb08\x91]8\x91[\xc0\xb08\x92\x1d8\x92\x1b\xc0\xb08\x92]8\x92[\xc0\xb08\x93\x1d8\x93\x1b\xc0\xb08\x93]8\x93[\xc0\xb08\x94\x1d8\x94\x1b\xc0\xb08\x94]8\x94[\xc0\xb08\x95\x1d8\x95\x1b\xc0\xb08\x95]8\x95[\xc0\xb08\x96\x1d8\x96\x1b\xc0\xb08\x96]8\x96[\xc0\xb08\x97\x1d8\x97\x1b\xc0\xb08\x97]8\x97[\xc0\xb08\x98\x1d8\x98\x1b\xc0\xb08\x98]8\x98[\xc0\xb08\x99\x1d8\x99\x1b\xc0\xb08\x99]8\x99[\xc0\xb08\x9a\x1d8\x9a\x1b\xc0\xb08\x9a]8\x9a[\xc0\xb08\x9b\x1d8\x9b\x1b\xc0\xb08\x9b]8\x9b[\xc0\xb08\x9c\x1d8\x9c\x1b\xc0\xb08\x9c]8\x9c[\xc0\xb08\x9d\x1d8\x9d\x1b\xc0\xb0c@\x00\x06\x07\x80C\x10\x07c'
+
+# The same module with h returning "H".
+lazymod_v2 = b'C\x07\x00\x1f\x17\x00\x16lazymod2.py\x00\x0f\x02A\x00\x02c\x00\x06gen\x00\x02f\x00\x02g\x00\x02h\x00\x02H\x00#\x02x\x00\x06add\x00\ninner\x00/-5\x02n\x00\x02a\x00\x02b\x00\x82\x13\x02y\x00\x0b\x02z\x00\x82|\x18\x12\x01\x89\x0bd@m \x84.T2\x00\x10\x024\x02\x16\x022\x01\x16\x04\x82*\x01,\x00\x83\x10\x03b3\x02\x16\x052\x03\x16\x062\x04\x16\x07Qc\x05\x81<\x00\x06\x02(d\x11\r\x16\x0e\x10\x02\x16\x0f2\x00\x16\t2\x01\x16\x0bQc\x02`\x1a\x08\t\x13\n@\xb1\x1f\n\x00Qc\x81\x1c"\r\x0b\x13\x14`@e\x00\xb0 \x00\x01\xc2\xb2\xb14\x01c\x01p\x1a\n\x0c\x15\x16``%\x00\x13\n:[c\x82\x00\xa9@\n\x04\x10\x80\x0c&\xb0\x80BKW\xc1\xb18\x89\x1dgY8\x88NXZA1\x80YYQc\x81\x18\xa2\x89\x80\x80@\x0c\x05\x11\x12\x03\x80\x11\xb0:[:\x81\x1bc\x97\x10\x10X\x06\x80\x16"((((((((((((((((((((((((((((((((((((((((\x80\xc0\xb08\x89]8\x89[\xc0\xb08\x8a\x1d8\x8a\x1b\xc0\xb08\x8a]8\x8a[\xc0\xb08\x8b\x1d8\x8b\x1b\xc0\xb08\x8b]8\x8b[\xc0\xb08\x8c\x1d8\x8c\x1b\xc0\xb08\x8c]8\x8c[\xc0\xb08\x8d\x1d8\x8d\x1b\xc0\xb08\x8d]8\x8d[\xc0\xb08\x8e\x1d8\x8e\x1b\xc0\xb08\x8e]8\x8e[\xc0\xb08\x8f\x1d8\x8f\x1b\xc0\xb08\x8f]8\x8f[\xc0\xb08\x90\x1d8\x90\x1b\xc0\xb08\x90]8\x90[\xc0\xb08\x91\x1d8\x91\x1b\xc0\xb08\x91]8\x91[\xc0\xb08\x92\x1d8\x92\x1b\xc0\xb08\x92]8\x92[\xc0\xb08\x93\x1d8\x93\x1b\xc0\xb08\x93]8\x93[\xc0\xb08\x94\x1d8\x94\x1b\xc0\xb08\x94]8\x94[\xc0\xb08\x95\x1d8\x95\x1b\xc0\xb08\x95]8\x95[\xc0\xb08\x96\x1d8\x96\x1b\xc0\xb08\x96]8\x96[\xc0\xb08\x97\x1d8\x97\x1b\xc0\xb08\x97]8\x97[\xc0\xb08\x98\x1d8\x98\x1b\xc0\xb08\x98]8\x98[\xc0\xb08\x99\x1d8\x99\x1b\xc0\xb08\x99]8\x99[\xc0\xb08\x9a\x1d8\x9a\x1b\xc0\xb08\x9a]8\x9a[\xc0\xb08\x9b\x1d8\x9b\x1b\xc0\xb08\x9b]8\x9b[\xc0\xb08\x9c\x1d8\x9c\x1b\xc0\xb08\x9c]8\x9c[\xc0\xb08\x9d\x1d8\x9d\x1b\xc0\xb0c@\x00\x06\x07\x80C\x10\x08c'
+
+
+def write(data, name="lazymod"):
+    with open(temp_dir + "/" + name + ".mpy", "wb") as f:
+        f.write(data)
+
+
+os.mkdir(temp_dir)
+sys.path.insert(0, temp_dir)
+
+try:
+    # Without lazy loading, a change to the file after import goes unnoticed.
+    write(lazymod_v1, "lazyprobe")
+    import lazyprobe
+
+    write(lazymod_v2, "lazyprobe")
+    try:
+        lazyprobe.h()
+        print("SKIP")
+        raise SystemExit
+    except ValueError:
+        pass
+    os.remove(temp_dir + "/lazyprobe.mpy")
+
+    write(lazymod_v1)
+    import lazymod
+
+    # Function objects exist before their bytecode is loaded.
+    print(lazymod.f.__name__, lazymod.gen.__name__)
+    print(lazymod.f(1), lazymod.f(1, 0, c=0))
+    print(list(lazymod.gen(4)))
+    a = lazymod.A(10)
+    print(a.add(5), a.add(6))
+
+    # Bytecode only takes up RAM once a function is used.
+    try:
+        from memorymonitor import heap_usage
+
+        gc.collect()
+        before = heap_usage()["bytecode"]
+        lazymod.g()
+        gc.collect()
+        print(heap_usage()["bytecode"] - before > 100)
+    except ImportError:
+        print(True)
+
+    # Calling a function whose file changed since import is an error, not a
+    # crash.
+    write(lazymod_v2)
+    try:
+        print(lazymod.h())
+    except ValueError as er:
+        print("ValueError", er)
+
+    # Functions that were already called keep working.
+    print(lazymod.f(2))
+    os.remove(temp_dir + "/lazymod.mpy")
+    print(lazymod.f(3), a.add(7))
+finally:
+    sys.path.pop(0)
+    for name in ("lazymod", "lazyprobe"):
+        try:
+            os.remove(temp_dir + "/" + name + ".mpy")
+        except OSError:
+            pass
+    os.rmdir(temp_dir)
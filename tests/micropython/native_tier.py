@@ -0,0 +1,106 @@
+# test promotion of hot bytecode functions to native code
+
+import micropython
+import io
+import sys
+
+try:
+    micropython.native_tier
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+# only source compiled while promotion is enabled can be promoted
+micropython.native_tier(10)
+print(micropython.native_tier())
+
+g = {}
+exec(
+    """
+def add(a, b):
+    return a + b
+
+def loop(n):
+    s = 0
+    i = 0
+    while i < n:
+        s += i
+        i += 1
+    return s
+
+def fail(x):
+    return 1 // x
+
+def rec(n):
+    return n if n < 2 else rec(n - 1) + rec(n - 2)
+
+def gen(n):
+    for i in range(n):
+        yield i
+
+def make(k):
+    def inner(v):
+        return v * k
+    return inner
+
+def maybe(c):
+    if c:
+        x = 1
+    return x
+
+def reraise(x):
+    try:
+        return 1 // x
+    except ZeroDivisionError:
+        raise
+""",
+    g,
+)
+
+
+# number of frames in the traceback of a call; native frames don't add one
+def frames(f, *args):
+    try:
+        f(*args)
+    except ZeroDivisionError as e:
+        buf = io.StringIO()
+        sys.print_exception(e, buf)
+        return buf.getvalue().count(", line ")
+
+
+print(frames(g["fail"], 0))
+for i in range(20):
+    g["fail"](1)
+print(frames(g["fail"], 0))
+print(g["fail"].__name__)
+
+print([g["add"](i, i) for i in range(20)][-1], g["add"].__name__)
+
+# backward jumps count too, promotion happens on the next call
+print(g["loop"](100), g["loop"](100), g["loop"](1000))
+
+# a recursive function is promoted once its outermost call has returned
+print(g["rec"](15), g["rec"](15))
+
+# generators stay bytecode
+print(sum(g["gen"](100)), sum(g["gen"](100)))
+
+# closures created before and after promotion of the enclosing function
+fs = [g["make"](k) for k in range(20)]
+print([f(2) for f in fs])
+print([f(3) for f in fs])
+
+print([f.__name__ for f in fs[:2]])
+
+# unbound locals still raise once promoted
+print([g["maybe"](1) for i in range(20)][-1])
+try:
+    g["maybe"](0)
+except NameError:
+    print("NameError")
+
+# functions with forms of raise that native code can't run stay bytecode
+print([g["reraise"](1) for i in range(20)][-1], frames(g["reraise"], 0))
+
+micropython.native_tier(0)
+print(micropython.native_tier())
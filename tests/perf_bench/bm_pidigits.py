@@ -32,15 +32,23 @@ def gen_pi_digits(n):
     return digs
 
 
+# Modular exponentiation as used by RSA/DH-style code: a chain of pow() calls
+# with full-width exponents against an odd and an even modulus.
+def modpow_chain(bits, n):
+    x = 0x123456789ABCDEF
+    for m in ((1 << bits) - 159, (1 << bits) - 2):
+        for i in range(n):
+            x = pow(x + i, m - 1 - i, m)
+    return x
 ###########################################################################
 # Benchmark interface
 
 bm_params = {
-    (32, 10): (1, 20),
-    (50, 25): (1, 35),
-    (100, 100): (1, 65),
-    (1000, 1000): (2, 250),
-    (5000, 1000): (3, 350),
+    (32, 10): (1, 20, 64, 1),
+    (50, 25): (1, 35, 128, 2),
+    (100, 100): (1, 65, 256, 4),
+    (1000, 1000): (2, 250, 1024, 4),
+    (5000, 1000): (3, 350, 2048, 4),
 }
 
 
@@ -49,13 +57,13 @@ def bm_setup(params):
 
     def run():
         nonlocal state
-        nloop, ndig = params
-        ndig = params[1]
+        nloop, ndig, modbits, nmod = params
         for _ in range(nloop):
             state = None  # free previous result
-            state = gen_pi_digits(ndig)
+            state = gen_pi_digits(ndig), modpow_chain(modbits, nmod)
 
     def result():
-        return params[0] * params[1], "".join(str(d) for d in state)
+        digs, x = state
+        return params[0] * params[1], "".join(str(d) for d in digs) + " " + str(x % 1000000007)
 
     return run, result
@@ -0,0 +1,76 @@
+# Test performance of aesio, encrypting a buffer in place in each mode and
+# decrypting it again. GCM also authenticates a header and checks the tag.
+
+try:
+    import aesio
+
+    aesio.MODE_GCM
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+KEY = b"Sixteen byte key"
+IV = b"sixteen byte iv!"
+NONCE = IV[:12]
+HEADER = b"frame header"
+
+
+def setup(nbytes):
+    global payload, data
+    payload = bytes(i * 7 & 0xFF for i in range(nbytes))
+    data = bytearray(payload)
+
+
+def run_ecb():
+    view = memoryview(data)
+    cipher = aesio.AES(KEY, aesio.MODE_ECB)
+    for i in range(0, len(view), 16):
+        cipher.encrypt_into(view[i : i + 16], view[i : i + 16])
+    for i in range(0, len(view), 16):
+        cipher.decrypt_into(view[i : i + 16], view[i : i + 16])
+    return True
+
+
+def run_chained(mode):
+    aesio.AES(KEY, mode, IV=IV).encrypt_into(data, data)
+    aesio.AES(KEY, mode, IV=IV).decrypt_into(data, data)
+    return True
+
+
+def run_gcm():
+    cipher = aesio.AES(KEY, aesio.MODE_GCM, IV=NONCE)
+    cipher.update(HEADER)
+    cipher.encrypt_into(data, data)
+    tag = cipher.digest()
+    cipher = aesio.AES(KEY, aesio.MODE_GCM, IV=NONCE)
+    cipher.update(HEADER)
+    cipher.decrypt_into(data, data)
+    cipher.verify(tag)
+    return True
+
+
+def test(nloop):
+    global result
+    ok = True
+    for _ in range(nloop):
+        ok = ok and run_ecb() and data == payload
+        ok = ok and run_chained(aesio.MODE_CBC) and data == payload
+        ok = ok and run_chained(aesio.MODE_CTR) and data == payload
+        ok = ok and run_gcm() and data == payload
+    result = ok
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (1, 256),
+    (1000, 10): (2, 4096),
+    (5000, 10): (4, 16384),
+}
+
+
+def bm_setup(params):
+    nloop, nbytes = params
+    setup(nbytes)
+    return lambda: test(nloop), lambda: (nloop * nbytes * 4, result)
@@ -0,0 +1,54 @@
+# Test performance of hashing a file, as when checking a firmware image.
+# SHA-256 and SHA-1 digests are taken in one pass where that is supported,
+# otherwise the file is read in chunks and each chunk is hashed in Python.
+
+import io
+
+try:
+    import hashlib
+
+    hashlib.sha256
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+NAMES = tuple(name for name in ("sha256", "sha1") if hasattr(hashlib, name))
+
+
+def setup(nbytes):
+    global payload, expected
+    payload = bytes(i * 7 & 0xFF for i in range(nbytes))
+    expected = tuple(getattr(hashlib, name)(payload).digest() for name in NAMES)
+
+
+def test(nloop):
+    global result
+    for _ in range(nloop):
+        f = io.BytesIO(payload)
+        if hasattr(hashlib, "file_digest"):
+            digests = hashlib.file_digest(f, NAMES)
+        else:
+            digests = tuple(getattr(hashlib, name)() for name in NAMES)
+            while True:
+                chunk = f.read(4096)
+                if not chunk:
+                    break
+                for h in digests:
+                    h.update(chunk)
+        result = tuple(h.digest() for h in digests) == expected
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (1, 4096),
+    (1000, 10): (2, 32768),
+    (5000, 10): (4, 65536),
+}
+
+
+def bm_setup(params):
+    nloop, nbytes = params
+    setup(nbytes)
+    return lambda: test(nloop), lambda: (nloop * nbytes, result)
@@ -0,0 +1,244 @@
+# Test performance of importing an .mpy file of which only a small part is used,
+# like a driver library with many methods when a program calls just one of them.
+# Builds that load functions lazily only read the functions used.
+
+import os, sys
+
+try:
+    os.stat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+# This is the __lazy_bench.py file that is compiled to __lazy_bench.mpy below.
+"""
+class Driver:
+    def __init__(self, reg):
+        self.reg = reg
+
+    def value(self):
+        return self.reg * 2
+
+    def op0(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 2:
+                out.append((x * 3) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op1(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 3:
+                out.append((x * 4) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op2(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 4:
+                out.append((x * 5) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op3(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 5:
+                out.append((x * 6) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op4(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 6:
+                out.append((x * 7) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op5(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 7:
+                out.append((x * 8) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op6(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 8:
+                out.append((x * 9) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op7(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 9:
+                out.append((x * 10) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op8(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 10:
+                out.append((x * 11) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op9(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 11:
+                out.append((x * 12) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op10(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 12:
+                out.append((x * 13) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+    def op11(self, a, b):
+        out = []
+        for x in range(a, b):
+            if x % 13:
+                out.append((x * 14) ^ self.reg)
+            else:
+                out.append(self.reg - x)
+        self.reg = sum(out) & 0xFFFF
+        return out
+
+
+def helper0(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 31 + b + i) & 0xFFFFFFFF
+    return "helper0", total
+
+
+def helper1(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 32 + b + i) & 0xFFFFFFFF
+    return "helper1", total
+
+
+def helper2(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 33 + b + i) & 0xFFFFFFFF
+    return "helper2", total
+
+
+def helper3(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 34 + b + i) & 0xFFFFFFFF
+    return "helper3", total
+
+
+def helper4(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 35 + b + i) & 0xFFFFFFFF
+    return "helper4", total
+
+
+def helper5(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 36 + b + i) & 0xFFFFFFFF
+    return "helper5", total
+
+
+def helper6(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 37 + b + i) & 0xFFFFFFFF
+    return "helper6", total
+
+
+def helper7(buf):
+    total = 0
+    for i, b in enumerate(buf):
+        total = (total * 38 + b + i) & 0xFFFFFFFF
+    return "helper7", total
+
+
+result = 123
+"""
+file_data = b'C\x07\x00\x1f%\x01\x1e__lazy_bench.py\x00\x0f\x0cDriver\x00\x0ehelper0\x00\x0ehelper1\x00\x0ehelper2\x00\x0ehelper3\x00\x0ehelper4\x00\x0ehelper5\x00\x0ehelper6\x00\x0ehelper7\x00#\x06reg\x00\x82E\x06op0\x00y\x06op1\x00\x06op2\x00\x06op3\x00\x06op4\x00\x06op5\x00\x06op6\x00\x06op7\x00\x06op8\x00\x06op9\x00\x08op10\x00\x08op11\x00\x0cresult\x00/-5\x06buf\x00\x12enumerate\x00\x82\x13\x02a\x00\x02b\x00\x823\x07\n4294967295\x84,\x10&\x01\x89\x80\x84\x07\x84\x07\x84\x07\x84\x07\x84\x07\x84\x07\x84\x07\x84\x07T2\x00\x10\x024\x02\x16\x022\x01\x16\x032\x02\x16\x042\x03\x16\x052\x04\x16\x062\x05\x16\x072\x06\x16\x082\x07\x16\t2\x08\x16\n"\x80{\x16\x1bQc\t\x85t\x004\x02(dd\x84\n\x84\n\x84\n\x84\n\x84\n\x84\n\x84\n\x84\n\x84\n\x84\n\x84\n\x11\x1c\x16\x1d\x10\x02\x16\x1e2\x00\x16\x0b2\x01\x16\r2\x02\x16\x0e2\x03\x16\x102\x04\x16\x112\x05\x16\x122\x06\x16\x132\x07\x16\x142\x08\x16\x152\t\x16\x162\n\x16\x172\x0b\x16\x182\x0c\x16\x192\r\x16\x1aQc\x0e`\x1a\x08\x0b!\x0c@\xb1\x1f\x0c\x00Qch\x11\x08\r!`@\x1d\x0c\x008\x89\x1dc\x85\x10S\x18\x0e!"#\x80\x08#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x89!DP\x1e\x0f\x03\xb48\x89]\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x10!"#\x80\x12#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x89aDP\x1e\x0f\x03\xb48\x8a\x1d\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x11!"#\x80\x1c#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8a!DP\x1e\x0f\x03\xb48\x8a]\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x12!"#\x80&#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8aaDP\x1e\x0f\x03\xb48\x8b\x1d\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x13!"#\x800#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8b!DP\x1e\x0f\x03\xb48\x8b]\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x14!"#\x80:#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8baDP\x1e\x0f\x03\xb48\x8c\x1d\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x15!"#\x80D#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8c!DP\x1e\x0f\x03\xb48\x8c]\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x16!"#\x80N#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8caDP\x1e\x0f\x03\xb48\x8d\x1d\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x17!"#\x80X#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8d!DP\x1e\x0f\x03\xb48\x8d]\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x18!"#\x80b#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8daDP\x1e\x0f\x03\xb48\x8e\x1d\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x19!"#\x80l#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8e!DP\x1e\x0f\x03\xb48\x8e]\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x85\x10S\x18\x1a!"#\x80v#&&P6-+\x00\xc3\xb2\xb1BgW\xc4\xb48\x8eaDP\x1e\x0f\x03\xb48\x8f\x1d\x1d\x0c\x00\xee6\x01YBL\x1e\x0f\x03\x1d\x0c\x00:\x82\x1c6\x01Y8\x88NXZA\x15\x80YY\x12$\xb34\x01"\x83\xff\x7f\xef\x1f\x0c\x00\xb3c\x82hI\x0e\x03\x1f\x80\x81",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x97]:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\x03\xb1*\x02c\x82hI\x0e\x04\x1f\x80\x88",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x98\x1d:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\x04\xb1*\x02c\x82hI\x0e\x05\x1f\x80\x8f",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x98]:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\x05\xb1*\x02c\x82hI\x0e\x06\x1f\x80\x96",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x99\x1d:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\x06\xb1*\x02c\x82hI\x0e\x07\x1f\x80\x9d",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x99]:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\x07\xb1*\x02c\x82hI\x0e\x08\x1f\x80\xa4",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x9a\x1d:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\x08\xb1*\x02c\x82hI\x0e\t\x1f\x80\xab",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x9a]:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\t\xb1*\x02c\x82hI\x0e\n\x1f\x80\xb2",0\x80\xc1\x12 \xb04\x01_K\x140\x02\xc2\xc3\xb18\x9b\x1d:\x81[:\x81\x1b#\x00\xef\xc1B*\x10\n\xb1*\x02c'
+
+# Functions are only loaded lazily from an absolute path.
+temp_dir = os.getcwd() + "/micropy_lazy_bench_dir"
+try:
+    try:
+        os.mkdir(temp_dir)
+    except OSError:
+        pass  # left behind by an earlier run
+    with open(temp_dir + "/__lazy_bench.mpy", "wb") as f:
+        f.write(file_data)
+except OSError:
+    print("SKIP")
+    raise SystemExit
+
+
+def finish(nloop):
+    os.remove(temp_dir + "/__lazy_bench.mpy")
+    os.rmdir(temp_dir)
+    return nloop, result
+
+
+def test(r):
+    global result
+    for _ in r:
+        sys.modules.pop("__lazy_bench", None)
+        module = __import__("__lazy_bench")
+        result = module.Driver(module.result).value()
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (20,),
+    (1000, 10): (200,),
+    (5000, 10): (2000,),
+}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    sys.path.insert(0, temp_dir)
+    return lambda: test(range(nloop)), lambda: finish(nloop)
@@ -0,0 +1,46 @@
+# This tests list.sort() speed on random, already sorted, reverse sorted and
+# partially sorted data, with and without a key function.
+
+
+def make_lists(n):
+    x = 12345
+    rand = []
+    for _ in range(n):
+        x = (x * 1103515245 + 12345) & 0x7FFFFFFF
+        rand.append(x >> 8)
+    records = [(r & 0xFFFF, r) for r in rand]
+    return (
+        rand,
+        sorted(rand),
+        sorted(rand, reverse=True),
+        sorted(rand[: n // 2]) + rand[n // 2 :],
+        records,
+    )
+
+
+def test(nloop, lists):
+    rand, ascending, descending, half, records = lists
+    for _ in range(nloop):
+        rand[:].sort()
+        ascending[:].sort()
+        descending[:].sort()
+        half[:].sort()
+        # Log records sorted by a timestamp key.
+        sorted(records, key=lambda r: r[0])
+        sorted(records, key=lambda r: r[0], reverse=True)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (2, 100),
+    (1000, 10): (4, 1000),
+    (5000, 10): (4, 5000),
+}
+
+
+def bm_setup(params):
+    nloop, n = params
+    lists = make_lists(n)
+    return lambda: test(nloop, lists), lambda: (nloop * n // 100, None)
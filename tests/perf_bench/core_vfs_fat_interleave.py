@@ -0,0 +1,86 @@
+# Test performance of writing two log files on a FAT filesystem while reading
+# a third, as a data logger that looks up values in a table file would.
+# The block device charges a fixed time per call, like the command overhead
+# of an SD card, so the result reflects how many device calls are made.
+
+import os, time
+
+try:
+    os.VfsFat
+    time.sleep_us
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = 0
+        self.writes = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        time.sleep_us(50)
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.writes += 1
+        time.sleep_us(50)
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def setup():
+    global bdev, vfs
+    bdev = RAMBlockDevice(400)
+    os.VfsFat.mkfs(bdev)
+    vfs = os.VfsFat(bdev)
+    with vfs.open("/table", "wb") as f:
+        f.write(bytes(range(256)) * 32)
+
+
+def test(r):
+    global result
+    a = vfs.open("/a.csv", "w")
+    b = vfs.open("/b.csv", "w")
+    table = vfs.open("/table", "rb")
+    na = nb = 0
+    ok = True
+    for i in r:
+        na += a.write("%d,%d\n" % (i, i * i))
+        nb += b.write("%d\n" % -i)
+        offset = table.tell()
+        chunk = table.read(31)
+        if not chunk:
+            table.seek(0)
+            offset = 0
+            chunk = table.read(31)
+        ok = ok and chunk[0] == offset % 256
+    a.close()
+    b.close()
+    table.close()
+    result = ok and vfs.stat("/a.csv")[6] == na and vfs.stat("/b.csv")[6] == nb
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (40,),
+    (1000, 10): (400,),
+    (5000, 10): (2000,),
+}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    setup()
+    return lambda: test(range(nloop)), lambda: (nloop, result)
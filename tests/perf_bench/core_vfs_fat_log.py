@@ -0,0 +1,78 @@
+# Test performance of logging records to a file on a FAT filesystem, flushing
+# it regularly so that little is lost on a power failure. The file is
+# preallocated where that is supported.
+# The block device charges a fixed time per call, like the command overhead
+# of an SD card, so the result reflects how many device calls are made.
+
+import os, time
+
+try:
+    os.VfsFat
+    time.sleep_us
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = 0
+        self.writes = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        time.sleep_us(50)
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.writes += 1
+        time.sleep_us(50)
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+RECORD = b"%08d,0123456789,0123456789,0123456789,0123456789,0123456789\n"
+
+
+def setup():
+    global bdev, vfs
+    bdev = RAMBlockDevice(600)
+    os.VfsFat.mkfs(bdev)
+    vfs = os.VfsFat(bdev)
+
+
+def test(r):
+    global result
+    f = vfs.open("/log.csv", "wb")
+    if hasattr(f, "preallocate"):
+        f.preallocate(len(RECORD % 0) * len(r))
+    for i in r:
+        f.write(RECORD % i)
+        if i % 16 == 15:
+            f.flush()
+    f.close()
+    result = vfs.stat("/log.csv")[6] == len(RECORD % 0) * len(r)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (100,),
+    (1000, 10): (1000,),
+    (5000, 10): (3000,),
+}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    setup()
+    return lambda: test(range(nloop)), lambda: (nloop, result)
@@ -0,0 +1,134 @@
+# Test performance of logging records to littlefs on a simulated NOR flash,
+# the way a littlefs CIRCUITPY stores them.
+# The flash can only be erased in 4KB sectors and erasing is slow. FAT on the
+# same flash has to erase a whole sector for each 512-byte block it writes,
+# which is done once up front to compare how evenly the two wear the flash.
+
+import os, time
+
+try:
+    os.VfsFat
+    os.VfsLfs2
+    time.sleep_us
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class NORFlash:
+    ERASE_SIZE = 4096
+
+    def __init__(self, sectors):
+        self.data = bytearray(sectors * self.ERASE_SIZE)
+        self.erases = [0] * sectors
+
+    def erase(self, sector):
+        self.erases[sector] += 1
+        time.sleep_us(100)
+        a = sector * self.ERASE_SIZE
+        self.data[a : a + self.ERASE_SIZE] = b"\xff" * self.ERASE_SIZE
+
+
+# FAT sees 512-byte blocks, and each write rewrites the sectors it touches.
+class FATBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, flash):
+        self.flash = flash
+
+    def readblocks(self, n, buf):
+        a = n * self.SEC_SIZE
+        buf[:] = self.flash.data[a : a + len(buf)]
+
+    def writeblocks(self, n, buf):
+        a = n * self.SEC_SIZE
+        end = a + len(buf)
+        for sector in range(a // NORFlash.ERASE_SIZE, (end - 1) // NORFlash.ERASE_SIZE + 1):
+            s = sector * NORFlash.ERASE_SIZE
+            old = self.flash.data[s : s + NORFlash.ERASE_SIZE]
+            self.flash.erase(sector)
+            self.flash.data[s : s + NORFlash.ERASE_SIZE] = old
+        self.flash.data[a:end] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.flash.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+# littlefs sees the 4KB erase sectors and erases them itself.
+class LFSBlockDevice:
+    def __init__(self, flash):
+        self.flash = flash
+
+    def readblocks(self, n, buf, off):
+        a = n * NORFlash.ERASE_SIZE + off
+        buf[:] = self.flash.data[a : a + len(buf)]
+
+    def writeblocks(self, n, buf, off):
+        a = n * NORFlash.ERASE_SIZE + off
+        self.flash.data[a : a + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.flash.erases)
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return NORFlash.ERASE_SIZE
+        if op == 6:  # MP_BLOCKDEV_IOCTL_BLOCK_ERASE
+            self.flash.erase(arg)
+            return 0
+
+
+RECORD = b"%08d,0123456789,0123456789,0123456789\n"
+LOG_MAX = 8192
+
+
+def log(vfs, r):
+    f = vfs.open("/log.csv", "ab")
+    for i in r:
+        f.write(RECORD % i)
+        if i % 16 == 15:
+            f.flush()
+            if f.tell() >= LOG_MAX:
+                # Start a new log, as a long running logger would.
+                f.close()
+                vfs.remove("/log.csv")
+                f = vfs.open("/log.csv", "ab")
+    f.close()
+
+
+def setup(n):
+    global flash, vfs, fat_max_erases
+    fat_flash = NORFlash(64)
+    bdev = FATBlockDevice(fat_flash)
+    os.VfsFat.mkfs(bdev)
+    log(os.VfsFat(bdev), range(n))
+    fat_max_erases = max(fat_flash.erases)
+
+    flash = NORFlash(64)
+    bdev = LFSBlockDevice(flash)
+    os.VfsLfs2.mkfs(bdev, readsize=256, progsize=256, block_cycles=500, cache_size=512)
+    vfs = os.VfsLfs2(bdev, readsize=256, progsize=256, block_cycles=500, cache_size=512)
+
+
+def test(r):
+    global result
+    log(vfs, r)
+    result = max(flash.erases) < fat_max_erases
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (32, 10): (100,),
+    (1000, 10): (1000,),
+    (5000, 10): (3000,),
+}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    setup(nloop)
+    return lambda: test(range(nloop)), lambda: (nloop, result)
@@ -262,6 +262,10 @@ def main():
         "--emit", default="bytecode", help="MicroPython emitter to use (bytecode or native)"
     )
     cmd_parser.add_argument("--heapsize", help="heapsize to use (use default if not specified)")
+    cmd_parser.add_argument(
+        "--tier",
+        help="recompile functions as native code after this many calls and loop iterations",
+    )
     cmd_parser.add_argument("--via-mpy", action="store_true", help="compile code to .mpy first")
     cmd_parser.add_argument("--mpy-cross-flags", default="", help="flags to pass to mpy-cross")
     cmd_parser.add_argument(
@@ -291,6 +295,8 @@ def main():
         target = [MICROPYTHON, "-X", "emit=" + args.emit]
         if args.heapsize is not None:
             target.extend(["-X", "heapsize=" + args.heapsize])
+        if args.tier is not None:
+            target.extend(["-X", "tier=" + args.tier])
 
     if len(args.files) == 0:
         tests_skip = ("benchrun.py",)
@@ -0,0 +1,67 @@
+# Measures how fast vectorio shapes are rasterized, in pixels per second.
+#
+# Each shape is moved back and forth by one pixel so that its whole footprint
+# is redrawn on every refresh. Run on a board with a built-in display. For a
+# per-fill_area breakdown, build with VECTORIO_PERF enabled in
+# shared-module/vectorio/VectorShape.c.
+import time
+import board
+import displayio
+import vectorio
+
+REFRESHES = 50
+
+display = board.DISPLAY
+display.auto_refresh = False
+
+palette = displayio.Palette(2)
+palette[0] = 0x000000
+palette[1] = 0x34BB90
+
+size = min(display.width, display.height) // 2 - 2
+shapes = (
+    ("Rectangle", vectorio.Rectangle(pixel_shader=palette, width=2 * size, height=2 * size)),
+    ("Circle", vectorio.Circle(pixel_shader=palette, radius=size, x=size, y=size)),
+    (
+        "Polygon",
+        vectorio.Polygon(
+            pixel_shader=palette,
+            points=[
+                (0, 0),
+                (2 * size, size // 2),
+                (size, size),
+                (2 * size, 2 * size),
+                (size // 2, 3 * size // 2),
+            ],
+        ),
+    ),
+)
+
+background = vectorio.Rectangle(
+    pixel_shader=palette, width=display.width, height=display.height, color_index=0
+)
+
+for name, shape in shapes:
+    group = displayio.Group()
+    group.append(background)
+    group.append(shape)
+    display.root_group = group
+    display.refresh()
+
+    # Shape footprints are their bounding areas; that is what gets filled per refresh.
+    x = shape.x
+    start = time.monotonic_ns()
+    for i in range(REFRESHES):
+        shape.x = x + (i & 1)
+        display.refresh()
+    elapsed = time.monotonic_ns() - start
+    pixels = REFRESHES * (2 * size + 2) * (2 * size + 2)
+    print(
+        "{:10s} {:8.1f} ms/refresh {:10.0f} px/s".format(
+            name, elapsed / REFRESHES / 1e6, pixels * 1e9 / elapsed
+        )
+    )
+    shape.x = x
+
+display.root_group = None
+display.auto_refresh = True
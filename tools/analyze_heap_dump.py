@@ -7,10 +7,13 @@
 
 # To dump ram do this in GDB: dump binary memory ram.bin &_srelocate &_estack
 
+# It can also summarize the text output of micropython.mem_info(1) captured from the serial
+# console. Only that file is needed then. When the build tags allocations by kind
+# (MICROPY_GC_ALLOC_KIND), the summary breaks the heap down by kind.
+
 import binascii
 import struct
 import sys
-import pygraphviz as pgv
 import io
 import html
 import os.path
@@ -20,6 +23,26 @@ import click
 
 from analyze_mpy import Prelude
 
+# Characters used for head blocks by gc_dump_alloc_table().
+BLOCK_CHARS = {
+    "h": "other",
+    "T": "tuple",
+    "L": "list",
+    "D": "dict",
+    "S": "str",
+    "A": "array",
+    "F": "float",
+    "B": "function",
+    "M": "module",
+    "*": "other",
+    "Q": "qstr",
+    "C": "bytecode",
+    "K": "constants",
+    "G": "globals",
+    "P": "display",
+    "W": "audio",
+}
+
 BITS_PER_BYTE = 8
 BLOCKS_PER_ATB = 4
 BLOCKS_PER_FTB = 8
@@ -51,10 +74,90 @@ SKIP_SYMBOLS = [
 ]
 
 
+def summarize_text_dump(text, bytes_per_block):
+    # Each allocation is a head block followed by its tail blocks, which may continue onto
+    # the next line. A line of all free blocks is elided, and so ends an allocation too.
+    allocations = {}
+    free_blocks = 0
+    total_blocks = 0
+    largest_free = 0
+    head = None
+    length = 0
+    run = 0
+    kinds = []
+    in_kinds = False
+
+    def end_allocation():
+        nonlocal head
+        if head is not None:
+            count, blocks = allocations.get(head, (0, 0))
+            allocations[head] = (count + 1, blocks + length)
+        head = None
+
+    def end_run():
+        nonlocal run, largest_free
+        largest_free = max(largest_free, run)
+        run = 0
+
+    for line in text.splitlines():
+        line = line.rstrip()
+        if line.startswith("GC memory layout"):
+            end_allocation()
+            end_run()
+            in_kinds = False
+        elif line.startswith("GC allocation kinds:"):
+            in_kinds = True
+        elif in_kinds and line.startswith("  "):
+            kinds.append(line.split())
+        elif line.strip().startswith("(") and "lines all free" in line:
+            end_allocation()
+            blocks = int(line.strip()[1:].split()[0]) * 64
+            free_blocks += blocks
+            total_blocks += blocks
+            run += blocks
+        elif len(line) > 10 and line[8:10] == ": ":
+            for c in line[10:]:
+                total_blocks += 1
+                if c == ".":
+                    end_allocation()
+                    free_blocks += 1
+                    run += 1
+                elif c == "=":
+                    length += 1
+                else:
+                    end_run()
+                    end_allocation()
+                    head = c
+                    length = 1
+    end_allocation()
+    end_run()
+
+    if total_blocks == 0:
+        print("No heap layout found. Is the dump from micropython.mem_info(1)?")
+        return
+
+    print(
+        "{} blocks of {} bytes, {} free, largest free run {} blocks".format(
+            total_blocks, bytes_per_block, free_blocks, largest_free
+        )
+    )
+    print("{:>10} {:>8} {:>10}  {}".format("type", "count", "bytes", "char"))
+    for c, (count, blocks) in sorted(allocations.items(), key=lambda item: -item[1][1]):
+        print(
+            "{:>10} {:>8} {:>10}  {}".format(
+                BLOCK_CHARS.get(c, "?"), count, blocks * bytes_per_block, c
+            )
+        )
+    if kinds:
+        print("Allocation kinds reported by the device:")
+        for kind in kinds:
+            print("{:>10} {:>10}".format(kind[1], kind[2]))
+
+
 @click.command()
 @click.argument("ram_filename")
-@click.argument("bin_filename")
-@click.argument("map_filename")
+@click.argument("bin_filename", required=False)
+@click.argument("map_filename", required=False)
 @click.option(
     "--print_block_contents", default=False, help="Prints the contents of each allocated block"
 )
@@ -82,6 +185,9 @@ SKIP_SYMBOLS = [
     help="Draw the ownership graph of blocks on the heap",
 )
 @click.option("--analyze-snapshots", default="last", type=click.Choice(["all", "last"]))
+@click.option(
+    "--bytes-per-block", default=BYTES_PER_BLOCK, help="GC block size used by a text dump"
+)
 def do_all_the_things(
     ram_filename,
     bin_filename,
@@ -95,10 +201,20 @@ def do_all_the_things(
     draw_heap_layout,
     draw_heap_ownership,
     analyze_snapshots,
+    bytes_per_block,
 ):
     with open(ram_filename, "rb") as f:
         ram_dump = f.read()
 
+    if b"GC memory layout" in ram_dump:
+        summarize_text_dump(ram_dump.decode("utf-8", "replace"), bytes_per_block)
+        return
+
+    if bin_filename is None or map_filename is None:
+        raise click.UsageError("A binary ram dump needs the firmware binary and map file too.")
+
+    import pygraphviz as pgv
+
     with open(bin_filename, "rb") as f:
         rom = f.read()
 
@@ -87,7 +87,8 @@ class FreezeError(Exception):
 
 
 class Config:
-    MPY_VERSION = 6
+    # CIRCUITPY-CHANGE: version 7 adds fused opcodes
+    MPY_VERSION = 7
     MPY_SUB_VERSION = 1
     MICROPY_LONGINT_IMPL_NONE = 0
     MICROPY_LONGINT_IMPL_LONGLONG = 1
@@ -188,10 +189,10 @@ class Opcode:
     # fmt: off
     # Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op
     MP_BC_BASE_RESERVED               = (0x00) # ----------------
-    MP_BC_BASE_QSTR_O                 = (0x10) # LLLLLLSSSDDII---
+    MP_BC_BASE_QSTR_O                 = (0x10) # LLLLLLSSSDDIIXXX
     MP_BC_BASE_VINT_E                 = (0x20) # MMLLLLSSDDBBBBBB
-    MP_BC_BASE_VINT_O                 = (0x30) # UUMMCCCC--------
-    MP_BC_BASE_JUMP_E                 = (0x40) # J-JJJJJEEEEF----
+    MP_BC_BASE_VINT_O                 = (0x30) # UUMMCCCCXXX-----
+    MP_BC_BASE_JUMP_E                 = (0x40) # JXJJJJJEEEEF----
     MP_BC_BASE_BYTE_O                 = (0x50) # LLLLSSDTTTTTEEFF
     MP_BC_BASE_BYTE_E                 = (0x60) # --BREEEYYI------
     MP_BC_LOAD_CONST_SMALL_INT_MULTI  = (0x70) # LLLLLLLLLLLLLLLL
@@ -293,16 +294,33 @@ class Opcode:
     MP_BC_IMPORT_NAME                 = (MP_BC_BASE_QSTR_O + 0x0b) # qstr
     MP_BC_IMPORT_FROM                 = (MP_BC_BASE_QSTR_O + 0x0c) # qstr
     MP_BC_IMPORT_STAR                 = (MP_BC_BASE_BYTE_E + 0x09)
+
+    # CIRCUITPY-CHANGE: fused opcodes, see py/bc0.h
+    MP_BC_LOAD_FAST_ATTR              = (MP_BC_BASE_QSTR_O + 0x0d) # qstr; then a byte
+    MP_BC_LOAD_FAST_METHOD            = (MP_BC_BASE_QSTR_O + 0x0e) # qstr; then a byte
+    MP_BC_LOAD_FAST_STORE_ATTR        = (MP_BC_BASE_QSTR_O + 0x0f) # qstr; then a byte
+    MP_BC_BINARY_OP_SMALL_INT         = (MP_BC_BASE_VINT_O + 0x08) # uint
+    MP_BC_STORE_LOAD_FAST             = (MP_BC_BASE_VINT_O + 0x09) # uint
+    MP_BC_BINARY_OP_FAST              = (MP_BC_BASE_VINT_O + 0x0a) # uint
+    MP_BC_BINARY_OP_POP_JUMP_IF       = (MP_BC_BASE_JUMP_E + 0x01) # signed relative bytecode offset; then a byte
     # fmt: on
 
     # Create sets of related opcodes.
     ALL_OFFSET_SIGNED = (
         MP_BC_UNWIND_JUMP,
+        MP_BC_BINARY_OP_POP_JUMP_IF,
         MP_BC_JUMP,
         MP_BC_POP_JUMP_IF_TRUE,
         MP_BC_POP_JUMP_IF_FALSE,
     )
 
+    # CIRCUITPY-CHANGE: opcodes with an extra byte that MP_BC_MASK_EXTRA_BYTE doesn't cover
+    ALL_QSTR_EXTRA_BYTE = (
+        MP_BC_LOAD_FAST_ATTR,
+        MP_BC_LOAD_FAST_METHOD,
+        MP_BC_LOAD_FAST_STORE_ATTR,
+    )
+
     # Create a dict mapping opcode value to opcode name.
     mapping = ["unknown" for _ in range(256)]
     for op_name in list(locals()):
@@ -373,7 +391,7 @@ def mp_opcode_decode(bytecode, ip):
             ip += 2
             if opcode in Opcode.ALL_OFFSET_SIGNED:
                 arg -= 0x4000
-    if opcode & MP_BC_MASK_EXTRA_BYTE == 0:
+    if opcode & MP_BC_MASK_EXTRA_BYTE == 0 or opcode in Opcode.ALL_QSTR_EXTRA_BYTE:
         extra_arg = bytecode[ip]
         ip += 1
     return f, ip - ip_start, arg, extra_arg
@@ -1590,7 +1608,9 @@ def adjust_bytecode_qstr_obj_indices(bytecode_in, qstr_table_base, obj_table_bas
         opcodes.append(opcode)
         ip += sz
         if fmt == MP_BC_FORMAT_OFFSET:
-            opcode.arg += ip
+            # CIRCUITPY-CHANGE: the offset is relative to the end of the
+            # offset itself, which is before any extra byte
+            opcode.arg += ip - (extra_arg is not None)
 
     # Link jump opcodes to their destination.
     for opcode in opcodes:
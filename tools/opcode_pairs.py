@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+#
+# SPDX-License-Identifier: MIT
+
+# Runs a script under a unix micropython built with
+# MICROPY_DEBUG_VM_OPCODE_PAIRS=1 and prints the most frequently executed
+# pairs of opcodes. This is the profile used to choose which opcode sequences
+# py/emitbc.c fuses into a single opcode. For example:
+#
+#   make -C ports/unix VARIANT=standard BUILD=build-pairs \
+#       CFLAGS_EXTRA=-DMICROPY_DEBUG_VM_OPCODE_PAIRS=1
+#   tools/opcode_pairs.py -m ports/unix/build-pairs/micropython \
+#       tests/perf_bench/bm_chaos.py tests/perf_bench/benchrun.py -e "bm_run(100, 1000)"
+#
+# Files given together are concatenated into one program, so a perf_bench test
+# can be run by passing it followed by benchrun.py.
+
+import argparse
+import importlib.util
+import os
+import subprocess
+import sys
+import tempfile
+
+DUMP = """
+import micropython
+print("OPCODE_PAIRS", micropython.opcode_pairs())
+"""
+
+
+def opcode_names():
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "mpy-tool.py")
+    spec = importlib.util.spec_from_file_location("mpy_tool", path)
+    mpy_tool = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(mpy_tool)
+    return mpy_tool.Opcode.mapping
+
+
+def main():
+    cmd_parser = argparse.ArgumentParser(description="Profile pairs of executed opcodes.")
+    cmd_parser.add_argument(
+        "-m", "--micropython", default="micropython", help="micropython executable to run"
+    )
+    cmd_parser.add_argument("-n", type=int, default=40, help="number of pairs to print")
+    cmd_parser.add_argument("-e", "--execute", default="", help="code to append to the program")
+    cmd_parser.add_argument("files", nargs="+", help="scripts to concatenate and run")
+    args = cmd_parser.parse_args()
+
+    program = b""
+    for filename in args.files:
+        with open(filename, "rb") as f:
+            program += f.read() + b"\n"
+    program += args.execute.encode() + b"\n" + DUMP.encode()
+
+    with tempfile.NamedTemporaryFile(suffix=".py") as f:
+        f.write(program)
+        f.flush()
+        output = subprocess.check_output([args.micropython, f.name])
+
+    pairs = None
+    for line in output.decode().splitlines():
+        if line.startswith("OPCODE_PAIRS "):
+            pairs = eval(line[len("OPCODE_PAIRS ") :])
+    if pairs is None:
+        sys.exit("no opcode pairs found; is MICROPY_DEBUG_VM_OPCODE_PAIRS enabled?")
+
+    names = opcode_names()
+    total = sum(count for count, _, _ in pairs)
+    pairs.sort(reverse=True)
+    print("{} opcode pairs executed".format(total))
+    for count, first, second in pairs[: args.n]:
+        print(
+            "{:12d} {:5.1f}%  {:02x} {:02x}  {} ; {}".format(
+                count, 100 * count / total, first, second, names[first], names[second]
+            )
+        )
+
+
+if __name__ == "__main__":
+    main()